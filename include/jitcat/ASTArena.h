@@ -0,0 +1,74 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+
+namespace jitcat::AST
+{
+	//Allocates AST nodes from a small number of contiguous blocks, so that the nodes of an AST are
+	//close together in memory and so that they are all freed at once when the arena is destroyed.
+	//While an ASTArena::Scope is active, the AST nodes that are created by the current thread are allocated from its arena.
+	//Deleting an object that lives in an arena runs its destructor, but its memory is only freed when the arena is destroyed.
+	//An arena must therefore outlive all the objects that were allocated from it.
+	//Every object has a small header that records the arena it was allocated from, so that objects allocated from an arena and 
+	//objects allocated from the heap (for example nodes that are created during type checking) can be mixed within the same AST.
+	class ASTArena
+	{
+	public:
+		ASTArena();
+		ASTArena(const ASTArena&) = delete;
+		void operator=(const ASTArena&) = delete;
+		~ASTArena();
+
+		//Makes an arena the arena that AST nodes are allocated from by the current thread, until the scope is destroyed.
+		class Scope
+		{
+		public:
+			Scope(ASTArena* arena);
+			Scope(const Scope&) = delete;
+			void operator=(const Scope&) = delete;
+			~Scope();
+
+		private:
+			ASTArena* previousArena;
+		};
+
+		//The number of bytes that were allocated from the arena, including object headers.
+		std::size_t getAllocatedMemory() const;
+		//The number of bytes reserved by the blocks of the arena.
+		std::size_t getReservedMemory() const;
+		std::size_t getNumBlocks() const;
+
+		//Allocates an object from an arena, or from the heap if arena is nullptr.
+		static void* allocateObject(std::size_t size, ASTArena* arena);
+		//Frees an object that was allocated by allocateObject. Does nothing if the object lives in an arena.
+		static void freeObject(void* object);
+
+		//Returns the arena of the innermost active Scope of the current thread, or nullptr if there is none.
+		static ASTArena* getCurrent();
+		//The memory reserved by all arenas that currently exist.
+		static std::size_t getTotalReservedMemory();
+
+	private:
+		void* allocate(std::size_t size);
+
+	private:
+		std::vector<char*> blocks;
+		char* currentPosition;
+		char* currentBlockEnd;
+		std::size_t nextBlockSize;
+		std::size_t allocatedMemory;
+		std::size_t reservedMemory;
+
+		static thread_local ASTArena* currentArena;
+	};
+
+} //End namespace jitcat::AST
@@ -9,6 +9,8 @@
 
 #include "jitcat/Lexeme.h"
 
+#include <cstddef>
+
 namespace jitcat::AST
 {
 
@@ -21,8 +23,20 @@ namespace jitcat::AST
 		const Tokenizer::Lexeme& getLexeme() const {return lexeme;};
 		void setLexeme(const Tokenizer::Lexeme& lexeme_) {lexeme = lexeme_;}
 
+		//AST node allocations are counted so that the memory used by ASTs can be reported. See JitCat::getMemoryStatistics.
+		//Nodes are allocated from the ASTArena of the current thread if there is one, see ASTArena::Scope.
+		static void* operator new(std::size_t size);
+		static void operator delete(void* node, std::size_t size);
+
+		//The number of AST nodes that currently exist and their total size in bytes.
+		static std::size_t getNumAllocatedNodes();
+		static std::size_t getAllocatedMemory();
+		//The number of AST bytes allocated minus the number of AST bytes freed by the calling thread.
+		//The difference between two calls is the memory retained by the ASTs that were built in between.
+		static std::ptrdiff_t getThreadAllocatedMemory();
+
 	protected:
 		Tokenizer::Lexeme lexeme;
 	};
 
-} //End namespace jitcat::AST
\ No newline at end of file
+} //End namespace jitcat::AST
@@ -25,14 +25,14 @@ namespace jitcat
 
 namespace jitcat::Parser
 {
-	class StackItem;
+	struct StackItem;
 
 	class ASTNodeParser
 	{
 	public:
-		ASTNodeParser(const std::vector<Parser::StackItem*>& stack, std::size_t numItems, RuntimeContext* context);
+		ASTNodeParser(const std::vector<Parser::StackItem>& stack, std::size_t numItems, RuntimeContext* context);
 		int getNumItems() const;
-		Parser::StackItem* getItem(unsigned int index) const;
+		const Parser::StackItem* getItem(unsigned int index) const;
 		AST::ASTNode* getASTNodeByIndex(unsigned int index) const;
 		template<typename ASTNodeT>
 		ASTNodeT* getASTNodeByIndex(unsigned int index) const;
@@ -41,7 +41,7 @@ namespace jitcat::Parser
 		Tokenizer::Lexeme getStackLexeme() const;
 
 	private:
-		const std::vector<Parser::StackItem*>& stack;
+		const std::vector<Parser::StackItem>& stack;
 		std::size_t numItems;
 		std::size_t startIndex;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "TypeInfo.h"
+#include <mutex>
 #include <vector>
 
 
@@ -51,5 +52,7 @@ namespace jitcat::Reflection
 		CatGenericType arrayItemType;
 
 		static std::vector<ArrayTypeInfo*> arrayTypes;
+		//Guards arrayTypes. Recursive because destroying an array type can destroy array types of its item type.
+		static std::recursive_mutex arrayTypesMutex;
 	};
 }
\ No newline at end of file
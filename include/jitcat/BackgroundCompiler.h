@@ -0,0 +1,62 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+
+namespace jitcat
+{
+	//Runs compilation jobs on a single background thread, in the order in which they were queued.
+	//Each job is identified by an owner (the expression) and a context, so that jobs can be cancelled
+	//when either of them is destroyed or when the expression is recompiled. See JitCat::setBackgroundCompilation.
+	class BackgroundCompiler
+	{
+	public:
+		BackgroundCompiler();
+		BackgroundCompiler(const BackgroundCompiler&) = delete;
+		BackgroundCompiler& operator=(const BackgroundCompiler&) = delete;
+		//Jobs that have not yet started are discarded.
+		~BackgroundCompiler();
+
+		//The background thread is started when the first job is queued.
+		void enqueue(const void* owner, const void* context, std::function<void()> job);
+		//Removes the queued jobs of which ownerOrContext is either the owner or the context.
+		//If such a job is currently running, waits for it to finish.
+		void cancel(const void* ownerOrContext);
+		//Blocks until all queued jobs have finished.
+		void waitUntilIdle();
+		std::size_t getNumQueuedJobs();
+
+	private:
+		void run();
+
+	private:
+		struct Job
+		{
+			const void* owner;
+			const void* context;
+			std::function<void()> function;
+		};
+		std::deque<Job> jobs;
+		//The owner and context of the job that is currently running, nullptr if there is none.
+		const void* runningOwner;
+		const void* runningContext;
+
+		std::mutex mutex;
+		std::condition_variable jobQueued;
+		std::condition_variable jobFinished;
+		bool stopping;
+		std::thread thread;
+	};
+
+} //End namespace jitcat
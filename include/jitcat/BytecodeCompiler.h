@@ -0,0 +1,80 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+namespace jitcat
+{
+	class CatGenericType;
+	class ColumnBinding;
+}
+#include "jitcat/BytecodeProgram.h"
+#include "jitcat/CatASTNodesDeclares.h"
+#include "jitcat/CatScopeID.h"
+
+#include <memory>
+
+
+namespace jitcat::Bytecode
+{
+	//Lowers a type checked and const collapsed expression AST to a BytecodeProgram.
+	//Literals, scope roots, member accesses, infix and prefix operators and most of the numeric built-in functions
+	//are lowered to bytecode instructions. Other nodes are executed through the tree-walking interpreter.
+	class BytecodeCompiler
+	{
+		BytecodeCompiler(BytecodeProgram* program);
+	public:
+		//Returns nullptr if the expression does not benefit from being lowered to bytecode.
+		//This is the case when the expression does not return a type that fits in a register,
+		//or when none of the AST nodes of the expression could be lowered.
+		//The expression must outlive the returned program.
+		static std::unique_ptr<BytecodeProgram> compile(const AST::CatTypedExpression* expression);
+
+		//Compiles an expression that is evaluated once for each row of a ColumnBinding.
+		//Members of the scope columnScopeId are loaded from the bound columns, see BytecodeProgram::getColumnMembers.
+		//Returns nullptr if the expression uses the scope columnScopeId other than through a bound member, 
+		//or if any of its nodes would have to be executed by the tree-walking interpreter.
+		static std::unique_ptr<BytecodeProgram> compileColumns(const AST::CatTypedExpression* expression, CatScopeID columnScopeId, const ColumnBinding& columns);
+
+		//Returns true and sets kind if a value of the type can be stored in a bytecode register.
+		static bool getRegisterKind(const CatGenericType& type, RegisterKind& kind);
+
+	private:
+		unsigned short generate(const AST::CatTypedExpression* expression);
+		unsigned short generate(const AST::CatBuiltInFunctionCall* functionCall, RegisterKind resultKind);
+		unsigned short generate(const AST::CatInfixOperator* infixOperator, RegisterKind resultKind);
+		unsigned short generate(const AST::CatLiteral* literal, RegisterKind resultKind);
+		unsigned short generate(const AST::CatMemberAccess* memberAccess, RegisterKind resultKind);
+		unsigned short generate(const AST::CatPrefixOperator* prefixOperator, RegisterKind resultKind);
+		unsigned short generate(const AST::CatScopeRoot* scopeRoot);
+
+		//Returns true if the member access was lowered to a column load.
+		bool generateColumnLoad(const AST::CatMemberAccess* memberAccess, RegisterKind resultKind, unsigned short& result);
+		unsigned short generateFallback(const AST::CatTypedExpression* expression, RegisterKind resultKind);
+		unsigned short generateConversion(unsigned short source, RegisterKind sourceKind, RegisterKind targetKind);
+		//Generates code that evaluates either the first or the second expression depending on the condition register.
+		unsigned short generateSelect(unsigned short condition, const AST::CatTypedExpression* first, const AST::CatTypedExpression* second);
+
+		unsigned short emit(BytecodeOpcode opcode, unsigned short left = 0, unsigned short right = 0, uintptr_t immediate = 0);
+		unsigned short emitConstant(const BytecodeRegister& value);
+		void emitMove(unsigned short destination, unsigned short source);
+		std::size_t emitJump(BytecodeOpcode opcode, unsigned short condition);
+		void patchJump(std::size_t jumpInstruction);
+		unsigned short allocateRegister();
+
+	private:
+		BytecodeProgram* program;
+		std::size_t numLoweredNodes;
+		bool registerOverflow;
+		//Only set when compiling columns.
+		const ColumnBinding* columns;
+		CatScopeID columnScopeId;
+		//Set if the expression cannot be evaluated over columns.
+		bool columnError;
+	};
+
+} //End namespace jitcat::Bytecode
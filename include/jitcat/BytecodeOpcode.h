@@ -0,0 +1,176 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+
+namespace jitcat::Bytecode
+{
+	//Instructions of the bytecode interpreter. See BytecodeProgram.h.
+	//Unless otherwise noted, the result is written to the destination register and the operands are read
+	//from the left and right registers.
+	enum class BytecodeOpcode: unsigned char
+	{
+		//Copies the immediate value into the destination register.
+		LoadConstant,
+		//Loads the address of the scope object with the scope id stored in the immediate.
+		LoadScopeObject,
+		//Copies the left register into the destination register.
+		Move,
+
+		//Control flow. The immediate contains the index of the instruction to jump to.
+		Jump,
+		JumpIfFalse,
+		JumpIfTrue,
+
+		//Loads a member that is located at a fixed offset (immediate) from the object pointer in the left register.
+		//If the object pointer is null, a default value is loaded.
+		LoadMemberBool,
+		LoadMemberInt,
+		LoadMemberFloat,
+		LoadMemberDouble,
+		LoadMemberPointer,
+		//Computes the address of a member object that is located at a fixed offset (immediate) from the object pointer in the left register.
+		MemberAddress,
+		//Loads the value of the current row from a column of values. The immediate contains the index of the column.
+		//Only used by programs that are created by BytecodeCompiler::compileColumns.
+		LoadColumnBool,
+		LoadColumnInt,
+		LoadColumnFloat,
+		LoadColumnDouble,
+
+		//Gets a member through TypeMemberInfo::getMemberReference. The immediate contains the index of the member access node.
+		LoadMemberIndirectBool,
+		LoadMemberIndirectInt,
+		LoadMemberIndirectFloat,
+		LoadMemberIndirectDouble,
+		LoadMemberIndirectPointer,
+
+		//Executes an AST node using the tree-walking interpreter. The immediate contains the index of the node.
+		ExecuteFallbackBool,
+		ExecuteFallbackInt,
+		ExecuteFallbackFloat,
+		ExecuteFallbackDouble,
+		ExecuteFallbackPointer,
+
+		//Arithmetic and comparison operators. The order within each group follows CatInfixOperatorType.
+		IntAdd,
+		IntSubtract,
+		IntMultiply,
+		IntDivide,
+		IntModulo,
+		IntGreater,
+		IntSmaller,
+		IntGreaterOrEqual,
+		IntSmallerOrEqual,
+		IntEquals,
+		IntNotEquals,
+
+		FloatAdd,
+		FloatSubtract,
+		FloatMultiply,
+		FloatDivide,
+		FloatModulo,
+		FloatGreater,
+		FloatSmaller,
+		FloatGreaterOrEqual,
+		FloatSmallerOrEqual,
+		FloatEquals,
+		FloatNotEquals,
+
+		DoubleAdd,
+		DoubleSubtract,
+		DoubleMultiply,
+		DoubleDivide,
+		DoubleModulo,
+		DoubleGreater,
+		DoubleSmaller,
+		DoubleGreaterOrEqual,
+		DoubleSmallerOrEqual,
+		DoubleEquals,
+		DoubleNotEquals,
+
+		BoolEquals,
+		BoolNotEquals,
+		PointerEquals,
+		PointerNotEquals,
+
+		BoolNot,
+		IntNegate,
+		FloatNegate,
+		DoubleNegate,
+
+		//Conversions between basic types, these follow the semantics of CatGenericType::convertToType
+		BoolToInt,
+		BoolToFloat,
+		BoolToDouble,
+		IntToBool,
+		IntToFloat,
+		IntToDouble,
+		FloatToBool,
+		FloatToInt,
+		FloatToDouble,
+		DoubleToBool,
+		DoubleToInt,
+		DoubleToFloat,
+
+		//Built-in functions
+		FloatSin,
+		FloatCos,
+		FloatTan,
+		FloatAsin,
+		FloatAcos,
+		FloatAtan,
+		FloatSinh,
+		FloatCosh,
+		FloatTanh,
+		FloatAsinh,
+		FloatAcosh,
+		FloatAtanh,
+		FloatLog10,
+		FloatLn,
+		FloatExp,
+		FloatSqrt,
+		FloatCeil,
+		FloatFloor,
+		FloatAbs,
+		FloatPow,
+		FloatAtan2,
+		FloatHypot,
+		FloatMin,
+		FloatMax,
+
+		DoubleSin,
+		DoubleCos,
+		DoubleTan,
+		DoubleAsin,
+		DoubleAcos,
+		DoubleAtan,
+		DoubleSinh,
+		DoubleCosh,
+		DoubleTanh,
+		DoubleAsinh,
+		DoubleAcosh,
+		DoubleAtanh,
+		DoubleLog10,
+		DoubleLn,
+		DoubleExp,
+		DoubleSqrt,
+		DoubleCeil,
+		DoubleFloor,
+		DoubleAbs,
+		DoublePow,
+		DoubleAtan2,
+		DoubleHypot,
+		DoubleMin,
+		DoubleMax,
+
+		IntAbs,
+		IntMin,
+		IntMax
+	};
+}
@@ -0,0 +1,110 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+namespace jitcat
+{
+	class CatRuntimeContext;
+	namespace AST
+	{
+		class CatTypedExpression;
+	}
+	namespace Reflection
+	{
+		struct TypeMemberInfo;
+	}
+}
+#include "jitcat/BytecodeOpcode.h"
+#include "jitcat/CatGenericType.h"
+
+#include <any>
+#include <cstdint>
+#include <vector>
+
+
+namespace jitcat::Bytecode
+{
+	class BytecodeCompiler;
+
+	//The types of values that can be stored in a bytecode register.
+	enum class RegisterKind: unsigned char
+	{
+		Bool,
+		Int,
+		Float,
+		Double,
+		//A pointer to a reflectable object.
+		Pointer
+	};
+
+
+	union BytecodeRegister
+	{
+		bool boolValue;
+		int intValue;
+		float floatValue;
+		double doubleValue;
+		uintptr_t pointerValue;
+	};
+
+
+	struct BytecodeInstruction
+	{
+		BytecodeOpcode opcode;
+		unsigned short destination;
+		unsigned short left;
+		unsigned short right;
+		//Depending on the opcode, contains a constant, a member offset, a scope id, a jump target or an index into the node table.
+		BytecodeRegister immediate;
+	};
+
+
+	//A program for the register-based bytecode interpreter.
+	//A program is created from a type checked and const collapsed AST by the BytecodeCompiler.
+	//Every AST node that is lowered gets its own register. Nodes that cannot be lowered are executed
+	//through the tree-walking interpreter, so the AST must outlive the program.
+	//Executing a program is re-entrant, the registers are allocated on the stack, or on the heap for programs 
+	//that need more than maxStackRegisters registers.
+	class BytecodeProgram
+	{
+		friend class BytecodeCompiler;
+		BytecodeProgram(const CatGenericType& resultType, RegisterKind resultKind);
+	public:
+		BytecodeProgram(const BytecodeProgram&) = delete;
+		~BytecodeProgram();
+
+		//Executes the program and returns the register that contains the result.
+		//For programs created by BytecodeCompiler::compileColumns, columnValues points to the value of the current row for each of the column members.
+		BytecodeRegister execute(CatRuntimeContext* runtimeContext, const unsigned char* const* columnValues = nullptr) const;
+		//Executes the program and returns the result in the same form as AST::CatTypedExpression::execute.
+		std::any executeToAny(CatRuntimeContext* runtimeContext) const;
+
+		//Converts a result returned by execute to the same form as AST::CatTypedExpression::execute.
+		std::any registerToAny(const BytecodeRegister& result) const;
+
+		const CatGenericType& getResultType() const;
+		RegisterKind getResultKind() const;
+		std::size_t getNumInstructions() const;
+		std::size_t getNumRegisters() const;
+		//The members that are loaded from columns, in the order of the column indices used by the LoadColumn instructions.
+		const std::vector<const Reflection::TypeMemberInfo*>& getColumnMembers() const;
+
+	private:
+		static constexpr std::size_t maxStackRegisters = 64;
+
+		std::vector<BytecodeInstruction> instructions;
+		//AST nodes that are executed by the tree-walking interpreter or whose members are accessed indirectly. (not owned)
+		std::vector<AST::CatTypedExpression*> nodes;
+		std::vector<const Reflection::TypeMemberInfo*> columnMembers;
+		std::size_t numRegisters;
+		unsigned short resultRegister;
+		CatGenericType resultType;
+		RegisterKind resultKind;
+	};
+
+} //End namespace jitcat::Bytecode
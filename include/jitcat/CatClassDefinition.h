@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "jitcat/ASTArena.h"
 #include "jitcat/CatDefinition.h"
 #include "jitcat/CatGenericType.h"
 #include "jitcat/CatScope.h"
@@ -106,6 +107,9 @@ namespace jitcat::AST
 
 		const CatClassDefinition* parentClass;
 
+		//The arenas of the statements that were injected by injectCode. Declared before the definitions so that they outlive the statements.
+		std::vector<std::unique_ptr<ASTArena>> injectedCodeArenas;
+
 		//All definitions
 		std::vector<std::unique_ptr<CatDefinition>> definitions;
 
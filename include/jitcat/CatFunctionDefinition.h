@@ -24,6 +24,16 @@
 #include <vector>
 
 
+namespace jitcat
+{
+	class ProfileRecord;
+}
+
+namespace jitcat::Bytecode
+{
+	class BytecodeProgram;
+}
+
 namespace jitcat::Reflection
 {
 	class CustomTypeInfo;
@@ -80,6 +90,9 @@ namespace jitcat::AST
 		//This function name disambiguates between overloaded functions based on return type and argument types.
 		std::string getMangledFunctionName(bool sRetBeforeThis) const;
 
+		//Set by typeCheck if profiling is enabled, otherwise nullptr. See JitCat::setProfilingEnabled.
+		ProfileRecord* getProfileRecord() const;
+
 		CatScopeBlock* getScopeBlock() const;
 		CatScopeBlock* getEpilogBlock() const;
 		CatScopeBlock* getOrCreateEpilogBlock(CatRuntimeContext* compileTimeContext, ExpressionErrorManager* errorManager, void* errorContext);
@@ -93,6 +106,8 @@ namespace jitcat::AST
 
 	private:
 		CatScopeID pushScope(CatRuntimeContext* runtimeContext, unsigned char* instance) const;
+		//If the function body consists of a single return statement, it is lowered to bytecode when the interpreter mode is set to bytecode.
+		void compileToBytecode();
 
 	private:
 		std::string name;
@@ -109,6 +124,9 @@ namespace jitcat::AST
 
 		std::unique_ptr<CatScopeBlock> scopeBlock;
 		std::unique_ptr<CatScopeBlock> epilogBlock;
+		std::unique_ptr<Bytecode::BytecodeProgram> bytecodeProgram;
+		//Native code of the function refers to the record, so it is kept alive by the function definition.
+		std::shared_ptr<ProfileRecord> profileRecord;
 
 		Reflection::ReflectableHandle errorManagerHandle;
 		
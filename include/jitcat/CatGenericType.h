@@ -30,6 +30,7 @@ namespace jitcat
 
 	class CatGenericType
 	{
+		friend class CatValue;
 	private:
 		enum class SpecificType: unsigned char
 		{
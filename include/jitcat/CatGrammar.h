@@ -81,6 +81,7 @@ namespace jitcat::Grammar
 		//The tokenizer defines all the tokens for the language, such as literals, identifiers and operators.
 		CatGrammar(Tokenizer::TokenizerBase* tokenizer, CatGrammarType grammarType);
 		virtual const char* getProductionName(int production) const;
+		virtual const Parser::SLRParseTables* getPrecomputedParseTables() const override final;
 
 	private:
 		//Semantic action
@@ -121,6 +122,8 @@ namespace jitcat::Grammar
 		static AST::ASTNode* toFunctionCall(const Parser::ASTNodeParser& nodeParser);
 	
 	private:
+		CatGrammarType grammarType;
+
 		//Tokens types:
 		static unsigned short comment;
 		static unsigned short ws;
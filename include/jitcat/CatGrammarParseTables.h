@@ -0,0 +1,20 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include "jitcat/SLRParseTables.h"
+
+
+//The precomputed parse tables of each type of CatGrammar. They are defined in CatGrammarParseTables.cpp, which is generated by
+//the JitCatParseTableGenerator tool. Build the JitCatParseTables target to regenerate them after the grammar or tokenizer has changed.
+namespace jitcat::Grammar::CatGrammarParseTables
+{
+	extern const Parser::SLRParseTables expression;
+	extern const Parser::SLRParseTables statement;
+	extern const Parser::SLRParseTables full;
+}
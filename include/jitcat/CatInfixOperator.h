@@ -33,6 +33,7 @@ namespace jitcat::AST
 
 		virtual CatStatement* constCollapse(CatRuntimeContext* compileTimeContext, ExpressionErrorManager* errorManager, void* errorContext) override final;
 		virtual std::any execute(CatRuntimeContext* runtimeContext) override final;
+		virtual CatValue executeValue(CatRuntimeContext* runtimeContext) override final;
 
 		virtual bool typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErrorManager* errorManager, void* errorContext) override final;
 
@@ -44,16 +45,22 @@ namespace jitcat::AST
 
 	private:
 		inline std::any calculateExpression(CatRuntimeContext* runtimeContext);
-
-		template<typename T, typename U, typename V>
-		inline std::any calculateScalarExpression(const T& lValue, const U& rValue);
+		//Calculates && and ||, only executing the right hand side if it can change the result. Used by both execute and executeValue.
+		inline bool calculateLogicalExpression(CatRuntimeContext* runtimeContext);
+		inline std::any calculateExpression(std::any& lValue, std::any& rValue);
+		inline CatValue calculateValue(const CatValue& lValue, const CatValue& rValue);
+
+		//ResultT is either std::any or CatValue
+		template<typename ResultT, typename T, typename U, typename V>
+		inline ResultT calculateScalarExpression(const T& lValue, const U& rValue);
 	
 		template<typename T, typename U>
 		inline std::any calculateStringExpression(const T& lValue, const U& rValue);
 
 		inline std::any calculateStringExpression(const std::string& lValue, const std::string& rValue);
 
-		inline std::any calculateBooleanExpression(bool lValue, bool rValue);
+		template<typename ResultT>
+		inline ResultT calculateBooleanExpression(bool lValue, bool rValue);
 
 	private:
 		std::unique_ptr<CatTypedExpression> overloadedOperator;
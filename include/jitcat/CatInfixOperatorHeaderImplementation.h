@@ -12,114 +12,166 @@
 
 inline std::any CatInfixOperator::calculateExpression(CatRuntimeContext* runtimeContext)
 {
-	//Optimization to prevent always calculating both sides of an && or an ||
 	if (oper == CatInfixOperatorType::LogicalAnd || oper == CatInfixOperatorType::LogicalOr)
 	{
-		std::any lValue = lhs->execute(runtimeContext);
-		//If lValue is true and oper is || then result is true
-		//If lValue is false and oper is && then result is false
-		if (std::any_cast<bool>(lValue) == (oper == CatInfixOperatorType::LogicalOr))
-		{
-			return lValue;
-		}
-		else
-		{
-			std::any rValue = rhs->execute(runtimeContext);
-			if (oper == CatInfixOperatorType::LogicalAnd)
-			{
-				return std::any(std::any_cast<bool>(lValue) && std::any_cast<bool>(rValue));
-			}
-			else
-			{
-				return std::any(std::any_cast<bool>(lValue) || std::any_cast<bool>(rValue));
-			}
-		}
+		return std::any(calculateLogicalExpression(runtimeContext));
 	}
 	else
 	{
-
 		std::any lValue = lhs->execute(runtimeContext);
 		std::any rValue = rhs->execute(runtimeContext);
-		CatGenericType lType = lhs->getType();
-		CatGenericType rType = rhs->getType();
-		if (lType.isFloatType())
-		{
-			if		(rType.isIntType())			return calculateScalarExpression<float, int, float>(std::any_cast<float>(lValue), std::any_cast<int>(rValue));
-			else if (rType.isFloatType())		return calculateScalarExpression<float, float, float>(std::any_cast<float>(lValue), std::any_cast<float>(rValue));
-			else if (rType.isDoubleType())		return calculateScalarExpression<float, double, double>(std::any_cast<float>(lValue), std::any_cast<double>(rValue));
-			else if (rType.isStringValueType())	return calculateStringExpression<float, Configuration::CatString>(std::any_cast<float>(lValue), std::any_cast<Configuration::CatString>(rValue));
-		}
-		else if (lType.isDoubleType())
-		{
-			if		(rType.isIntType())			return calculateScalarExpression<double, int, double>(std::any_cast<double>(lValue), std::any_cast<int>(rValue));
-			else if (rType.isFloatType())		return calculateScalarExpression<double, float, double>(std::any_cast<double>(lValue), std::any_cast<float>(rValue));
-			else if (rType.isDoubleType())		return calculateScalarExpression<double, double, double>(std::any_cast<double>(lValue), std::any_cast<double>(rValue));
-			else if (rType.isStringValueType())	return calculateStringExpression<double, Configuration::CatString>(std::any_cast<double>(lValue), std::any_cast<Configuration::CatString>(rValue));
-		}
-		else if (lType.isIntType())
-		{
-			if		(rType.isIntType())			return calculateScalarExpression<int, int, int>(std::any_cast<int>(lValue), std::any_cast<int>(rValue));
-			else if (rType.isFloatType())		return calculateScalarExpression<int, float, float>(std::any_cast<int>(lValue), std::any_cast<float>(rValue));
-			else if (rType.isDoubleType())		return calculateScalarExpression<int, double, double>(std::any_cast<int>(lValue), std::any_cast<double>(rValue));
-			else if (rType.isStringValueType())	return calculateStringExpression<int, Configuration::CatString>(std::any_cast<int>(lValue), std::any_cast<Configuration::CatString>(rValue));
-		}
-		else if (lType.isStringValueType())
-		{
-			if		(rType.isIntType())			return calculateStringExpression<Configuration::CatString, int>(std::any_cast<Configuration::CatString>(lValue), std::any_cast<int>(rValue));
-			else if (rType.isFloatType())		return calculateStringExpression<Configuration::CatString, float>(std::any_cast<Configuration::CatString>(lValue), std::any_cast<float>(rValue));
-			else if (rType.isDoubleType())		return calculateStringExpression<Configuration::CatString, double>(std::any_cast<Configuration::CatString>(lValue), std::any_cast<double>(rValue));
-			else if (rType.isStringValueType())	return calculateStringExpression(std::any_cast<Configuration::CatString>(lValue), std::any_cast<Configuration::CatString>(rValue));
-			else if (rType.isBoolType())		return calculateStringExpression(std::any_cast<Configuration::CatString>(lValue), std::any_cast<bool>(rValue));
-		}
-		else if (lType.isBoolType())
+		return calculateExpression(lValue, rValue);
+	}
+}
+
+
+inline bool CatInfixOperator::calculateLogicalExpression(CatRuntimeContext* runtimeContext)
+{
+	//Optimization to prevent always calculating both sides of an && or an ||
+	bool lValue = lhs->executeValue(runtimeContext).getBool();
+	//If lValue is true and oper is || then result is true
+	//If lValue is false and oper is && then result is false
+	if (lValue == (oper == CatInfixOperatorType::LogicalOr))
+	{
+		return lValue;
+	}
+	return rhs->executeValue(runtimeContext).getBool();
+}
+
+
+inline std::any CatInfixOperator::calculateExpression(std::any& lValue, std::any& rValue)
+{
+	const CatGenericType& lType = lhs->getType();
+	const CatGenericType& rType = rhs->getType();
+	if (lType.isFloatType())
+	{
+		if		(rType.isIntType())			return calculateScalarExpression<std::any, float, int, float>(std::any_cast<float>(lValue), std::any_cast<int>(rValue));
+		else if (rType.isFloatType())		return calculateScalarExpression<std::any, float, float, float>(std::any_cast<float>(lValue), std::any_cast<float>(rValue));
+		else if (rType.isDoubleType())		return calculateScalarExpression<std::any, float, double, double>(std::any_cast<float>(lValue), std::any_cast<double>(rValue));
+		else if (rType.isStringValueType())	return calculateStringExpression<float, Configuration::CatString>(std::any_cast<float>(lValue), std::any_cast<Configuration::CatString>(rValue));
+	}
+	else if (lType.isDoubleType())
+	{
+		if		(rType.isIntType())			return calculateScalarExpression<std::any, double, int, double>(std::any_cast<double>(lValue), std::any_cast<int>(rValue));
+		else if (rType.isFloatType())		return calculateScalarExpression<std::any, double, float, double>(std::any_cast<double>(lValue), std::any_cast<float>(rValue));
+		else if (rType.isDoubleType())		return calculateScalarExpression<std::any, double, double, double>(std::any_cast<double>(lValue), std::any_cast<double>(rValue));
+		else if (rType.isStringValueType())	return calculateStringExpression<double, Configuration::CatString>(std::any_cast<double>(lValue), std::any_cast<Configuration::CatString>(rValue));
+	}
+	else if (lType.isIntType())
+	{
+		if		(rType.isIntType())			return calculateScalarExpression<std::any, int, int, int>(std::any_cast<int>(lValue), std::any_cast<int>(rValue));
+		else if (rType.isFloatType())		return calculateScalarExpression<std::any, int, float, float>(std::any_cast<int>(lValue), std::any_cast<float>(rValue));
+		else if (rType.isDoubleType())		return calculateScalarExpression<std::any, int, double, double>(std::any_cast<int>(lValue), std::any_cast<double>(rValue));
+		else if (rType.isStringValueType())	return calculateStringExpression<int, Configuration::CatString>(std::any_cast<int>(lValue), std::any_cast<Configuration::CatString>(rValue));
+	}
+	else if (lType.isStringValueType())
+	{
+		if		(rType.isIntType())			return calculateStringExpression<Configuration::CatString, int>(std::any_cast<Configuration::CatString>(lValue), std::any_cast<int>(rValue));
+		else if (rType.isFloatType())		return calculateStringExpression<Configuration::CatString, float>(std::any_cast<Configuration::CatString>(lValue), std::any_cast<float>(rValue));
+		else if (rType.isDoubleType())		return calculateStringExpression<Configuration::CatString, double>(std::any_cast<Configuration::CatString>(lValue), std::any_cast<double>(rValue));
+		else if (rType.isStringValueType())	return calculateStringExpression(std::any_cast<Configuration::CatString>(lValue), std::any_cast<Configuration::CatString>(rValue));
+		else if (rType.isBoolType())		return calculateStringExpression(std::any_cast<Configuration::CatString>(lValue), std::any_cast<bool>(rValue));
+	}
+	else if (lType.isBoolType())
+	{
+		if		(rType.isBoolType())		return calculateBooleanExpression<std::any>(std::any_cast<bool>(lValue), std::any_cast<bool>(rValue));
+		else if (rType.isStringValueType())	return calculateStringExpression(std::any_cast<bool>(lValue), std::any_cast<Configuration::CatString>(rValue));
+	}
+	else if (lType.isPointerToReflectableObjectType() && rType.isPointerToReflectableObjectType())
+	{
+		switch (oper)
 		{
-			if		(rType.isBoolType())		return calculateBooleanExpression(std::any_cast<bool>(lValue), std::any_cast<bool>(rValue));
-			else if (rType.isStringValueType())	return calculateStringExpression(std::any_cast<bool>(lValue), std::any_cast<Configuration::CatString>(rValue));
+			case CatInfixOperatorType::Equals:		return lType.getRawPointer(lValue) == rType.getRawPointer(rValue);
+			case CatInfixOperatorType::NotEquals:	return lType.getRawPointer(lValue) != rType.getRawPointer(rValue);
+			default:								assert(false);
 		}
-		else if (lType.isPointerToReflectableObjectType() && rType.isPointerToReflectableObjectType())
-		{
-			switch (oper)
+	}
+	assert(false);
+	return std::any();
+}
+
+
+inline CatValue CatInfixOperator::calculateValue(const CatValue& lValue, const CatValue& rValue)
+{
+	switch (lValue.getTag())
+	{
+		case CatValue::Tag::Float:
+			switch (rValue.getTag())
 			{
-				case CatInfixOperatorType::Equals:		return lType.getRawPointer(lValue) == rType.getRawPointer(rValue);
-				case CatInfixOperatorType::NotEquals:	return lType.getRawPointer(lValue) != rType.getRawPointer(rValue);
-				default:								assert(false);
-			}
-		}
-		assert(false);
-		return std::any();
+				case CatValue::Tag::Int:	return calculateScalarExpression<CatValue, float, int, float>(lValue.getFloat(), rValue.getInt());
+				case CatValue::Tag::Float:	return calculateScalarExpression<CatValue, float, float, float>(lValue.getFloat(), rValue.getFloat());
+				case CatValue::Tag::Double:	return calculateScalarExpression<CatValue, float, double, double>(lValue.getFloat(), rValue.getDouble());
+				default:					break;
+			} break;
+		case CatValue::Tag::Double:
+			switch (rValue.getTag())
+			{
+				case CatValue::Tag::Int:	return calculateScalarExpression<CatValue, double, int, double>(lValue.getDouble(), rValue.getInt());
+				case CatValue::Tag::Float:	return calculateScalarExpression<CatValue, double, float, double>(lValue.getDouble(), rValue.getFloat());
+				case CatValue::Tag::Double:	return calculateScalarExpression<CatValue, double, double, double>(lValue.getDouble(), rValue.getDouble());
+				default:					break;
+			} break;
+		case CatValue::Tag::Int:
+			switch (rValue.getTag())
+			{
+				case CatValue::Tag::Int:	return calculateScalarExpression<CatValue, int, int, int>(lValue.getInt(), rValue.getInt());
+				case CatValue::Tag::Float:	return calculateScalarExpression<CatValue, int, float, float>(lValue.getInt(), rValue.getFloat());
+				case CatValue::Tag::Double:	return calculateScalarExpression<CatValue, int, double, double>(lValue.getInt(), rValue.getDouble());
+				default:					break;
+			} break;
+		case CatValue::Tag::Bool:
+			if (rValue.getTag() == CatValue::Tag::Bool)
+			{
+				return calculateBooleanExpression<CatValue>(lValue.getBool(), rValue.getBool());
+			} break;
+		case CatValue::Tag::Pointer:
+			if (rValue.getTag() == CatValue::Tag::Pointer)
+			{
+				switch (oper)
+				{
+					case CatInfixOperatorType::Equals:		return CatValue(lValue.getPointer() == rValue.getPointer());
+					case CatInfixOperatorType::NotEquals:	return CatValue(lValue.getPointer() != rValue.getPointer());
+					default:								assert(false);
+				}
+			} break;
+		default: break;
 	}
+	//Other combinations of types are calculated through std::any.
+	std::any lAny = lValue.toAny(lhs->getType());
+	std::any rAny = rValue.toAny(rhs->getType());
+	return CatValue::fromAny(calculateExpression(lAny, rAny), resultType);
 }
 
 
-template<typename T, typename U, typename V>
-inline std::any CatInfixOperator::calculateScalarExpression(const T& lValue, const U& rValue)
+template<typename ResultT, typename T, typename U, typename V>
+inline ResultT CatInfixOperator::calculateScalarExpression(const T& lValue, const U& rValue)
 {
 	switch (oper)
 	{
-		case CatInfixOperatorType::Plus:			return std::any((V)lValue + (V)rValue);
-		case CatInfixOperatorType::Minus:			return std::any((V)lValue - (V)rValue);
-		case CatInfixOperatorType::Multiply:		return std::any((V)lValue * (V)rValue);
-		case CatInfixOperatorType::Greater:			return std::any(lValue > rValue);
-		case CatInfixOperatorType::Smaller:			return std::any(lValue < rValue);
-		case CatInfixOperatorType::GreaterOrEqual:	return std::any(lValue >= rValue);
-		case CatInfixOperatorType::SmallerOrEqual:	return std::any(lValue <= rValue);
-		case CatInfixOperatorType::Equals:			return std::any(lValue == rValue);
-		case CatInfixOperatorType::NotEquals:		return std::any(lValue != rValue);
+		case CatInfixOperatorType::Plus:			return ResultT((V)lValue + (V)rValue);
+		case CatInfixOperatorType::Minus:			return ResultT((V)lValue - (V)rValue);
+		case CatInfixOperatorType::Multiply:		return ResultT((V)lValue * (V)rValue);
+		case CatInfixOperatorType::Greater:			return ResultT(lValue > rValue);
+		case CatInfixOperatorType::Smaller:			return ResultT(lValue < rValue);
+		case CatInfixOperatorType::GreaterOrEqual:	return ResultT(lValue >= rValue);
+		case CatInfixOperatorType::SmallerOrEqual:	return ResultT(lValue <= rValue);
+		case CatInfixOperatorType::Equals:			return ResultT(lValue == rValue);
+		case CatInfixOperatorType::NotEquals:		return ResultT(lValue != rValue);
 		case CatInfixOperatorType::Divide:
 			if constexpr (jitcat::Configuration::divisionByZeroYieldsZero)
 			{
 				if (rValue != 0)
 				{
-					return std::any((V)lValue / (V)rValue);
+					return ResultT((V)lValue / (V)rValue);
 				}
 				else 
 				{
-					return std::any((V)0);
+					return ResultT((V)0);
 				}
 			}
 			else
 			{
-				return std::any((V)lValue / (V)rValue);
+				return ResultT((V)lValue / (V)rValue);
 			}
 		case CatInfixOperatorType::Modulo:
 		{
@@ -133,19 +185,19 @@ inline std::any CatInfixOperator::calculateScalarExpression(const T& lValue, con
 				{
 					if (rValue != 0)
 					{
-						if constexpr (eitherIsDouble)	return std::any((double)fmod((double)lValue, (double)rValue));
-						else							return std::any((float)fmodf((float)lValue, (float)rValue));
+						if constexpr (eitherIsDouble)	return ResultT((double)fmod((double)lValue, (double)rValue));
+						else							return ResultT((float)fmodf((float)lValue, (float)rValue));
 					}
 					else
 					{
-						if constexpr (eitherIsDouble)	return std::any(0.0);
-						else							return std::any(0.0f);
+						if constexpr (eitherIsDouble)	return ResultT(0.0);
+						else							return ResultT(0.0f);
 					}
 				}
 				else
 				{
-					if constexpr (eitherIsDouble)	return std::any((double)fmod((double)lValue, (double)rValue));
-					else							return std::any((float)fmodf((float)lValue, (float)rValue));
+					if constexpr (eitherIsDouble)	return ResultT((double)fmod((double)lValue, (double)rValue));
+					else							return ResultT((float)fmodf((float)lValue, (float)rValue));
 				}
 			}
 			else
@@ -154,23 +206,23 @@ inline std::any CatInfixOperator::calculateScalarExpression(const T& lValue, con
 				{
 					if ((int)rValue != 0)
 					{
-						return std::any((int)lValue % (int)rValue);
+						return ResultT((int)lValue % (int)rValue);
 					}
 					else
 					{
-						return std::any(0);
+						return ResultT(0);
 					}
 				}
 				else
 				{
-					return std::any((int)lValue % (int)rValue);
+					return ResultT((int)lValue % (int)rValue);
 				}
 			}
 		}
 		default:	assert(false);
 	}
 	assert(false);
-	return std::any(V());
+	return ResultT(V());
 }
 
 
@@ -207,16 +259,17 @@ inline std::any CatInfixOperator::calculateStringExpression(const Configuration:
 }
 
 
-inline std::any CatInfixOperator::calculateBooleanExpression(bool lValue, bool rValue)
+template<typename ResultT>
+inline ResultT CatInfixOperator::calculateBooleanExpression(bool lValue, bool rValue)
 {
 	switch (oper)
 	{
-		case CatInfixOperatorType::Equals:		return std::any(lValue == rValue);
-		case CatInfixOperatorType::NotEquals:	return std::any(lValue != rValue);
-		case CatInfixOperatorType::LogicalAnd:	return std::any(lValue && rValue);
-		case CatInfixOperatorType::LogicalOr:	return std::any(lValue || rValue);
+		case CatInfixOperatorType::Equals:		return ResultT(lValue == rValue);
+		case CatInfixOperatorType::NotEquals:	return ResultT(lValue != rValue);
+		case CatInfixOperatorType::LogicalAnd:	return ResultT(lValue && rValue);
+		case CatInfixOperatorType::LogicalOr:	return ResultT(lValue || rValue);
 		default:								assert(false);
 	}
 	assert(false);
-	return std::any(false);
+	return ResultT(false);
 }
\ No newline at end of file
@@ -7,11 +7,15 @@
 
 #pragma once
 
+#include "jitcat/ASTArena.h"
 #include "jitcat/CatRuntimeContext.h"
 #include "jitcat/Document.h"
+#include "jitcat/LLVMCompileOptions.h"
+#include "jitcat/MemoryStatistics.h"
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -83,12 +87,26 @@ namespace jitcat
 
 		CatRuntimeContext* getRuntimeContext() const;
 
+		//Overrides JitCat::getDefaultOptimizationLevel for source files that are added after the level was set.
+		void setOptimizationLevel(LLVM::LLVMOptimizationLevel level);
+		//Returns the level set by setOptimizationLevel, or the default level if it was not set.
+		LLVM::LLVMOptimizationLevel getOptimizationLevel() const;
+
+		//Reports the memory used by the ASTs of the source files and by the types they define. See JitCat::getMemoryStatistics.
+		//Not thread safe with addSource.
+		CatLibMemoryStatistics getMemoryStatistics() const;
+
 	private:
 		std::string name;
 		std::unique_ptr<ExpressionErrorManager> errorManager;
 		std::unique_ptr<CatRuntimeContext> context;
 
+		//The arenas that the ASTs of the source files were allocated from. Declared before sourceFiles so that they outlive the ASTs.
+		std::vector<std::unique_ptr<AST::ASTArena>> astArenas;
 		std::vector<std::unique_ptr<AST::CatSourceFile>> sourceFiles;
+		std::optional<LLVM::LLVMOptimizationLevel> optimizationLevel;
+		//The AST memory retained by the source files.
+		std::size_t astMemory;
 
 	};
 
@@ -32,12 +32,19 @@ namespace jitcat::AST
 		virtual CatStatement* constCollapse(CatRuntimeContext* compileTimeContext, ExpressionErrorManager* errorManager, void* errorContext) override final {return this;}
 		virtual CatASTNodeType getNodeType() const override final {return CatASTNodeType::Literal;}
 		virtual std::any execute(CatRuntimeContext* runtimeContext) override final {return value;};
+		virtual CatValue executeValue(CatRuntimeContext* runtimeContext) override final;
 		virtual bool typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErrorManager* errorManager, void* errorContext) override final;
 		const std::any& getValue() const;
 
+	private:
+		static CatValue createScalarValue(const std::any& value, const CatGenericType& type);
+
 	private:
 		CatGenericType type;
 		::std::any value;
+		//Scalar values are converted once. Other values are converted when the literal is executed,
+		//because not every literal value is guaranteed to be of the C++ type that the type caster expects.
+		CatValue literalValue;
 	};
 
 } // End namespace jitcat::AST
\ No newline at end of file
@@ -33,6 +33,7 @@ namespace jitcat::AST
 		virtual CatASTNodeType getNodeType() const override final;
 		virtual std::any execute(CatRuntimeContext* runtimeContext) override final;
 		std::any executeWithBase(CatRuntimeContext* runtimeContext, std::any baseValue);
+		virtual CatValue executeValue(CatRuntimeContext* runtimeContext) override final;
 		virtual bool typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErrorManager* errorManager, void* errorContext) override final;
 		virtual const CatGenericType& getType() const override final;
 		virtual bool isConst() const override final;
@@ -62,6 +63,8 @@ namespace jitcat::AST
 		std::unique_ptr<CatArgumentList> arguments;
 		CatGenericType returnType;
 		std::vector<int> argumentsToCheckForNull;
+		//True if the base, the arguments and the result can be passed as CatValues. (See MemberFunctionInfo::callValue)
+		bool callWithValues;
 
 		// Inherited via FunctionSignature
 		virtual const std::string& getLowerCaseFunctionName() const override;
@@ -22,10 +22,13 @@ namespace jitcat::Reflection
 	class TypeInfo;
 	struct TypeMemberInfo;
 }
+#include "jitcat/CatGenericType.h"
 #include "jitcat/CatScopeID.h"
 #include "jitcat/JitCat.h"
 #include "jitcat/ReflectableHandle.h"
 #include "jitcat/RuntimeContext.h"
+#include "jitcat/SymbolTable.h"
+#include "jitcat/TemporaryArena.h"
 #include "jitcat/TypeRegistry.h"
 
 #include <any>
@@ -33,6 +36,7 @@ namespace jitcat::Reflection
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -40,6 +44,8 @@ namespace jitcat
 {
 	class CatRuntimeContext;
 	class CatScope;
+	class CompileSession;
+	class ContextMemoryCounters;
 	class ErrorContext;
 	class ExpressionErrorManager;
 	class PrecompilationContext;
@@ -54,6 +60,19 @@ namespace jitcat
 		class ObjectInstance;
 	}
 
+	//Counts the lookups of the find functions of a CatRuntimeContext that were answered from its lookup cache.
+	struct LookupCacheStatistics
+	{
+		std::size_t numHits = 0;
+		std::size_t numMisses = 0;
+		//The number of times a non-empty cache was cleared because scopes were added or removed, or because a type changed.
+		std::size_t numInvalidations = 0;
+
+		//Returns a value between 0 and 1, or 0 if there were no lookups.
+		double getHitRate() const;
+	};
+
+
 	//A CatRuntimeContext provides variables and functions for use in expressions. (See Expression.h, ExpressionAny.h)
 	//It can contain multiple "scopes" of variables.
 	//Variables can come from classes that inherit from Reflectable (and implement the static functions required for reflection, see TypeInfo.h) or
@@ -77,6 +96,25 @@ namespace jitcat
 			bool isStatic;
 			const std::string_view scopeName;
 		};
+
+		enum class LookupKind: unsigned char
+		{
+			Variable,
+			StaticVariable,
+			StaticConstant,
+			FirstMemberFunction,
+			MemberFunction,
+			StaticFunction,
+			Type
+		};
+
+		//The result of a find function, including misses. Signature lookups also store the parameter types of the signature.
+		struct LookupCacheEntry
+		{
+			std::vector<CatGenericType> parameterTypes;
+			void* result;
+			CatScopeID scopeId;
+		};
 	public:
 		//contextName is used to provide better descriptions for errors that are generated by expressions compiled using this context.
 		//errorManager manages the list of errors generated by expressions. If errorManager is null, a new errorManager will be created just for this context.
@@ -128,6 +166,13 @@ namespace jitcat
 		void removeScope(CatScopeID id);
 		//If the ScopeID refers to a static scope, any expressions that were compiled using this context should be recompiled.
 		void setScopeObject(CatScopeID id, unsigned char* scopeObject);
+		//Used for evaluating an expression over many objects, see Expression::getValues.
+		//beginScopeObjectBatch clears the object of a dynamic scope and returns the previous object.
+		//Until endScopeObjectBatch is called, setBatchScopeObject sets the scope object without registering it with a ReflectableHandle.
+		//The objects must not be deleted while they are set.
+		unsigned char* beginScopeObjectBatch(CatScopeID id);
+		void setBatchScopeObject(CatScopeID id, unsigned char* scopeObject);
+		void endScopeObjectBatch(CatScopeID id, unsigned char* previousScopeObject);
 		//Returns weither or not the provided ScopeID is a static scope.
 		bool isStaticScope(CatScopeID id) const;
 	
@@ -139,18 +184,24 @@ namespace jitcat
 		void pushErrorContext(ErrorContext* context);
 		void popErrorContext(ErrorContext* context);
 
+		//Names are case insensitive. The overloads that take a SymbolId do not need to look up the symbol of the name. (See SymbolTable.h)
+		//Results are cached per context until a scope is added or removed or any type changes its members, see getLookupCacheStatistics.
 		//Tries to find a variable by name, starting from the most recently added scope and going backwards through
 		//the scopes until the variable is found or there are no more scopes.
-		Reflection::TypeMemberInfo* findVariable(const std::string& lowercaseName, CatScopeID& scopeId);
+		Reflection::TypeMemberInfo* findVariable(const std::string& name, CatScopeID& scopeId);
+		Reflection::TypeMemberInfo* findVariable(Reflection::SymbolId symbol, CatScopeID& scopeId);
 		//Tries to find a static variable by name, starting from the most recently added scope and going backwards through
 		//the scopes until the variable is found or there are no more scopes.
-		Reflection::StaticMemberInfo* findStaticVariable(const std::string& lowercaseName, CatScopeID& scopeId);
+		Reflection::StaticMemberInfo* findStaticVariable(const std::string& name, CatScopeID& scopeId);
+		Reflection::StaticMemberInfo* findStaticVariable(Reflection::SymbolId symbol, CatScopeID& scopeId);
 		//Tries to find a static constant by name, starting from the most recently added scope and going backwards through
 		//the scopes until the variable is found or there are no more scopes.
-		Reflection::StaticConstMemberInfo* findStaticConstant(const std::string& lowercaseName, CatScopeID& scopeId);
+		Reflection::StaticConstMemberInfo* findStaticConstant(const std::string& name, CatScopeID& scopeId);
+		Reflection::StaticConstMemberInfo* findStaticConstant(Reflection::SymbolId symbol, CatScopeID& scopeId);
 		//Tries to find a function by name, starting from the most recently added scope and going backwards through
 		//the scopes until the function is found or there are no more scopes.
-		Reflection::MemberFunctionInfo* findFirstMemberFunction(const std::string& lowercaseName, CatScopeID& scopeId);
+		Reflection::MemberFunctionInfo* findFirstMemberFunction(const std::string& name, CatScopeID& scopeId);
+		Reflection::MemberFunctionInfo* findFirstMemberFunction(Reflection::SymbolId symbol, CatScopeID& scopeId);
 		//Tries to find a function by signature, starting from the most recently added scope and going backwards through
 		//the scopes until the function is found or there are no more scopes.
 		Reflection::MemberFunctionInfo* findMemberFunction(const Reflection::FunctionSignature* functionSignature, CatScopeID& scopeId);
@@ -158,7 +209,8 @@ namespace jitcat
 		//the scopes until the function is found or there are no more scopes.
 		Reflection::StaticFunctionInfo* findStaticFunction(const Reflection::FunctionSignature* functionSignature, CatScopeID& scopeId);
 
-		Reflection::TypeInfo* findType(const std::string& lowercaseName, CatScopeID& scopeId);
+		Reflection::TypeInfo* findType(const std::string& name, CatScopeID& scopeId);
+		Reflection::TypeInfo* findType(Reflection::SymbolId symbol, CatScopeID& scopeId);
 
 		void setCodeGenerator(std::shared_ptr<LLVM::LLVMCodeGenerator> codegenerator);
 		std::shared_ptr<LLVM::LLVMCodeGenerator> getCodeGenerator();
@@ -177,22 +229,48 @@ namespace jitcat
 		bool getIsReturning() const;
 		void setReturning(bool isReturning);
 
+		//Temporaries are values that the interpreter needs to keep alive until an expression has been executed.
+		//They live until clearTemporaries is called, which expressions do after each interpreted execution.
+		//Clearing the temporaries keeps their memory for the next execution, see TemporaryArena.
 		std::any& addTemporary(const std::any& value);
+		std::any& addTemporary(std::any&& value);
+		template<typename TemporaryT, typename... ArgumentsT>
+		TemporaryT& createTemporary(ArgumentsT&&... arguments);
 		void clearTemporaries();
 
 		std::size_t getContextHash() const;
+		//Returns the type of each scope, followed by the type and object of each static scope.
+		//Expressions that are compiled using contexts with the same scope layout can be executed using either context.
+		//Unlike getContextHash, this distinguishes static scope objects, because compiled expressions can refer to them directly.
+		std::vector<const void*> getScopeLayout() const;
+		//Returns the TypeInfo::getVersion of the type of each scope, followed by that of each static scope.
+		std::vector<unsigned long long> getScopeVersions() const;
 
 		void setPrecompilationContext(std::shared_ptr<PrecompilationContext> precompilationContext);
 		std::shared_ptr<PrecompilationContext> getPrecompilationContext() const;
 
+		//Expressions that are compiled using this context are accounted to these counters. See JitCat::getMemoryStatistics.
+		const std::shared_ptr<ContextMemoryCounters>& getMemoryCounters() const;
+
+		//Hits and misses of the lookup cache of the find functions above since the context was created or the statistics were reset.
+		const LookupCacheStatistics& getLookupCacheStatistics() const;
+		void resetLookupCacheStatistics();
+
 		static CatRuntimeContext& getDefaultContext();
 
 	private:
+		friend class CompileSession;
 		CatScopeID createDynamicScope(unsigned char* scopeObject, Reflection::TypeInfo* type);
 		CatScopeID createStaticScope(unsigned char* scopeObject, Reflection::TypeInfo* type, const std::string_view& staticScopeUniqueName);
 		CatRuntimeContext::Scope* getScope(CatScopeID scopeId) const;
 		const std::string_view getGlobalNameReference(const std::string& globalName);
 
+		//Searches the scopes for symbol using lookup, most recently added scope first, and caches the result.
+		//If functionSignature is not null, only cached results for the same parameter types are returned.
+		template<typename ResultT, typename LookupT>
+		ResultT* findInScopes(LookupKind kind, Reflection::SymbolId symbol, const Reflection::FunctionSignature* functionSignature, CatScopeID& scopeId, const LookupT& lookup);
+		void invalidateLookupCache();
+
 	private:
 		int nextFunctionIndex;
 		AST::CatFunctionDefinition* currentFunctionDefinition;
@@ -211,17 +289,26 @@ namespace jitcat
 		//A separate list of static scopes because static scopes are available accross function calls.
 		std::vector<std::unique_ptr<CatRuntimeContext::Scope>> staticScopes;
 
-		std::vector<std::unique_ptr<std::any>> temporaries;
+		TemporaryArena temporaries;
+
+		//Keyed by the LookupKind in the upper 32 bits and the SymbolId in the lower 32 bits.
+		std::unordered_map<unsigned long long, std::vector<LookupCacheEntry>> lookupCache;
+		//The TypeInfo::getLookupVersion at the time the cache entries were added.
+		unsigned long long lookupCacheVersion;
+		LookupCacheStatistics lookupCacheStatistics;
 
 		CatScopeID currentStackFrameOffset;
 		std::vector<CatScopeID> stackFrameOffsets;
 
 		std::shared_ptr<PrecompilationContext> precompilationContext;
+		std::shared_ptr<ContextMemoryCounters> memoryCounters;
 
 	#ifdef ENABLE_LLVM
 		std::shared_ptr<LLVM::LLVMCodeGenerator> codeGenerator;
 	#endif
 		std::vector<ErrorContext*> errorContextStack;
+		//The compile sessions, on any thread, that hold expressions of this context. They are all cancelled when the context is destroyed.
+		std::vector<CompileSession*> compileSessions;
 	};
 
 
@@ -232,6 +319,13 @@ namespace jitcat
 		return createDynamicScope(reinterpret_cast<unsigned char*>(scopeObject), typeInfo);
 	}
 
+	template<typename TemporaryT, typename... ArgumentsT>
+	inline TemporaryT& CatRuntimeContext::createTemporary(ArgumentsT&&... arguments)
+	{
+		return temporaries.create<TemporaryT>(std::forward<ArgumentsT>(arguments)...);
+	}
+
+
 	template<typename ReflectableType>
 	inline CatScopeID CatRuntimeContext::addStaticScope(ReflectableType* scopeObject, const std::string& staticScopeUniqueName)
 	{
@@ -11,11 +11,18 @@
 
 namespace jitcat::Tokenizer
 {
+	class ConstantToken;
+
 	//Defines the tokens that make up the JitCat language.
 	class CatTokenizer : public TokenizerBase
 	{
 	public:
 		CatTokenizer();
+
+		//Tokenizes the document in a single pass that selects the token type from the class of the first character,
+		//instead of trying each token factory in turn. Produces exactly the same tokens as TokenizerBase::tokenize.
+		virtual bool tokenize(Document& document) override final;
+
 		static const unsigned short whiteSpace;
 		static const unsigned short comment;
 		static const unsigned short constant;
@@ -23,6 +30,9 @@ namespace jitcat::Tokenizer
 		static const unsigned short twoChar;
 		static const unsigned short oneChar;
 		static const unsigned short error;
+
+	private:
+		const ConstantToken* constantToken;
 	};
 
 } //End namespace jitcat
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include "jitcat/CatStatement.h"
 #include "jitcat/CatGenericType.h"
+#include "jitcat/CatValue.h"
 
 namespace jitcat::AST
 {
@@ -23,6 +24,10 @@ namespace jitcat::AST
 		virtual bool isConst() const = 0;
 		virtual bool isAssignable() const {return false;}
 		virtual bool isTypedExpression() const override final { return true;}
+
+		//Executes the expression without boxing scalar and pointer results in a std::any.
+		//Must only be called if CatValue::canHold(getType()) is true. Nodes that do not override this convert the result of execute.
+		virtual CatValue executeValue(CatRuntimeContext* runtimeContext) {return CatValue::fromAny(execute(runtimeContext), getType());}
 	};
 
 } //End namespace jitcat::AST
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+namespace jitcat
+{
+	class CatGenericType;
+}
+
+#include <any>
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+
+namespace jitcat
+{
+	//A tagged value that is passed between AST nodes by AST::CatTypedExpression::executeValue.
+	//A CatValue holds scalars and pointers to reflectable objects (including strings) and is trivially copyable.
+	//Values of any other type (strings by value, enums, handles, objects by value) can not be held by a CatValue (see canHold),
+	//expressions of those types are executed through AST::CatTypedExpression::execute.
+	//Member reads, literals, scope roots, operators and calls to reflected member functions (MemberFunctionInfo::callValue) 
+	//produce CatValues directly. Pointers are converted from and to std::any by TypeCaster::castToValue and castFromValue.
+	class CatValue
+	{
+	public:
+		enum class Tag: unsigned char
+		{
+			None,
+			Bool,
+			Char,
+			UChar,
+			Int,
+			UInt,
+			Int64,
+			UInt64,
+			Float,
+			Double,
+			//A raw pointer to a reflectable object.
+			Pointer
+		};
+
+		CatValue(): tag(Tag::None) {storage.pointerValue = 0;}
+		explicit CatValue(bool value): tag(Tag::Bool) {storage.boolValue = value;}
+		explicit CatValue(char value): tag(Tag::Char) {storage.charValue = value;}
+		explicit CatValue(unsigned char value): tag(Tag::UChar) {storage.uCharValue = value;}
+		explicit CatValue(int value): tag(Tag::Int) {storage.intValue = value;}
+		explicit CatValue(unsigned int value): tag(Tag::UInt) {storage.uIntValue = value;}
+		explicit CatValue(int64_t value): tag(Tag::Int64) {storage.int64Value = value;}
+		explicit CatValue(uint64_t value): tag(Tag::UInt64) {storage.uInt64Value = value;}
+		explicit CatValue(float value): tag(Tag::Float) {storage.floatValue = value;}
+		explicit CatValue(double value): tag(Tag::Double) {storage.doubleValue = value;}
+
+		//Returns the tag of the values of a type. Returns Tag::None if the type can not be held by a CatValue.
+		static Tag getTag(const CatGenericType& type);
+		//Returns true if values of the type can be held by a CatValue.
+		static bool canHold(const CatGenericType& type);
+		//Returns true if values of the C++ type T can be constructed directly.
+		template<typename T>
+		static constexpr bool isInlineBasicType()
+		{
+			return std::is_same<T, bool>::value || std::is_same<T, char>::value || std::is_same<T, unsigned char>::value
+				   || std::is_same<T, int>::value || std::is_same<T, unsigned int>::value
+				   || std::is_same<T, int64_t>::value || std::is_same<T, uint64_t>::value
+				   || std::is_same<T, float>::value || std::is_same<T, double>::value;
+		}
+
+		static CatValue fromPointer(uintptr_t pointer);
+		//Converts the result of AST::CatTypedExpression::execute, value must be of type valueType and canHold(valueType) must be true.
+		static CatValue fromAny(const std::any& value, const CatGenericType& valueType);
+		//Converts back to the form returned by AST::CatTypedExpression::execute. valueType must be the type the value was created from.
+		std::any toAny(const CatGenericType& valueType) const;
+
+		//Creates a CatValue from a C++ value. T must be an inline basic type or a pointer.
+		template<typename T>
+		static CatValue fromNative(T value)
+		{
+			if constexpr (std::is_pointer<T>::value)	return fromPointer(reinterpret_cast<uintptr_t>(value));
+			else										return CatValue(value);
+		}
+		//Returns the value as a C++ value. T must be the inline basic type that matches the tag, or a pointer if the tag is Tag::Pointer.
+		template<typename T>
+		T getNative() const
+		{
+			if constexpr (std::is_pointer<T>::value)					return reinterpret_cast<T>(getPointer());
+			else if constexpr (std::is_same<T, bool>::value)			return getBool();
+			else if constexpr (std::is_same<T, char>::value)			return getChar();
+			else if constexpr (std::is_same<T, unsigned char>::value)	return getUChar();
+			else if constexpr (std::is_same<T, int>::value)				return getInt();
+			else if constexpr (std::is_same<T, unsigned int>::value)	return getUInt();
+			else if constexpr (std::is_same<T, int64_t>::value)			return getInt64();
+			else if constexpr (std::is_same<T, uint64_t>::value)		return getUInt64();
+			else if constexpr (std::is_same<T, float>::value)			return getFloat();
+			else														return getDouble();
+		}
+
+		Tag getTag() const {return tag;}
+
+		bool getBool() const			{assert(tag == Tag::Bool); return storage.boolValue;}
+		char getChar() const			{assert(tag == Tag::Char); return storage.charValue;}
+		unsigned char getUChar() const	{assert(tag == Tag::UChar); return storage.uCharValue;}
+		int getInt() const				{assert(tag == Tag::Int); return storage.intValue;}
+		unsigned int getUInt() const	{assert(tag == Tag::UInt); return storage.uIntValue;}
+		int64_t getInt64() const		{assert(tag == Tag::Int64); return storage.int64Value;}
+		uint64_t getUInt64() const		{assert(tag == Tag::UInt64); return storage.uInt64Value;}
+		float getFloat() const			{assert(tag == Tag::Float); return storage.floatValue;}
+		double getDouble() const		{assert(tag == Tag::Double); return storage.doubleValue;}
+		uintptr_t getPointer() const	{assert(tag == Tag::Pointer); return storage.pointerValue;}
+
+	private:
+		Tag tag;
+		union
+		{
+			bool boolValue;
+			char charValue;
+			unsigned char uCharValue;
+			int intValue;
+			unsigned int uIntValue;
+			int64_t int64Value;
+			uint64_t uInt64Value;
+			float floatValue;
+			double doubleValue;
+			uintptr_t pointerValue;
+		} storage;
+	};
+
+} //End namespace jitcat
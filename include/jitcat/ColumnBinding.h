@@ -0,0 +1,73 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+namespace jitcat::Reflection
+{
+	class TypeInfo;
+	struct TypeMemberInfo;
+}
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+namespace jitcat
+{
+	//Binds members of a scope type to columns of values, so that an expression can be evaluated over data that is stored
+	//as a structure of arrays instead of as an array of reflected objects. See Expression::getColumnValues.
+	//A column contains the values of one member for all rows. The value of row i is located at data + i * stride.
+	//Only members of type bool, int, float or double can be bound and the stride must be a multiple of the size of the member type.
+	//The data is not owned by the ColumnBinding.
+	class ColumnBinding
+	{
+	public:
+		struct Column
+		{
+			const Reflection::TypeMemberInfo* member;
+			const unsigned char* data;
+			std::size_t stride;
+		};
+
+		ColumnBinding(Reflection::TypeInfo* scopeType, std::size_t numRows);
+
+		//Returns false if the scope type has no member with that name, if the member is not of type bool, int, float or double
+		//or if the stride is not a multiple of the size of the member type.
+		//Binding a member that is already bound replaces the column.
+		bool bindColumn(const std::string& memberName, const void* data, std::size_t stride);
+		bool bindColumn(const Reflection::TypeMemberInfo* member, const void* data, std::size_t stride);
+		//Binds a column of tightly packed values.
+		template<typename T>
+		bool bindColumn(const std::string& memberName, const T* data);
+
+		//Returns nullptr if no column is bound to the member.
+		const Column* getColumn(const Reflection::TypeMemberInfo* member) const;
+		const std::vector<Column>& getColumns() const;
+
+		Reflection::TypeInfo* getScopeType() const;
+		std::size_t getNumRows() const;
+		void setNumRows(std::size_t numRows);
+
+	private:
+		Reflection::TypeInfo* scopeType;
+		std::size_t numRows;
+		std::vector<Column> columns;
+	};
+
+
+	template<typename T>
+	inline bool ColumnBinding::bindColumn(const std::string& memberName, const T* data)
+	{
+		static_assert(std::is_same<T, bool>::value || std::is_same<T, int>::value || std::is_same<T, float>::value || std::is_same<T, double>::value,
+					  "Only bool, int, float and double columns are supported.");
+		return bindColumn(memberName, data, sizeof(T));
+	}
+
+} //End namespace jitcat
@@ -0,0 +1,66 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include "jitcat/CatGenericType.h"
+
+#include <vector>
+
+
+namespace jitcat
+{
+	class CatRuntimeContext;
+	class ExpressionBase;
+
+	//While a CompileSession is open, expressions that are compiled on the same thread and that support deferred compilation
+	//are collected by the session instead of being compiled to native code one by one. Until the session is finalized they are executed by the interpreter.
+	//When the session is finalized, the functions of all collected expressions of the same context are generated into a single LLVM module
+	//that is compiled and linked once, after which the compiled function of each expression is set.
+	//Without the LLVM backend, the expressions are compiled to bytecode when the session is finalized.
+	//Sessions can be nested, an expression is added to the innermost session. Sessions may be finalized in any order, but must be finalized on the thread that created them.
+	class CompileSession
+	{
+	public:
+		CompileSession();
+		CompileSession(const CompileSession&) = delete;
+		CompileSession& operator=(const CompileSession&) = delete;
+		//Finalizes the session if that was not already done.
+		~CompileSession();
+
+		//Compiles all collected expressions and closes the session. Expressions that are compiled afterwards are compiled normally.
+		void finalize();
+		//Removes the expressions of which expressionOrContext is either the expression or its compile context.
+		//Called when an expression is recompiled or destroyed and when a context is destroyed.
+		void cancel(const void* expressionOrContext);
+		std::size_t getNumPendingExpressions() const;
+
+		//Returns the innermost session that is open on the calling thread, or nullptr.
+		static CompileSession* getCurrent();
+
+	private:
+		friend class ExpressionBase;
+		void add(ExpressionBase* expression, CatRuntimeContext* context, const CatGenericType& expectedType);
+
+	private:
+		struct Entry
+		{
+			ExpressionBase* expression;
+			CatRuntimeContext* context;
+			CatGenericType expectedType;
+		};
+		//Unregisters the session from the contexts of removedEntries that no longer have any entries in this session.
+		void releaseContexts(const std::vector<Entry>& removedEntries);
+
+		std::vector<Entry> entries;
+		bool isOpen;
+		CompileSession* previousSession;
+
+		static thread_local CompileSession* currentSession;
+	};
+
+} //End namespace jitcat
@@ -24,9 +24,11 @@ namespace jitcat::Tokenizer
 		virtual bool createIfMatch(Document& document, std::size_t& currentPosition) const override final;
 		virtual const char* getSubTypeName(unsigned short subType) const override final;
 		virtual const char* getSubTypeSymbol(unsigned short subType) const override final;
+
+		//Returns ConstantType::NoType if the text does not start with a constant. Otherwise, offset is set to the length of the constant.
+		ConstantType parseConstant(const char* text, std::size_t textLength, std::size_t& offset) const;
 	
 	private:
-		ConstantType parseConstant(const char* text, std::size_t textLength, std::size_t& offset) const;
 		ConstantType parseIntOrFloat(const char* text, std::size_t textLength, std::size_t& offset) const;
 		ConstantType parseFloatOrHexOrOct(const char* text, std::size_t textLength, std::size_t& offset) const;
 		ConstantType parseFloatOrOct(const char* text, std::size_t textLength, std::size_t& offset) const;
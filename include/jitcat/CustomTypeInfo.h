@@ -143,6 +143,8 @@ namespace jitcat::Reflection
 
 		virtual bool canBeDeleted() const override final;
 
+		virtual std::size_t getMemoryUsage() const override final;
+
 		llvm::orc::JITDylib* getDylib() const;
 		void setDylib(llvm::orc::JITDylib* generatedDylib);
 
@@ -34,8 +34,10 @@ namespace jitcat::Reflection
 
 		inline virtual std::any getMemberReference(unsigned char* base) override final;
 		inline virtual std::any getAssignableMemberReference(unsigned char* base) override final;
+		inline virtual CatValue getMemberValue(unsigned char* base) override final;
 		inline virtual llvm::Value* generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const override final;
 		inline virtual llvm::Value* generateAssignCode(llvm::Value* parentObjectPointer, llvm::Value* rValue, LLVM::LLVMCompileTimeContext* context) const override final;
+		inline virtual DirectMemberAccess getDirectMemberAccess(std::size_t& offset) const override final;
 
 		void assign(std::any& base, const BasicT& valueToSet);
 	};
@@ -62,8 +64,10 @@ namespace jitcat::Reflection
 
 		virtual std::any getMemberReference(unsigned char* base) override final;
 		virtual std::any getAssignableMemberReference(unsigned char* base) override final;
+		virtual CatValue getMemberValue(unsigned char* base) override final;
 		virtual llvm::Value* generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const override final;
 		virtual llvm::Value* generateAssignCode(llvm::Value* parentObjectPointer, llvm::Value* rValue, LLVM::LLVMCompileTimeContext* context) const override final;
+		virtual DirectMemberAccess getDirectMemberAccess(std::size_t& offset) const override final;
 
 		void assign(std::any& base, std::any& valueToSet);
 	};
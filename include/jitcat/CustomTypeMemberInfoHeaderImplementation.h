@@ -28,6 +28,24 @@ inline std::any CustomBasicTypeMemberInfo<BasicT>::getMemberReference(unsigned c
 }
 
 
+template<typename BasicT>
+inline CatValue CustomBasicTypeMemberInfo<BasicT>::getMemberValue(unsigned char* base)
+{
+	if constexpr (CatValue::isInlineBasicType<BasicT>())
+	{
+		if (base != nullptr)
+		{
+			return CatValue(*reinterpret_cast<BasicT*>(&base[memberOffset]));
+		}
+		return CatValue(BasicT());
+	}
+	else
+	{
+		return CatValue::fromAny(getMemberReference(base), catType);
+	}
+}
+
+
 template<typename BasicT>
 inline std::any CustomBasicTypeMemberInfo<BasicT>::getAssignableMemberReference(unsigned char* base)
 {
@@ -48,12 +66,8 @@ inline llvm::Value* CustomBasicTypeMemberInfo<BasicT>::generateDereferenceCode(l
 	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
 	{
 		LLVM::LLVMCodeGeneratorHelper* generatorHelper = compileContext->helper;
-		//Convert to int so we can add the offset
-		llvm::Value* dataPointerAsInt = generatorHelper->convertToIntPtr(parentObjectPointer, "dataIntPtr");
-		//Create a constant with the offset of this member relative to the the data pointer
-		llvm::Value* memberOffsetValue = context->helper->createOffsetGlobalValue(context, getMemberOffsetVariableName(), memberOffset);
-		//Add the offset to the data pointer.
-		llvm::Value* addressValue = generatorHelper->createAdd(dataPointerAsInt, memberOffsetValue, memberName + "_IntPtr");
+		//Add the offset of this member to the data pointer.
+		llvm::Value* addressValue = generatorHelper->createMemberAddress(compileContext, parentObjectPointer, getMemberOffsetVariableName(), memberOffset, memberName + "_Address");
 		return generatorHelper->loadBasicType(generatorHelper->toLLVMType(catType), addressValue, memberName);
 	};
 	return context->helper->createOptionalNullCheckSelect(parentObjectPointer, notNullCodeGen, context->helper->toLLVMType(catType), context);
@@ -70,13 +84,9 @@ inline llvm::Value* CustomBasicTypeMemberInfo<BasicT>::generateAssignCode(llvm::
 	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
 	{
 		LLVM::LLVMCodeGeneratorHelper* generatorHelper = compileContext->helper;
-		//Convert to int so we can add the offset
-		llvm::Value* dataPointerAsInt = generatorHelper->convertToIntPtr(parentObjectPointer, "dataIntPtr");
-		//Create a constant with the offset of this member relative to the the data pointer
-		llvm::Value* memberOffsetValue = context->helper->createOffsetGlobalValue(context, getMemberOffsetVariableName(), memberOffset);
-		//Add the offset to the data pointer.
-		llvm::Value* addressIntValue = generatorHelper->createAdd(dataPointerAsInt, memberOffsetValue, memberName + "_IntPtr");
-		llvm::Value* addressValue = context->helper->convertToPointer(addressIntValue, memberName + "_Ptr", context->helper->toLLVMPtrType(catType));
+		//Add the offset of this member to the data pointer.
+		llvm::Value* memberAddress = generatorHelper->createMemberAddress(compileContext, parentObjectPointer, getMemberOffsetVariableName(), memberOffset, memberName + "_Address");
+		llvm::Value* addressValue = context->helper->convertToPointer(memberAddress, memberName + "_Ptr", context->helper->toLLVMPtrType(catType));
 		context->helper->writeToPointer(addressValue, rValue);
 		return rValue;
 	};
@@ -87,6 +97,23 @@ inline llvm::Value* CustomBasicTypeMemberInfo<BasicT>::generateAssignCode(llvm::
 }
 
 
+template<typename BasicT>
+inline DirectMemberAccess CustomBasicTypeMemberInfo<BasicT>::getDirectMemberAccess(std::size_t& offset) const
+{
+	//Only types that fit in a bytecode register can be loaded directly.
+	if constexpr (std::is_same<BasicT, bool>::value || std::is_same<BasicT, int>::value
+				  || std::is_same<BasicT, float>::value || std::is_same<BasicT, double>::value)
+	{
+		offset = memberOffset;
+		return DirectMemberAccess::Value;
+	}
+	else
+	{
+		return DirectMemberAccess::None;
+	}
+}
+
+
 template<typename BasicT>
 inline void CustomBasicTypeMemberInfo<BasicT>::assign(std::any& base, const BasicT& valueToSet)
 {
@@ -10,7 +10,6 @@
 #include "jitcat/Lexeme.h"
 #include "jitcat/DocumentSelection.h"
 #include "jitcat/ParseToken.h"
-#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -51,12 +50,10 @@ namespace jitcat::Tokenizer
 
 	private:
 		std::string document;
-		//Stores a map from offsets to line numbers. 
-		std::map<int, int> lineNumberLookup;
+		//Stores the offset of the end of each line, ordered by line number.
+		std::vector<int> lineEndOffsets;
 
 		std::vector<ParseToken> tokens;
-
-		int currentLineIndex;
 	};
 
 } //End namespace jitcat::Tokenizer
\ No newline at end of file
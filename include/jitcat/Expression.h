@@ -9,9 +9,12 @@
 
 #include "jitcat/ExpressionBase.h"
 #include "jitcat/CatGenericType.h"
+#include "jitcat/CatScopeID.h"
+#include "jitcat/ColumnBinding.h"
 #include "jitcat/ReflectableHandle.h"
 #include "jitcat/TypeTraits.h"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -49,20 +52,53 @@ namespace jitcat
 		//This function will only work if either native code compilation is disabled or DiscardASTAfterNativeCodeCompilation is set to false (see JitCat.h).
 		const ExpressionResultT getInterpretedValue(CatRuntimeContext* runtimeContext);
 
+		//Executes the expression once for each of the numObjects objects and stores the values in results, which must have room for numObjects values.
+		//For each execution, the object is set as the scope object of the dynamic scope batchScopeId. The scope object is restored afterwards.
+		//If the LLVM backend is enabled and the expression is of a basic type, the loop over the objects is compiled to native code.
+		void getValues(CatRuntimeContext* runtimeContext, CatScopeID batchScopeId, unsigned char* const* objects, std::size_t numObjects, ExpressionResultT* results);
+
+		//Executes the expression once for each row of the columns and stores the values in results, which must have room for columns.getNumRows() values.
+		//Members of the scope columnScopeId are read from the columns instead of from the scope object.
+		//Only expressions of type bool, int, float or double that consist of literals, operators, built-in math functions and
+		//members can be evaluated over columns. Every member of the scope columnScopeId that is used by the expression must be bound.
+		//Returns false, without writing results, if the expression cannot be evaluated over the columns.
+		//If the LLVM backend is enabled, the loop over the rows is compiled to native code and vectorized where the target allows it, see JitCat::getCodeGenerationStatistics.
+		//If the AST was discarded after native code compilation, the expression is compiled again using the context it was originally compiled with.
+		//Returns false if that context no longer exists.
+		bool getColumnValues(CatRuntimeContext* runtimeContext, CatScopeID columnScopeId, const ColumnBinding& columns, ExpressionResultT* results);
+
 		//Parses the expression, checks for errors and compiles the expression to native code if the LLVM backend is enabled.
 		virtual void compile(CatRuntimeContext* context) override final;
 
 	protected:
 		virtual void handleCompiledFunction(uintptr_t functionAddress) override final;
 		virtual void resetCompiledFunctionToDefault() override final;
+		virtual bool getSupportsBackgroundCompilation() const override final;
+		virtual bool getSupportsDeferredCompilation() const override final;
+		//Selects getExecuteBackgroundValue.
+		virtual void handleBackgroundCompilationQueued() override final;
 
+		//The function that is called by getValue. Same as valueFunctionPtr, unless the expression is profiled, in which case it is getExecuteProfiledValue.
 		const ExpressionResultT (Expression<ExpressionResultT>::*getValuePtr)(CatRuntimeContext* runtimeContext);
+		//The function that executes the expression. Should only be set using setValueFunction.
+		const ExpressionResultT (Expression<ExpressionResultT>::*valueFunctionPtr)(CatRuntimeContext* runtimeContext);
 		const ExpressionResultT getExecuteInterpretedValue(CatRuntimeContext* runtimeContext);
+		//Executes the expression with the tree-walking interpreter and compiles it once it has become hot.
+		const ExpressionResultT getExecuteColdValue(CatRuntimeContext* runtimeContext);
+		const ExpressionResultT getExecuteBytecodeValue(CatRuntimeContext* runtimeContext);
+		//Executes the expression with the tree-walking interpreter until the background compiler has finished, then selects the compiled function.
+		const ExpressionResultT getExecuteBackgroundValue(CatRuntimeContext* runtimeContext);
+		//Counts the call in the profile record and executes valueFunctionPtr.
+		const ExpressionResultT getExecuteProfiledValue(CatRuntimeContext* runtimeContext);
 		const ExpressionResultT getCachedValue(CatRuntimeContext* runtimeContext);
 		const ExpressionResultT getDefaultValue(CatRuntimeContext* runtimeContext);
 
 	private:
 		CatGenericType getExpectedCatType() const;
+		//Sets valueFunctionPtr, and getValuePtr to either the same function or getExecuteProfiledValue if the expression is profiled.
+		void setValueFunction(const ExpressionResultT (Expression<ExpressionResultT>::*valueFunction)(CatRuntimeContext* runtimeContext));
+		//Selects the bytecode interpreter if a bytecode program is available, otherwise selects the tree-walking interpreter.
+		void setInterpretedValueFunction();
 		static inline ExpressionResultT getActualValue(const std::any& catValue);
 
 	private:
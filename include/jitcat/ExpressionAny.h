@@ -44,9 +44,13 @@ namespace jitcat
 	protected:
 		virtual void handleCompiledFunction(uintptr_t functionAddress) override final;
 		virtual void resetCompiledFunctionToDefault() override final;
+		virtual bool getSupportsDeferredCompilation() const override final;
 
 	private:
+		//The function that is called by getValue. Same as valueFunctionPtr, unless the expression is profiled, in which case it is getExecuteProfiledValue.
 		const std::any (ExpressionAny::*getValuePtr)(CatRuntimeContext* runtimeContext);
+		//The function that executes the expression. Should only be set using setValueFunction.
+		const std::any (ExpressionAny::*valueFunctionPtr)(CatRuntimeContext* runtimeContext);
 
 		const std::any getExecuteVoidValue(CatRuntimeContext* runtimeContext);
 		const std::any getExecuteBoolValue(CatRuntimeContext* runtimeContext);
@@ -57,9 +61,19 @@ namespace jitcat
 		const std::any getExecutePtrPtrValue(CatRuntimeContext* runtimeContext);
 
 		const std::any getExecuteInterpretedValue(CatRuntimeContext* runtimeContext);
+		//Executes the expression with the tree-walking interpreter and compiles it once it has become hot.
+		const std::any getExecuteColdValue(CatRuntimeContext* runtimeContext);
+		const std::any getExecuteBytecodeValue(CatRuntimeContext* runtimeContext);
+		//Counts the call in the profile record and executes valueFunctionPtr.
+		const std::any getExecuteProfiledValue(CatRuntimeContext* runtimeContext);
 		const std::any getCachedValue(CatRuntimeContext* runtimeContext);
 		const std::any getDefaultValue(CatRuntimeContext* runtimeContext);
 
+		//Sets valueFunctionPtr, and getValuePtr to either the same function or getExecuteProfiledValue if the expression is profiled.
+		void setValueFunction(const std::any (ExpressionAny::*valueFunction)(CatRuntimeContext* runtimeContext));
+		//Selects the bytecode interpreter if a bytecode program is available, otherwise selects the tree-walking interpreter.
+		void setInterpretedValueFunction();
+
 	private:
 		std::any cachedValue;
 		uintptr_t nativeFunctionAddress;
@@ -9,30 +9,45 @@
 
 #include "jitcat/CatASTNodesDeclares.h"
 #include "jitcat/CatGenericType.h"
+#include "jitcat/CatScopeID.h"
 #include "jitcat/IndirectionConversionMode.h"
+#include "jitcat/LLVMCompileOptions.h"
+#include "jitcat/MemoryStatistics.h"
 #include "jitcat/ReflectableHandle.h"
+#include "jitcat/SharedExpressionCache.h"
 #include "jitcat/SLRParseResult.h"
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace jitcat
 {
 	class CatRuntimeContext;
+	class ColumnBinding;
+	class CompileSession;
 	class ExpressionErrorManager;
+	class ProfileRecord;
 	namespace Parser
 	{
 		struct SLRParseResult;	
 	}
+	namespace Bytecode
+	{
+		class BytecodeProgram;
+	}
 	namespace LLVM
 	{
 		class LLVMCodeGenerator;
+		struct LLVMCompileTimeContext;
 	}
 
 
 	//This class serves as the base class to Expression<T>, ExpressionAny and ExpressionAssignment, implementing shared functionality.
 	class ExpressionBase
 	{
+		friend class CompileSession;
 	public:
 		ExpressionBase(bool expectAssignable = false);
 		ExpressionBase(const char* expression, bool expectAssignable = false);
@@ -62,32 +77,129 @@ namespace jitcat
 		//Gets the type of the expression.
 		const CatGenericType& getType() const;
 
+		//Overrides JitCat::getDefaultOptimizationLevel for this expression. Takes effect when the expression is next compiled.
+		void setOptimizationLevel(LLVM::LLVMOptimizationLevel level);
+		//Returns the level set by setOptimizationLevel, or the default level if it was not set.
+		LLVM::LLVMOptimizationLevel getOptimizationLevel() const;
+		//The options that the native code of this expression is generated with.
+		LLVM::LLVMCompileOptions getCompileOptions() const;
+
 	protected:
 		bool parse(CatRuntimeContext* context, ExpressionErrorManager* errorManager, void* errorContext, const CatGenericType& expectedType);
 		virtual void handleCompiledFunction(uintptr_t functionAddress) = 0;
 		virtual void resetCompiledFunctionToDefault() = 0;
 		void discardAST();
+		//Returns the address of a native function that evaluates the expression for an array of objects that are set as the scope batchScopeId.
+		//The function is generated on first use. Returns 0 if native code generation is not available or if the function could not be generated,
+		//in which case generation is not attempted again until the expression is recompiled.
+		uintptr_t getBatchFunctionAddress(CatRuntimeContext* context, CatScopeID batchScopeId, const CatGenericType& expectedType);
+		//Compiles columnProgram, and columnFunctionAddress if the LLVM backend is enabled, for evaluating the expression over the columns.
+		//Compiled code is reused as long as the same scope is used and all the members that the expression uses are bound.
+		//Returns false if the expression cannot be evaluated over the columns.
+		bool prepareColumnEvaluation(CatRuntimeContext* context, CatScopeID columnScopeId, const ColumnBinding& columns, const CatGenericType& expectedType);
+
+		//Returns true if the expression can swap in a compiled function while it is being executed on another thread.
+		//If true, parse will leave compilation to startBackgroundCompilation when background compilation is enabled. See JitCat::setBackgroundCompilation.
+		virtual bool getSupportsBackgroundCompilation() const;
+		//Returns true if the expression can be executed by the interpreter until it is hot. See JitCat::setCompilationThreshold.
+		virtual bool getSupportsDeferredCompilation() const;
+		//Counts an execution of a cold expression. Returns true when the expression has become hot and should be compiled using compileDeferred.
+		bool countExecution();
+		//Compiles an expression that has become hot using its compile context. If background compilation is enabled and supported, the compilation is queued and false is returned.
+		//Otherwise the expression is compiled immediately and true is returned. If the compile context no longer exists, the expression is not compiled and false is returned.
+		bool compileDeferred(const CatGenericType& expectedType);
+		//Called by startBackgroundCompilation after the compilation has been queued. Should select a value function that calls finishBackgroundCompilation.
+		virtual void handleBackgroundCompilationQueued();
+		//Installs the result of a background compilation using handleCompiledFunction, once the background compiler has finished.
+		//Returns false if the compilation has not finished. Must be called on the thread that executes the expression.
+		bool finishBackgroundCompilation();
+		//Queues the compilation that was skipped by parse. Should be called after an interpreted value function has been selected.
+		//Does nothing if the expression was added to a CompileSession.
+		void startBackgroundCompilation(CatRuntimeContext* context, const CatGenericType& expectedType);
+		//Cancels deferred compilation and resets the execution count, waits for the background compiler if it is compiling this expression.
+		//Also removes the expression from the CompileSession that it was added to.
+		void cancelDeferredCompilation();
 
 	private:
+		//Batch and column evaluation generate code from the AST. If the AST was discarded after native code compilation, 
+		//the expression is compiled again using its compile context and its AST is kept from then on. 
+		//Returns false if there is no valid AST, or if the AST was discarded and the compile context no longer exists.
+		bool ensureAST();
+		//Returns the context that the expression was last compiled with, or nullptr if that context has been destroyed.
+		CatRuntimeContext* getCompileContext() const;
+		//Returns false if the AST should be kept after native code compilation, see JitCat::setDiscardASTAfterNativeCodeCompilation.
+		bool getDiscardASTAfterCompilation() const;
 		void constCollapse(CatRuntimeContext* context, ExpressionErrorManager* errorManager, void* errorContext);
 		void typeCheck(const CatGenericType& expectedType, CatRuntimeContext* context, ExpressionErrorManager* errorManager, void* errorContext);
 		void handleParseErrors(CatRuntimeContext* context);
-		void compileToNativeCode(CatRuntimeContext* context, const CatGenericType& expectedType);
+		//Returns the address of the native function, or 0 if no native function was generated.
+		uintptr_t compileToNativeCode(CatRuntimeContext* context, const CatGenericType& expectedType);
+		//Returns true if a precompiled function was found and handled.
+		bool linkPrecompiledFunction(CatRuntimeContext* context, const CatGenericType& expectedType);
+#ifdef ENABLE_LLVM
+		uintptr_t generateNativeCode(CatRuntimeContext* context, const CatGenericType& expectedType);
+		//Sets up the compile context of a batch or column function and calls generateFunction with it while holding the LLVM context lock.
+		template<typename GenerateFunctionT>
+		uintptr_t generateLoopFunction(CatRuntimeContext* context, GenerateFunctionT generateFunction);
+		//Called by CompileSession::finalize to generate the function of this expression into the session module.
+		void addToCompileSession(std::shared_ptr<LLVM::LLVMCodeGenerator> sessionCodeGenerator, LLVM::LLVMCompileTimeContext* llvmCompileContext, const CatGenericType& expectedType);
+#endif
+		//Called by CompileSession::finalize after the session module has been linked. functionAddress is 0 if the LLVM backend is not enabled.
+		void finishSessionCompilation(uintptr_t functionAddress);
+		void compileToBytecode();
+		//Returns true if a bytecode program should be compiled for the expression, see JitCat::setInterpreterMode.
+		bool getUsesBytecode() const;
 		void calculateLiteralStatus();
+		//See JitCat::setExpressionSharing.
+		void useSharedExpression(const std::shared_ptr<const SharedExpression>& shared, CatRuntimeContext* context);
+		void shareExpression(const SharedExpressionCache::Key& key, uintptr_t functionAddress, std::vector<Reflection::TypeVersion>&& resolvedTypes);
 
 	protected:
 		std::string expression;
 		CatGenericType valueType;
-		Parser::SLRParseResult parseResult;
+		//Never null. Shared with other expressions if it was shared through the SharedExpressionCache, in which case it is not modified.
+		std::shared_ptr<Parser::SLRParseResult> parseResult;
+		//Set if this expression uses, or was added to, the SharedExpressionCache. See JitCat::setExpressionSharing.
+		std::shared_ptr<const SharedExpression> sharedExpression;
+		//Only created if native code is not available and the interpreter mode is set to bytecode. See JitCat::setInterpreterMode.
+		std::unique_ptr<Bytecode::BytecodeProgram> bytecodeProgram;
 #ifdef ENABLE_LLVM
 		//Storing a shared pointer to the code generator here guarantees that generated expression code
 		//does not get destroyed before the Expression gets destroyed.
 		std::shared_ptr<LLVM::LLVMCodeGenerator> codeGenerator;
 #endif
 
+		//Cached result of getBatchFunctionAddress.
+		uintptr_t batchFunctionAddress;
+		CatScopeID batchFunctionScopeId;
+		//Created by prepareColumnEvaluation. The column function is only generated if the expression is of the expected type.
+		std::unique_ptr<Bytecode::BytecodeProgram> columnProgram;
+		CatScopeID columnProgramScopeId;
+		uintptr_t columnFunctionAddress;
+		//Set by ensureAST once the expression is used for batch or column evaluation. The AST is then no longer discarded.
+		bool keepAST;
+
 		bool expressionIsLiteral;
 		bool isConstant;
 		bool expectAssignable;
+		std::optional<LLVM::LLVMOptimizationLevel> optimizationLevel;
+		//Set by parse when compilation has been deferred, either to startBackgroundCompilation or until the expression is hot.
+		bool compilationPending;
+		//Set by parse when compilation has been deferred until the expression has been executed JitCat::getCompilationThreshold() times.
+		bool compileWhenHot;
+		unsigned int executionCount;
+		//The context that was passed to parse. Only valid while the context exists, see getCompileContext.
+		CatRuntimeContext* compileContext;
+		//Written by the background compiler before it sets backgroundCompilationFinished. Read by finishBackgroundCompilation after it has been set.
+		uintptr_t backgroundFunctionAddress;
+		std::unique_ptr<Bytecode::BytecodeProgram> backgroundBytecodeProgram;
+		std::atomic<bool> backgroundCompilationFinished;
+		//The session that this expression was added to by parse, see CompileSession.
+		CompileSession* compileSession;
+		//Set by parse if profiling is enabled, see JitCat::setProfilingEnabled.
+		std::shared_ptr<ProfileRecord> profileRecord;
+		//Accounts the AST of this expression to the context it was compiled with, see JitCat::getMemoryStatistics.
+		ExpressionMemoryAccount memoryAccount;
 		Reflection::ReflectableHandle errorManagerHandle;
 	};
 
@@ -6,25 +6,31 @@
 */
 
 #include "jitcat/Expression.h"
+#include "jitcat/BytecodeProgram.h"
 #include "jitcat/CatASTNodes.h"
 #include "jitcat/CatGenericType.h"
 #include "jitcat/Configuration.h"
 #include "jitcat/Document.h"
 #include "jitcat/ExpressionErrorManager.h"
+#include "jitcat/ExpressionProfiler.h"
 #include "jitcat/JitCat.h"
 
 #include "jitcat/SLRParseResult.h"
 #include "jitcat/Tools.h"
 #include "jitcat/TypeTraits.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <vector>
 
 namespace jitcat
 {
 
 	template<typename ExpressionResultT>
 	Expression<ExpressionResultT>::Expression():
-		getValuePtr(&Expression<ExpressionResultT>::getDefaultValue)
+		getValuePtr(&Expression<ExpressionResultT>::getDefaultValue),
+		valueFunctionPtr(&Expression<ExpressionResultT>::getDefaultValue)
 	{
 	}
 
@@ -32,7 +38,8 @@ namespace jitcat
 	template<typename ExpressionResultT>
 	inline Expression<ExpressionResultT>::Expression(const char* expression):
 		ExpressionBase(expression),
-		getValuePtr(&Expression<ExpressionResultT>::getDefaultValue)
+		getValuePtr(&Expression<ExpressionResultT>::getDefaultValue),
+		valueFunctionPtr(&Expression<ExpressionResultT>::getDefaultValue)
 	{
 	}
 
@@ -40,7 +47,8 @@ namespace jitcat
 	template<typename ExpressionResultT>
 	Expression<ExpressionResultT>::Expression(const std::string& expression):
 		ExpressionBase(expression),
-		getValuePtr(&Expression<ExpressionResultT>::getDefaultValue)
+		getValuePtr(&Expression<ExpressionResultT>::getDefaultValue),
+		valueFunctionPtr(&Expression<ExpressionResultT>::getDefaultValue)
 	{
 	}
 
@@ -48,7 +56,8 @@ namespace jitcat
 	template<typename ExpressionResultT>
 	Expression<ExpressionResultT>::Expression(CatRuntimeContext* compileContext, const std::string& expression):
 		ExpressionBase(compileContext, expression),
-		getValuePtr(&Expression<ExpressionResultT>::getDefaultValue)
+		getValuePtr(&Expression<ExpressionResultT>::getDefaultValue),
+		valueFunctionPtr(&Expression<ExpressionResultT>::getDefaultValue)
 	{
 		compile(compileContext);
 	}
@@ -57,7 +66,8 @@ namespace jitcat
 	template<typename ExpressionResultT>
 	Expression<ExpressionResultT>::~Expression()
 	{
-
+		//Must happen before the Expression is destroyed because the background compiler may still be reading it.
+		cancelDeferredCompilation();
 	}
 
 
@@ -79,14 +89,23 @@ namespace jitcat
 			{
 				if constexpr (!std::is_same<void, ExpressionResultT>::value)
 				{
-					cachedValue = getActualValue(parseResult.getNode<AST::CatTypedExpression>()->execute(context));
+					cachedValue = getActualValue(parseResult->getNode<AST::CatTypedExpression>()->execute(context));
 				}
-				getValuePtr = &Expression<ExpressionResultT>::getCachedValue;
+				setValueFunction(&Expression<ExpressionResultT>::getCachedValue);
 				discardAST();
 			}
+			else if (compileWhenHot)
+			{
+				setValueFunction(&Expression<ExpressionResultT>::getExecuteColdValue);
+			}
+			else if (compilationPending)
+			{
+				setInterpretedValueFunction();
+				startBackgroundCompilation(context, TypeTraits<ExpressionResultT>::toGenericType());
+			}
 			else if (!Configuration::enableLLVM && !JitCat::get()->getHasPrecompiledExpression())
 			{
-				getValuePtr = &Expression<ExpressionResultT>::getExecuteInterpretedValue;
+				setInterpretedValueFunction();
 			}
 		}
 	}
@@ -95,14 +114,17 @@ namespace jitcat
 	template<typename ExpressionResultT>
 	inline void Expression<ExpressionResultT>::handleCompiledFunction(uintptr_t functionAddress)
 	{
-		static_assert(sizeof(getValuePtr) == sizeof(uintptr_t) || sizeof(getValuePtr) == 2 * sizeof(uintptr_t));
+		static_assert(sizeof(valueFunctionPtr) == sizeof(uintptr_t) || sizeof(valueFunctionPtr) == 2 * sizeof(uintptr_t));
 		if (functionAddress != 0)
 		{
-			memcpy(reinterpret_cast<unsigned char*>(&getValuePtr), reinterpret_cast<unsigned char*>(&functionAddress), sizeof(uintptr_t));
+			//Only the first word of the member function pointer is replaced. The rest of the pointer of a non-virtual member function of this class is the same for the compiled function.
+			const ExpressionResultT (Expression<ExpressionResultT>::*compiledFunction)(CatRuntimeContext*) = &Expression<ExpressionResultT>::getDefaultValue;
+			memcpy(reinterpret_cast<unsigned char*>(&compiledFunction), reinterpret_cast<unsigned char*>(&functionAddress), sizeof(uintptr_t));
+			setValueFunction(compiledFunction);
 		}
 		else
 		{
-			getValuePtr = &Expression<ExpressionResultT>::getExecuteInterpretedValue;
+			setInterpretedValueFunction();
 		}
 	}
 
@@ -110,7 +132,28 @@ namespace jitcat
 	template<typename ExpressionResultT>
 	inline void Expression<ExpressionResultT>::resetCompiledFunctionToDefault()
 	{
-		getValuePtr = &Expression<ExpressionResultT>::getDefaultValue;
+		setValueFunction(&Expression<ExpressionResultT>::getDefaultValue);
+	}
+
+
+	template<typename ExpressionResultT>
+	inline bool Expression<ExpressionResultT>::getSupportsBackgroundCompilation() const
+	{
+		return true;
+	}
+
+
+	template<typename ExpressionResultT>
+	inline bool Expression<ExpressionResultT>::getSupportsDeferredCompilation() const
+	{
+		return true;
+	}
+
+
+	template<typename ExpressionResultT>
+	inline void Expression<ExpressionResultT>::handleBackgroundCompilationQueued()
+	{
+		setValueFunction(&Expression<ExpressionResultT>::getExecuteBackgroundValue);
 	}
 
 
@@ -135,7 +178,7 @@ namespace jitcat
 				return;
 			}
 		}
-		else if (parseResult.success)
+		else if (parseResult->success)
 		{
 			return getExecuteInterpretedValue(runtimeContext);
 		}
@@ -146,6 +189,108 @@ namespace jitcat
 	}
 
 
+	template<typename ExpressionResultT>
+	inline void Expression<ExpressionResultT>::getValues(CatRuntimeContext* runtimeContext, CatScopeID batchScopeId, unsigned char* const* objects, 
+														 std::size_t numObjects, ExpressionResultT* results)
+	{
+		if (runtimeContext == nullptr)
+		{
+			runtimeContext = &CatRuntimeContext::getDefaultContext();
+		}
+		if constexpr (!std::is_same<void, ExpressionResultT>::value)
+		{
+			if (isConstant)
+			{
+				for (std::size_t i = 0; i < numObjects; ++i)
+				{
+					results[i] = cachedValue;
+				}
+				return;
+			}
+		}
+		if constexpr (CatValue::isInlineBasicType<ExpressionResultT>())
+		{
+			//The native batch function reads the objects directly and does not use the batch scope of the runtimeContext.
+			if (uintptr_t functionAddress = getBatchFunctionAddress(runtimeContext, batchScopeId, getExpectedCatType()); functionAddress != 0)
+			{
+				reinterpret_cast<void(*)(CatRuntimeContext*, unsigned char* const*, int64_t, ExpressionResultT*)>(functionAddress)(runtimeContext, objects, static_cast<int64_t>(numObjects), results);
+				return;
+			}
+		}
+		unsigned char* previousScopeObject = runtimeContext->beginScopeObjectBatch(batchScopeId);
+		for (std::size_t i = 0; i < numObjects; ++i)
+		{
+			runtimeContext->setBatchScopeObject(batchScopeId, objects[i]);
+			if constexpr (!std::is_same<void, ExpressionResultT>::value)
+			{
+				results[i] = (this->*valueFunctionPtr)(runtimeContext);
+			}
+			else
+			{
+				(this->*valueFunctionPtr)(runtimeContext);
+			}
+		}
+		runtimeContext->endScopeObjectBatch(batchScopeId, previousScopeObject);
+	}
+
+
+	template<typename ExpressionResultT>
+	inline bool Expression<ExpressionResultT>::getColumnValues(CatRuntimeContext* runtimeContext, CatScopeID columnScopeId, const ColumnBinding& columns, ExpressionResultT* results)
+	{
+		if constexpr (std::is_same<bool, ExpressionResultT>::value || std::is_same<int, ExpressionResultT>::value
+					  || std::is_same<float, ExpressionResultT>::value || std::is_same<double, ExpressionResultT>::value)
+		{
+			if (runtimeContext == nullptr)
+			{
+				runtimeContext = &CatRuntimeContext::getDefaultContext();
+			}
+			std::size_t numRows = columns.getNumRows();
+			if (isConstant)
+			{
+				std::fill(results, results + numRows, cachedValue);
+				return true;
+			}
+			if (!prepareColumnEvaluation(runtimeContext, columnScopeId, columns, getExpectedCatType()))
+			{
+				return false;
+			}
+			const std::vector<const Reflection::TypeMemberInfo*>& columnMembers = columnProgram->getColumnMembers();
+			std::vector<const unsigned char*> columnValues(columnMembers.size());
+			std::vector<int64_t> columnStrides(columnMembers.size());
+			for (std::size_t i = 0; i < columnMembers.size(); ++i)
+			{
+				const ColumnBinding::Column* column = columns.getColumn(columnMembers[i]);
+				columnValues[i] = column->data;
+				columnStrides[i] = static_cast<int64_t>(column->stride);
+			}
+			if (columnFunctionAddress != 0)
+			{
+				reinterpret_cast<void(*)(CatRuntimeContext*, const unsigned char* const*, const int64_t*, int64_t, ExpressionResultT*)>(columnFunctionAddress)
+					(runtimeContext, columnValues.data(), columnStrides.data(), static_cast<int64_t>(numRows), results);
+				return true;
+			}
+			for (std::size_t row = 0; row < numRows; ++row)
+			{
+				Bytecode::BytecodeRegister result = columnProgram->execute(runtimeContext, columnValues.data());
+				if		(columnProgram->getResultKind() == Bytecode::RegisterKind::Bool && std::is_same<bool, ExpressionResultT>::value)		results[row] = (ExpressionResultT)result.boolValue;
+				else if (columnProgram->getResultKind() == Bytecode::RegisterKind::Int && std::is_same<int, ExpressionResultT>::value)		results[row] = (ExpressionResultT)result.intValue;
+				else if (columnProgram->getResultKind() == Bytecode::RegisterKind::Float && std::is_same<float, ExpressionResultT>::value)	results[row] = (ExpressionResultT)result.floatValue;
+				else if (columnProgram->getResultKind() == Bytecode::RegisterKind::Double && std::is_same<double, ExpressionResultT>::value)	results[row] = (ExpressionResultT)result.doubleValue;
+				else																														results[row] = getActualValue(columnProgram->registerToAny(result));
+				for (std::size_t i = 0; i < columnValues.size(); ++i)
+				{
+					columnValues[i] += columnStrides[i];
+				}
+			}
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+
 	template<typename ExpressionResultT>
 	CatGenericType Expression<ExpressionResultT>::getExpectedCatType() const
 	{
@@ -153,6 +298,36 @@ namespace jitcat
 	}
 
 
+	template<typename ExpressionResultT>
+	inline void Expression<ExpressionResultT>::setInterpretedValueFunction()
+	{
+		if (bytecodeProgram != nullptr)
+		{
+			setValueFunction(&Expression<ExpressionResultT>::getExecuteBytecodeValue);
+		}
+		else
+		{
+			setValueFunction(&Expression<ExpressionResultT>::getExecuteInterpretedValue);
+		}
+	}
+
+
+	template<typename ExpressionResultT>
+	inline void Expression<ExpressionResultT>::setValueFunction(const ExpressionResultT (Expression<ExpressionResultT>::*valueFunction)(CatRuntimeContext* runtimeContext))
+	{
+		//The choice between the profiled and the unprofiled function is made here, so that getValue does not need to check for a profile record.
+		valueFunctionPtr = valueFunction;
+		if (profileRecord != nullptr)
+		{
+			getValuePtr = &Expression<ExpressionResultT>::getExecuteProfiledValue;
+		}
+		else
+		{
+			getValuePtr = valueFunction;
+		}
+	}
+
+
 	template<typename ExpressionResultT>
 	inline ExpressionResultT Expression<ExpressionResultT>::getActualValue(const std::any& catValue)
 	{
@@ -167,15 +342,34 @@ namespace jitcat
 		{
 			runtimeContext = &CatRuntimeContext::getDefaultContext();
 		}
+		if constexpr (CatValue::isInlineBasicType<ExpressionResultT>())
+		{
+			//Basic types are returned without boxing them in a std::any.
+			AST::CatTypedExpression* expression = parseResult->getNode<AST::CatTypedExpression>();
+			if (CatValue::canHold(expression->getType()))
+			{
+				CatValue value = expression->executeValue(runtimeContext);
+				runtimeContext->clearTemporaries();
+				switch (value.getTag())
+				{
+					case CatValue::Tag::Bool:	if constexpr (std::is_same<bool, ExpressionResultT>::value)		return value.getBool(); break;
+					case CatValue::Tag::Int:	if constexpr (std::is_same<int, ExpressionResultT>::value)		return value.getInt(); break;
+					case CatValue::Tag::Float:	if constexpr (std::is_same<float, ExpressionResultT>::value)	return value.getFloat(); break;
+					case CatValue::Tag::Double:	if constexpr (std::is_same<double, ExpressionResultT>::value)	return value.getDouble(); break;
+					default: break;
+				}
+				return getActualValue(value.toAny(expression->getType()));
+			}
+		}
 		if constexpr (!std::is_same<void, ExpressionResultT>::value)
 		{
-			std::any value = parseResult.getNode<AST::CatTypedExpression>()->execute(runtimeContext);
+			std::any value = parseResult->getNode<AST::CatTypedExpression>()->execute(runtimeContext);
 			runtimeContext->clearTemporaries();
 			return getActualValue(value);
 		}
 		else
 		{
-			parseResult.getNode<AST::CatTypedExpression>()->execute(runtimeContext);
+			parseResult->getNode<AST::CatTypedExpression>()->execute(runtimeContext);
 			runtimeContext->clearTemporaries();
 			return;
 		}
@@ -183,7 +377,81 @@ namespace jitcat
 
 
 	template<typename ExpressionResultT>
-	inline const ExpressionResultT Expression<ExpressionResultT>::getCachedValue(CatRuntimeContext* runtimeContext)
+	inline const ExpressionResultT Expression<ExpressionResultT>::getExecuteColdValue(CatRuntimeContext* runtimeContext)
+	{
+		if (runtimeContext == nullptr)
+		{
+			runtimeContext = &CatRuntimeContext::getDefaultContext();
+		}
+		if (countExecution())
+		{
+			//Stops counting. When compiling in the background, the interpreter is used until the compiled function is available.
+			setInterpretedValueFunction();
+			if (compileDeferred(getExpectedCatType()) && !Configuration::enableLLVM)
+			{
+				//Selects the bytecode program if it was compiled.
+				setInterpretedValueFunction();
+			}
+			return (this->*valueFunctionPtr)(runtimeContext);
+		}
+		return getExecuteInterpretedValue(runtimeContext);
+	}
+
+
+	template<typename ExpressionResultT>
+	inline const ExpressionResultT Expression<ExpressionResultT>::getExecuteBytecodeValue(CatRuntimeContext* runtimeContext)
+	{
+		if (runtimeContext == nullptr)
+		{
+			runtimeContext = &CatRuntimeContext::getDefaultContext();
+		}
+		Bytecode::BytecodeRegister result = bytecodeProgram->execute(runtimeContext);
+		runtimeContext->clearTemporaries();
+		//Basic types are read directly from the result register, other types are converted through std::any.
+		if constexpr (std::is_same<bool, ExpressionResultT>::value)
+		{
+			if (bytecodeProgram->getResultKind() == Bytecode::RegisterKind::Bool)		return result.boolValue;
+		}
+		else if constexpr (std::is_same<int, ExpressionResultT>::value)
+		{
+			if (bytecodeProgram->getResultKind() == Bytecode::RegisterKind::Int)		return result.intValue;
+		}
+		else if constexpr (std::is_same<float, ExpressionResultT>::value)
+		{
+			if (bytecodeProgram->getResultKind() == Bytecode::RegisterKind::Float)		return result.floatValue;
+		}
+		else if constexpr (std::is_same<double, ExpressionResultT>::value)
+		{
+			if (bytecodeProgram->getResultKind() == Bytecode::RegisterKind::Double)	return result.doubleValue;
+		}
+		if constexpr (!std::is_same<void, ExpressionResultT>::value)
+		{
+			return getActualValue(bytecodeProgram->registerToAny(result));
+		}
+	}
+
+
+	template<typename ExpressionResultT>
+	inline const ExpressionResultT Expression<ExpressionResultT>::getExecuteBackgroundValue(CatRuntimeContext* runtimeContext)
+	{
+		if (finishBackgroundCompilation())
+		{
+			return (this->*valueFunctionPtr)(runtimeContext);
+		}
+		return getExecuteInterpretedValue(runtimeContext);
+	}
+
+
+	template<typename ExpressionResultT>
+	inline const ExpressionResultT Expression<ExpressionResultT>::getExecuteProfiledValue(CatRuntimeContext* runtimeContext)
+	{
+		ProfileScope profileScope(profileRecord.get());
+		return (this->*valueFunctionPtr)(runtimeContext);
+	}
+
+
+	template<typename ExpressionResultT>
+	inline const ExpressionResultT Expression<ExpressionResultT>::getCachedValue([[maybe_unused]] CatRuntimeContext* runtimeContext)
 	{
 		if constexpr (!std::is_same<void, ExpressionResultT>::value)
 		{
@@ -197,7 +465,7 @@ namespace jitcat
 	
 	
 	template<typename ExpressionResultT>
-	inline const ExpressionResultT Expression<ExpressionResultT>::getDefaultValue(CatRuntimeContext* runtimeContext)
+	inline const ExpressionResultT Expression<ExpressionResultT>::getDefaultValue([[maybe_unused]] CatRuntimeContext* runtimeContext)
 	{
 		return ExpressionResultT();
 	}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "jitcat/CatGenericType.h"
+#include "jitcat/LLVMCompileOptions.h"
 
 #include <map>
 #include <string>
@@ -27,7 +28,8 @@ namespace jitcat
 		static bool canBeAssigned(const CatGenericType& targetType, const CatGenericType& sourceType);
 		static ExpressionBase* createExpression(const CatGenericType& type, const std::string& expressionText, CatRuntimeContext* compileContext);
 		static ExpressionBase* createExpression(const CatGenericType& type, const std::string& expressionText);
-		static std::string getUniqueExpressionFunctionName(const std::string& expression, CatRuntimeContext* context, bool isAssignExpression, const CatGenericType& expectedReturnType);
+		//Returns the name of the native function of an expression. Functions of the same expression that are compiled at different optimization levels have different names.
+		static std::string getUniqueExpressionFunctionName(const std::string& expression, CatRuntimeContext* context, bool isAssignExpression, const CatGenericType& expectedReturnType, LLVM::LLVMOptimizationLevel optimizationLevel);
 	};
 
 
@@ -0,0 +1,130 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+
+namespace jitcat
+{
+	enum class ProfileRecordKind
+	{
+		Expression,
+		Assignment,
+		Function
+	};
+
+
+	//Counts the calls of the expressions or functions with the same text and context name and the time spent in those calls.
+	//Records are shared by the expressions and functions that use them and are freed when the last of those is destroyed or recompiled.
+	class ProfileRecord
+	{
+	public:
+		ProfileRecord(ProfileRecordKind kind, const std::string& name, const std::string& contextName);
+		ProfileRecord(const ProfileRecord&) = delete;
+		void operator=(const ProfileRecord&) = delete;
+
+		//Returns the current time in nanoseconds.
+		static inline uint64_t getTime()
+		{
+			return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		//Counts a call that started at startTime, as returned by getTime. May be called from multiple threads.
+		inline void addCall(uint64_t startTime)
+		{
+			numCalls.fetch_add(1, std::memory_order_relaxed);
+			totalTime.fetch_add(getTime() - startTime, std::memory_order_relaxed);
+		}
+
+		const ProfileRecordKind kind;
+		//The expression text or the qualified function name.
+		const std::string name;
+		const std::string contextName;
+		std::atomic<uint64_t> numCalls;
+		//In nanoseconds.
+		std::atomic<uint64_t> totalTime;
+	};
+
+
+	//Counts a call to a profiled expression or function for as long as it is in scope. Does nothing if record is nullptr.
+	class ProfileScope
+	{
+	public:
+		inline ProfileScope(ProfileRecord* record):
+			record(record),
+			startTime(record != nullptr ? ProfileRecord::getTime() : 0)
+		{}
+		inline ~ProfileScope()
+		{
+			if (record != nullptr)
+			{
+				record->addCall(startTime);
+			}
+		}
+		ProfileScope(const ProfileScope&) = delete;
+		void operator=(const ProfileScope&) = delete;
+
+	private:
+		ProfileRecord* record;
+		uint64_t startTime;
+	};
+
+
+	struct ProfileReportEntry
+	{
+		ProfileRecordKind kind;
+		std::string name;
+		std::string contextName;
+		uint64_t numCalls;
+		//In nanoseconds. Includes the time spent in profiled functions that were called by the expression or function.
+		uint64_t totalTime;
+		double averageTime;
+	};
+
+
+	//Keeps track of the profile records of expressions and functions that were compiled while profiling was enabled. See JitCat::setProfilingEnabled.
+	//The report only includes records that are still in use.
+	class ExpressionProfiler
+	{
+	public:
+		ExpressionProfiler();
+		ExpressionProfiler(const ExpressionProfiler&) = delete;
+		void operator=(const ExpressionProfiler&) = delete;
+		~ExpressionProfiler();
+
+		//Returns the record for the name and context name, creating it if it does not exist yet.
+		std::shared_ptr<ProfileRecord> getRecord(ProfileRecordKind kind, const std::string& name, const std::string& contextName);
+
+		//Returns an entry for each record that has been called, sorted by total time, longest first.
+		std::vector<ProfileReportEntry> getReport() const;
+		//Writes the report as a table. If maxEntries is not 0, only the first maxEntries entries are written.
+		void writeReport(std::ostream& stream, std::size_t maxEntries) const;
+		//Sets the counters of all records to zero.
+		void reset();
+
+		static const char* toString(ProfileRecordKind kind);
+
+	private:
+		mutable std::mutex mutex;
+		std::map<std::tuple<ProfileRecordKind, std::string, std::string>, std::weak_ptr<ProfileRecord>> records;
+		//Records that are no longer used are removed from records once it has grown to this size.
+		std::size_t recordPruneThreshold;
+	};
+
+} //End namespace jitcat
@@ -8,6 +8,7 @@
 #pragma once
 
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <vector>
@@ -22,6 +23,7 @@ namespace jitcat
 	{
 		class ASTNodeParser;
 		class SLRParser;
+		struct SLRParseTables;
 	}
 	namespace Tokenizer
 	{
@@ -42,7 +44,13 @@ namespace jitcat
 			virtual ~GrammarBase();
 			virtual const char* getProductionName(int production) const = 0;
 			ProductionToken* epsilon();
+			//Creates the parser from the precomputed parse tables if they match the grammar, otherwise the DFA is built from the grammar.
 			std::unique_ptr<Parser::SLRParser> createSLRParser() const;
+			//Returns the parse tables that were generated ahead of time for this grammar, or nullptr if there are none.
+			virtual const Parser::SLRParseTables* getPrecomputedParseTables() const;
+			//Returns a hash of the productions, rules and tokens of the grammar. 
+			//It is the same on every platform, so that it can be used to check if precomputed parse tables match the grammar.
+			std::uint64_t getGrammarHash() const;
 
 			typedef AST::ASTNode* (*SemanticAction)(const Parser::ASTNodeParser&);
 
@@ -21,6 +21,9 @@ namespace jitcat::Tokenizer
 		virtual const char* getSubTypeName(unsigned short subType) const override final;
 		virtual const char* getSubTypeSymbol(unsigned short subType) const override final;
 		virtual bool createIfMatch(Document& document, std::size_t& currentPosition) const override final;
+
+		//Returns the keyword type of an identifier, or Identifier::Identifier if it is not a keyword.
+		static Identifier getIdentifierType(const char* text, std::size_t length);
 	};
 
 } //End namespace jitcat::Tokenizer
\ No newline at end of file
@@ -0,0 +1,23 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+
+namespace jitcat
+{
+	//Determines how expressions and functions are executed when they are not compiled to native code.
+	//See JitCat::setInterpreterMode
+	enum class InterpreterMode
+	{
+		//Executes the expression by recursively calling execute on the AST nodes.
+		TreeWalking,
+		//Lowers the AST to a flat, register-based bytecode program that is executed by a dispatch loop.
+		//Parts of the AST that cannot be lowered are still executed by the tree-walking interpreter.
+		Bytecode
+	};
+}
@@ -7,10 +7,20 @@
 
 #pragma once
 
+namespace jitcat
+{
+	class BackgroundCompiler;
+	class SharedExpressionCache;
+}
 namespace jitcat::Grammar
 {
 	class CatGrammar;
 }
+namespace jitcat::LLVM
+{
+	class LLVMCodeGenerator;
+	class LLVMCodeGeneratorHelper;
+}
 namespace jitcat::Tokenizer
 {
 	class CatTokenizer;
@@ -23,22 +33,61 @@ namespace jitcat::Parser
 	struct SLRParseResult;
 }
 
+#include "jitcat/ExpressionProfiler.h"
+#include "jitcat/InterpreterMode.h"
+#include "jitcat/LLVMCompileOptions.h"
+#include "jitcat/MemoryStatistics.h"
+#include "jitcat/SharedExpressionCache.h"
+
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 
 namespace jitcat
 {
 	class CatRuntimeContext;
+	class ExpressionBase;
 	class ExpressionErrorManager;
 	class PrecompilationContext;
 
+	//Statistics about expressions of which compilation was deferred until they were hot. See JitCat::setCompilationThreshold.
+	struct TieringStatistics
+	{
+		//Number of compiled expressions that were executed by the interpreter until they became hot.
+		std::size_t numDeferredExpressions;
+		//Number of those expressions that reached the compilation threshold and were compiled.
+		std::size_t numHotExpressions;
+		//Number of interpreted executions of expressions before they became hot.
+		std::size_t numColdExecutions;
+	};
+
+
+	//Statistics about the native code that is generated by the LLVM backend. All counts are 0 if LLVM is not enabled.
+	struct CodeGenerationStatistics
+	{
+		//Number of functions that were generated for Expression::getColumnValues.
+		std::size_t numColumnFunctions;
+		//Number of those functions that contain vector instructions after the loop and SLP vectorizers have run.
+		std::size_t numVectorizedColumnFunctions;
+		//Number of null checks that were generated for dereferencing pointers.
+		std::size_t numNullChecks;
+		//Number of null checks that were omitted because the pointer was known to be non-null, see MemberFlags::isTrustedNonNull.
+		std::size_t numElidedNullChecks;
+	};
+
+
 	class JitCat
 	{
+		friend class ExpressionBase;
+		friend class LLVM::LLVMCodeGenerator;
+		friend class LLVM::LLVMCodeGeneratorHelper;
 		JitCat();
 		~JitCat();
 	public:
@@ -46,6 +95,17 @@ namespace jitcat
 		std::unique_ptr<Parser::SLRParseResult> parseExpression(Tokenizer::Document& expression, CatRuntimeContext* context, ExpressionErrorManager* errorManager, void* errorContext) const;
 		std::unique_ptr<Parser::SLRParseResult> parseStatement(Tokenizer::Document& statement, CatRuntimeContext* context, ExpressionErrorManager* errorManager, void* errorContext) const;
 		std::unique_ptr<Parser::SLRParseResult> parseFull(Tokenizer::Document& expression, CatRuntimeContext* context, ExpressionErrorManager* errorManager, void* errorContext) const;
+
+		//Compiles each expression using the context it is paired with. Parsing, type checking and bytecode compilation
+		//are spread over threadCount threads. If threadCount is 0, the number of hardware threads is used.
+		//Native code generation is not parallelized. All code generators share the LLVMContext of LLVMJit,
+		//so only one thread at a time generates and links native code. With LLVM enabled, compileAll therefore
+		//only gets faster with more threads to the extent that parsing and type checking dominate compile time.
+		//Expressions whose contexts share an ExpressionErrorManager are compiled on the same thread, so in order to compile
+		//expressions in parallel they should be spread over contexts that each have their own error manager.
+		//The contexts must not be used by other threads during compilation.
+		//The expressions of each error manager are compiled in a CompileSession, so that expressions of the same context are linked as a single module.
+		void compileAll(const std::vector<std::pair<ExpressionBase*, CatRuntimeContext*>>& expressions, unsigned int threadCount = 0) const;
 		
 		static uintptr_t getPrecompiledSymbol(const std::string& name);
 
@@ -72,6 +132,94 @@ namespace jitcat
 		void setDiscardASTAfterNativeCodeCompilation(bool discard);
 		bool getDiscardASTAfterNativeCodeCompilation() const;
 
+		//Selects how expressions and functions are executed when they are not compiled to native code.
+		//The default is InterpreterMode::TreeWalking.
+		//The mode is applied when an expression is compiled, changing the mode does not affect expressions that have already been compiled.
+		void setInterpreterMode(InterpreterMode mode);
+		InterpreterMode getInterpreterMode() const;
+
+		//Selects the optimization passes that are run on native code generated by the LLVM backend. The default is LLVMOptimizationLevel::O1.
+		//The level can be overridden per expression and per CatLib. Applies to code that is generated after the level was set.
+		void setDefaultOptimizationLevel(LLVM::LLVMOptimizationLevel level);
+		LLVM::LLVMOptimizationLevel getDefaultOptimizationLevel() const;
+
+		//Background compilation is disabled by default.
+		//When enabled, Expression::compile returns after the expression has been type checked and the expression is executed by the
+		//tree-walking interpreter until native code, or bytecode if LLVM is not enabled, has been compiled on a background thread.
+		//Only applies to Expression<T>, other kinds of expressions are always compiled immediately.
+		//The AST of an expression that is compiled in the background is not discarded.
+		//A context that is used to compile expressions in the background must not be modified until compilation has finished.
+		void setBackgroundCompilation(bool enabled);
+		bool getBackgroundCompilation() const;
+		//Sets the number of times an Expression<T> or ExpressionAny is executed by the interpreter before it is compiled.
+		//This avoids compiling expressions that are only executed a few times, saving both compile time and code memory.
+		//A threshold of 0 disables tiering: expressions are compiled immediately. This is the default.
+		//Expressions that become hot are compiled using the context that they were compiled with, or in the background if background compilation is enabled.
+		//If that context has been destroyed by then, the expression remains interpreted.
+		//When LLVM is not enabled, expressions are compiled to bytecode if the interpreter mode is InterpreterMode::Bytecode.
+		//Applies to expressions that are compiled after the threshold was set.
+		void setCompilationThreshold(unsigned int numExecutions);
+		unsigned int getCompilationThreshold() const;
+		TieringStatistics getTieringStatistics() const;
+		void resetTieringStatistics();
+
+		//Returns nullptr if background compilation has never been enabled.
+		BackgroundCompiler* getBackgroundCompiler() const;
+		//Blocks until all expressions that are being compiled in the background have been compiled.
+		void waitForBackgroundCompilation();
+		//Cancels background compilation of an expression, or of all expressions that are compiled using a context.
+		//If the expression is currently being compiled, this waits for it to finish.
+		static void cancelBackgroundCompilation(const void* expressionOrContext);
+
+		//Expression sharing is disabled by default. When enabled, Expression<T>, ExpressionAny and assignments that are compiled with the same expression text and
+		//expected type, using contexts with the same scope layout (see CatRuntimeContext::getScopeLayout), share their type checked AST and, if LLVM is enabled, 
+		//their native function instead of each parsing, type checking and compiling the expression. Only expressions that are compiled immediately are shared, 
+		//not expressions that are constant, compiled in a CompileSession, in the background, when hot, or with a PrecompilationContext.
+		//A compiled expression is no longer shared once a scope type, or a type that a name in the expression was looked up in, adds or removes members. 
+		//Compiled expressions are freed when the last expression that uses them is destroyed or recompiled.
+		//Shared ASTs are accounted to the context of the expression that compiled them, see getMemoryStatistics.
+		void setExpressionSharing(bool enabled);
+		bool getExpressionSharing() const;
+		ExpressionSharingStatistics getExpressionSharingStatistics() const;
+		void resetExpressionSharingStatistics();
+
+		//Sets a directory in which the object code of JIT-compiled expressions is stored. When a later run of the program compiles the same expression
+		//in the same context for the same target, the object code is loaded from the directory instead of being generated by the LLVM backend.
+		//Expressions that refer to addresses of objects, such as string literals and static members, are cached but only reused while those addresses stay the same.
+		//An empty string disables the object cache, this is the default. Has no effect when LLVM is not enabled.
+		void setObjectCacheDirectory(const std::string& directory);
+		const std::string& getObjectCacheDirectory() const;
+
+		//Writes the address, size and expression text of each function that is JIT-compiled while enabled to /tmp/perf-<pid>.map,
+		//so that the Linux perf tool can attribute samples in JIT-compiled code to expressions. CatLib functions are listed by their symbol name.
+		//Can be toggled at runtime. Disabled by default. Has no effect when LLVM is not enabled.
+		void setPerfMapEnabled(bool enabled);
+		bool getPerfMapEnabled() const;
+		//Registers code that is JIT-compiled while enabled with the GDB JIT interface, so that debuggers can show the names of JIT-compiled functions.
+		//Can be toggled at runtime. Disabled by default. Has no effect when LLVM is not enabled.
+		void setGDBJitRegistrationEnabled(bool enabled);
+		bool getGDBJitRegistrationEnabled() const;
+
+		//Profiling is disabled by default. When enabled, Expression<T>, ExpressionAny, assignments and CatLib functions that are compiled
+		//afterwards count their calls and measure the time spent in them, both when interpreted and when executed as native code.
+		//Expressions with the same text and context name share their counters. Disabling profiling does not affect expressions that are already compiled.
+		void setProfilingEnabled(bool enabled);
+		bool getProfilingEnabled() const;
+		ExpressionProfiler* getProfiler() const;
+		//Returns the profiled expressions and functions that have been called and still exist, sorted by the total time spent in them, longest first.
+		std::vector<ProfileReportEntry> getProfilingReport() const;
+		//Writes the profiling report as a table. If maxEntries is not 0, only the first maxEntries entries are written.
+		void writeProfilingReport(std::ostream& stream, std::size_t maxEntries = 0) const;
+		void resetProfilingStatistics();
+
+		//Reports the memory used by JIT-compiled code, ASTs, type infos, the string constant pool and ReflectableHandle tracking of custom objects.
+		//AST memory is also broken down per CatRuntimeContext and per CatLib, type info memory of CatLib types is reported per CatLib.
+		//Not thread safe with registering types or with CatLib::addSource on other threads.
+		MemoryStatistics getMemoryStatistics() const;
+
+		CodeGenerationStatistics getCodeGenerationStatistics() const;
+		void resetCodeGenerationStatistics();
+
 	private:
 		static void expressionEnumerationCallback(const char* name, uintptr_t address);
 		static void globalVariablesEnumerationCallback(const char* name, uintptr_t address);
@@ -98,6 +246,28 @@ namespace jitcat
 
 		bool hasPrecompiledExpressions;
 		bool discardASTAfterNativeCodeCompilation;
+		InterpreterMode interpreterMode;
+		LLVM::LLVMOptimizationLevel defaultOptimizationLevel;
+		bool backgroundCompilation;
+		unsigned int compilationThreshold;
+		std::string objectCacheDirectory;
+		bool perfMapEnabled;
+		bool gdbJitRegistrationEnabled;
+		bool profilingEnabled;
+		std::unique_ptr<ExpressionProfiler> profiler;
+		bool expressionSharing;
+		std::unique_ptr<SharedExpressionCache> sharedExpressionCache;
+		//Updated by ExpressionBase, possibly from multiple threads.
+		std::atomic<std::size_t> numDeferredExpressions;
+		std::atomic<std::size_t> numHotExpressions;
+		std::atomic<std::size_t> numColdExecutions;
+		//Updated by LLVMCodeGenerator and LLVMCodeGeneratorHelper, possibly from multiple threads.
+		std::atomic<std::size_t> numColumnFunctions;
+		std::atomic<std::size_t> numVectorizedColumnFunctions;
+		std::atomic<std::size_t> numNullChecks;
+		std::atomic<std::size_t> numElidedNullChecks;
+		//Declared last so that it is destroyed, and its thread is stopped, first.
+		std::unique_ptr<BackgroundCompiler> backgroundCompiler;
 	};
 
 } //End namespace jitcat
\ No newline at end of file
@@ -62,6 +62,9 @@ namespace jitcat::LLVM
 		extern "C" void _jc_freeMemory(unsigned char* memory);
 		extern "C" unsigned char* _jc_getObjectPointerFromHandle(const Reflection::ReflectableHandle& handle);
 		extern "C" void _jc_assignPointerToReflectableHandle(Reflection::ReflectableHandle& handle, unsigned char* reflectable, Reflection::TypeInfo* reflectableType);
+		//Used by functions that are compiled while profiling is enabled. profileRecord is the address of a ProfileRecord.
+		extern "C" uint64_t _jc_getProfileTime();
+		extern "C" void _jc_addProfiledCall(uint64_t profileRecord, uint64_t startTime);
 	};
 
 	class LLVMCatIntrinsics
@@ -15,12 +15,15 @@ namespace jitcat
 	{
 		class CustomTypeInfo;
 		struct MemberFunctionInfo;
+		struct TypeMemberInfo;
 	}
 }
 #include "jitcat/CatASTNodesDeclares.h"
 #include "jitcat/LLVMForwardDeclares.h"
 #include "jitcat/CatScopeID.h"
+#include "jitcat/LLVMCompileOptions.h"
 
+#include <functional>
 #include <memory>
 #include <set>
 #include <string>
@@ -55,14 +58,46 @@ namespace jitcat::LLVM
 		llvm::Function* generateExpressionFunction(const AST::CatTypedExpression* expression, LLVMCompileTimeContext* context, const std::string& name, bool generateThisCall);
 
 		llvm::Function* generateExpressionAssignFunction(const AST::CatAssignableExpression* expression, LLVMCompileTimeContext* context, const std::string& name);
+
+		//Wraps an expression into a function that loops over an array of objects and stores the expression's value for each object in a results array.
+		//The function has four parameters: the CatRuntimeContext, an array of object pointers, the number of objects and a pointer to the results array.
+		//Inside the loop, the scope batchScopeId refers to the current object. The expression must be of a basic type that is not a string.
+		llvm::Function* generateExpressionBatchFunction(const AST::CatTypedExpression* expression, CatScopeID batchScopeId, LLVMCompileTimeContext* context, const std::string& name);
+
+		//Wraps an expression into a function that loops over rows of column data (see ColumnBinding) and stores the expression's value for each row in a results array.
+		//The function has five parameters: the CatRuntimeContext, an array of column data pointers, an array of column strides in bytes,
+		//the number of rows and a pointer to the results array. The columns are passed in the order of columnMembers.
+		//Members of the scope columnScopeId are loaded from the columns. The loop is optimized using the loop and SLP vectorizers.
+		//Sin and Cos are not widened to vector math functions, so whether a loop that calls them is vectorized is up to the cost model of the target.
+		llvm::Function* generateExpressionColumnFunction(const AST::CatTypedExpression* expression, CatScopeID columnScopeId, 
+														 const std::vector<const Reflection::TypeMemberInfo*>& columnMembers, 
+														 LLVMCompileTimeContext* context, const std::string& name);
 	
 		//Generates a function that returns the value of the expression.
 		intptr_t generateAndGetFunctionAddress(const AST::CatTypedExpression* expression, const std::string& expressionStr, 
 											   const CatGenericType& expectedType, LLVMCompileTimeContext* context, bool generateThisCall);
 
+		//Generates a function that evaluates the expression for each object in an array, see generateExpressionBatchFunction.
+		intptr_t generateAndGetBatchFunctionAddress(const AST::CatTypedExpression* expression, const std::string& expressionStr, 
+													const CatGenericType& expectedType, CatScopeID batchScopeId, LLVMCompileTimeContext* context);
+
+		//Generates a function that evaluates the expression for each row of column data, see generateExpressionColumnFunction.
+		intptr_t generateAndGetColumnFunctionAddress(const AST::CatTypedExpression* expression, const std::string& expressionStr, const CatGenericType& expectedType, 
+													 CatScopeID columnScopeId, const std::vector<const Reflection::TypeMemberInfo*>& columnMembers, 
+													 LLVMCompileTimeContext* context);
+
 		//Generates a function that takes a parameter that will be assigned to the result of the expression. Expression must be of an assignable type (lValue).
 		intptr_t generateAndGetAssignFunctionAddress(const jitcat::AST::CatAssignableExpression* expression, const std::string& expressionStr, const CatGenericType& expectedType, LLVMCompileTimeContext* context);
 
+		//A compile session generates the functions of many expressions into a single module, which is then compiled and linked once.
+		//No other functions should be generated by this code generator between beginSession and finalizeSession. See CompileSession.
+		void beginSession(LLVMCompileTimeContext* context);
+		//Generates the same function as generateAndGetFunctionAddress into the session module.
+		void addToSession(const AST::CatTypedExpression* expression, const std::string& expressionStr, const CatGenericType& expectedType, 
+						  LLVMCompileTimeContext* context, bool generateThisCall);
+		//Links the session module and returns the function addresses in the order in which the expressions were added.
+		std::vector<intptr_t> finalizeSession();
+
 		void emitModuleToObjectFile(const std::string& objectFileName);
 
 		//Generates a function that takes a callback to a function that will be called with the name and address of every symbol in the set.
@@ -77,6 +112,9 @@ namespace jitcat::LLVM
 		//Generates a function that returns an int with the jitcat ABI version from Configuration.h
 		llvm::Function* generateJitCatABIVersionFunction();
 
+		//The memory manager that holds the code and data sections of all code generators.
+		static LLVMMemoryManager* getMemoryManager();
+
 	private:
 		llvm::Value* generate(const AST::CatBuiltInFunctionCall* functionCall, LLVMCompileTimeContext* context);
 		llvm::Value* generate(const AST::CatIndirectionConversion* indirectionConversion, LLVMCompileTimeContext* context);
@@ -119,8 +157,20 @@ namespace jitcat::LLVM
 
 		void initContext(LLVMCompileTimeContext* context);
 		void createNewModule(LLVMCompileTimeContext* context);
+		//Creates the void function of a batch or column function with the given parameter types, and sets the attributes that they share.
+		llvm::Function* createLoopFunction(const std::string& name, const std::vector<llvm::Type*>& parameters);
+		//Returns the address of the batch or column function functionName. If it does not exist yet, it is generated into a new module by 
+		//generateFunction, which is then compiled. Returns 0 if generateFunction returns nullptr.
+		intptr_t getOrGenerateLoopFunctionAddress(const std::string& functionName, const std::string& description, LLVMCompileTimeContext* context, 
+												  const std::function<llvm::Function*()>& generateFunction);
+		//Runs the module passes of the optimization level of the current module. Should be called after all functions have been generated.
+		void runModuleOptimisationPasses();
+		//Gives the current module a key in the object cache, unless its code contains addresses of objects in the current process.
+		void setModuleCacheKey(const std::string& keySource);
 		
 		llvm::Function* verifyAndOptimizeFunction(llvm::Function* function);
+		//Same as verifyAndOptimizeFunction, but also runs the loop and SLP vectorizers.
+		llvm::Function* verifyAndVectorizeFunction(llvm::Function* function);
 
 		uint64_t getSymbolAddress(const std::string& name, llvm::orc::JITDylib& dyLib) const;
 
@@ -136,7 +186,7 @@ namespace jitcat::LLVM
 
 		llvm::Value* booleanCast(llvm::Value* boolean);
 
-		static void createOptimisationPasses(llvm::legacy::FunctionPassManager* passManager);
+		static void createOptimisationPasses(llvm::legacy::FunctionPassManager* passManager, LLVMOptimizationLevel optimizationLevel);
 
 	private:
 		const LLVMTargetConfig* targetConfig;
@@ -144,9 +194,16 @@ namespace jitcat::LLVM
 		std::unique_ptr<llvm::orc::ExecutionSession> executionSession;
 		//A module represents a "translation unit".
 		std::unique_ptr<llvm::Module> currentModule;
+		//The names of the functions that were added to the current session, see beginSession.
+		std::vector<std::string> sessionFunctionNames;
+		//The subset of sessionFunctionNames that was generated into currentModule rather than found in the dylib.
+		std::set<std::string> sessionGeneratedFunctions;
 		//
 		llvm::orc::JITDylib* dylib;
 		std::set<const llvm::orc::JITDylib*> linkedLibs;
+		//Calls to inline function bodies in the function that is being generated. They are inlined by verifyAndOptimizeFunction.
+		//They are cleared when a function or module is started, so that calls left behind by a failed generation are never inlined.
+		std::vector<llvm::CallInst*> callsToInline;
 
 		std::unique_ptr<llvm::IRBuilder<llvm::ConstantFolder, llvm::IRBuilderDefaultInserter>> builder;
 		//Can be used to add object files to the JIT.
@@ -156,6 +213,11 @@ namespace jitcat::LLVM
 		//Takes an LLVM IR module and creates an object file that is linked into the JIT using the objectLinkLayer
 		std::unique_ptr<llvm::orc::IRCompileLayer> compileLayer;
 		std::unique_ptr<llvm::legacy::FunctionPassManager> passManager;
+		//The optimization level of currentModule and passManager.
+		LLVMOptimizationLevel currentModuleOptimizationLevel;
+		//Set when code that contains the address of an object in the current process, such as a static scope or a string literal, 
+		//is generated into currentModule. Such a module can not be stored in the object cache.
+		bool currentModuleEmbedsAddresses;
 		std::unique_ptr<LLVMCodeGeneratorHelper> helper;
 		//The runtime library dylib
 		llvm::orc::JITDylib* runtimeLibraryDyLib;
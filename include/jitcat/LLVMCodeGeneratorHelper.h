@@ -125,6 +125,12 @@ namespace jitcat::LLVM
 		llvm::Value* createAdd(llvm::Value* value1, llvm::Constant* value2, const std::string& name);
 
 		llvm::Value* createOffsetGlobalValue(LLVMCompileTimeContext* context, const std::string& globalName, std::uintptr_t value);
+		//Returns a pointer to the member at offset from objectPointer. When JIT compiling, the offset is an immediate and the address is an inbounds GEP,
+		//so that LLVM can fold a chain of member accesses into a single address calculation. When precompiling, the offset is loaded from offsetGlobalName.
+		llvm::Value* createMemberAddress(LLVMCompileTimeContext* context, llvm::Value* objectPointer, const std::string& offsetGlobalName, std::uintptr_t offset, const std::string& name);
+		//Same as createMemberAddress, but returns a null pointer if objectPointer is null and dereference null checks are enabled.
+		//Uses a select instead of a branch because computing the address has no side effects.
+		llvm::Value* createEmbeddedMemberAddress(LLVMCompileTimeContext* context, llvm::Value* objectPointer, const std::string& offsetGlobalName, std::uintptr_t offset, const std::string& name);
 		llvm::Value* createTypeInfoGlobalValue(LLVMCompileTimeContext* context, Reflection::TypeInfo* typeInfo);
 
 		llvm::Constant* createZeroInitialisedConstant(llvm::Type* type);
@@ -180,6 +186,9 @@ namespace jitcat::LLVM
 											    const std::vector<const jitcat::AST::CatTypedExpression*>& arguments, 
 												const std::vector<int>& argumentsToCheckForNull,
 												LLVMCompileTimeContext* context);
+		//Calls the inline body of a member function, see MemberFunctionInfo::setInlineBody. The call is inlined when the current function is optimized.
+		//arguments starts with the this pointer. Returns nullptr, without generating any code, if the body can not be used.
+		llvm::Value* generateInlinedMemberFunctionCall(const jitcat::Reflection::MemberFunctionInfo* memberFunction, const std::vector<llvm::Value*>& arguments, LLVMCompileTimeContext* context);
 
 		//Generates a simple loop
 		void generateLoop(LLVMCompileTimeContext* context,
@@ -192,6 +201,8 @@ namespace jitcat::LLVM
 		void defineWeakSymbol(LLVMCompileTimeContext* context, intptr_t functionAddress, const std::string& mangledFunctionName, bool isDirectlyLinked);
 
 	private:
+		//Parses the inline body of a member function and links it into the current module. Returns the existing definition if it was already linked.
+		llvm::Function* linkInlineFunctionBody(const jitcat::Reflection::MemberFunctionInfo* memberFunction);
 		llvm::Value* convertIndirection(llvm::Value* value, llvm::Type* expectedType);
 		llvm::Value* copyConstructIfValueType(llvm::Value* value, const CatGenericType& type, LLVMCompileTimeContext* context, const std::string& valueName);
 		llvm::Value* generateIntrinsicCall(jitcat::Reflection::StaticFunctionInfo* functionInfo, std::vector<llvm::Value*>& arguments, LLVMCompileTimeContext* context, bool isDirectlyLinked);
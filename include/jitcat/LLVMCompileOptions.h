@@ -9,12 +9,35 @@
 
 namespace jitcat::LLVM
 {
+	//Selects the optimization passes that are run on generated code.
+	//Higher levels produce faster code at the cost of compile time.
+	enum class LLVMOptimizationLevel
+	{
+		//Only promotes stack variables to registers.
+		O0,
+		//Instruction combining, reassociation, GVN and CFG simplification on each function. This is the default.
+		O1,
+		//Also runs the standard module pipeline, which includes inlining, LICM, loop unrolling and loop and SLP vectorization.
+		O2,
+		//Same as O2 with a more aggressive inlining threshold.
+		O3
+	};
+
 
 	struct LLVMCompileOptions
 	{
-		LLVMCompileOptions(): enableDereferenceNullChecks(false) 
+		LLVMCompileOptions(): enableDereferenceNullChecks(false), optimizationLevel(LLVMOptimizationLevel::O1)
 		{}
+		//Expressions only share compiled code if their options are equal, see SharedExpressionCache. New options must be compared here.
+		bool operator==(const LLVMCompileOptions& other) const
+		{
+			return enableDereferenceNullChecks == other.enableDereferenceNullChecks
+				   && optimizationLevel == other.optimizationLevel;
+		}
 		bool enableDereferenceNullChecks;
+		//Initialized from JitCat::getDefaultOptimizationLevel by LLVMCompileTimeContext.
+		//Can be overridden per expression (ExpressionBase::setOptimizationLevel) and per CatLib (CatLib::setOptimizationLevel).
+		LLVMOptimizationLevel optimizationLevel;
 	};
 
 } //End namespace jitcat::LLVM
\ No newline at end of file
@@ -17,6 +17,10 @@ namespace jitcat
 		class CatFunctionDefinition;
 		class CatScopeBlock;
 	}
+	namespace Reflection
+	{
+		struct TypeMemberInfo;
+	}
 }
 #include "jitcat/CatScopeID.h"
 #include "jitcat/LLVMCompileOptions.h"
@@ -24,6 +28,7 @@ namespace jitcat
 
 #include <functional>
 #include <map>
+#include <set>
 #include <vector>
 
 
@@ -41,6 +46,13 @@ namespace jitcat::LLVM
 
 		void clearState();
 
+		//Returns true if value is known to be non-null at the current insert point, so that a null check on value can be omitted.
+		//Non-null constants, loads with non-null metadata and values passed to markNonNull are known to be non-null. Casts are looked through.
+		bool isKnownNonNull(const llvm::Value* value) const;
+		//The value must be non-null wherever it can be used. Code that marks values that are only non-null in part of a function, 
+		//like the not-null branch of a null check, saves nonNullValues before generating that part and restores it afterwards.
+		void markNonNull(const llvm::Value* value);
+
 		CatLib* currentLib;
 
 		const LLVMTargetConfig* targetConfig;
@@ -48,6 +60,8 @@ namespace jitcat::LLVM
 		const AST::CatScopeBlock* currentScope;
 		const AST::CatFunctionDefinition* currentFunctionDefinition;
 		llvm::Function* currentFunction;
+		//The time at which a call to a profiled function started, see CatFunctionDefinition::getProfileRecord. Otherwise nullptr.
+		llvm::Value* profileStartTime;
 
 		LLVMCodeGeneratorHelper* helper;
 		std::vector<std::function<llvm::Value*()>> blockDestructorGenerators;
@@ -55,6 +69,13 @@ namespace jitcat::LLVM
 		LLVMCompileOptions options;
 
 		std::map<CatScopeID, llvm::Value*> scopeValues;
+		//Values that have been proven non-null, see isKnownNonNull.
+		std::set<const llvm::Value*> nonNullValues;
+
+		//Only used when generating a column function, see LLVMCodeGenerator::generateExpressionColumnFunction.
+		//Members of the scope columnScopeId are not loaded from an object, but from columnValues.
+		CatScopeID columnScopeId;
+		std::map<const Reflection::TypeMemberInfo*, llvm::Value*> columnValues;
 	};
 
 } //End namespace jitcat::LLVM
\ No newline at end of file
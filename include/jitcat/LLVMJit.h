@@ -49,7 +49,9 @@ namespace jitcat::LLVM
 {
 	class LLVMCodeGenerator;
 	class LLVMJit;
+	class LLVMObjectCache;
 	class LLVMPrecompilationContext;
+	class LLVMProfilerSupport;
 	class LLVMTargetConfig;
 
 	class LLVMJitInitializer
@@ -78,6 +80,12 @@ namespace jitcat::LLVM
 
 		const LLVMTargetConfig* getJitTargetConfig() const;
 
+		//Shared by all code generators. Disabled unless a directory has been set, see JitCat::setObjectCacheDirectory.
+		LLVMObjectCache* getObjectCache() const;
+
+		//Shared by all code generators. Reports JIT-compiled code to profilers and debuggers, see JitCat::setPerfMapEnabled.
+		LLVMProfilerSupport* getProfilerSupport() const;
+
 		void cleanup();
 
 	private:
@@ -95,6 +103,10 @@ namespace jitcat::LLVM
 
 		//A string pool that is shared among executionSessions. It stores symbol names.
 		std::shared_ptr<llvm::orc::SymbolStringPool> symbolStringPool;
+
+		std::unique_ptr<LLVMObjectCache> objectCache;
+
+		std::unique_ptr<LLVMProfilerSupport> profilerSupport;
 	};
 
 
@@ -10,6 +10,7 @@
 #include <llvm/ExecutionEngine/RTDyldMemoryManager.h>
 #include <llvm/Support/Memory.h>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 
@@ -111,6 +112,7 @@ namespace jitcat::LLVM
 	};
 
 
+	//All public functions of the memory manager lock an internal mutex so that it can be shared between code generators on different threads.
 	class LLVMMemoryManager
 	{
 	public:
@@ -135,6 +137,10 @@ namespace jitcat::LLVM
 		std::size_t getAllocatedCodeMemory();
 		//Get the total size of all reserved memory blocks. This will always be greater or equal to the allocated code memory.
 		std::size_t getReservedCodeMemory();
+		//Get the total size of all data sections
+		std::size_t getAllocatedDataMemory();
+		//Get the total size of all reserved data memory blocks.
+		std::size_t getReservedDataMemory();
 
 	private:
 		static void updateBlockPermissions(SectionMemoryBlock* block);
@@ -152,6 +158,8 @@ namespace jitcat::LLVM
 		//A map of freed data section allocations that allows for re-use.
 		std::map<std::size_t, std::multimap<std::size_t, SectionMemoryAllocation*>> freedDataSectionAllocations;
 
+		std::mutex mutex;
+
 		//The maximum difference in size between an allocation request and a re-used SectionMemoryAllocation.
 		static const int maxReAllocationSizeDifference;
 	};
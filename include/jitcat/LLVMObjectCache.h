@@ -0,0 +1,67 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include "jitcat/LLVMCompileOptions.h"
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <memory>
+#include <mutex>
+#include <string>
+
+
+namespace jitcat::LLVM
+{
+	class LLVMTargetConfig;
+
+	//Stores the object code of JIT-compiled expressions in a directory, so that later runs of the program
+	//can load the object code instead of running the LLVM backend again. See JitCat::setObjectCacheDirectory.
+	//Only modules that were given a cache key by setCacheKey are cached.
+	class LLVMObjectCache: public llvm::ObjectCache
+	{
+	public:
+		LLVMObjectCache();
+		LLVMObjectCache(const LLVMObjectCache&) = delete;
+		void operator=(const LLVMObjectCache&) = delete;
+		virtual ~LLVMObjectCache() override;
+
+		//An empty directory disables the cache.
+		void setDirectory(const std::string& directory);
+		std::string getDirectory() const;
+
+		//Gives a module that has been generated and optimized a cache key.
+		//keySource should identify the functions in the module. For expressions, the unique expression function names are used,
+		//which combine the expression text, the expected type and the context hash.
+		//The key also includes the optimization level, the target, the JitCat ABI version and a hash of the module IR, so that a cached object is never
+		//used if the generated code is different, for example because a member offset has changed.
+		//Only modules that contain no addresses of objects in the current process, such as static scopes, string literals or
+		//type infos, should be given a key. Those addresses change from run to run, so their objects would never be loaded again.
+		//A cache hit skips the LLVM backend. The IR is still generated and optimized, which also defines the symbols that the object links against.
+		//Does nothing if the cache is disabled.
+		void setCacheKey(llvm::Module* module, const std::string& keySource, LLVMOptimizationLevel optimizationLevel, const LLVMTargetConfig* targetConfig) const;
+
+		std::size_t getNumLoadedObjects() const;
+		std::size_t getNumStoredObjects() const;
+
+		//llvm::ObjectCache
+		virtual void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef object) override final;
+		virtual std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override final;
+
+	private:
+		//Returns an empty string if the module has no cache key.
+		std::string getObjectFilePath(const llvm::Module* module) const;
+
+	private:
+		std::string directory;
+		std::size_t numLoadedObjects;
+		std::size_t numStoredObjects;
+		mutable std::mutex mutex;
+	};
+
+} //End namespace jitcat::LLVM
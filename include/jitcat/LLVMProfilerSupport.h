@@ -0,0 +1,64 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include <llvm/ExecutionEngine/JITEventListener.h>
+#include <llvm/ExecutionEngine/Orc/Core.h>
+#include <llvm/ExecutionEngine/RuntimeDyld.h>
+#include <llvm/Object/ObjectFile.h>
+
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+
+namespace jitcat::LLVM
+{
+	//Makes JIT-compiled code visible to profilers and debuggers. See JitCat::setPerfMapEnabled and JitCat::setGDBJitRegistrationEnabled.
+	//When the perf map is enabled, the address, size and a description of each JIT-compiled function are appended to /tmp/perf-<pid>.map,
+	//which is read by the Linux perf tool. The description of an expression function is the expression text. 
+	//Functions without a description, such as CatLib functions, are listed by their symbol name.
+	//When GDB registration is enabled, loaded objects are registered with the GDB JIT interface, which is also used by other debuggers.
+	//Only objects that are loaded while a setting is enabled are reported.
+	class LLVMProfilerSupport
+	{
+	public:
+		LLVMProfilerSupport();
+		LLVMProfilerSupport(const LLVMProfilerSupport&) = delete;
+		void operator=(const LLVMProfilerSupport&) = delete;
+		~LLVMProfilerSupport();
+
+		void setPerfMapEnabled(bool enabled);
+		bool getPerfMapEnabled() const;
+
+		void setGDBRegistrationEnabled(bool enabled);
+		bool getGDBRegistrationEnabled() const;
+
+		//Sets the description of a function that is about to be compiled. Does nothing if the perf map is disabled.
+		void setFunctionDescription(const std::string& functionName, const std::string& description);
+
+		//Called by the object linking layer of a code generator after an object has been loaded into memory.
+		void notifyObjectLoaded(llvm::orc::VModuleKey key, const llvm::object::ObjectFile& object, const llvm::RuntimeDyld::LoadedObjectInfo& loadedObjectInfo);
+
+	private:
+		void writePerfMapEntries(const llvm::object::ObjectFile& debugObject);
+
+	private:
+		bool perfMapEnabled;
+		bool gdbRegistrationEnabled;
+		//Opened when the first entry is written.
+		FILE* perfMapFile;
+		//Descriptions of functions that have not been loaded yet, by symbol name.
+		std::unordered_map<std::string, std::string> functionDescriptions;
+		//Owned by LLVM.
+		llvm::JITEventListener* gdbListener;
+		mutable std::mutex mutex;
+	};
+
+} //End namespace jitcat::LLVM
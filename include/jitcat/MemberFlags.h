@@ -18,7 +18,10 @@ namespace jitcat::Reflection
 		none = 0,
 		isConst = 1,
 		isStaticConst = 2,
-		isWritable = 4
+		isWritable = 4,
+		//The member is a pointer that is never null. When JIT compiling, members of the object it points to are accessed without a null check
+		//if the object that contains this member is also known to be non-null. Only use this for members that are guaranteed to be set.
+		isTrustedNonNull = 8
 	};
 	typedef MemberFlags MF;
 
@@ -9,6 +9,7 @@
 
 #include "jitcat/BuildIndicesHelper.h"
 #include "jitcat/CatGenericType.h"
+#include "jitcat/CatValue.h"
 #include "jitcat/FunctionSignature.h"
 #include "jitcat/LLVMForwardDeclares.h"
 #include "jitcat/MemberVisibility.h"
@@ -89,6 +90,12 @@ namespace jitcat::Reflection
 
 
 		inline virtual std::any call(CatRuntimeContext* runtimeContext, std::any& base, const std::vector<std::any>& parameters) const { return std::any(); }
+		//Returns true if the function can be called through callValue. This is the case for reflected member functions 
+		//whose arguments are scalars and whose return type is a scalar or a pointer. (See CatValue.h)
+		inline virtual bool canCallWithValues() const {return false;}
+		//Calls the function without boxing the base, the arguments and the result in a std::any. Must only be called if canCallWithValues returns true.
+		//base is a raw pointer to the object, parameters points to one value for each argument type.
+		inline virtual CatValue callValue(CatRuntimeContext* runtimeContext, uintptr_t base, const CatValue* parameters) const {return CatValue();}
 		virtual std::size_t getNumberOfArguments() const { return argumentTypes.size(); }
 		inline virtual MemberFunctionCallData getFunctionAddress(FunctionType functionType) const {return MemberFunctionCallData();}
 		inline virtual bool isDeferredFunctionCall() {return false;}
@@ -104,6 +111,28 @@ namespace jitcat::Reflection
 
 		void addParameterType(const CatGenericType& type);
 
+		//Registers a definition of this function as LLVM IR, either as text or as bitcode, so that calls to it can be inlined into JIT-compiled code.
+		//The body would typically be generated at build time by compiling a small wrapper with clang -emit-llvm.
+		//functionName is the name of the function in the IR. Its first parameter is the object pointer, followed by the function arguments.
+		//Argument and return types must match the LLVM types that JitCat uses for the function, except that pointer types may differ.
+		//The body should be self-contained. If it can not be used, the function is called as usual.
+		void setInlineBody(const std::string& llvmIROrBitcode, const std::string& functionName);
+		bool hasInlineBody() const;
+		const std::string& getInlineBody() const;
+		const std::string& getInlineBodyFunctionName() const;
+
+		//The maximum number of arguments of a function that is called through callValue.
+		static constexpr std::size_t maxValueCallArguments = 8;
+
+	protected:
+		//Returns true if a reflected function with these return and argument types can be called through callValue.
+		template<typename ReturnT, typename ... TFunctionArguments>
+		static constexpr bool supportsValueCall()
+		{
+			return (CatValue::isInlineBasicType<ReturnT>() || (std::is_pointer<ReturnT>::value && std::is_class<typename std::remove_pointer<ReturnT>::type>::value))
+				   && (CatValue::isInlineBasicType<TFunctionArguments>() && ...)
+				   && sizeof...(TFunctionArguments) <= maxValueCallArguments;
+		}
 
 	protected:
 		const std::string memberFunctionName;
@@ -111,6 +140,9 @@ namespace jitcat::Reflection
 		CatGenericType returnType;
 		MemberVisibility visibility;
 
+		std::string inlineBody;
+		std::string inlineBodyFunctionName;
+
 		std::vector<CatGenericType> argumentTypes;
 	};
 
@@ -147,6 +179,12 @@ namespace jitcat::Reflection
 		template<std::size_t... Is>
 		inline std::any callWithIndexed(const std::vector<std::any>& parameters, std::any& base, Indices<Is...>) const;
 
+		inline virtual bool canCallWithValues() const override final;
+		inline virtual CatValue callValue(CatRuntimeContext* runtimeContext, uintptr_t base, const CatValue* parameters) const override final;
+
+		template<std::size_t... Is>
+		inline CatValue callValueWithIndexed(const CatValue* parameters, ClassT* baseObject, Indices<Is...>) const;
+
 		inline virtual std::size_t getNumberOfArguments() const override final;
 		static inline ReturnT staticExecute(ClassT* base, MemberFunctionInfoWithArgs<ClassT, ReturnT, TFunctionArguments...>* functionInfo, TFunctionArguments... args);
 		inline virtual MemberFunctionCallData getFunctionAddress(FunctionType functionType) const override final;
@@ -167,6 +205,12 @@ namespace jitcat::Reflection
 		template<std::size_t... Is>
 		inline std::any callWithIndexed(const std::vector<std::any>& parameters, std::any& base, Indices<Is...>) const;
 
+		inline virtual bool canCallWithValues() const override final;
+		inline virtual CatValue callValue(CatRuntimeContext* runtimeContext, uintptr_t base, const CatValue* parameters) const override final;
+
+		template<std::size_t... Is>
+		inline CatValue callValueWithIndexed(const CatValue* parameters, ClassT* baseObject, Indices<Is...>) const;
+
 		inline virtual std::size_t getNumberOfArguments() const override final;
 		static inline ReturnT staticExecute(ClassT* base, ConstMemberFunctionInfoWithArgs<ClassT, ReturnT, TFunctionArguments...>* functionInfo, TFunctionArguments... args);
 		inline virtual MemberFunctionCallData getFunctionAddress(FunctionType functionType) const override final;
@@ -188,6 +232,12 @@ namespace jitcat::Reflection
 		template<std::size_t... Is>
 		inline std::any callWithIndexed(const std::vector<std::any>& parameters, std::any& base, Indices<Is...>) const;
 
+		inline virtual bool canCallWithValues() const override final;
+		inline virtual CatValue callValue(CatRuntimeContext* runtimeContext, uintptr_t base, const CatValue* parameters) const override final;
+
+		template<std::size_t... Is>
+		inline CatValue callValueWithIndexed(const CatValue* parameters, ClassT* baseObject, Indices<Is...>) const;
+
 		virtual inline std::size_t getNumberOfArguments() const override final;
 		static inline ReturnT staticExecute(ClassT* base, PseudoMemberFunctionInfoWithArgs<ClassT, ReturnT, TFunctionArguments...>* functionInfo, TFunctionArguments... args);
 		inline virtual MemberFunctionCallData getFunctionAddress(FunctionType functionType) const override final;
@@ -59,11 +59,13 @@ namespace jitcat::Reflection
 
 		inline virtual std::any getMemberReference(unsigned char* base) override final;
 		inline virtual std::any getAssignableMemberReference(unsigned char* base) override final;
+		inline virtual CatValue getMemberValue(unsigned char* base) override final;
 		unsigned long long getMemberPointerOffset() const;
 		inline virtual llvm::Value* generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const override final;
 		inline virtual llvm::Value* generateAssignCode(llvm::Value* parentObjectPointer, llvm::Value* rValue, LLVM::LLVMCompileTimeContext* context) const override final;
 
 		inline virtual unsigned long long getOrdinal() const override final;
+		inline virtual DirectMemberAccess getDirectMemberAccess(std::size_t& offset) const override final;
 	
 	private:
 		inline std::string getMemberOffsetName() const;
@@ -80,10 +82,12 @@ namespace jitcat::Reflection
 
 		inline virtual std::any getMemberReference(unsigned char* base) override final;
 		inline virtual std::any getAssignableMemberReference(unsigned char* base) override final;
+		inline virtual CatValue getMemberValue(unsigned char* base) override final;
 
 		inline virtual llvm::Value* generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const override final;
 
 		inline virtual unsigned long long getOrdinal() const override final;
+		inline virtual DirectMemberAccess getDirectMemberAccess(std::size_t& offset) const override final;
 	
 	private:
 		inline std::string getMemberOffsetName() const;
@@ -101,6 +105,7 @@ namespace jitcat::Reflection
 		static ClassT* getPointer(BaseT* parentObject, ClassUniquePtrMemberInfo<BaseT, ClassT>* info);
 		inline virtual std::any getMemberReference(unsigned char* base) override final;
 		inline virtual std::any getAssignableMemberReference(unsigned char* base) override final;
+		inline virtual CatValue getMemberValue(unsigned char* base) override final;
 		inline virtual llvm::Value* generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const override final;
 
 		inline virtual unsigned long long getOrdinal() const override final;
@@ -122,11 +127,13 @@ namespace jitcat::Reflection
 	
 		inline virtual std::any getMemberReference(unsigned char* base) override final;
 		inline virtual std::any getAssignableMemberReference(unsigned char* base) override final;
+		inline virtual CatValue getMemberValue(unsigned char* base) override final;
 
 		unsigned long long getMemberPointerOffset() const;
 		inline virtual llvm::Value* generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const override final;
 		inline virtual llvm::Value* generateAssignCode(llvm::Value* parentObjectPointer, llvm::Value* rValue, LLVM::LLVMCompileTimeContext* context) const override final;
 		inline virtual unsigned long long getOrdinal() const override final;
+		inline virtual DirectMemberAccess getDirectMemberAccess(std::size_t& offset) const override final;
 
 	private:
 		inline std::string getMemberOffsetName() const;
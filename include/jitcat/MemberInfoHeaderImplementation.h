@@ -83,6 +83,18 @@ inline std::any ClassPointerMemberInfo<BaseT, ClassT>::getAssignableMemberRefere
 }
 
 
+template<typename BaseT, typename ClassT>
+inline CatValue ClassPointerMemberInfo<BaseT, ClassT>::getMemberValue(unsigned char* base)
+{
+	BaseT* baseObject = reinterpret_cast<BaseT*>(base);
+	if (baseObject != nullptr)
+	{
+		return CatValue::fromPointer(reinterpret_cast<uintptr_t>(baseObject->*memberPointer));
+	}
+	return CatValue::fromPointer(0);
+}
+
+
 template<typename BaseT, typename ClassT>
 inline unsigned long long ClassPointerMemberInfo<BaseT, ClassT>::getMemberPointerOffset() const
 {
@@ -97,9 +109,7 @@ inline llvm::Value* ClassPointerMemberInfo<BaseT, ClassT>::generateDereferenceCo
 	unsigned long long offset = getMemberPointerOffset();
 	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
 	{
-		llvm::Value* memberOffset = context->helper->createOffsetGlobalValue(context, getMemberOffsetName(), offset);
-		llvm::Value* parentObjectPointerInt = context->helper->convertToIntPtr(parentObjectPointer, memberName + "_Parent_IntPtr");
-		llvm::Value* addressValue = context->helper->createAdd(parentObjectPointerInt, memberOffset, memberName + "_IntPtr");
+		llvm::Value* addressValue = context->helper->createMemberAddress(context, parentObjectPointer, getMemberOffsetName(), offset, memberName + "_Address");
 		return context->helper->loadPointerAtAddress(addressValue, memberName);
 	};
 	return context->helper->createOptionalNullCheckSelect(parentObjectPointer, notNullCodeGen, context->targetConfig->getLLVMTypes().pointerType, context);
@@ -116,10 +126,8 @@ inline llvm::Value* ClassPointerMemberInfo<BaseT, ClassT>::generateAssignCode(ll
 	unsigned long long offset = getMemberPointerOffset();
 	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
 	{
-		llvm::Value* memberOffset = context->helper->createOffsetGlobalValue(context, getMemberOffsetName(), offset);
-		llvm::Value* parentObjectPointerInt = context->helper->convertToIntPtr(parentObjectPointer, memberName + "_Parent_IntPtr");
-		llvm::Value* addressIntValue = context->helper->createAdd(parentObjectPointerInt, memberOffset, memberName + "_IntPtr");
-		llvm::Value* addressValue = context->helper->convertToPointer(addressIntValue, memberName + "_Ptr", context->helper->toLLVMPtrType(catType));
+		llvm::Value* memberAddress = context->helper->createMemberAddress(context, parentObjectPointer, getMemberOffsetName(), offset, memberName + "_Address");
+		llvm::Value* addressValue = context->helper->convertToPointer(memberAddress, memberName + "_Ptr", context->helper->toLLVMPtrType(catType));
 		context->helper->writeToPointer(addressValue, rValue);
 		return rValue;
 	};
@@ -137,6 +145,14 @@ inline unsigned long long ClassPointerMemberInfo<BaseT, ClassT>::getOrdinal() co
 }
 
 
+template<typename BaseT, typename ClassT>
+inline DirectMemberAccess ClassPointerMemberInfo<BaseT, ClassT>::getDirectMemberAccess(std::size_t& offset) const
+{
+	offset = (std::size_t)getMemberPointerOffset();
+	return DirectMemberAccess::Value;
+}
+
+
 template<typename BaseT, typename ClassT>
 inline std::string ClassPointerMemberInfo<BaseT, ClassT>::getMemberOffsetName() const
 {
@@ -177,19 +193,25 @@ inline std::any ClassObjectMemberInfo<BaseT, ClassT>::getAssignableMemberReferen
 }
 
 
+template<typename BaseT, typename ClassT>
+inline CatValue ClassObjectMemberInfo<BaseT, ClassT>::getMemberValue(unsigned char* base)
+{
+	BaseT* baseObject = reinterpret_cast<BaseT*>(base);
+	if (baseObject != nullptr)
+	{
+		return CatValue::fromPointer(reinterpret_cast<uintptr_t>(&(baseObject->*memberPointer)));
+	}
+	return CatValue::fromPointer(0);
+}
+
+
 template<typename BaseT, typename ClassT>
 inline llvm::Value* ClassObjectMemberInfo<BaseT, ClassT>::generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const
 {
 #ifdef ENABLE_LLVM
 	unsigned long long offset = getOffset(memberPointer);
-	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
-	{
-		llvm::Value* memberOffset = context->helper->createOffsetGlobalValue(context, getMemberOffsetName(), offset);
-		llvm::Value* parentObjectPointerInt = context->helper->convertToIntPtr(parentObjectPointer, memberName + "_Parent_IntPtr");
-		llvm::Value* addressValue = context->helper->createAdd(parentObjectPointerInt, memberOffset, memberName + "_Ptr");
-		return context->helper->convertToPointer(addressValue, memberName);
-	};
-	return context->helper->createOptionalNullCheckSelect(parentObjectPointer, notNullCodeGen, context->targetConfig->getLLVMTypes().pointerType, context);
+	//The member is embedded in the parent, so there is no load and nested object members fold into a single address calculation.
+	return context->helper->createEmbeddedMemberAddress(context, parentObjectPointer, getMemberOffsetName(), offset, memberName);
 #else 
 	return nullptr;
 #endif // ENABLE_LLVM
@@ -202,6 +224,14 @@ inline unsigned long long ClassObjectMemberInfo<BaseT, ClassT>::getOrdinal() con
 }
 
 
+template<typename BaseT, typename ClassT>
+inline DirectMemberAccess ClassObjectMemberInfo<BaseT, ClassT>::getDirectMemberAccess(std::size_t& offset) const
+{
+	offset = (std::size_t)getOffset(memberPointer);
+	return DirectMemberAccess::Address;
+}
+
+
 template<typename BaseT, typename ClassT>
 inline std::string ClassObjectMemberInfo<BaseT, ClassT>::getMemberOffsetName() const
 {
@@ -253,6 +283,18 @@ inline std::any ClassUniquePtrMemberInfo<BaseT, ClassT>::getAssignableMemberRefe
 }
 
 
+template<typename BaseT, typename ClassT>
+inline CatValue ClassUniquePtrMemberInfo<BaseT, ClassT>::getMemberValue(unsigned char* base)
+{
+	BaseT* baseObject = reinterpret_cast<BaseT*>(base);
+	if (baseObject != nullptr)
+	{
+		return CatValue::fromPointer(reinterpret_cast<uintptr_t>((baseObject->*memberPointer).get()));
+	}
+	return CatValue::fromPointer(0);
+}
+
+
 template<typename BaseT, typename ClassT>
 inline llvm::Value* ClassUniquePtrMemberInfo<BaseT, ClassT>::generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const
 {
@@ -344,6 +386,25 @@ inline std::any BasicTypeMemberInfo<BaseT, BasicT>::getAssignableMemberReference
 }
 
 
+template<typename BaseT, typename BasicT>
+inline CatValue BasicTypeMemberInfo<BaseT, BasicT>::getMemberValue(unsigned char* base)
+{
+	if constexpr (CatValue::isInlineBasicType<BasicT>())
+	{
+		BaseT* objectPointer = reinterpret_cast<BaseT*>(base);
+		if (objectPointer != nullptr)
+		{
+			return CatValue(objectPointer->*memberPointer);
+		}
+		return CatValue(BasicT());
+	}
+	else
+	{
+		return CatValue::fromAny(getMemberReference(base), catType);
+	}
+}
+
+
 template<typename BaseT, typename BasicT>
 inline unsigned long long BasicTypeMemberInfo<BaseT, BasicT>::getMemberPointerOffset() const
 {
@@ -358,9 +419,7 @@ inline llvm::Value* BasicTypeMemberInfo<BaseT, BasicT>::generateDereferenceCode(
 	unsigned long long offset = getMemberPointerOffset();
 	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
 	{	
-		llvm::Value* memberOffset = context->helper->createOffsetGlobalValue(context, getMemberOffsetName(), offset);
-		llvm::Value* parentObjectPointerInt = context->helper->convertToIntPtr(parentObjectPointer, memberName + "_Parent_IntPtr");
-		llvm::Value* addressValue = context->helper->createAdd(parentObjectPointerInt, memberOffset, memberName + "_IntPtr");
+		llvm::Value* addressValue = context->helper->createMemberAddress(context, parentObjectPointer, getMemberOffsetName(), offset, memberName + "_Address");
 		return context->helper->loadBasicType(context->helper->toLLVMType(catType), addressValue, memberName);
 	};
 	return context->helper->createOptionalNullCheckSelect(parentObjectPointer, notNullCodeGen, context->helper->toLLVMType(catType), context);
@@ -377,10 +436,8 @@ inline llvm::Value* BasicTypeMemberInfo<BaseT, BasicT>::generateAssignCode(llvm:
 	unsigned long long offset = getMemberPointerOffset();
 	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
 	{	
-		llvm::Value* memberOffset = context->helper->createOffsetGlobalValue(context, getMemberOffsetName(), offset);
-		llvm::Value* parentObjectPointerInt = context->helper->convertToIntPtr(parentObjectPointer, memberName + "_Parent_IntPtr");
-		llvm::Value* addressIntValue = context->helper->createAdd(parentObjectPointerInt, memberOffset, memberName + "_IntPtr");
-		llvm::Value* addressValue = context->helper->convertToPointer(addressIntValue, memberName + "_Ptr", context->helper->toLLVMPtrType(catType));
+		llvm::Value* memberAddress = context->helper->createMemberAddress(context, parentObjectPointer, getMemberOffsetName(), offset, memberName + "_Address");
+		llvm::Value* addressValue = context->helper->convertToPointer(memberAddress, memberName + "_Ptr", context->helper->toLLVMPtrType(catType));
 		context->helper->writeToPointer(addressValue, rValue);
 		return rValue;
 	};
@@ -397,6 +454,23 @@ inline unsigned long long BasicTypeMemberInfo<BaseT, BasicT>::getOrdinal() const
 }
 
 
+template<typename BaseT, typename BasicT>
+inline DirectMemberAccess BasicTypeMemberInfo<BaseT, BasicT>::getDirectMemberAccess(std::size_t& offset) const
+{
+	//Only types that fit in a bytecode register can be loaded directly.
+	if constexpr (std::is_same<BasicT, bool>::value || std::is_same<BasicT, int>::value
+				  || std::is_same<BasicT, float>::value || std::is_same<BasicT, double>::value)
+	{
+		offset = (std::size_t)getMemberPointerOffset();
+		return DirectMemberAccess::Value;
+	}
+	else
+	{
+		return DirectMemberAccess::None;
+	}
+}
+
+
 template<typename BaseT, typename BasicT>
 inline std::string BasicTypeMemberInfo<BaseT, BasicT>::getMemberOffsetName() const
 {
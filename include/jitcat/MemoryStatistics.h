@@ -0,0 +1,190 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace jitcat
+{
+	class CatLib;
+
+	//Memory used by the expressions that were compiled using a CatRuntimeContext.
+	struct ContextMemoryStatistics
+	{
+		std::string contextName;
+		//False if the context was destroyed while some of the expressions that were compiled using it still exist.
+		bool contextExists = true;
+		//Expressions that were compiled without errors and have not yet been destroyed or recompiled.
+		std::size_t numExpressions = 0;
+		//Expressions that still hold their AST, see JitCat::setDiscardASTAfterNativeCodeCompilation.
+		std::size_t numRetainedASTs = 0;
+		std::size_t astMemory = 0;
+	};
+
+
+	//Memory used by the source files and types of a CatLib.
+	struct CatLibMemoryStatistics
+	{
+		std::string libName;
+		std::size_t numSourceFiles = 0;
+		std::size_t astMemory = 0;
+		//Includes the types of the source files themselves as well as the classes defined in them.
+		std::size_t numTypes = 0;
+		std::size_t typeInfoMemory = 0;
+	};
+
+
+	//A snapshot of the memory used by JitCat, see JitCat::getMemoryStatistics.
+	//JIT code memory and AST memory are exact. The other sizes are estimates of the heap memory used by the containers involved.
+	struct MemoryStatistics
+	{
+		//Code and data sections of JIT-compiled code. Zero if the LLVM backend is not enabled.
+		std::size_t allocatedCodeMemory = 0;
+		std::size_t reservedCodeMemory = 0;
+		std::size_t allocatedDataMemory = 0;
+		std::size_t reservedDataMemory = 0;
+		//All AST nodes that exist, this includes the ASTs of CatLib source files.
+		std::size_t numASTNodes = 0;
+		std::size_t astMemory = 0;
+		//The memory reserved by the arenas that parsed ASTs are allocated from, see AST::ASTArena.
+		//This overlaps with astMemory, because it includes the nodes that live in the arenas.
+		std::size_t astArenaMemory = 0;
+		//Types owned by the TypeRegistry, these are the reflected C++ types. Types defined by CatLibs are reported per CatLib.
+		//Types that were registered with the TypeRegistry by pointer are owned by the caller and are not included.
+		std::size_t numTypeInfos = 0;
+		std::size_t typeInfoMemory = 0;
+		std::size_t numPooledStrings = 0;
+		std::size_t stringConstantPoolMemory = 0;
+		//The interned names of members, functions and types, see Reflection::SymbolTable.
+		std::size_t numSymbols = 0;
+		std::size_t symbolTableMemory = 0;
+		//Objects of custom types that have ReflectableHandles pointing to them, see ReflectableHandle.
+		std::size_t numCustomObjectObservers = 0;
+		std::size_t customObjectObserverMemory = 0;
+
+		std::vector<ContextMemoryStatistics> contexts;
+		std::vector<CatLibMemoryStatistics> catLibs;
+
+		//The sum of the reserved JIT memory, the AST memory and the estimated memory of the type infos (including those of CatLibs), 
+		//the string constant pool, the symbol table and the custom object observers.
+		std::size_t getTotalMemory() const;
+
+		void write(std::ostream& stream) const;
+		std::string toString() const;
+	};
+
+
+	//The memory counters of a CatRuntimeContext. The counters are shared with the expressions that were compiled using the context,
+	//so that expressions that outlive their context are still accounted for.
+	class ContextMemoryCounters
+	{
+	public:
+		ContextMemoryCounters(const std::string& contextName);
+		ContextMemoryCounters(const ContextMemoryCounters&) = delete;
+		void operator=(const ContextMemoryCounters&) = delete;
+
+		void setContextDestroyed();
+		ContextMemoryStatistics getStatistics() const;
+
+	private:
+		friend class ExpressionMemoryAccount;
+		const std::string contextName;
+		std::atomic<bool> contextExists;
+		std::atomic<std::size_t> numExpressions;
+		std::atomic<std::size_t> numRetainedASTs;
+		std::atomic<std::size_t> astMemory;
+	};
+
+
+	//The memory of a single expression that is accounted to the context it was compiled with.
+	class ExpressionMemoryAccount
+	{
+	public:
+		ExpressionMemoryAccount();
+		ExpressionMemoryAccount(const ExpressionMemoryAccount&) = delete;
+		void operator=(const ExpressionMemoryAccount&) = delete;
+		~ExpressionMemoryAccount();
+
+		//Accounts an expression to counters. Replaces the previous account.
+		void open(std::shared_ptr<ContextMemoryCounters> counters, std::size_t astMemory);
+		//Called when the expression no longer holds its AST.
+		void releaseAST();
+		void close();
+		//Returns true if an account is open and the context it is accounted to has not been destroyed.
+		bool getContextExists() const;
+
+	private:
+		std::shared_ptr<ContextMemoryCounters> counters;
+		std::size_t astMemory;
+		bool hasAST;
+	};
+
+
+	//Keeps track of the contexts and CatLibs that exist, so that JitCat::getMemoryStatistics can report on them.
+	class MemoryStatisticsRegistry
+	{
+		MemoryStatisticsRegistry() = delete;
+	public:
+		static void registerContext(std::weak_ptr<ContextMemoryCounters> counters);
+		static void registerCatLib(const CatLib* catLib);
+		static void unregisterCatLib(const CatLib* catLib);
+
+		//Adds the statistics of all registered contexts and CatLibs.
+		static void collect(MemoryStatistics& statistics);
+
+	private:
+		struct Registry
+		{
+			std::mutex mutex;
+			std::vector<std::weak_ptr<ContextMemoryCounters>> contexts;
+			std::size_t contextPruneThreshold = 64;
+			std::vector<const CatLib*> catLibs;
+		};
+		//The registry is created on first use because contexts can be created during static initialization.
+		//It is intentionally leaked because contexts and CatLibs can also be destroyed during static destruction.
+		static Registry& getRegistry();
+	};
+
+
+	//Helper functions for estimating the heap memory used by standard containers.
+	namespace MemoryEstimation
+	{
+		//Estimated bookkeeping per node of an ordered associative container.
+		constexpr std::size_t treeNodeOverhead = 4 * sizeof(void*);
+		//Estimated bookkeeping per node of an unordered associative container. Each node also has a bucket pointer.
+		constexpr std::size_t hashNodeOverhead = 2 * sizeof(void*);
+
+		//Returns 0 if the string fits in its small string buffer.
+		std::size_t getStringMemory(const std::string& string);
+
+		template<typename ContainerT>
+		std::size_t getTreeMemory(const ContainerT& container)
+		{
+			return container.size() * (treeNodeOverhead + sizeof(typename ContainerT::value_type));
+		}
+
+		template<typename ContainerT>
+		std::size_t getHashMemory(const ContainerT& container)
+		{
+			return container.bucket_count() * sizeof(void*) + container.size() * (hashNodeOverhead + sizeof(typename ContainerT::value_type));
+		}
+
+		template<typename ContainerT>
+		std::size_t getVectorMemory(const ContainerT& container)
+		{
+			return container.capacity() * sizeof(typename ContainerT::value_type);
+		}
+	}
+}
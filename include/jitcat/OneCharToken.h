@@ -24,6 +24,9 @@ namespace jitcat::Tokenizer
 		virtual const char* getSubTypeSymbol(unsigned short subType) const override final;
 		virtual bool isSuggestedToken(unsigned short subType) const override final;
 		virtual bool createIfMatch(Document& document, std::size_t& currentPosition) const override final;
+
+		//Returns OneChar::Unknown if the character is not a one character token.
+		static OneChar getOneCharType(char character);
 	};
 
 } //End namespace jitcat::Tokenizer
\ No newline at end of file
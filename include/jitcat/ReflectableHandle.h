@@ -39,6 +39,10 @@ namespace jitcat::Reflection
 		//Will set all the handles that point to object to nullptr, and will unlinks them.
 		static void nullifyObjectHandles(unsigned char* object, CustomTypeInfo* objectType);
 
+		//The number of custom objects that are tracked through customObjectObservers and an estimate of the memory used, see JitCat::getMemoryStatistics.
+		static std::size_t getNumCustomObjectObservers();
+		static std::size_t getCustomObjectObserverMemory();
+
 		TypeInfo* getObjectType() const;
 		ReflectableHandle* getNextHandle() const;
 		void setNextHandle(ReflectableHandle* next);
@@ -46,6 +50,10 @@ namespace jitcat::Reflection
 		void setPreviousHandle(ReflectableHandle* previous);
 
 		void setReflectableReplacement(unsigned char* reflectable, TypeInfo* reflectableType);
+		//Sets the reflectable without registering this handle as an observer of the reflectable.
+		//The handle must not be tracking an object when this is called and must be set back to nullptr using this
+		//function before it is used in any other way. The caller guarantees that the reflectable outlives its use.
+		void setUntrackedReflectable(unsigned char* reflectable);
 
 		bool validateHandles() const;
 
@@ -69,6 +69,9 @@ namespace jitcat::Reflection
 		template <typename ConstantT>
 		inline ReflectedTypeInfo& addConstant(const std::string& identifier, ConstantT value);
 
+		//Registers LLVM IR or bitcode for the most recently added member function with the given name, see MemberFunctionInfo::setInlineBody.
+		ReflectedTypeInfo& setInlineFunctionBody(const std::string& identifier, const std::string& llvmIROrBitcode, const std::string& functionName);
+
 		//Set weither or not construction is allowed.
 		ReflectedTypeInfo& enableConstruction();
 		ReflectedTypeInfo& disableConstruction();
@@ -42,6 +42,7 @@ namespace jitcat::Reflection
 		TypeMemberInfo* memberInfo = MemberTypeInfoCreator<MemberT>::getMemberInfo(identifier_, member, isConst, isWritable);
 		if (memberInfo != nullptr)
 		{
+			memberInfo->setIsTrustedNonNull((flags & MF::isTrustedNonNull) != 0);
 			if ((memberInfo->getType().isReflectableHandleType() || memberInfo->getType().isPointerToReflectableObjectType())
 				&& (Tools::startsWith(identifier, "$") || memberInfo->getType().getOwnershipSemantics() == TypeOwnershipSemantics::Value))
 			{
@@ -110,7 +111,8 @@ namespace jitcat::Reflection
 		{
 			static_assert(std::is_class_v<MemberT>, "Static member type not supported.");
 		}
-		staticMembers.emplace(identifier, memberInfo);
+		memberInfo->trustedNonNull = (flags & MF::isTrustedNonNull) != 0;
+		insertStaticMember(identifier, memberInfo);
 		return *this;
 	}
 
@@ -119,7 +121,7 @@ namespace jitcat::Reflection
 	inline ReflectedTypeInfo& ReflectedTypeInfo::addMember(const std::string& identifier_, ReturnT (ReflectedT::*function)(Args...))
 	{
 		std::string identifier = Tools::toLowerCase(identifier_);
-		memberFunctions.emplace(identifier, new MemberFunctionInfoWithArgs<ReflectedT, ReturnT, Args...>(identifier_, function));
+		insertMemberFunction(identifier, new MemberFunctionInfoWithArgs<ReflectedT, ReturnT, Args...>(identifier_, function));
 		return *this;
 	}
 
@@ -128,7 +130,7 @@ namespace jitcat::Reflection
 	inline ReflectedTypeInfo& ReflectedTypeInfo::addMember(const std::string& identifier_, ReturnT (ReflectedT::*function)(Args...) const)
 	{
 		std::string identifier = Tools::toLowerCase(identifier_);
-		memberFunctions.emplace(identifier, new ConstMemberFunctionInfoWithArgs<ReflectedT, ReturnT, Args...>(identifier_, function));
+		insertMemberFunction(identifier, new ConstMemberFunctionInfoWithArgs<ReflectedT, ReturnT, Args...>(identifier_, function));
 		return *this;
 	}
 	
@@ -137,7 +139,7 @@ namespace jitcat::Reflection
 	inline ReflectedTypeInfo& ReflectedTypeInfo::addMember(const std::string& identifier_, ReturnT (*function)(Args...))
 	{
 		std::string identifier = Tools::toLowerCase(identifier_);
-		staticFunctions.emplace(identifier, new StaticFunctionInfoWithArgs<ReturnT, Args...>(identifier_, this, function));
+		insertStaticFunction(identifier, new StaticFunctionInfoWithArgs<ReturnT, Args...>(identifier_, this, function));
 		return *this;
 	}
 
@@ -146,7 +148,7 @@ namespace jitcat::Reflection
 	inline ReflectedTypeInfo& ReflectedTypeInfo::addPseudoMemberFunction(const std::string& identifier_, ReturnT(*function)(ReflectedT*, Args...))
 	{
 		std::string identifier = Tools::toLowerCase(identifier_);
-		memberFunctions.emplace(identifier, new PseudoMemberFunctionInfoWithArgs<ReflectedT, ReturnT, Args...>(identifier_, function));
+		insertMemberFunction(identifier, new PseudoMemberFunctionInfoWithArgs<ReflectedT, ReturnT, Args...>(identifier_, function));
 		return *this;
 	}
 
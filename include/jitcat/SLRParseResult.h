@@ -9,6 +9,7 @@
 
 namespace jitcat::AST
 {
+	class ASTArena;
 	class ASTNode;
 }
 #include <memory>
@@ -27,6 +28,8 @@ namespace jitcat::Parser
 		SLRParseResult& operator=(std::unique_ptr<SLRParseResult>&& other);
 
 		void clear();
+		//Deletes the AST and the arena it was allocated from, but keeps the value of success.
+		void discardAST();
 
 		template<typename ASTNodeType>
 		ASTNodeType* getNode() { return static_cast<ASTNodeType*>(astRootNode.get());}
@@ -34,6 +37,9 @@ namespace jitcat::Parser
 		template<typename ASTNodeType>
 		ASTNodeType* releaseNode() { return static_cast<ASTNodeType*>(astRootNode.release());}
 
+		//The arena that the parser allocated the AST nodes from. It must outlive the nodes, so it is declared before astRootNode.
+		//When releasing the root node, the arena should be released as well and kept alive by the new owner of the AST.
+		std::unique_ptr<AST::ASTArena> astArena;
 		std::unique_ptr<AST::ASTNode> astRootNode;
 		bool success;
 	};
@@ -0,0 +1,36 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace jitcat::Parser
+{
+	//A compact, array based representation of the DFA of an SLRParser.
+	//Building the DFA from a grammar is expensive, so the tables are generated ahead of time by the JitCatParseTableGenerator tool
+	//and compiled into the library. SLRParser::loadParseTables then creates the DFA directly from the tables.
+	//Productions are identified by their production ID and rules by their index within the production.
+	struct SLRParseTables
+	{
+		//The hash of the grammar that the tables were generated from, see GrammarBase::getGrammarHash.
+		std::uint64_t grammarHash;
+		std::size_t numStates;
+		//The items of state i are items[stateItemOffsets[i]] up to items[stateItemOffsets[i + 1]], 
+		//stateItemOffsets has numStates + 1 elements. The same goes for the transitions.
+		const std::uint32_t* stateItemOffsets;
+		//Three values per item: the production ID, the rule index and the token offset.
+		const std::uint16_t* items;
+		const std::uint32_t* stateTransitionOffsets;
+		//Four values per transition: the production ID, rule index and token offset of the item that moves past 
+		//the transition token, followed by the index of the next state.
+		const std::uint16_t* transitions;
+	};
+
+} //End namespace jitcat::Parser
@@ -28,7 +28,9 @@ namespace jitcat::Grammar
 #include "jitcat/SLRParseResult.h"
 #include "jitcat/ParseToken.h"
 
+#include <cstdint>
 #include <memory>
+#include <ostream>
 #include <set>
 #include <string>
 #include <vector>
@@ -37,15 +39,22 @@ namespace jitcat::Parser
 {
 	class DFAState;
 	class Item;
-	class StackItem;
+	struct SLRParseTables;
+	struct StackItem;
 
 
 	class SLRParser
 	{
 	public:
-		SLRParser(const Grammar::GrammarBase* grammar): grammar(grammar) {}
+		SLRParser(const Grammar::GrammarBase* grammar): grammar(grammar), numTerminalColumns(0), numGotoColumns(0), maxTokenId(0), maxTokenSubType(0) {}
 	
 		void createNFA();
+		//Creates the DFA from parse tables that were generated by writeParseTables, instead of building it from the grammar.
+		//Returns false if the tables were not generated from the same grammar.
+		bool loadParseTables(const SLRParseTables& tables);
+		//Writes the DFA as C++ source code that defines the arrays and the SLRParseTables constant with the given name.
+		//Returns false if the DFA is too large to be represented by SLRParseTables.
+		bool writeParseTables(std::ostream& stream, const std::string& tablesName) const;
 
 	private:
 		void buildNFA(DFAState* currentState, std::vector<DFAState*>& nfa);
@@ -56,17 +65,18 @@ namespace jitcat::Parser
 		void cleanupAfterConversionToDFA(std::vector<DFAState*>& dfaToClean);
 
 		void markReachableStates(DFAState* currentState);
+
+		//Returns the index of rule within its production.
+		static std::size_t getRuleIndex(const Item& item);
 	
 		bool hasMultipleTransitionsWithToken(DFAState* state, Grammar::ProductionToken* token) const;
 		void aggregateTokenTransitionIntoNewState(DFAState* state, Grammar::ProductionToken* token, std::vector<DFAState*>& nfa, const Item& item);
 
-		//Reduces if possible and returns true if reduce move was done
-		bool tryReduce(DFAState* currentState, std::vector<StackItem*>& stack, StackItem* nextToken, RuntimeContext* context) const;
-		//Returns the new state if it is possible to shift the given token onto the stack.
-		//Returns nullptr if the shift is not possible (error)
-		DFAState* canShift(DFAState* currentState, StackItem* tokenToShift) const;
-		bool isStackItemInFollowSet(StackItem* item, const Grammar::ProductionTokenSet& followSet) const;
-		void printStack(const std::vector<StackItem*> stack) const;
+		//Converts the DFA into the dense action and goto tables that are used by parse.
+		void buildActionTables();
+		//Returns the column of the action table for a token.
+		std::size_t getTerminalColumn(const Tokenizer::ParseToken& token) const;
+		void printStack(const std::vector<StackItem>& stack) const;
 
 		void scanForConflicts() const;
 
@@ -79,6 +89,24 @@ namespace jitcat::Parser
 	private:
 		const Grammar::GrammarBase* grammar;
 		std::vector<DFAState*> dfa;
+
+		struct ReduceAction
+		{
+			const Grammar::Production* production;
+			const Grammar::ProductionRule* rule;
+		};
+		//Indexed by state * numTerminalColumns + terminal column. 
+		//Zero is an error, a positive value shifts to the state value - 1 and a negative value reduces reduceActions[-value - 1].
+		std::vector<std::int32_t> actionTable;
+		std::size_t numTerminalColumns;
+		//Indexed by state * numGotoColumns + production ID. Holds the next state + 1, or zero if there is no transition.
+		std::vector<std::uint16_t> gotoTable;
+		std::size_t numGotoColumns;
+		std::vector<ReduceAction> reduceActions;
+		//Maps a token ID and sub type to its terminal column, indexed by tokenId * (maxTokenSubType + 1) + subType.
+		std::vector<std::uint16_t> terminalColumns;
+		std::size_t maxTokenId;
+		std::size_t maxTokenSubType;
 	};
 
 } //End namespace jitcat::Parser
\ No newline at end of file
@@ -0,0 +1,126 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+namespace jitcat::LLVM
+{
+	class LLVMCodeGenerator;
+}
+namespace jitcat::Parser
+{
+	struct SLRParseResult;
+}
+
+#include "jitcat/CatGenericType.h"
+#include "jitcat/LLVMCompileOptions.h"
+#include "jitcat/TypeVersion.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace jitcat
+{
+	class CatRuntimeContext;
+
+	//Statistics about expressions that share their compiled code. See JitCat::setExpressionSharing.
+	struct ExpressionSharingStatistics
+	{
+		//Number of distinct compiled expressions that are currently in use by one or more expressions.
+		std::size_t numSharedExpressions;
+		//Number of compiles that reused a compiled expression.
+		std::size_t numHits;
+		//Number of compiles that did not find a compiled expression to reuse.
+		std::size_t numMisses;
+	};
+
+
+	//The result of compiling an expression, shared by the expressions that are compiled with the same text, expected type, compile options and scope layout.
+	//It is not modified after it has been added to the SharedExpressionCache. It is no longer shared once one of the types it was resolved against changes.
+	struct SharedExpression
+	{
+		//The type checked AST. Has no AST if it was discarded after native code compilation.
+		std::shared_ptr<Parser::SLRParseResult> parseResult;
+		CatGenericType valueType;
+		bool expressionIsLiteral;
+		//The native function, or 0 if the LLVM backend is not enabled.
+		uintptr_t functionAddress;
+		//Keeps the native function alive.
+		std::shared_ptr<LLVM::LLVMCodeGenerator> codeGenerator;
+		//The types that names were looked up in while compiling the expression, with their versions at that time. See TypeInfo::setRecordedLookups.
+		std::vector<Reflection::TypeVersion> resolvedTypes;
+	};
+
+
+	//A process wide cache of compiled expressions, used by ExpressionBase when expression sharing is enabled. See JitCat::setExpressionSharing.
+	//The cache does not keep the expressions alive. A SharedExpression is freed when the last expression that uses it is destroyed or recompiled.
+	//Thread safe.
+	class SharedExpressionCache
+	{
+	public:
+		//Identifies a compiled expression. Expressions with the same key can use each other's compiled code.
+		class Key
+		{
+		public:
+			Key(const std::string& expression, const CatGenericType& expectedType, bool isAssignment, const LLVM::LLVMCompileOptions& compileOptions, const CatRuntimeContext* context);
+			bool operator==(const Key& other) const;
+			std::size_t getHash() const;
+
+		private:
+			std::string expression;
+			CatGenericType expectedType;
+			bool isAssignment;
+			//Includes the effective optimization level of the expression.
+			LLVM::LLVMCompileOptions compileOptions;
+			//See CatRuntimeContext::getScopeLayout.
+			std::vector<const void*> scopeLayout;
+			//A scope type that adds or removes members may change the result of compiling the expression, see TypeInfo::getVersion.
+			//Lookups in scope types are not always recorded in SharedExpression::resolvedTypes, because CatRuntimeContext caches them.
+			std::vector<unsigned long long> scopeVersions;
+			std::size_t hash;
+		};
+
+		SharedExpressionCache();
+		SharedExpressionCache(const SharedExpressionCache&) = delete;
+		SharedExpressionCache& operator=(const SharedExpressionCache&) = delete;
+
+		//Returns nullptr if no expression with the same key is in use, or if one of the types it was resolved against has changed.
+		std::shared_ptr<const SharedExpression> find(const Key& key);
+		//Replaces any expression with the same key.
+		void add(const Key& key, const std::shared_ptr<const SharedExpression>& sharedExpression);
+
+		ExpressionSharingStatistics getStatistics() const;
+		void resetStatistics();
+
+	private:
+		//Removes the entries of expressions that are no longer in use. The mutex must be locked.
+		void prune();
+
+	private:
+		struct KeyHash
+		{
+			std::size_t operator()(const Key& key) const
+			{
+				return key.getHash();
+			}
+		};
+
+		mutable std::mutex mutex;
+		std::unordered_map<Key, std::weak_ptr<const SharedExpression>, KeyHash> expressions;
+		//Expired entries are pruned when the number of entries reaches this threshold.
+		std::size_t pruneThreshold;
+		std::size_t numHits;
+		std::size_t numMisses;
+	};
+
+} //End namespace jitcat
@@ -25,21 +25,24 @@ namespace jitcat::Grammar
 
 namespace jitcat::Parser
 {
-	class DFAState;
-
-
-	class StackItem
+	//An item on the parse stack. It is either a shifted token or a reduced production, except for the item at the 
+	//bottom of the stack, which is neither. The parse stack holds its items by value.
+	struct StackItem
 	{
-	public:
 		StackItem():
-			state(nullptr),
-			astNode(nullptr)
+			state(0),
+			astNode(nullptr),
+			token(nullptr),
+			production(nullptr)
 		{}
-		virtual ~StackItem() {}
-		DFAState* state;
+		const Tokenizer::ParseToken* getTokenIfToken() const {return token;}
+		const Grammar::Production* getProductionIfProduction() const {return production;}
+
+		//The index of the DFA state that the parser moved to after this item was pushed.
+		std::size_t state;
 		AST::ASTNode* astNode;
-		virtual const Tokenizer::ParseToken* getTokenIfToken() const {return 0;}
-		virtual const Grammar::Production* getProductionIfProduction() const {return 0;}
+		const Tokenizer::ParseToken* token;
+		const Grammar::Production* production;
 	};
 
-} //End namespace jitcat::Parser
\ No newline at end of file
+} //End namespace jitcat::Parser
@@ -29,7 +29,7 @@ namespace jitcat::Reflection
 
 	struct StaticMemberInfo
 	{
-		StaticMemberInfo(): visibility(MemberVisibility::Private) {}
+		StaticMemberInfo(): visibility(MemberVisibility::Private), trustedNonNull(false) {}
 		StaticMemberInfo(const std::string& memberName, const CatGenericType& type, const char* parentTypeName);
 
 		virtual ~StaticMemberInfo() {};
@@ -41,6 +41,8 @@ namespace jitcat::Reflection
 
 		CatGenericType catType;
 		MemberVisibility visibility;
+		//See MemberFlags::isTrustedNonNull
+		bool trustedNonNull;
 		const char* parentTypeName;
 		std::string memberName;
 	};
@@ -11,11 +11,13 @@
 
 #include "jitcat/Configuration.h"
 
+#include <mutex>
 #include <unordered_set>
 
 
 namespace jitcat::AST
 {
+	//The pool is shared by all threads that parse or compile expressions, access is guarded by a mutex.
 	class StringConstantPool
 	{
 		StringConstantPool() = delete;
@@ -28,7 +30,12 @@ namespace jitcat::AST
 		//Warning: This will clear all the strings in the pool, including those that are still being referenced by any code.
 		static void clearPool();
 
+		//The number of strings in the pool and an estimate of the memory they use, see JitCat::getMemoryStatistics.
+		static std::size_t getNumStrings();
+		static std::size_t getMemoryUsage();
+
 	private:
 		static std::unordered_set<Configuration::CatString> pool;
+		static std::mutex poolMutex;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+namespace jitcat::Reflection
+{
+	//Identifies a case insensitive name in the SymbolTable.
+	using SymbolId = unsigned int;
+
+	//Identifiers in JitCat are case insensitive. The names of members, functions and types are interned into the symbol table
+	//when they are added to a TypeInfo or the TypeRegistry. Lookups then find the symbol of an identifier once and search
+	//hash tables that are keyed by SymbolId, instead of creating a lower case copy of the identifier for every map they search.
+	//Symbols are never removed. The table is shared by all threads. Finding a symbol does not lock, only interning a new name takes a mutex.
+	class SymbolTable
+	{
+		SymbolTable() = delete;
+		~SymbolTable() = delete;
+		SymbolTable(const SymbolTable&) = delete;
+		SymbolTable& operator=(const SymbolTable&) = delete;
+	public:
+		//No name maps to this symbol.
+		static constexpr SymbolId noSymbol = 0;
+
+		//Returns the symbol of the name, ignoring case. The name is added to the table if it was not interned before.
+		static SymbolId intern(const std::string_view& name);
+		//Returns the symbol of the name, ignoring case, or noSymbol if it was never interned. Does not allocate.
+		//A name that was never interned cannot be the name of any member, function or type.
+		static SymbolId find(const std::string_view& name);
+		//Returns the lower case name of an interned symbol. Unlike find, this takes the mutex.
+		static const std::string& getName(SymbolId symbol);
+
+		//Returns pointers to the entries of a map that is keyed by SymbolId, sorted by the name of their symbol.
+		//Used where the order of members or types is visible, such as when enumerating or exporting them.
+		template<typename MapT>
+		static std::vector<const typename MapT::value_type*> sortByName(const MapT& map);
+
+		//The number of symbols in the table and an estimate of the memory they use, see JitCat::getMemoryStatistics.
+		static std::size_t getNumSymbols();
+		static std::size_t getMemoryUsage();
+	};
+
+
+	template<typename MapT>
+	inline std::vector<const typename MapT::value_type*> SymbolTable::sortByName(const MapT& map)
+	{
+		std::vector<std::pair<const std::string*, const typename MapT::value_type*>> namedEntries;
+		namedEntries.reserve(map.size());
+		for (const auto& entry : map)
+		{
+			namedEntries.emplace_back(&getName(entry.first), &entry);
+		}
+		std::sort(namedEntries.begin(), namedEntries.end(), [](const auto& first, const auto& second){return *first.first < *second.first;});
+		std::vector<const typename MapT::value_type*> entries;
+		entries.reserve(namedEntries.size());
+		for (const auto& namedEntry : namedEntries)
+		{
+			entries.push_back(namedEntry.second);
+		}
+		return entries;
+	}
+}
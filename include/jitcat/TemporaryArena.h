@@ -0,0 +1,78 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace jitcat
+{
+	//Holds the temporary values that the interpreter creates while it executes an expression, see CatRuntimeContext::addTemporary.
+	//Temporaries are constructed in place in contiguous blocks of memory. Resetting the arena destroys the temporaries in the reverse order 
+	//of their construction, but keeps the memory, so that executing an expression again does not allocate.
+	//Not thread safe. An arena belongs to a CatRuntimeContext, which is only used by one thread at a time.
+	class TemporaryArena
+	{
+	public:
+		TemporaryArena();
+		TemporaryArena(const TemporaryArena&) = delete;
+		void operator=(const TemporaryArena&) = delete;
+		~TemporaryArena();
+
+		//Constructs a temporary that lives until the next reset.
+		template<typename TemporaryT, typename... ArgumentsT>
+		TemporaryT& create(ArgumentsT&&... arguments);
+
+		//Destroys all temporaries. If they did not fit in a single block, the blocks are replaced by one block that is large enough to hold them all.
+		void reset();
+
+		bool isEmpty() const;
+		//The number of bytes reserved by the blocks of the arena.
+		std::size_t getReservedMemory() const;
+
+	private:
+		void* allocate(std::size_t size);
+		void allocateBlock(std::size_t size);
+
+	private:
+		struct Destructor
+		{
+			void (*destroy)(void* temporary);
+			void* temporary;
+		};
+
+		//Every temporary is aligned to this, the alignment of the memory returned by operator new.
+		static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+		std::vector<char*> blocks;
+		char* currentPosition;
+		char* currentBlockEnd;
+		std::size_t allocatedMemory;
+		std::size_t reservedMemory;
+		//Temporaries that are trivially destructible are not listed.
+		std::vector<Destructor> destructors;
+	};
+
+
+	template<typename TemporaryT, typename... ArgumentsT>
+	inline TemporaryT& TemporaryArena::create(ArgumentsT&&... arguments)
+	{
+		static_assert(alignof(TemporaryT) <= alignment);
+		TemporaryT* temporary = new (allocate(sizeof(TemporaryT))) TemporaryT(std::forward<ArgumentsT>(arguments)...);
+		if constexpr (!std::is_trivially_destructible_v<TemporaryT>)
+		{
+			destructors.push_back({[](void* object){static_cast<TemporaryT*>(object)->~TemporaryT();}, temporary});
+		}
+		return *temporary;
+	}
+
+} //End namespace jitcat
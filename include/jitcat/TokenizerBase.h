@@ -28,7 +28,9 @@ namespace jitcat::Tokenizer
 
 		//Returns true if the document was succesfully tokenized.
 		//The tokens vector is filled with the parsed tokens.
-		bool tokenize(Document& document);
+		//This tries each token factory in order at every position. A tokenizer can override this with a faster implementation
+		//that produces the same tokens.
+		virtual bool tokenize(Document& document);
 		void registerTokenFactory(std::unique_ptr<TokenFactory>&& factory);
 		
 		const char* getTokenName(unsigned short tokenId, unsigned short tokenSubType) const;
@@ -23,6 +23,9 @@ namespace jitcat::Tokenizer
 		virtual const char* getSubTypeName(unsigned short subType) const override final;
 		virtual const char* getSubTypeSymbol(unsigned short subType) const override final;
 		virtual bool createIfMatch(Document& document, std::size_t& currentPosition) const override final;
+
+		//Returns TwoChar::Unknown if the two characters are not a two character token.
+		static TwoChar getTwoCharType(char first, char second);
 	};
 
 } //End namespace jitcat::Tokenizer
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "jitcat/CatValue.h"
 #include "jitcat/Reflectable.h"
 
 #include <any>
@@ -41,6 +42,11 @@ namespace jitcat::Reflection
 
 		virtual void toBuffer(const std::any& value, const unsigned char*& buffer, std::size_t& bufferSize) const = 0;
 		virtual std::any getNull() const = 0;
+
+		//Converts between a pointer to an object of this type, in the form returned by AST::CatTypedExpression::execute, 
+		//and a CatValue that holds the raw pointer. (See CatValue.h)
+		CatValue castToValue(const std::any& pointer) const;
+		std::any castFromValue(const CatValue& value) const;
 	};
 
 
@@ -12,13 +12,17 @@
 #include "jitcat/MemberFlags.h"
 #include "jitcat/Reflectable.h"
 #include "jitcat/ReflectableHandle.h"
+#include "jitcat/SymbolTable.h"
 #include "jitcat/Tools.h"
+#include "jitcat/TypeVersion.h"
 
 #include <any>
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 
@@ -69,6 +73,9 @@ namespace jitcat::Reflection
 	//Static member functions are described by classes that inherit from StaticMemberfunctionInfo. (See StaticMemberFunctionInfo.h)
 	//Finally, static members are described by classes that inherit from StaticMemberInfo. (See StaticMemberInfo.h)
 
+	//Names are case insensitive. Members, functions and nested types are stored by the SymbolId of their name, 
+	//and can be looked up by name or directly by SymbolId. (See SymbolTable.h)
+
 	//TypeInfo can also construct and delete instances of the type it represents, if construction/deletion is allowed/possible. 
 	class TypeInfo
 	{
@@ -81,10 +88,20 @@ namespace jitcat::Reflection
 		//It will ensure that the type is only deleted when there are no more dependencies.
 		static void destroy(TypeInfo* type);
 		friend struct TypeInfoDeleter;
+		friend class TypeRegistry;
 
 	public:
 
 		static void updateTypeDestruction();
+		//Incremented whenever a member, function, constant or nested type is added to or removed from any type.
+		//A cached result of a lookup by name is no longer valid when this changes. (See CatRuntimeContext::findVariable)
+		static unsigned long long getLookupVersion();
+		//Changes whenever a member, function, constant or nested type is added to or removed from this type, 
+		//or when this type is removed from the TypeRegistry. Versions are unique across all types.
+		unsigned long long getVersion() const;
+		//While lookups is not nullptr, every lookup by name or function signature on the current thread adds the type that it was done on to lookups.
+		//Returns the previous value so that it can be restored. Used to find the types that an expression was resolved against, see SharedExpression.
+		static std::vector<TypeVersion>* setRecordedLookups(std::vector<TypeVersion>* lookups);
 		//Add a nested type to this type. Return true if the type was added, false if a type with this name already exists.
 		bool addType(TypeInfo* type);
 		//Add a named constant value to this type. Returns nullptr if a constant if this name already exists.
@@ -110,15 +127,19 @@ namespace jitcat::Reflection
 	
 		//Gets the type information of a member variable given its name.
 		TypeMemberInfo* getMemberInfo(const std::string& identifier) const;
+		TypeMemberInfo* getMemberInfo(SymbolId symbol) const;
 
 		//Gets the type information of a static member variable given its name.
 		StaticMemberInfo* getStaticMemberInfo(const std::string& identifier) const;
+		StaticMemberInfo* getStaticMemberInfo(SymbolId symbol) const;
 
 		//Gets the type and value information of a static const member given its name.
 		StaticConstMemberInfo* getStaticConstMemberInfo(const std::string& identifier) const;
+		StaticConstMemberInfo* getStaticConstMemberInfo(SymbolId symbol) const;
 
 		//Gets the type information of a member function given its name.
 		MemberFunctionInfo* getFirstMemberFunctionInfo(const std::string& identifier) const;
+		MemberFunctionInfo* getFirstMemberFunctionInfo(SymbolId symbol) const;
 		std::vector<MemberFunctionInfo*> getMemberFunctionsByName(const std::string& functionName) const;
 
 		//Gets the type information of a member function given its name.
@@ -134,6 +155,7 @@ namespace jitcat::Reflection
 
 		//Gets a nested type given its name
 		TypeInfo* getTypeInfo(const std::string& typeName) const;
+		TypeInfo* getTypeInfo(SymbolId symbol) const;
 
 		//Returns the type name of the class/struct
 		const char* getTypeName() const;
@@ -159,13 +181,13 @@ namespace jitcat::Reflection
 		//Returns true if the type can be constructed through zero-initialisation.
 		virtual bool isTriviallyConstructable() const;
 
-		//Beware that these lists are case insensitive because the keys have been converted to lower case
-		const std::map<std::string, std::unique_ptr<TypeMemberInfo>>& getMembers() const;
-		const std::map<std::string, std::unique_ptr<StaticMemberInfo>>& getStaticMembers() const;
+		//These are keyed by the SymbolId of the lower case name and are not in any particular order. See SymbolTable::sortByName.
+		const std::unordered_map<SymbolId, std::unique_ptr<TypeMemberInfo>>& getMembers() const;
+		const std::unordered_map<SymbolId, std::unique_ptr<StaticMemberInfo>>& getStaticMembers() const;
 		const std::map<unsigned long long, TypeMemberInfo*>& getMembersByOrdinal() const;
-		const std::multimap<std::string, std::unique_ptr<MemberFunctionInfo>>& getMemberFunctions() const;
-		const std::multimap<std::string, std::unique_ptr<StaticFunctionInfo>>& getStaticMemberFunctions() const;
-		const std::map<std::string, TypeInfo*>& getTypes() const;
+		const std::unordered_map<SymbolId, std::vector<std::unique_ptr<MemberFunctionInfo>>>& getMemberFunctions() const;
+		const std::unordered_map<SymbolId, std::vector<std::unique_ptr<StaticFunctionInfo>>>& getStaticMemberFunctions() const;
+		const std::unordered_map<SymbolId, TypeInfo*>& getTypes() const;
 
 		//May be nullptr when type info was read from XML
 		const TypeCaster* getTypeCaster() const;
@@ -195,6 +217,9 @@ namespace jitcat::Reflection
 		//Returns true if the type has no dependencies and can be deleted.
 		virtual bool canBeDeleted() const;
 
+		//Returns an estimate of the memory used by this type info and its member infos, see JitCat::getMemoryStatistics.
+		virtual std::size_t getMemoryUsage() const;
+
 		bool canBeAssignedBy(const CatGenericType& type) const;
 
 		void addDependentType(TypeInfo* otherType);
@@ -208,32 +233,51 @@ namespace jitcat::Reflection
 		void addMember(const std::string& memberName, TypeMemberInfo* memberInfo);
 		TypeMemberInfo* releaseMember(const std::string& memberName);
 
+		//Insert an info into the maps below. The name is interned into the SymbolTable.
+		//These take ownership of the info. Like std::map::emplace, a member or static member is not inserted (and deleted) 
+		//if a member with the same name already exists. Returns true if it was inserted.
+		bool insertMember(const std::string& lowerCaseName, TypeMemberInfo* memberInfo);
+		bool insertMember(SymbolId symbol, TypeMemberInfo* memberInfo);
+		bool insertStaticMember(const std::string& lowerCaseName, StaticMemberInfo* staticMemberInfo);
+		void insertMemberFunction(const std::string& lowerCaseName, MemberFunctionInfo* memberFunctionInfo);
+		void insertMemberFunction(SymbolId symbol, MemberFunctionInfo* memberFunctionInfo);
+		void insertStaticFunction(const std::string& lowerCaseName, StaticFunctionInfo* staticFunctionInfo);
+
+	private:
+		//Adds this type to the recorded lookups of the current thread, if any.
+		void recordLookup() const;
+		//Called when a lookup by name on this type may give a different result.
+		void updateLookupVersion();
+
 	protected:
 		const char* typeName;
 		std::unique_ptr<TypeCaster> caster;
 	protected:
 		
+		//The maps below are keyed by the SymbolId of the lower case name. (See SymbolTable.h)
+
 		//Member variables of this type
-		std::map<std::string, std::unique_ptr<TypeMemberInfo>> members;
+		std::unordered_map<SymbolId, std::unique_ptr<TypeMemberInfo>> members;
 		//Member variables sorted by their offset / ordinal
 		std::map<unsigned long long, TypeMemberInfo*> membersByOrdinal;
 
-		//Member functions of this type, member function overloading is allowed
-		std::multimap<std::string, std::unique_ptr<MemberFunctionInfo>> memberFunctions;
+		//Member functions of this type, member function overloading is allowed. Overloads are kept in the order they were added.
+		std::unordered_map<SymbolId, std::vector<std::unique_ptr<MemberFunctionInfo>>> memberFunctions;
 		//Static member variables of this type
-		std::map<std::string, std::unique_ptr<StaticMemberInfo>> staticMembers;
+		std::unordered_map<SymbolId, std::unique_ptr<StaticMemberInfo>> staticMembers;
 		//Static const members of this type
-		std::map<std::string, std::unique_ptr<StaticConstMemberInfo>> staticConstMembers;
-		//Static functions of this type, static function overloading is allowed
-		std::multimap<std::string, std::unique_ptr<StaticFunctionInfo>> staticFunctions;
+		std::unordered_map<SymbolId, std::unique_ptr<StaticConstMemberInfo>> staticConstMembers;
+		//Static functions of this type, static function overloading is allowed. Overloads are kept in the order they were added.
+		std::unordered_map<SymbolId, std::vector<std::unique_ptr<StaticFunctionInfo>>> staticFunctions;
 
 		//Nested type definitions within this type. These are not owned here.
-		std::map<std::string, TypeInfo*> types;
+		std::unordered_map<SymbolId, TypeInfo*> types;
 
 		//The parent of this type if this type is nested into another type. nullptr otherwise.
 		TypeInfo* parentType;
 		//Size of the type in bytes
 		std::size_t typeSize;
+		unsigned long long version;
 
 		//A set of types that use this type as an object data member or inherit from this type
 		std::set<TypeInfo*> dependentTypes;
@@ -241,6 +285,9 @@ namespace jitcat::Reflection
 		//Keep a list of types that are to be deleted.
 		//Types are only deleted if there are no more dependencies on that type.
 		static std::vector<TypeInfo*> typeDeletionList;
+
+		static std::atomic<unsigned long long> lookupVersion;
+		static thread_local std::vector<TypeVersion>* recordedLookups;
 	};
 
 	template<>
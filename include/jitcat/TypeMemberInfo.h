@@ -7,6 +7,7 @@
 #pragma once
 
 #include "jitcat/CatGenericType.h"
+#include "jitcat/CatValue.h"
 #include "jitcat/LLVMForwardDeclares.h"
 #include "jitcat/MemberVisibility.h"
 
@@ -21,18 +22,35 @@ namespace jitcat::LLVM
 
 namespace jitcat::Reflection
 {
+	//Describes how a member can be accessed without calling getMemberReference. See TypeMemberInfo::getDirectMemberAccess.
+	enum class DirectMemberAccess
+	{
+		//The member can only be accessed through getMemberReference.
+		None,
+		//The value of the member is stored at a fixed offset from the start of the parent object.
+		Value,
+		//The member is an object that is stored inline at a fixed offset from the start of the parent object. The member's address is its value.
+		Address
+	};
+
+
 	struct TypeMemberInfo
 	{
-		TypeMemberInfo(): visibility(MemberVisibility::Private) {}
-		TypeMemberInfo(const std::string& memberName, const CatGenericType& type): catType(type), visibility(MemberVisibility::Public), memberName(memberName)  {}
+		TypeMemberInfo(): visibility(MemberVisibility::Private), trustedNonNull(false) {}
+		TypeMemberInfo(const std::string& memberName, const CatGenericType& type): catType(type), visibility(MemberVisibility::Public), trustedNonNull(false), memberName(memberName)  {}
 		virtual ~TypeMemberInfo() {};
 		virtual std::any getMemberReference(unsigned char* base);
 		virtual std::any getAssignableMemberReference(unsigned char* base);
+		//Same as getMemberReference, but returns the value as a CatValue. Used by AST::CatTypedExpression::executeValue.
+		virtual CatValue getMemberValue(unsigned char* base);
 		virtual llvm::Value* generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const;
 		virtual llvm::Value* generateAssignCode(llvm::Value* parentObjectPointer, llvm::Value* rValue, LLVM::LLVMCompileTimeContext* context) const;
 		virtual llvm::Value* generateArrayIndexCode(llvm::Value* container, llvm::Value* index, LLVM::LLVMCompileTimeContext* context) const;
 		virtual bool isDeferred() const { return false; }
 		virtual unsigned long long getOrdinal() const { return 0;}
+		//Used by the bytecode interpreter to access members without going through getMemberReference.
+		//If the member can be accessed directly, offset is set to the offset of the member relative to the parent object.
+		virtual DirectMemberAccess getDirectMemberAccess(std::size_t& offset) const { return DirectMemberAccess::None; }
 
 		TypeMemberInfo* toDeferredTypeMemberInfo(TypeMemberInfo* baseMember);
 
@@ -44,9 +62,14 @@ namespace jitcat::Reflection
 		MemberVisibility getMemberVisibility() const;
 		void setVisibility(MemberVisibility newVisibility);
 
+		//See MemberFlags::isTrustedNonNull
+		bool getIsTrustedNonNull() const;
+		void setIsTrustedNonNull(bool isTrustedNonNull);
+
 	protected:
 		CatGenericType catType;
 		MemberVisibility visibility;
+		bool trustedNonNull;
 
 		std::string memberName;
 	};
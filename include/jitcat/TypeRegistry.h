@@ -11,14 +11,17 @@ namespace jitcat
 {
 	class CatGenericType;
 }
+#include "jitcat/SymbolTable.h"
 #include "jitcat/TypeInfoDeleter.h"
 
 #include <cassert>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 
@@ -29,6 +32,8 @@ namespace jitcat::Reflection
 	class TypeCaster;
 	class TypeInfo;
 
+	//Registering and looking up types is guarded by a mutex so that expressions can be compiled on multiple threads.
+	//getTypes, loadRegistryFromXML and exportRegistyToXML are not thread safe.
 	class TypeRegistry
 	{
 	private:
@@ -40,10 +45,17 @@ namespace jitcat::Reflection
 		static TypeRegistry* get();
 		static void recreate();
 
-		//Returns nullptr if type wasn't found, type names are case sensitive
+		//Returns nullptr if type wasn't found, type names are case insensitive
 		TypeInfo* getTypeInfo(const std::string& typeName);
+		TypeInfo* getTypeInfo(SymbolId symbol);
 
-		const std::map<std::string, TypeInfo*>& getTypes() const;
+		//Keyed by the SymbolId of the lower case type name. (See SymbolTable.h)
+		const std::unordered_map<SymbolId, TypeInfo*>& getTypes() const;
+
+		//The number of types owned by the registry and an estimate of the memory they use, see JitCat::getMemoryStatistics.
+		//Types that were registered by pointer are owned by the caller and are not included.
+		std::size_t getNumOwnedTypes() const;
+		std::size_t getOwnedTypesMemoryUsage() const;
 	
 		//If the type is already registered, it will just return the TypeInfo.
 		//Never returns nullptr
@@ -70,9 +82,14 @@ namespace jitcat::Reflection
 		static std::unique_ptr<TypeInfo, TypeInfoDeleter> createEnumTypeInfo(const char* typeName, const CatGenericType& underlyingType, std::size_t typeSize, std::unique_ptr<TypeCaster> typeCaster);
 		static ReflectedTypeInfo* castToReflectedTypeInfo(TypeInfo* typeInfo);
 		static ReflectedEnumTypeInfo* castToReflectedEnumTypeInfo(TypeInfo* typeInfo);
+		//Adds the type to types. The name is interned into the SymbolTable.
+		void insertType(const std::string& typeName, TypeInfo* typeInfo);
+		void eraseType(std::unordered_map<SymbolId, TypeInfo*>::iterator typeIterator);
 	private:
-		std::map<std::string, TypeInfo*> types;
+		std::unordered_map<SymbolId, TypeInfo*> types;
 		std::vector<std::unique_ptr<TypeInfo, TypeInfoDeleter>> ownedTypes;
+		//Recursive because registering a type also registers the types of its members.
+		std::recursive_mutex mutex;
 		static TypeRegistry* instance;
 	};
 
@@ -95,18 +112,18 @@ namespace jitcat::Reflection
 		
 		//A compile error on this line usually means that there was an attempt to reflect a type that is not reflectable (or an unsupported basic type).
 		const char* typeName = TypeNameGetter<ReflectableT>::get();
-		std::string lowerTypeName = Tools::toLowerCase(typeName);
-		std::map<std::string, TypeInfo*>::iterator iter = types.find(lowerTypeName);
-		if (iter != types.end())
+		std::lock_guard<std::recursive_mutex> lock(mutex);
+		if (TypeInfo* existingTypeInfo = getTypeInfo(SymbolTable::find(typeName)); existingTypeInfo != nullptr)
 		{
 			if (typeInfoToSet != nullptr)
 			{
-				*typeInfoToSet = iter->second;
+				*typeInfoToSet = existingTypeInfo;
 			}
-			return iter->second;
+			return existingTypeInfo;
 		}
 		else
 		{
+			std::string lowerTypeName = Tools::toLowerCase(typeName);
 			std::size_t typeSize = sizeof(ReflectableT);
 			std::unique_ptr<jitcat::Reflection::ObjectTypeCaster<ReflectableT>> typeCaster = std::make_unique<jitcat::Reflection::ObjectTypeCaster<ReflectableT>>();
 
@@ -168,7 +185,7 @@ namespace jitcat::Reflection
 				
 				std::unique_ptr<jitcat::Reflection::TypeInfo, TypeInfoDeleter> typeInfo = createTypeInfo(typeName, typeSize, std::move(typeCaster), isConstructible, isCopyConstructible || triviallyCopyable, isMoveConstructible || triviallyCopyable, triviallyCopyable, false,
 																					  placementConstructor, copyConstructor, moveConstructor, placementDestructor);
-				types[lowerTypeName] = typeInfo.get();
+				insertType(lowerTypeName, typeInfo.get());
 				if (typeInfoToSet != nullptr)
 				{
 					*typeInfoToSet = typeInfo.get();
@@ -193,7 +210,7 @@ namespace jitcat::Reflection
 			else
 			{
 				std::unique_ptr<jitcat::Reflection::TypeInfo, TypeInfoDeleter> typeInfo = createEnumTypeInfo(typeName, TypeTraits<typename UnderlyingType<ReflectableT>::type>::toGenericType(), typeSize, std::move(typeCaster));
-				types[lowerTypeName] = typeInfo.get();
+				insertType(lowerTypeName, typeInfo.get());
 				jitcat::Reflection::TypeInfo* returnTypeInfo = typeInfo.get();
 				ownedTypes.emplace_back(std::move(typeInfo));
 				reflectEnum<ReflectableT>(*castToReflectedEnumTypeInfo(returnTypeInfo));
@@ -0,0 +1,21 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+namespace jitcat::Reflection
+{
+	class TypeInfo;
+
+	//A type and its TypeInfo::getVersion at the time a lookup was done on it. See TypeInfo::setRecordedLookups.
+	struct TypeVersion
+	{
+		const TypeInfo* type;
+		unsigned long long version;
+	};
+
+} //End namespace jitcat::Reflection
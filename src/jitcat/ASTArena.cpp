@@ -0,0 +1,154 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/ASTArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+using namespace jitcat::AST;
+
+
+namespace
+{
+	//The header in front of each object holds the arena it was allocated from. It is as large as the alignment
+	//of the objects, so that they remain suitably aligned.
+	constexpr std::size_t objectAlignment = alignof(std::max_align_t);
+	constexpr std::size_t headerSize = objectAlignment;
+	static_assert(sizeof(ASTArena*) <= headerSize);
+
+	//Expression ASTs typically take a few hundred bytes, so the first block is small. 
+	//Larger ASTs, such as those of CatLib source files, get increasingly larger blocks.
+	constexpr std::size_t firstBlockSize = 1024;
+	constexpr std::size_t maxBlockSize = 64 * 1024;
+
+	std::atomic<std::size_t> totalReservedMemory(0);
+
+
+	std::size_t alignSize(std::size_t size)
+	{
+		return (size + objectAlignment - 1) & ~(objectAlignment - 1);
+	}
+}
+
+
+thread_local ASTArena* ASTArena::currentArena = nullptr;
+
+
+ASTArena::ASTArena():
+	currentPosition(nullptr),
+	currentBlockEnd(nullptr),
+	nextBlockSize(firstBlockSize),
+	allocatedMemory(0),
+	reservedMemory(0)
+{
+}
+
+
+ASTArena::~ASTArena()
+{
+	for (char* block : blocks)
+	{
+		::operator delete(block);
+	}
+	totalReservedMemory.fetch_sub(reservedMemory, std::memory_order_relaxed);
+}
+
+
+ASTArena::Scope::Scope(ASTArena* arena):
+	previousArena(currentArena)
+{
+	currentArena = arena;
+}
+
+
+ASTArena::Scope::~Scope()
+{
+	currentArena = previousArena;
+}
+
+
+std::size_t ASTArena::getAllocatedMemory() const
+{
+	return allocatedMemory;
+}
+
+
+std::size_t ASTArena::getReservedMemory() const
+{
+	return reservedMemory;
+}
+
+
+std::size_t ASTArena::getNumBlocks() const
+{
+	return blocks.size();
+}
+
+
+void* ASTArena::allocateObject(std::size_t size, ASTArena* arena)
+{
+	const std::size_t totalSize = headerSize + alignSize(size);
+	char* memory = nullptr;
+	if (arena != nullptr)
+	{
+		memory = static_cast<char*>(arena->allocate(totalSize));
+	}
+	else
+	{
+		memory = static_cast<char*>(::operator new(totalSize));
+	}
+	*reinterpret_cast<ASTArena**>(memory) = arena;
+	return memory + headerSize;
+}
+
+
+void ASTArena::freeObject(void* object)
+{
+	if (object == nullptr)
+	{
+		return;
+	}
+	char* memory = static_cast<char*>(object) - headerSize;
+	if (*reinterpret_cast<ASTArena**>(memory) == nullptr)
+	{
+		::operator delete(memory);
+	}
+}
+
+
+ASTArena* ASTArena::getCurrent()
+{
+	return currentArena;
+}
+
+
+std::size_t ASTArena::getTotalReservedMemory()
+{
+	return totalReservedMemory.load(std::memory_order_relaxed);
+}
+
+
+void* ASTArena::allocate(std::size_t size)
+{
+	if ((std::size_t)(currentBlockEnd - currentPosition) < size)
+	{
+		//The remainder of the current block is abandoned.
+		const std::size_t blockSize = std::max(nextBlockSize, size);
+		currentPosition = static_cast<char*>(::operator new(blockSize));
+		currentBlockEnd = currentPosition + blockSize;
+		blocks.push_back(currentPosition);
+		reservedMemory += blockSize;
+		totalReservedMemory.fetch_add(blockSize, std::memory_order_relaxed);
+		nextBlockSize = std::min(nextBlockSize * 2, maxBlockSize);
+	}
+	void* memory = currentPosition;
+	currentPosition += size;
+	allocatedMemory += size;
+	return memory;
+}
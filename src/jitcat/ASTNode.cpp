@@ -0,0 +1,57 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/ASTNode.h"
+#include "jitcat/ASTArena.h"
+
+#include <atomic>
+
+using namespace jitcat::AST;
+
+
+namespace
+{
+	std::atomic<std::size_t> numAllocatedNodes(0);
+	std::atomic<std::size_t> allocatedMemory(0);
+	thread_local std::ptrdiff_t threadAllocatedMemory = 0;
+}
+
+
+void* ASTNode::operator new(std::size_t size)
+{
+	numAllocatedNodes.fetch_add(1, std::memory_order_relaxed);
+	allocatedMemory.fetch_add(size, std::memory_order_relaxed);
+	threadAllocatedMemory += (std::ptrdiff_t)size;
+	return ASTArena::allocateObject(size, ASTArena::getCurrent());
+}
+
+
+void ASTNode::operator delete(void* node, std::size_t size)
+{
+	numAllocatedNodes.fetch_sub(1, std::memory_order_relaxed);
+	allocatedMemory.fetch_sub(size, std::memory_order_relaxed);
+	threadAllocatedMemory -= (std::ptrdiff_t)size;
+	ASTArena::freeObject(node);
+}
+
+
+std::size_t ASTNode::getNumAllocatedNodes()
+{
+	return numAllocatedNodes.load(std::memory_order_relaxed);
+}
+
+
+std::size_t ASTNode::getAllocatedMemory()
+{
+	return allocatedMemory.load(std::memory_order_relaxed);
+}
+
+
+std::ptrdiff_t ASTNode::getThreadAllocatedMemory()
+{
+	return threadAllocatedMemory;
+}
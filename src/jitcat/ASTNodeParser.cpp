@@ -16,7 +16,7 @@ using namespace jitcat::Parser;
 using namespace jitcat::Tokenizer;
 
 
-ASTNodeParser::ASTNodeParser(const std::vector<StackItem*>& stack, std::size_t numItems, RuntimeContext* context):
+ASTNodeParser::ASTNodeParser(const std::vector<StackItem>& stack, std::size_t numItems, RuntimeContext* context):
 	stack(stack),
 	numItems(numItems),
 	context(context)
@@ -38,11 +38,11 @@ int ASTNodeParser::getNumItems() const
 }
 
 
-StackItem* ASTNodeParser::getItem(unsigned int index) const
+const StackItem* ASTNodeParser::getItem(unsigned int index) const
 {
 	if (startIndex + index < stack.size())
 	{
-		return stack[startIndex + index];
+		return &stack[startIndex + index];
 	}
 	else
 	{
@@ -56,11 +56,11 @@ ASTNode* ASTNodeParser::getASTNodeByIndex(unsigned int index) const
 	std::size_t currentIndex = 0;
 	for (std::size_t i = startIndex; i < stack.size(); i++)
 	{
-		if (stack[i]->astNode != nullptr)
+		if (stack[i].astNode != nullptr)
 		{
 			if (index == currentIndex)
 			{
-				return stack[i]->astNode;
+				return stack[i].astNode;
 			}
 			currentIndex++;
 		}
@@ -74,11 +74,11 @@ const ParseToken* ASTNodeParser::getTerminalByIndex(unsigned int index) const
 	std::size_t currentIndex = 0;
 	for (std::size_t i = startIndex; i < stack.size(); i++)
 	{
-		if (stack[i]->getTokenIfToken() != nullptr)
+		if (stack[i].getTokenIfToken() != nullptr)
 		{
 			if (index == currentIndex)
 			{
-				return stack[i]->getTokenIfToken();
+				return stack[i].getTokenIfToken();
 			}
 			currentIndex++;
 		}
@@ -101,14 +101,14 @@ Tokenizer::Lexeme jitcat::Parser::ASTNodeParser::getStackLexeme() const
 	{
 		const char* itemStart = nullptr;
 		const char* itemEnd = nullptr;
-		if (stack[i]->astNode != nullptr)
+		if (stack[i].astNode != nullptr)
 		{
-			itemStart = stack[i]->astNode->getLexeme().data();
-			itemEnd = itemStart + stack[i]->astNode->getLexeme().length();
+			itemStart = stack[i].astNode->getLexeme().data();
+			itemEnd = itemStart + stack[i].astNode->getLexeme().length();
 		}
-		else if (stack[i]->getTokenIfToken() != nullptr)
+		else if (stack[i].getTokenIfToken() != nullptr)
 		{
-			const Lexeme& tokenLexeme = stack[i]->getTokenIfToken()->lexeme;
+			const Lexeme& tokenLexeme = stack[i].getTokenIfToken()->lexeme;
 			itemStart = tokenLexeme.data();
 			itemEnd = itemStart + tokenLexeme.length();
 		}
@@ -15,11 +15,11 @@ ArrayTypeInfo::ArrayTypeInfo(CatGenericType arrayItemType):
 	TypeInfo("array", sizeof(Array), std::make_unique<ObjectTypeCaster<Array>>()),
 	arrayItemType(arrayItemType)
 {
-	memberFunctions.emplace("__init", std::make_unique<ArrayMemberFunctionInfo>(ArrayMemberFunctionInfo::Operation::Init, this));
-	memberFunctions.emplace("__destroy", std::make_unique<ArrayMemberFunctionInfo>(ArrayMemberFunctionInfo::Operation::Destroy, this));
-	memberFunctions.emplace("size", std::make_unique<ArrayMemberFunctionInfo>(ArrayMemberFunctionInfo::Operation::Size, this));
-	memberFunctions.emplace("resize", std::make_unique<ArrayMemberFunctionInfo>(ArrayMemberFunctionInfo::Operation::Resize, this));
-	memberFunctions.emplace("[]", std::make_unique<ArrayMemberFunctionInfo>(ArrayMemberFunctionInfo::Operation::Index, this));
+	insertMemberFunction("__init", new ArrayMemberFunctionInfo(ArrayMemberFunctionInfo::Operation::Init, this));
+	insertMemberFunction("__destroy", new ArrayMemberFunctionInfo(ArrayMemberFunctionInfo::Operation::Destroy, this));
+	insertMemberFunction("size", new ArrayMemberFunctionInfo(ArrayMemberFunctionInfo::Operation::Size, this));
+	insertMemberFunction("resize", new ArrayMemberFunctionInfo(ArrayMemberFunctionInfo::Operation::Resize, this));
+	insertMemberFunction("[]", new ArrayMemberFunctionInfo(ArrayMemberFunctionInfo::Operation::Index, this));
 	arrayItemType.addDependentType(this);
 }
 
@@ -175,6 +175,7 @@ bool ArrayTypeInfo::getAllowMoveConstruction() const
 
 ArrayTypeInfo& ArrayTypeInfo::createArrayTypeOf(const CatGenericType& arrayItemType)
 {
+	std::lock_guard<std::recursive_mutex> lock(arrayTypesMutex);
 	for (auto& iter : arrayTypes)
 	{
 		if (iter->getArrayItemType().compare(arrayItemType, true, true))
@@ -190,6 +191,7 @@ ArrayTypeInfo& ArrayTypeInfo::createArrayTypeOf(const CatGenericType& arrayItemT
 
 void ArrayTypeInfo::deleteArrayTypeOfType(const CatGenericType& arrayItemType)
 {
+	std::lock_guard<std::recursive_mutex> lock(arrayTypesMutex);
 	int size = (int)arrayTypes.size();
 	for (int i = 0; i < size; i++)
 	{
@@ -215,4 +217,5 @@ std::size_t ArrayTypeInfo::getItemSize() const
 }
 
 
-std::vector<ArrayTypeInfo*> ArrayTypeInfo::arrayTypes = std::vector<ArrayTypeInfo*>();
\ No newline at end of file
+std::vector<ArrayTypeInfo*> ArrayTypeInfo::arrayTypes = std::vector<ArrayTypeInfo*>();
+std::recursive_mutex ArrayTypeInfo::arrayTypesMutex;
\ No newline at end of file
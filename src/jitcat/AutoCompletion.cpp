@@ -322,8 +322,8 @@ void AutoCompletion::addOptionsFromTypeInfo(TypeInfo* typeInfo, std::vector<Auto
 		const auto& memberFunctions = typeInfo->getMemberFunctions();
 		for (const auto& iter : members)
 		{
-			std::size_t findLocation = iter.first.find(lowercasePrefix);
-			if (findLocation != iter.first.npos)
+			std::size_t findLocation = Tools::toLowerCase(iter.second->getMemberName()).find(lowercasePrefix);
+			if (findLocation != std::string::npos)
 			{
 				std::string newExpression = originalExpression;
 				std::string replacement = iter.second->getMemberName();
@@ -334,17 +334,20 @@ void AutoCompletion::addOptionsFromTypeInfo(TypeInfo* typeInfo, std::vector<Auto
 		}
 		for (const auto& iter : memberFunctions)
 		{
-			std::size_t findLocation = iter.first.find(lowercasePrefix);
-			if (findLocation != iter.first.npos)
+			for (const auto& memberFunction : iter.second)
 			{
-				std::string newExpression = originalExpression;
-				std::string parenthesesToAdd = "(";
-				if (iter.second->getNumberOfArguments() == 0)
+				std::size_t findLocation = memberFunction->getLowerCaseFunctionName().find(lowercasePrefix);
+				if (findLocation != std::string::npos)
 				{
-					parenthesesToAdd = "()";
+					std::string newExpression = originalExpression;
+					std::string parenthesesToAdd = "(";
+					if (memberFunction->getNumberOfArguments() == 0)
+					{
+						parenthesesToAdd = "()";
+					}
+					newExpression.replace(prefixOffset, lowercasePrefix.size(), memberFunction->getMemberFunctionName() + parenthesesToAdd);
+					results.push_back(AutoCompletionEntry(newExpression, memberFunction->getMemberFunctionName()  + parenthesesToAdd, findLocation == 0, prefixOffset + memberFunction->getMemberFunctionName().size() + parenthesesToAdd.size()));
 				}
-				newExpression.replace(prefixOffset, lowercasePrefix.size(), iter.second->getMemberFunctionName() + parenthesesToAdd);
-				results.push_back(AutoCompletionEntry(newExpression, iter.second->getMemberFunctionName()  + parenthesesToAdd, findLocation == 0, prefixOffset + iter.second->getMemberFunctionName().size() + parenthesesToAdd.size()));
 			}
 		}
 	}
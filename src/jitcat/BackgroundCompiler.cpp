@@ -0,0 +1,102 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/BackgroundCompiler.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace jitcat;
+
+
+BackgroundCompiler::BackgroundCompiler():
+	runningOwner(nullptr),
+	runningContext(nullptr),
+	stopping(false)
+{
+}
+
+
+BackgroundCompiler::~BackgroundCompiler()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+		jobs.clear();
+	}
+	jobQueued.notify_all();
+	if (thread.joinable())
+	{
+		thread.join();
+	}
+}
+
+
+void BackgroundCompiler::enqueue(const void* owner, const void* context, std::function<void()> job)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		jobs.push_back({owner, context, std::move(job)});
+		if (!thread.joinable())
+		{
+			thread = std::thread(&BackgroundCompiler::run, this);
+		}
+	}
+	jobQueued.notify_one();
+}
+
+
+void BackgroundCompiler::cancel(const void* ownerOrContext)
+{
+	assert(ownerOrContext != nullptr);
+	std::unique_lock<std::mutex> lock(mutex);
+	jobs.erase(std::remove_if(jobs.begin(), jobs.end(), [&](const Job& job) {return job.owner == ownerOrContext || job.context == ownerOrContext;}), jobs.end());
+	jobFinished.notify_all();
+	//A job that cancels jobs of its own owner must not wait for itself.
+	if (std::this_thread::get_id() != thread.get_id())
+	{
+		jobFinished.wait(lock, [&]() {return runningOwner != ownerOrContext && runningContext != ownerOrContext;});
+	}
+}
+
+
+void BackgroundCompiler::waitUntilIdle()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	jobFinished.wait(lock, [&]() {return jobs.empty() && runningOwner == nullptr;});
+}
+
+
+std::size_t BackgroundCompiler::getNumQueuedJobs()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return jobs.size();
+}
+
+
+void BackgroundCompiler::run()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		jobQueued.wait(lock, [&]() {return stopping || !jobs.empty();});
+		if (stopping)
+		{
+			return;
+		}
+		Job job = std::move(jobs.front());
+		jobs.pop_front();
+		runningOwner = job.owner;
+		runningContext = job.context;
+		lock.unlock();
+		job.function();
+		lock.lock();
+		runningOwner = nullptr;
+		runningContext = nullptr;
+		jobFinished.notify_all();
+	}
+}
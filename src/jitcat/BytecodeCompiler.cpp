@@ -0,0 +1,641 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/BytecodeCompiler.h"
+#include "jitcat/CatArgumentList.h"
+#include "jitcat/CatBuiltInFunctionCall.h"
+#include "jitcat/CatGenericType.h"
+#include "jitcat/CatInfixOperator.h"
+#include "jitcat/CatLiteral.h"
+#include "jitcat/CatMemberAccess.h"
+#include "jitcat/CatPrefixOperator.h"
+#include "jitcat/CatScopeRoot.h"
+#include "jitcat/CatTypedExpression.h"
+#include "jitcat/ColumnBinding.h"
+#include "jitcat/TypeMemberInfo.h"
+
+#include <cassert>
+#include <limits>
+
+using namespace jitcat;
+using namespace jitcat::AST;
+using namespace jitcat::Bytecode;
+using namespace jitcat::Reflection;
+
+
+namespace
+{
+	//Opcodes for the infix operators Plus up to and including NotEquals, in the order of CatInfixOperatorType.
+	constexpr std::size_t numScalarInfixOperators = (std::size_t)CatInfixOperatorType::NotEquals + 1;
+	constexpr BytecodeOpcode intInfixOpcodes[numScalarInfixOperators] =
+	{
+		BytecodeOpcode::IntAdd, BytecodeOpcode::IntSubtract, BytecodeOpcode::IntMultiply, BytecodeOpcode::IntDivide, BytecodeOpcode::IntModulo,
+		BytecodeOpcode::IntGreater, BytecodeOpcode::IntSmaller, BytecodeOpcode::IntGreaterOrEqual, BytecodeOpcode::IntSmallerOrEqual,
+		BytecodeOpcode::IntEquals, BytecodeOpcode::IntNotEquals
+	};
+	constexpr BytecodeOpcode floatInfixOpcodes[numScalarInfixOperators] =
+	{
+		BytecodeOpcode::FloatAdd, BytecodeOpcode::FloatSubtract, BytecodeOpcode::FloatMultiply, BytecodeOpcode::FloatDivide, BytecodeOpcode::FloatModulo,
+		BytecodeOpcode::FloatGreater, BytecodeOpcode::FloatSmaller, BytecodeOpcode::FloatGreaterOrEqual, BytecodeOpcode::FloatSmallerOrEqual,
+		BytecodeOpcode::FloatEquals, BytecodeOpcode::FloatNotEquals
+	};
+	constexpr BytecodeOpcode doubleInfixOpcodes[numScalarInfixOperators] =
+	{
+		BytecodeOpcode::DoubleAdd, BytecodeOpcode::DoubleSubtract, BytecodeOpcode::DoubleMultiply, BytecodeOpcode::DoubleDivide, BytecodeOpcode::DoubleModulo,
+		BytecodeOpcode::DoubleGreater, BytecodeOpcode::DoubleSmaller, BytecodeOpcode::DoubleGreaterOrEqual, BytecodeOpcode::DoubleSmallerOrEqual,
+		BytecodeOpcode::DoubleEquals, BytecodeOpcode::DoubleNotEquals
+	};
+
+
+	inline bool isNumericKind(RegisterKind kind)
+	{
+		return kind == RegisterKind::Int || kind == RegisterKind::Float || kind == RegisterKind::Double;
+	}
+
+
+	inline RegisterKind getWidestKind(RegisterKind left, RegisterKind right)
+	{
+		if (left == RegisterKind::Double || right == RegisterKind::Double)	return RegisterKind::Double;
+		else if (left == RegisterKind::Float || right == RegisterKind::Float)	return RegisterKind::Float;
+		else																	return RegisterKind::Int;
+	}
+
+
+	//Returns true if the built-in function is a float/double math function that takes a single argument.
+	inline bool getUnaryMathOpcodes(CatBuiltInFunctionType function, BytecodeOpcode& floatOpcode, BytecodeOpcode& doubleOpcode)
+	{
+		switch (function)
+		{
+			case CatBuiltInFunctionType::Sin:	floatOpcode = BytecodeOpcode::FloatSin;		doubleOpcode = BytecodeOpcode::DoubleSin;	return true;
+			case CatBuiltInFunctionType::Cos:	floatOpcode = BytecodeOpcode::FloatCos;		doubleOpcode = BytecodeOpcode::DoubleCos;	return true;
+			case CatBuiltInFunctionType::Tan:	floatOpcode = BytecodeOpcode::FloatTan;		doubleOpcode = BytecodeOpcode::DoubleTan;	return true;
+			case CatBuiltInFunctionType::Asin:	floatOpcode = BytecodeOpcode::FloatAsin;	doubleOpcode = BytecodeOpcode::DoubleAsin;	return true;
+			case CatBuiltInFunctionType::Acos:	floatOpcode = BytecodeOpcode::FloatAcos;	doubleOpcode = BytecodeOpcode::DoubleAcos;	return true;
+			case CatBuiltInFunctionType::Atan:	floatOpcode = BytecodeOpcode::FloatAtan;	doubleOpcode = BytecodeOpcode::DoubleAtan;	return true;
+			case CatBuiltInFunctionType::Sinh:	floatOpcode = BytecodeOpcode::FloatSinh;	doubleOpcode = BytecodeOpcode::DoubleSinh;	return true;
+			case CatBuiltInFunctionType::Cosh:	floatOpcode = BytecodeOpcode::FloatCosh;	doubleOpcode = BytecodeOpcode::DoubleCosh;	return true;
+			case CatBuiltInFunctionType::Tanh:	floatOpcode = BytecodeOpcode::FloatTanh;	doubleOpcode = BytecodeOpcode::DoubleTanh;	return true;
+			case CatBuiltInFunctionType::Asinh:	floatOpcode = BytecodeOpcode::FloatAsinh;	doubleOpcode = BytecodeOpcode::DoubleAsinh;	return true;
+			case CatBuiltInFunctionType::Acosh:	floatOpcode = BytecodeOpcode::FloatAcosh;	doubleOpcode = BytecodeOpcode::DoubleAcosh;	return true;
+			case CatBuiltInFunctionType::Atanh:	floatOpcode = BytecodeOpcode::FloatAtanh;	doubleOpcode = BytecodeOpcode::DoubleAtanh;	return true;
+			case CatBuiltInFunctionType::Log10:	floatOpcode = BytecodeOpcode::FloatLog10;	doubleOpcode = BytecodeOpcode::DoubleLog10;	return true;
+			case CatBuiltInFunctionType::Ln:	floatOpcode = BytecodeOpcode::FloatLn;		doubleOpcode = BytecodeOpcode::DoubleLn;	return true;
+			case CatBuiltInFunctionType::Exp:	floatOpcode = BytecodeOpcode::FloatExp;		doubleOpcode = BytecodeOpcode::DoubleExp;	return true;
+			case CatBuiltInFunctionType::Sqrt:	floatOpcode = BytecodeOpcode::FloatSqrt;	doubleOpcode = BytecodeOpcode::DoubleSqrt;	return true;
+			default:							return false;
+		}
+	}
+}
+
+
+BytecodeCompiler::BytecodeCompiler(BytecodeProgram* program):
+	program(program),
+	numLoweredNodes(0),
+	registerOverflow(false),
+	columns(nullptr),
+	columnScopeId(InvalidScopeID),
+	columnError(false)
+{
+}
+
+
+std::unique_ptr<BytecodeProgram> BytecodeCompiler::compile(const CatTypedExpression* expression)
+{
+	RegisterKind resultKind = RegisterKind::Bool;
+	if (expression == nullptr || !getRegisterKind(expression->getType(), resultKind))
+	{
+		return nullptr;
+	}
+	std::unique_ptr<BytecodeProgram> program(new BytecodeProgram(expression->getType(), resultKind));
+	BytecodeCompiler compiler(program.get());
+	program->resultRegister = compiler.generate(expression);
+	if (compiler.registerOverflow || compiler.numLoweredNodes == 0)
+	{
+		return nullptr;
+	}
+	return program;
+}
+
+
+std::unique_ptr<BytecodeProgram> BytecodeCompiler::compileColumns(const CatTypedExpression* expression, CatScopeID columnScopeId, const ColumnBinding& columns)
+{
+	RegisterKind resultKind = RegisterKind::Bool;
+	if (expression == nullptr || !getRegisterKind(expression->getType(), resultKind) || resultKind == RegisterKind::Pointer)
+	{
+		return nullptr;
+	}
+	std::unique_ptr<BytecodeProgram> program(new BytecodeProgram(expression->getType(), resultKind));
+	BytecodeCompiler compiler(program.get());
+	compiler.columns = &columns;
+	compiler.columnScopeId = columnScopeId;
+	program->resultRegister = compiler.generate(expression);
+	if (compiler.registerOverflow || compiler.columnError)
+	{
+		return nullptr;
+	}
+	return program;
+}
+
+
+bool BytecodeCompiler::getRegisterKind(const CatGenericType& type, RegisterKind& kind)
+{
+	if		(type.isBoolType())							kind = RegisterKind::Bool;
+	else if (type.isIntType())							kind = RegisterKind::Int;
+	else if (type.isFloatType())						kind = RegisterKind::Float;
+	else if (type.isDoubleType())						kind = RegisterKind::Double;
+	else if (type.isPointerToReflectableObjectType())	kind = RegisterKind::Pointer;
+	else												return false;
+	return true;
+}
+
+
+unsigned short BytecodeCompiler::generate(const CatTypedExpression* expression)
+{
+	RegisterKind kind = RegisterKind::Bool;
+	bool isRegisterType = getRegisterKind(expression->getType(), kind);
+	assert(isRegisterType);
+	(void)isRegisterType;
+	switch (expression->getNodeType())
+	{
+		case CatASTNodeType::BuiltInFunctionCall:	return generate(static_cast<const CatBuiltInFunctionCall*>(expression), kind);
+		case CatASTNodeType::InfixOperator:			return generate(static_cast<const CatInfixOperator*>(expression), kind);
+		case CatASTNodeType::Literal:				return generate(static_cast<const CatLiteral*>(expression), kind);
+		case CatASTNodeType::MemberAccess:			return generate(static_cast<const CatMemberAccess*>(expression), kind);
+		case CatASTNodeType::PrefixOperator:		return generate(static_cast<const CatPrefixOperator*>(expression), kind);
+		case CatASTNodeType::ScopeRoot:				return generate(static_cast<const CatScopeRoot*>(expression));
+		default:									return generateFallback(expression, kind);
+	}
+}
+
+
+unsigned short BytecodeCompiler::generate(const CatBuiltInFunctionCall* functionCall, RegisterKind resultKind)
+{
+	const CatArgumentList* arguments = functionCall->getArgumentList();
+	std::size_t numArguments = arguments->getNumArguments();
+	//Get the register kinds of the arguments, if any of the arguments does not fit in a register, the function call is not lowered.
+	RegisterKind argumentKinds[3] = {RegisterKind::Bool, RegisterKind::Bool, RegisterKind::Bool};
+	for (std::size_t i = 0; i < numArguments; ++i)
+	{
+		if (i >= 3 || !getRegisterKind(arguments->getArgumentType(i), argumentKinds[i]) || argumentKinds[i] == RegisterKind::Pointer)
+		{
+			return generateFallback(functionCall, resultKind);
+		}
+	}
+	auto generateArgument = [&](std::size_t index, RegisterKind targetKind)
+	{
+		return generateConversion(generate(arguments->getArgument(index)), argumentKinds[index], targetKind);
+	};
+
+	CatBuiltInFunctionType function = functionCall->getFunctionType();
+	BytecodeOpcode floatOpcode = BytecodeOpcode::FloatSin;
+	BytecodeOpcode doubleOpcode = BytecodeOpcode::DoubleSin;
+	if (getUnaryMathOpcodes(function, floatOpcode, doubleOpcode) && numArguments == 1)
+	{
+		numLoweredNodes++;
+		if (argumentKinds[0] == RegisterKind::Double)	return emit(doubleOpcode, generateArgument(0, RegisterKind::Double));
+		else											return emit(floatOpcode, generateArgument(0, RegisterKind::Float));
+	}
+	switch (function)
+	{
+		case CatBuiltInFunctionType::ToInt:
+		case CatBuiltInFunctionType::ToFloat:
+		case CatBuiltInFunctionType::ToDouble:
+		case CatBuiltInFunctionType::ToBool:
+		{
+			numLoweredNodes++;
+			return generateArgument(0, resultKind);
+		}
+		case CatBuiltInFunctionType::Ceil:
+		case CatBuiltInFunctionType::Floor:
+		{
+			numLoweredNodes++;
+			bool isCeil = function == CatBuiltInFunctionType::Ceil;
+			if		(argumentKinds[0] == RegisterKind::Double)	return emit(isCeil ? BytecodeOpcode::DoubleCeil : BytecodeOpcode::DoubleFloor, generateArgument(0, RegisterKind::Double));
+			else if (argumentKinds[0] == RegisterKind::Float)	return emit(isCeil ? BytecodeOpcode::FloatCeil : BytecodeOpcode::FloatFloor, generateArgument(0, RegisterKind::Float));
+			//Integers are only converted to float.
+			else												return generateArgument(0, RegisterKind::Float);
+		}
+		case CatBuiltInFunctionType::Abs:
+		{
+			switch (argumentKinds[0])
+			{
+				case RegisterKind::Float:	numLoweredNodes++; return emit(BytecodeOpcode::FloatAbs, generateArgument(0, RegisterKind::Float));
+				case RegisterKind::Double:	numLoweredNodes++; return emit(BytecodeOpcode::DoubleAbs, generateArgument(0, RegisterKind::Double));
+				case RegisterKind::Int:		numLoweredNodes++; return emit(BytecodeOpcode::IntAbs, generateArgument(0, RegisterKind::Int));
+				default:					return generateFallback(functionCall, resultKind);
+			}
+		}
+		case CatBuiltInFunctionType::Pow:
+		case CatBuiltInFunctionType::Atan2:
+		case CatBuiltInFunctionType::Hypot:
+		{
+			numLoweredNodes++;
+			RegisterKind kind = (argumentKinds[0] == RegisterKind::Double || argumentKinds[1] == RegisterKind::Double) ? RegisterKind::Double : RegisterKind::Float;
+			BytecodeOpcode opcode = BytecodeOpcode::FloatPow;
+			switch (function)
+			{
+				case CatBuiltInFunctionType::Pow:	opcode = kind == RegisterKind::Double ? BytecodeOpcode::DoublePow : BytecodeOpcode::FloatPow; break;
+				case CatBuiltInFunctionType::Atan2:	opcode = kind == RegisterKind::Double ? BytecodeOpcode::DoubleAtan2 : BytecodeOpcode::FloatAtan2; break;
+				default:							opcode = kind == RegisterKind::Double ? BytecodeOpcode::DoubleHypot : BytecodeOpcode::FloatHypot; break;
+			}
+			unsigned short left = generateArgument(0, kind);
+			unsigned short right = generateArgument(1, kind);
+			return emit(opcode, left, right);
+		}
+		case CatBuiltInFunctionType::Min:
+		case CatBuiltInFunctionType::Max:
+		{
+			//The type of the first argument determines the type of the result.
+			RegisterKind kind = argumentKinds[0];
+			if (!isNumericKind(kind))
+			{
+				return generateFallback(functionCall, resultKind);
+			}
+			numLoweredNodes++;
+			bool isMin = function == CatBuiltInFunctionType::Min;
+			BytecodeOpcode opcode = BytecodeOpcode::IntMin;
+			switch (kind)
+			{
+				case RegisterKind::Double:	opcode = isMin ? BytecodeOpcode::DoubleMin : BytecodeOpcode::DoubleMax; break;
+				case RegisterKind::Float:	opcode = isMin ? BytecodeOpcode::FloatMin : BytecodeOpcode::FloatMax; break;
+				default:					opcode = isMin ? BytecodeOpcode::IntMin : BytecodeOpcode::IntMax; break;
+			}
+			unsigned short left = generateArgument(0, kind);
+			unsigned short right = generateArgument(1, kind);
+			return emit(opcode, left, right);
+		}
+		case CatBuiltInFunctionType::Cap:
+		{
+			RegisterKind kind = argumentKinds[0];
+			if (!isNumericKind(kind))
+			{
+				return generateFallback(functionCall, resultKind);
+			}
+			numLoweredNodes++;
+			BytecodeOpcode minOpcode = BytecodeOpcode::IntMin;
+			BytecodeOpcode maxOpcode = BytecodeOpcode::IntMax;
+			switch (kind)
+			{
+				case RegisterKind::Double:	minOpcode = BytecodeOpcode::DoubleMin; maxOpcode = BytecodeOpcode::DoubleMax; break;
+				case RegisterKind::Float:	minOpcode = BytecodeOpcode::FloatMin; maxOpcode = BytecodeOpcode::FloatMax; break;
+				default:					break;
+			}
+			unsigned short value = generateArgument(0, kind);
+			unsigned short capMin = generateArgument(1, kind);
+			unsigned short capMax = generateArgument(2, kind);
+			//Equivalent to swapping the bounds if capMin > capMax.
+			unsigned short lowerBound = emit(minOpcode, capMin, capMax);
+			unsigned short upperBound = emit(maxOpcode, capMin, capMax);
+			return emit(maxOpcode, lowerBound, emit(minOpcode, upperBound, value));
+		}
+		case CatBuiltInFunctionType::Select:
+		{
+			RegisterKind firstKind = RegisterKind::Bool;
+			RegisterKind secondKind = RegisterKind::Bool;
+			if (argumentKinds[0] != RegisterKind::Bool
+				|| !getRegisterKind(arguments->getArgumentType(1), firstKind) || firstKind != resultKind
+				|| !getRegisterKind(arguments->getArgumentType(2), secondKind) || secondKind != resultKind)
+			{
+				return generateFallback(functionCall, resultKind);
+			}
+			numLoweredNodes++;
+			return generateSelect(generate(arguments->getArgument(0)), arguments->getArgument(1), arguments->getArgument(2));
+		}
+		default:
+			return generateFallback(functionCall, resultKind);
+	}
+}
+
+
+unsigned short BytecodeCompiler::generate(const CatInfixOperator* infixOperator, RegisterKind resultKind)
+{
+	const CatTypedExpression* lhs = infixOperator->getLeft();
+	const CatTypedExpression* rhs = infixOperator->getRight();
+	RegisterKind leftKind = RegisterKind::Bool;
+	RegisterKind rightKind = RegisterKind::Bool;
+	//Overloaded operators have no left and right operands.
+	if (lhs == nullptr || rhs == nullptr
+		|| !getRegisterKind(lhs->getType(), leftKind)
+		|| !getRegisterKind(rhs->getType(), rightKind))
+	{
+		return generateFallback(infixOperator, resultKind);
+	}
+	CatInfixOperatorType oper = infixOperator->getOperatorType();
+	if (oper == CatInfixOperatorType::LogicalAnd || oper == CatInfixOperatorType::LogicalOr)
+	{
+		if (leftKind != RegisterKind::Bool || rightKind != RegisterKind::Bool)
+		{
+			return generateFallback(infixOperator, resultKind);
+		}
+		numLoweredNodes++;
+		//Short-circuit: the right hand side is only evaluated if the left hand side does not determine the result.
+		unsigned short result = allocateRegister();
+		unsigned short left = generate(lhs);
+		emitMove(result, left);
+		std::size_t jump = emitJump(oper == CatInfixOperatorType::LogicalAnd ? BytecodeOpcode::JumpIfFalse : BytecodeOpcode::JumpIfTrue, left);
+		emitMove(result, generate(rhs));
+		patchJump(jump);
+		return result;
+	}
+	else if (isNumericKind(leftKind) && isNumericKind(rightKind) && (std::size_t)oper < numScalarInfixOperators)
+	{
+		numLoweredNodes++;
+		RegisterKind kind = getWidestKind(leftKind, rightKind);
+		unsigned short left = generateConversion(generate(lhs), leftKind, kind);
+		unsigned short right = generateConversion(generate(rhs), rightKind, kind);
+		switch (kind)
+		{
+			case RegisterKind::Double:	return emit(doubleInfixOpcodes[(std::size_t)oper], left, right);
+			case RegisterKind::Float:	return emit(floatInfixOpcodes[(std::size_t)oper], left, right);
+			default:					return emit(intInfixOpcodes[(std::size_t)oper], left, right);
+		}
+	}
+	else if (leftKind == rightKind
+			 && (leftKind == RegisterKind::Bool || leftKind == RegisterKind::Pointer)
+			 && (oper == CatInfixOperatorType::Equals || oper == CatInfixOperatorType::NotEquals))
+	{
+		numLoweredNodes++;
+		bool isEquals = oper == CatInfixOperatorType::Equals;
+		BytecodeOpcode opcode = BytecodeOpcode::BoolEquals;
+		if (leftKind == RegisterKind::Bool)	opcode = isEquals ? BytecodeOpcode::BoolEquals : BytecodeOpcode::BoolNotEquals;
+		else								opcode = isEquals ? BytecodeOpcode::PointerEquals : BytecodeOpcode::PointerNotEquals;
+		unsigned short left = generate(lhs);
+		unsigned short right = generate(rhs);
+		return emit(opcode, left, right);
+	}
+	return generateFallback(infixOperator, resultKind);
+}
+
+
+unsigned short BytecodeCompiler::generate(const CatLiteral* literal, RegisterKind resultKind)
+{
+	numLoweredNodes++;
+	BytecodeRegister value;
+	value.pointerValue = 0;
+	const std::any& literalValue = literal->getValue();
+	switch (resultKind)
+	{
+		case RegisterKind::Bool:	value.boolValue = std::any_cast<bool>(literalValue); break;
+		case RegisterKind::Int:		value.intValue = std::any_cast<int>(literalValue); break;
+		case RegisterKind::Float:	value.floatValue = std::any_cast<float>(literalValue); break;
+		case RegisterKind::Double:	value.doubleValue = std::any_cast<double>(literalValue); break;
+		case RegisterKind::Pointer:	value.pointerValue = literal->getType().getRawPointer(literalValue); break;
+	}
+	return emitConstant(value);
+}
+
+
+unsigned short BytecodeCompiler::generate(const CatMemberAccess* memberAccess, RegisterKind resultKind)
+{
+	unsigned short columnResult = 0;
+	if (generateColumnLoad(memberAccess, resultKind, columnResult))
+	{
+		return columnResult;
+	}
+	TypeMemberInfo* memberInfo = memberAccess->getMemberInfo();
+	const CatTypedExpression* base = memberAccess->getBase();
+	RegisterKind baseKind = RegisterKind::Bool;
+	if (memberInfo == nullptr || base == nullptr
+		|| !getRegisterKind(base->getType(), baseKind) || baseKind != RegisterKind::Pointer)
+	{
+		return generateFallback(memberAccess, resultKind);
+	}
+	numLoweredNodes++;
+	std::size_t offset = 0;
+	DirectMemberAccess directAccess = memberInfo->getDirectMemberAccess(offset);
+	unsigned short baseRegister = generate(base);
+	if (directAccess == DirectMemberAccess::Value)
+	{
+		switch (resultKind)
+		{
+			case RegisterKind::Bool:	return emit(BytecodeOpcode::LoadMemberBool, baseRegister, 0, offset);
+			case RegisterKind::Int:		return emit(BytecodeOpcode::LoadMemberInt, baseRegister, 0, offset);
+			case RegisterKind::Float:	return emit(BytecodeOpcode::LoadMemberFloat, baseRegister, 0, offset);
+			case RegisterKind::Double:	return emit(BytecodeOpcode::LoadMemberDouble, baseRegister, 0, offset);
+			case RegisterKind::Pointer:	return emit(BytecodeOpcode::LoadMemberPointer, baseRegister, 0, offset);
+		}
+	}
+	else if (directAccess == DirectMemberAccess::Address && resultKind == RegisterKind::Pointer)
+	{
+		return emit(BytecodeOpcode::MemberAddress, baseRegister, 0, offset);
+	}
+	std::size_t nodeIndex = program->nodes.size();
+	program->nodes.push_back(const_cast<CatMemberAccess*>(memberAccess));
+	switch (resultKind)
+	{
+		case RegisterKind::Bool:	return emit(BytecodeOpcode::LoadMemberIndirectBool, baseRegister, 0, nodeIndex);
+		case RegisterKind::Int:		return emit(BytecodeOpcode::LoadMemberIndirectInt, baseRegister, 0, nodeIndex);
+		case RegisterKind::Float:	return emit(BytecodeOpcode::LoadMemberIndirectFloat, baseRegister, 0, nodeIndex);
+		case RegisterKind::Double:	return emit(BytecodeOpcode::LoadMemberIndirectDouble, baseRegister, 0, nodeIndex);
+		default:					return emit(BytecodeOpcode::LoadMemberIndirectPointer, baseRegister, 0, nodeIndex);
+	}
+}
+
+
+unsigned short BytecodeCompiler::generate(const CatPrefixOperator* prefixOperator, RegisterKind resultKind)
+{
+	const CatTypedExpression* rhs = prefixOperator->getRHS();
+	RegisterKind rightKind = RegisterKind::Bool;
+	if (rhs == nullptr || !getRegisterKind(rhs->getType(), rightKind))
+	{
+		return generateFallback(prefixOperator, resultKind);
+	}
+	if (prefixOperator->getOperator() == CatPrefixOperator::Operator::Not && rightKind == RegisterKind::Bool)
+	{
+		numLoweredNodes++;
+		return emit(BytecodeOpcode::BoolNot, generate(rhs));
+	}
+	else if (prefixOperator->getOperator() == CatPrefixOperator::Operator::Minus && isNumericKind(rightKind))
+	{
+		numLoweredNodes++;
+		switch (rightKind)
+		{
+			case RegisterKind::Float:	return emit(BytecodeOpcode::FloatNegate, generate(rhs));
+			case RegisterKind::Double:	return emit(BytecodeOpcode::DoubleNegate, generate(rhs));
+			default:					return emit(BytecodeOpcode::IntNegate, generate(rhs));
+		}
+	}
+	return generateFallback(prefixOperator, resultKind);
+}
+
+
+unsigned short BytecodeCompiler::generate(const CatScopeRoot* scopeRoot)
+{
+	//When compiling columns, there is no object for the column scope.
+	if (columns != nullptr && scopeRoot->getScopeId() == columnScopeId)
+	{
+		columnError = true;
+	}
+	numLoweredNodes++;
+	BytecodeRegister scopeId;
+	scopeId.pointerValue = 0;
+	scopeId.intValue = (int)scopeRoot->getScopeId();
+	unsigned short result = allocateRegister();
+	program->instructions.push_back({BytecodeOpcode::LoadScopeObject, result, 0, 0, scopeId});
+	return result;
+}
+
+
+bool BytecodeCompiler::generateColumnLoad(const CatMemberAccess* memberAccess, RegisterKind resultKind, unsigned short& result)
+{
+	const CatTypedExpression* base = memberAccess->getBase();
+	if (columns == nullptr || base == nullptr || base->getNodeType() != CatASTNodeType::ScopeRoot
+		|| static_cast<const CatScopeRoot*>(base)->getScopeId() != columnScopeId)
+	{
+		return false;
+	}
+	const TypeMemberInfo* memberInfo = memberAccess->getMemberInfo();
+	if (memberInfo == nullptr || columns->getColumn(memberInfo) == nullptr || resultKind == RegisterKind::Pointer)
+	{
+		columnError = true;
+		return false;
+	}
+	std::vector<const TypeMemberInfo*>& columnMembers = program->columnMembers;
+	std::size_t columnIndex = 0;
+	while (columnIndex < columnMembers.size() && columnMembers[columnIndex] != memberInfo)
+	{
+		columnIndex++;
+	}
+	if (columnIndex == columnMembers.size())
+	{
+		columnMembers.push_back(memberInfo);
+	}
+	numLoweredNodes++;
+	switch (resultKind)
+	{
+		case RegisterKind::Bool:	result = emit(BytecodeOpcode::LoadColumnBool, 0, 0, columnIndex); break;
+		case RegisterKind::Int:		result = emit(BytecodeOpcode::LoadColumnInt, 0, 0, columnIndex); break;
+		case RegisterKind::Float:	result = emit(BytecodeOpcode::LoadColumnFloat, 0, 0, columnIndex); break;
+		default:					result = emit(BytecodeOpcode::LoadColumnDouble, 0, 0, columnIndex); break;
+	}
+	return true;
+}
+
+
+unsigned short BytecodeCompiler::generateFallback(const CatTypedExpression* expression, RegisterKind resultKind)
+{
+	if (columns != nullptr)
+	{
+		columnError = true;
+	}
+	std::size_t nodeIndex = program->nodes.size();
+	program->nodes.push_back(const_cast<CatTypedExpression*>(expression));
+	switch (resultKind)
+	{
+		case RegisterKind::Bool:	return emit(BytecodeOpcode::ExecuteFallbackBool, 0, 0, nodeIndex);
+		case RegisterKind::Int:		return emit(BytecodeOpcode::ExecuteFallbackInt, 0, 0, nodeIndex);
+		case RegisterKind::Float:	return emit(BytecodeOpcode::ExecuteFallbackFloat, 0, 0, nodeIndex);
+		case RegisterKind::Double:	return emit(BytecodeOpcode::ExecuteFallbackDouble, 0, 0, nodeIndex);
+		default:					return emit(BytecodeOpcode::ExecuteFallbackPointer, 0, 0, nodeIndex);
+	}
+}
+
+
+unsigned short BytecodeCompiler::generateConversion(unsigned short source, RegisterKind sourceKind, RegisterKind targetKind)
+{
+	if (sourceKind == targetKind)
+	{
+		return source;
+	}
+	assert(sourceKind != RegisterKind::Pointer && targetKind != RegisterKind::Pointer);
+	switch (sourceKind)
+	{
+		case RegisterKind::Bool:
+			switch (targetKind)
+			{
+				case RegisterKind::Int:		return emit(BytecodeOpcode::BoolToInt, source);
+				case RegisterKind::Float:	return emit(BytecodeOpcode::BoolToFloat, source);
+				default:					return emit(BytecodeOpcode::BoolToDouble, source);
+			}
+		case RegisterKind::Int:
+			switch (targetKind)
+			{
+				case RegisterKind::Bool:	return emit(BytecodeOpcode::IntToBool, source);
+				case RegisterKind::Float:	return emit(BytecodeOpcode::IntToFloat, source);
+				default:					return emit(BytecodeOpcode::IntToDouble, source);
+			}
+		case RegisterKind::Float:
+			switch (targetKind)
+			{
+				case RegisterKind::Bool:	return emit(BytecodeOpcode::FloatToBool, source);
+				case RegisterKind::Int:		return emit(BytecodeOpcode::FloatToInt, source);
+				default:					return emit(BytecodeOpcode::FloatToDouble, source);
+			}
+		default:
+			switch (targetKind)
+			{
+				case RegisterKind::Bool:	return emit(BytecodeOpcode::DoubleToBool, source);
+				case RegisterKind::Int:		return emit(BytecodeOpcode::DoubleToInt, source);
+				default:					return emit(BytecodeOpcode::DoubleToFloat, source);
+			}
+	}
+}
+
+
+unsigned short BytecodeCompiler::generateSelect(unsigned short condition, const CatTypedExpression* first, const CatTypedExpression* second)
+{
+	unsigned short result = allocateRegister();
+	std::size_t jumpToSecond = emitJump(BytecodeOpcode::JumpIfFalse, condition);
+	emitMove(result, generate(first));
+	std::size_t jumpToEnd = emitJump(BytecodeOpcode::Jump, 0);
+	patchJump(jumpToSecond);
+	emitMove(result, generate(second));
+	patchJump(jumpToEnd);
+	return result;
+}
+
+
+unsigned short BytecodeCompiler::emit(BytecodeOpcode opcode, unsigned short left, unsigned short right, uintptr_t immediate)
+{
+	BytecodeRegister immediateValue;
+	immediateValue.pointerValue = immediate;
+	unsigned short destination = allocateRegister();
+	program->instructions.push_back({opcode, destination, left, right, immediateValue});
+	return destination;
+}
+
+
+unsigned short BytecodeCompiler::emitConstant(const BytecodeRegister& value)
+{
+	unsigned short destination = allocateRegister();
+	program->instructions.push_back({BytecodeOpcode::LoadConstant, destination, 0, 0, value});
+	return destination;
+}
+
+
+void BytecodeCompiler::emitMove(unsigned short destination, unsigned short source)
+{
+	BytecodeRegister immediateValue;
+	immediateValue.pointerValue = 0;
+	program->instructions.push_back({BytecodeOpcode::Move, destination, source, 0, immediateValue});
+}
+
+
+std::size_t BytecodeCompiler::emitJump(BytecodeOpcode opcode, unsigned short condition)
+{
+	BytecodeRegister immediateValue;
+	immediateValue.pointerValue = 0;
+	program->instructions.push_back({opcode, 0, condition, 0, immediateValue});
+	return program->instructions.size() - 1;
+}
+
+
+void BytecodeCompiler::patchJump(std::size_t jumpInstruction)
+{
+	program->instructions[jumpInstruction].immediate.pointerValue = program->instructions.size();
+}
+
+
+unsigned short BytecodeCompiler::allocateRegister()
+{
+	if (program->numRegisters >= std::numeric_limits<unsigned short>::max())
+	{
+		registerOverflow = true;
+		return 0;
+	}
+	return (unsigned short)program->numRegisters++;
+}
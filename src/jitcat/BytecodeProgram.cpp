@@ -0,0 +1,321 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/BytecodeProgram.h"
+#include "jitcat/CatMemberAccess.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/CatTypedExpression.h"
+#include "jitcat/Configuration.h"
+#include "jitcat/TypeMemberInfo.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+
+using namespace jitcat;
+using namespace jitcat::AST;
+using namespace jitcat::Bytecode;
+using namespace jitcat::Reflection;
+
+
+namespace
+{
+	template<typename T>
+	inline T divide(T left, T right)
+	{
+		if constexpr (Configuration::divisionByZeroYieldsZero)
+		{
+			if (right != 0)
+			{
+				return left / right;
+			}
+			return T(0);
+		}
+		else
+		{
+			return left / right;
+		}
+	}
+
+
+	template<typename T>
+	inline T modulo(T left, T right)
+	{
+		if constexpr (Configuration::divisionByZeroYieldsZero)
+		{
+			if (right == 0)
+			{
+				return T(0);
+			}
+		}
+		if constexpr (std::is_same<T, float>::value)		return fmodf(left, right);
+		else if constexpr (std::is_same<T, double>::value)	return fmod(left, right);
+		else												return left % right;
+	}
+
+
+	template<typename T>
+	inline T loadAtOffset(uintptr_t base, uintptr_t offset)
+	{
+		if (base != 0)
+		{
+			return *reinterpret_cast<T*>(base + offset);
+		}
+		return T();
+	}
+}
+
+
+BytecodeProgram::BytecodeProgram(const CatGenericType& resultType, RegisterKind resultKind):
+	numRegisters(0),
+	resultRegister(0),
+	resultType(resultType),
+	resultKind(resultKind)
+{
+}
+
+
+BytecodeProgram::~BytecodeProgram()
+{
+}
+
+
+BytecodeRegister BytecodeProgram::execute(CatRuntimeContext* runtimeContext, const unsigned char* const* columnValues) const
+{
+	//Most programs fit in the fixed register buffer on the stack. Larger programs allocate their registers on the heap,
+	//so that the stack usage of execute does not grow with the size of the expression.
+	//The registers are value-initialized. Every register is written before it is read, but the compiler cannot prove that.
+	BytecodeRegister stackRegisters[maxStackRegisters] = {};
+	std::unique_ptr<BytecodeRegister[]> heapRegisters;
+	BytecodeRegister* r = stackRegisters;
+	if (numRegisters > maxStackRegisters)
+	{
+		heapRegisters.reset(new BytecodeRegister[numRegisters]());
+		r = heapRegisters.get();
+	}
+	const BytecodeInstruction* const code = instructions.data();
+	const BytecodeInstruction* const end = code + instructions.size();
+	const BytecodeInstruction* i = code;
+	while (i != end)
+	{
+		switch (i->opcode)
+		{
+			case BytecodeOpcode::LoadConstant:		r[i->destination] = i->immediate; break;
+			case BytecodeOpcode::LoadScopeObject:	r[i->destination].pointerValue = reinterpret_cast<uintptr_t>(runtimeContext->getScopeObject(static_cast<CatScopeID>(i->immediate.intValue))); break;
+			case BytecodeOpcode::Move:				r[i->destination] = r[i->left]; break;
+
+			case BytecodeOpcode::Jump:				i = code + i->immediate.pointerValue; continue;
+			case BytecodeOpcode::JumpIfFalse:		if (!r[i->left].boolValue)	{ i = code + i->immediate.pointerValue; continue; } break;
+			case BytecodeOpcode::JumpIfTrue:		if (r[i->left].boolValue)	{ i = code + i->immediate.pointerValue; continue; } break;
+
+			case BytecodeOpcode::LoadMemberBool:	r[i->destination].boolValue = loadAtOffset<bool>(r[i->left].pointerValue, i->immediate.pointerValue); break;
+			case BytecodeOpcode::LoadMemberInt:		r[i->destination].intValue = loadAtOffset<int>(r[i->left].pointerValue, i->immediate.pointerValue); break;
+			case BytecodeOpcode::LoadMemberFloat:	r[i->destination].floatValue = loadAtOffset<float>(r[i->left].pointerValue, i->immediate.pointerValue); break;
+			case BytecodeOpcode::LoadMemberDouble:	r[i->destination].doubleValue = loadAtOffset<double>(r[i->left].pointerValue, i->immediate.pointerValue); break;
+			case BytecodeOpcode::LoadMemberPointer:	r[i->destination].pointerValue = loadAtOffset<uintptr_t>(r[i->left].pointerValue, i->immediate.pointerValue); break;
+			case BytecodeOpcode::MemberAddress:		r[i->destination].pointerValue = r[i->left].pointerValue != 0 ? r[i->left].pointerValue + i->immediate.pointerValue : 0; break;
+
+			case BytecodeOpcode::LoadColumnBool:	r[i->destination].boolValue = *reinterpret_cast<const bool*>(columnValues[i->immediate.pointerValue]); break;
+			case BytecodeOpcode::LoadColumnInt:		r[i->destination].intValue = *reinterpret_cast<const int*>(columnValues[i->immediate.pointerValue]); break;
+			case BytecodeOpcode::LoadColumnFloat:	r[i->destination].floatValue = *reinterpret_cast<const float*>(columnValues[i->immediate.pointerValue]); break;
+			case BytecodeOpcode::LoadColumnDouble:	r[i->destination].doubleValue = *reinterpret_cast<const double*>(columnValues[i->immediate.pointerValue]); break;
+
+			case BytecodeOpcode::LoadMemberIndirectBool:
+			case BytecodeOpcode::LoadMemberIndirectInt:
+			case BytecodeOpcode::LoadMemberIndirectFloat:
+			case BytecodeOpcode::LoadMemberIndirectDouble:
+			case BytecodeOpcode::LoadMemberIndirectPointer:
+			{
+				const CatMemberAccess* memberAccess = static_cast<const CatMemberAccess*>(nodes[i->immediate.pointerValue]);
+				CatValue value = memberAccess->getMemberInfo()->getMemberValue(reinterpret_cast<unsigned char*>(r[i->left].pointerValue));
+				switch (i->opcode)
+				{
+					case BytecodeOpcode::LoadMemberIndirectBool:	r[i->destination].boolValue = value.getBool(); break;
+					case BytecodeOpcode::LoadMemberIndirectInt:		r[i->destination].intValue = value.getInt(); break;
+					case BytecodeOpcode::LoadMemberIndirectFloat:	r[i->destination].floatValue = value.getFloat(); break;
+					case BytecodeOpcode::LoadMemberIndirectDouble:	r[i->destination].doubleValue = value.getDouble(); break;
+					default:										r[i->destination].pointerValue = value.getPointer(); break;
+				}
+			} break;
+
+			case BytecodeOpcode::ExecuteFallbackBool:		r[i->destination].boolValue = nodes[i->immediate.pointerValue]->executeValue(runtimeContext).getBool(); break;
+			case BytecodeOpcode::ExecuteFallbackInt:		r[i->destination].intValue = nodes[i->immediate.pointerValue]->executeValue(runtimeContext).getInt(); break;
+			case BytecodeOpcode::ExecuteFallbackFloat:		r[i->destination].floatValue = nodes[i->immediate.pointerValue]->executeValue(runtimeContext).getFloat(); break;
+			case BytecodeOpcode::ExecuteFallbackDouble:		r[i->destination].doubleValue = nodes[i->immediate.pointerValue]->executeValue(runtimeContext).getDouble(); break;
+			case BytecodeOpcode::ExecuteFallbackPointer:	r[i->destination].pointerValue = nodes[i->immediate.pointerValue]->executeValue(runtimeContext).getPointer(); break;
+
+			case BytecodeOpcode::IntAdd:				r[i->destination].intValue = r[i->left].intValue + r[i->right].intValue; break;
+			case BytecodeOpcode::IntSubtract:			r[i->destination].intValue = r[i->left].intValue - r[i->right].intValue; break;
+			case BytecodeOpcode::IntMultiply:			r[i->destination].intValue = r[i->left].intValue * r[i->right].intValue; break;
+			case BytecodeOpcode::IntDivide:				r[i->destination].intValue = divide(r[i->left].intValue, r[i->right].intValue); break;
+			case BytecodeOpcode::IntModulo:				r[i->destination].intValue = modulo(r[i->left].intValue, r[i->right].intValue); break;
+			case BytecodeOpcode::IntGreater:			r[i->destination].boolValue = r[i->left].intValue > r[i->right].intValue; break;
+			case BytecodeOpcode::IntSmaller:			r[i->destination].boolValue = r[i->left].intValue < r[i->right].intValue; break;
+			case BytecodeOpcode::IntGreaterOrEqual:		r[i->destination].boolValue = r[i->left].intValue >= r[i->right].intValue; break;
+			case BytecodeOpcode::IntSmallerOrEqual:		r[i->destination].boolValue = r[i->left].intValue <= r[i->right].intValue; break;
+			case BytecodeOpcode::IntEquals:				r[i->destination].boolValue = r[i->left].intValue == r[i->right].intValue; break;
+			case BytecodeOpcode::IntNotEquals:			r[i->destination].boolValue = r[i->left].intValue != r[i->right].intValue; break;
+
+			case BytecodeOpcode::FloatAdd:				r[i->destination].floatValue = r[i->left].floatValue + r[i->right].floatValue; break;
+			case BytecodeOpcode::FloatSubtract:			r[i->destination].floatValue = r[i->left].floatValue - r[i->right].floatValue; break;
+			case BytecodeOpcode::FloatMultiply:			r[i->destination].floatValue = r[i->left].floatValue * r[i->right].floatValue; break;
+			case BytecodeOpcode::FloatDivide:			r[i->destination].floatValue = divide(r[i->left].floatValue, r[i->right].floatValue); break;
+			case BytecodeOpcode::FloatModulo:			r[i->destination].floatValue = modulo(r[i->left].floatValue, r[i->right].floatValue); break;
+			case BytecodeOpcode::FloatGreater:			r[i->destination].boolValue = r[i->left].floatValue > r[i->right].floatValue; break;
+			case BytecodeOpcode::FloatSmaller:			r[i->destination].boolValue = r[i->left].floatValue < r[i->right].floatValue; break;
+			case BytecodeOpcode::FloatGreaterOrEqual:	r[i->destination].boolValue = r[i->left].floatValue >= r[i->right].floatValue; break;
+			case BytecodeOpcode::FloatSmallerOrEqual:	r[i->destination].boolValue = r[i->left].floatValue <= r[i->right].floatValue; break;
+			case BytecodeOpcode::FloatEquals:			r[i->destination].boolValue = r[i->left].floatValue == r[i->right].floatValue; break;
+			case BytecodeOpcode::FloatNotEquals:		r[i->destination].boolValue = r[i->left].floatValue != r[i->right].floatValue; break;
+
+			case BytecodeOpcode::DoubleAdd:				r[i->destination].doubleValue = r[i->left].doubleValue + r[i->right].doubleValue; break;
+			case BytecodeOpcode::DoubleSubtract:		r[i->destination].doubleValue = r[i->left].doubleValue - r[i->right].doubleValue; break;
+			case BytecodeOpcode::DoubleMultiply:		r[i->destination].doubleValue = r[i->left].doubleValue * r[i->right].doubleValue; break;
+			case BytecodeOpcode::DoubleDivide:			r[i->destination].doubleValue = divide(r[i->left].doubleValue, r[i->right].doubleValue); break;
+			case BytecodeOpcode::DoubleModulo:			r[i->destination].doubleValue = modulo(r[i->left].doubleValue, r[i->right].doubleValue); break;
+			case BytecodeOpcode::DoubleGreater:			r[i->destination].boolValue = r[i->left].doubleValue > r[i->right].doubleValue; break;
+			case BytecodeOpcode::DoubleSmaller:			r[i->destination].boolValue = r[i->left].doubleValue < r[i->right].doubleValue; break;
+			case BytecodeOpcode::DoubleGreaterOrEqual:	r[i->destination].boolValue = r[i->left].doubleValue >= r[i->right].doubleValue; break;
+			case BytecodeOpcode::DoubleSmallerOrEqual:	r[i->destination].boolValue = r[i->left].doubleValue <= r[i->right].doubleValue; break;
+			case BytecodeOpcode::DoubleEquals:			r[i->destination].boolValue = r[i->left].doubleValue == r[i->right].doubleValue; break;
+			case BytecodeOpcode::DoubleNotEquals:		r[i->destination].boolValue = r[i->left].doubleValue != r[i->right].doubleValue; break;
+
+			case BytecodeOpcode::BoolEquals:			r[i->destination].boolValue = r[i->left].boolValue == r[i->right].boolValue; break;
+			case BytecodeOpcode::BoolNotEquals:			r[i->destination].boolValue = r[i->left].boolValue != r[i->right].boolValue; break;
+			case BytecodeOpcode::PointerEquals:			r[i->destination].boolValue = r[i->left].pointerValue == r[i->right].pointerValue; break;
+			case BytecodeOpcode::PointerNotEquals:		r[i->destination].boolValue = r[i->left].pointerValue != r[i->right].pointerValue; break;
+
+			case BytecodeOpcode::BoolNot:				r[i->destination].boolValue = !r[i->left].boolValue; break;
+			case BytecodeOpcode::IntNegate:				r[i->destination].intValue = -r[i->left].intValue; break;
+			case BytecodeOpcode::FloatNegate:			r[i->destination].floatValue = -r[i->left].floatValue; break;
+			case BytecodeOpcode::DoubleNegate:			r[i->destination].doubleValue = -r[i->left].doubleValue; break;
+
+			case BytecodeOpcode::BoolToInt:				r[i->destination].intValue = r[i->left].boolValue ? 1 : 0; break;
+			case BytecodeOpcode::BoolToFloat:			r[i->destination].floatValue = r[i->left].boolValue ? 1.0f : 0.0f; break;
+			case BytecodeOpcode::BoolToDouble:			r[i->destination].doubleValue = r[i->left].boolValue ? 1.0 : 0.0; break;
+			case BytecodeOpcode::IntToBool:				r[i->destination].boolValue = r[i->left].intValue > 0; break;
+			case BytecodeOpcode::IntToFloat:			r[i->destination].floatValue = (float)r[i->left].intValue; break;
+			case BytecodeOpcode::IntToDouble:			r[i->destination].doubleValue = (double)r[i->left].intValue; break;
+			case BytecodeOpcode::FloatToBool:			r[i->destination].boolValue = r[i->left].floatValue > 0.0f; break;
+			case BytecodeOpcode::FloatToInt:			r[i->destination].intValue = (int)r[i->left].floatValue; break;
+			case BytecodeOpcode::FloatToDouble:			r[i->destination].doubleValue = (double)r[i->left].floatValue; break;
+			case BytecodeOpcode::DoubleToBool:			r[i->destination].boolValue = r[i->left].doubleValue > 0.0; break;
+			case BytecodeOpcode::DoubleToInt:			r[i->destination].intValue = (int)r[i->left].doubleValue; break;
+			case BytecodeOpcode::DoubleToFloat:			r[i->destination].floatValue = (float)r[i->left].doubleValue; break;
+
+			case BytecodeOpcode::FloatSin:				r[i->destination].floatValue = (float)sin(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatCos:				r[i->destination].floatValue = cosf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatTan:				r[i->destination].floatValue = tanf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatAsin:				r[i->destination].floatValue = asinf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatAcos:				r[i->destination].floatValue = acosf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatAtan:				r[i->destination].floatValue = atanf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatSinh:				r[i->destination].floatValue = sinhf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatCosh:				r[i->destination].floatValue = coshf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatTanh:				r[i->destination].floatValue = tanhf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatAsinh:			r[i->destination].floatValue = asinhf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatAcosh:			r[i->destination].floatValue = acoshf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatAtanh:			r[i->destination].floatValue = atanhf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatLog10:			r[i->destination].floatValue = log10f(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatLn:				r[i->destination].floatValue = logf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatExp:				r[i->destination].floatValue = expf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatSqrt:				r[i->destination].floatValue = sqrtf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatCeil:				r[i->destination].floatValue = ceilf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatFloor:			r[i->destination].floatValue = floorf(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatAbs:				r[i->destination].floatValue = std::abs(r[i->left].floatValue); break;
+			case BytecodeOpcode::FloatPow:				r[i->destination].floatValue = powf(r[i->left].floatValue, r[i->right].floatValue); break;
+			case BytecodeOpcode::FloatAtan2:			r[i->destination].floatValue = atan2f(r[i->left].floatValue, r[i->right].floatValue); break;
+			case BytecodeOpcode::FloatHypot:			r[i->destination].floatValue = hypotf(r[i->left].floatValue, r[i->right].floatValue); break;
+			case BytecodeOpcode::FloatMin:				r[i->destination].floatValue = std::min(r[i->left].floatValue, r[i->right].floatValue); break;
+			case BytecodeOpcode::FloatMax:				r[i->destination].floatValue = std::max(r[i->left].floatValue, r[i->right].floatValue); break;
+
+			case BytecodeOpcode::DoubleSin:				r[i->destination].doubleValue = sin(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleCos:				r[i->destination].doubleValue = cos(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleTan:				r[i->destination].doubleValue = tan(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleAsin:			r[i->destination].doubleValue = asin(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleAcos:			r[i->destination].doubleValue = acos(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleAtan:			r[i->destination].doubleValue = atan(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleSinh:			r[i->destination].doubleValue = sinh(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleCosh:			r[i->destination].doubleValue = cosh(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleTanh:			r[i->destination].doubleValue = tanh(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleAsinh:			r[i->destination].doubleValue = asinh(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleAcosh:			r[i->destination].doubleValue = acosh(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleAtanh:			r[i->destination].doubleValue = atanh(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleLog10:			r[i->destination].doubleValue = log10(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleLn:				r[i->destination].doubleValue = log(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleExp:				r[i->destination].doubleValue = exp(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleSqrt:			r[i->destination].doubleValue = sqrt(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleCeil:			r[i->destination].doubleValue = ceil(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleFloor:			r[i->destination].doubleValue = floor(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoubleAbs:				r[i->destination].doubleValue = std::abs(r[i->left].doubleValue); break;
+			case BytecodeOpcode::DoublePow:				r[i->destination].doubleValue = pow(r[i->left].doubleValue, r[i->right].doubleValue); break;
+			case BytecodeOpcode::DoubleAtan2:			r[i->destination].doubleValue = atan2(r[i->left].doubleValue, r[i->right].doubleValue); break;
+			case BytecodeOpcode::DoubleHypot:			r[i->destination].doubleValue = hypot(r[i->left].doubleValue, r[i->right].doubleValue); break;
+			case BytecodeOpcode::DoubleMin:				r[i->destination].doubleValue = std::min(r[i->left].doubleValue, r[i->right].doubleValue); break;
+			case BytecodeOpcode::DoubleMax:				r[i->destination].doubleValue = std::max(r[i->left].doubleValue, r[i->right].doubleValue); break;
+
+			case BytecodeOpcode::IntAbs:				r[i->destination].intValue = std::abs(r[i->left].intValue); break;
+			case BytecodeOpcode::IntMin:				r[i->destination].intValue = std::min(r[i->left].intValue, r[i->right].intValue); break;
+			case BytecodeOpcode::IntMax:				r[i->destination].intValue = std::max(r[i->left].intValue, r[i->right].intValue); break;
+
+			default:	assert(false); break;
+		}
+		++i;
+	}
+	return r[resultRegister];
+}
+
+
+std::any BytecodeProgram::executeToAny(CatRuntimeContext* runtimeContext) const
+{
+	return registerToAny(execute(runtimeContext));
+}
+
+
+std::any BytecodeProgram::registerToAny(const BytecodeRegister& result) const
+{
+	switch (resultKind)
+	{
+		case RegisterKind::Bool:	return std::any(result.boolValue);
+		case RegisterKind::Int:		return std::any(result.intValue);
+		case RegisterKind::Float:	return std::any(result.floatValue);
+		case RegisterKind::Double:	return std::any(result.doubleValue);
+		case RegisterKind::Pointer:	return resultType.createFromRawPointer(result.pointerValue);
+		default:					assert(false); return std::any();
+	}
+}
+
+
+const CatGenericType& BytecodeProgram::getResultType() const
+{
+	return resultType;
+}
+
+
+RegisterKind BytecodeProgram::getResultKind() const
+{
+	return resultKind;
+}
+
+
+std::size_t BytecodeProgram::getNumInstructions() const
+{
+	return instructions.size();
+}
+
+
+std::size_t BytecodeProgram::getNumRegisters() const
+{
+	return numRegisters;
+}
+
+
+const std::vector<const TypeMemberInfo*>& BytecodeProgram::getColumnMembers() const
+{
+	return columnMembers;
+}
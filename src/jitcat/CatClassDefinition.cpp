@@ -404,6 +404,7 @@ bool CatClassDefinition::injectCode(const std::string& functionName, const std::
 		std::unique_ptr<Parser::SLRParseResult> parseResult = JitCat::get()->parseStatement(doc, compileTimeContext, errorManager, errorContext);
 		if (parseResult->success)
 		{
+			injectedCodeArenas.push_back(std::move(parseResult->astArena));
 			CatStatement* statement = static_cast<CatStatement*>(parseResult->astRootNode.release());
 
 			//Build the context as it would have been in the function scope block
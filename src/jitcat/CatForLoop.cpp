@@ -82,7 +82,7 @@ bool CatForLoop::typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErro
 		return false;
 	}
 	CatScopeID scopeId = InvalidScopeID;
-	if (compiletimeContext->findVariable(Tools::toLowerCase(iteratorName), scopeId) != nullptr)
+	if (compiletimeContext->findVariable(iteratorName, scopeId) != nullptr)
 	{
 		errorManager->compiledWithError(Tools::append("A variable with name \"", iteratorName, "\" already exists."), errorContext, compiletimeContext->getContextName(), iteratorLexeme);
 		return false;
@@ -7,6 +7,7 @@
 
 #include "jitcat/CatFunctionDefinition.h"
 #include "jitcat/ASTHelper.h"
+#include "jitcat/BytecodeCompiler.h"
 #include "jitcat/CatArgumentList.h"
 #include "jitcat/CatClassDefinition.h"
 #include "jitcat/CatFunctionParameterDefinitions.h"
@@ -14,6 +15,7 @@
 #include "jitcat/CatIdentifier.h"
 #include "jitcat/CatLog.h"
 #include "jitcat/CatMemberFunctionCall.h"
+#include "jitcat/CatReturnStatement.h"
 #include "jitcat/CatRuntimeContext.h"
 #include "jitcat/CatTypeNode.h"
 #include "jitcat/CatScopeBlock.h"
@@ -22,7 +24,9 @@
 #include "jitcat/CustomTypeInfo.h"
 #include "jitcat/CustomTypeMemberFunctionInfo.h"
 #include "jitcat/ExpressionErrorManager.h"
+#include "jitcat/ExpressionProfiler.h"
 #include "jitcat/FunctionNameMangler.h"
+#include "jitcat/JitCat.h"
 #include "jitcat/ObjectInstance.h"
 #include "jitcat/Tools.h"
 #include "jitcat/TypeRegistry.h"
@@ -46,6 +50,7 @@ CatFunctionDefinition::CatFunctionDefinition(CatTypeNode* type, const std::strin
 	visibility(MemberVisibility::Public),
 	parametersScopeId(InvalidScopeID),
 	scopeBlock(scopeBlock),
+	profileRecord(nullptr),
 	parentClass(nullptr),
 	memberFunctionInfo(nullptr)
 {
@@ -62,6 +67,7 @@ CatFunctionDefinition::CatFunctionDefinition(const CatFunctionDefinition& other)
 	visibility(other.visibility),
 	parametersScopeId(InvalidScopeID),
 	scopeBlock(static_cast<CatScopeBlock*>(other.scopeBlock->copy())),
+	profileRecord(nullptr),
 	memberFunctionInfo(nullptr)
 {
 }
@@ -162,6 +168,8 @@ bool CatFunctionDefinition::typeCheck(CatRuntimeContext* compileTimeContext)
 	}	
 	ExpressionErrorManager* errorManager = compileTimeContext->getErrorManager();
 	errorManagerHandle.setReflectable(reinterpret_cast<unsigned char*>(errorManager), TypeRegistry::get()->registerType<ExpressionErrorManager>());
+	bytecodeProgram.reset(nullptr);
+	profileRecord = nullptr;
 
 	if (parameters->getNumParameters() > 0)
 	{
@@ -218,6 +226,12 @@ bool CatFunctionDefinition::typeCheck(CatRuntimeContext* compileTimeContext)
 	{
 		return false;
 	}
+	compileToBytecode();
+	if (JitCat::get()->getProfilingEnabled())
+	{
+		std::string qualifiedName = parentClass != nullptr ? Tools::append(parentClass->getQualifiedName(), "::", name) : name;
+		profileRecord = JitCat::get()->getProfiler()->getRecord(ProfileRecordKind::Function, qualifiedName, compileTimeContext->getContextName());
+	}
 	errorManager->compiledWithoutErrors(this);
 	return true;
 }
@@ -225,7 +239,17 @@ bool CatFunctionDefinition::typeCheck(CatRuntimeContext* compileTimeContext)
 
 std::any CatFunctionDefinition::executeFunctionWithPack(CatRuntimeContext* runtimeContext, CatScopeID packScopeId) const
 {
-	std::any result = scopeBlock->execute(runtimeContext);
+	ProfileScope profileScope(profileRecord.get());
+	std::any result;
+	if (bytecodeProgram != nullptr)
+	{
+		//The scope block has no local variables, so there is no need to push its scope.
+		result = bytecodeProgram->executeToAny(runtimeContext);
+	}
+	else
+	{
+		result = scopeBlock->execute(runtimeContext);
+	}
 	if (epilogBlock != nullptr)
 	{
 		epilogBlock->execute(runtimeContext);
@@ -357,6 +381,12 @@ std::string CatFunctionDefinition::getMangledFunctionName(bool sRetBeforeThis) c
 }
 
 
+ProfileRecord* CatFunctionDefinition::getProfileRecord() const
+{
+	return profileRecord.get();
+}
+
+
 CatScopeBlock* CatFunctionDefinition::getScopeBlock() const
 {
 	return scopeBlock.get();
@@ -401,4 +431,22 @@ bool CatFunctionDefinition::getAllControlPathsReturn() const
 CatScopeID CatFunctionDefinition::pushScope(CatRuntimeContext* runtimeContext, unsigned char* instance) const
 {
 	return runtimeContext->addDynamicScope(parameters->getCustomType(), instance);
+}
+
+
+void CatFunctionDefinition::compileToBytecode()
+{
+	if (Configuration::enableLLVM
+		|| JitCat::get()->getInterpreterMode() != InterpreterMode::Bytecode
+		|| scopeBlock->getCustomType()->getTypeSize() != 0
+		|| scopeBlock->getStatements().size() != 1
+		|| scopeBlock->getStatements()[0]->getNodeType() != CatASTNodeType::ReturnStatement)
+	{
+		return;
+	}
+	const CatReturnStatement* returnStatement = static_cast<const CatReturnStatement*>(scopeBlock->getStatements()[0].get());
+	if (returnStatement->getReturnExpression() != nullptr)
+	{
+		bytecodeProgram = Bytecode::BytecodeCompiler::compile(returnStatement->getReturnExpression());
+	}
 }
\ No newline at end of file
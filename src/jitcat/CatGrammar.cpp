@@ -8,6 +8,7 @@
 #include "jitcat/CatGrammar.h"
 #include "jitcat/ASTNodeParser.h"
 #include "jitcat/CatASTNodes.h"
+#include "jitcat/CatGrammarParseTables.h"
 #include "jitcat/CatScopeRoot.h"
 #include "jitcat/CatTokenizer.h"
 #include "jitcat/CommentToken.h"
@@ -33,7 +34,8 @@ using namespace jitcat::Tokenizer;
 
 
 CatGrammar::CatGrammar(TokenizerBase* tokenizer, CatGrammarType grammarType):
-	GrammarBase(tokenizer)
+	GrammarBase(tokenizer),
+	grammarType(grammarType)
 {
 	//Initialize the token id's
 	comment = CatTokenizer::comment;
@@ -223,6 +225,18 @@ CatGrammar::CatGrammar(TokenizerBase* tokenizer, CatGrammarType grammarType):
 }
 
 
+const Parser::SLRParseTables* CatGrammar::getPrecomputedParseTables() const
+{
+	switch (grammarType)
+	{
+		default:
+		case CatGrammarType::Expression: return &CatGrammarParseTables::expression;
+		case CatGrammarType::Full:		 return &CatGrammarParseTables::full;
+		case CatGrammarType::Statement:	 return &CatGrammarParseTables::statement;
+	}
+}
+
+
 const char* CatGrammar::getProductionName(int production) const
 {
 	switch ((Prod)production)
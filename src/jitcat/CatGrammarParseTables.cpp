@@ -0,0 +1,1555 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+//Generated by JitCatParseTableGenerator, do not edit.
+//Build the JitCatParseTables target to regenerate this file after the grammar or the tokenizer has changed.
+
+#include "jitcat/CatGrammarParseTables.h"
+
+#include <cstdint>
+
+namespace jitcat::Grammar::CatGrammarParseTables
+{
+
+static const std::uint32_t expressionStateItemOffsets[] =
+{
+	0, 52, 53, 102, 149, 194, 236, 273, 307, 337, 338, 365, 366, 367, 368, 369,
+	423, 424, 473, 474, 516, 553, 587, 617, 618, 645, 646, 647, 648, 649, 650, 651,
+	652, 653, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717,
+	718, 719, 749, 750, 751, 788, 825, 827, 829, 831, 834, 839, 842, 846, 850, 859,
+	865, 867, 869, 872, 877, 880, 884, 888, 943, 945, 947, 952, 955, 959, 963, 965,
+	968, 971, 973, 977
+};
+
+static const std::uint16_t expressionItems[] =
+{
+	0, 0, 0, 28, 0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26,
+	1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2,
+	0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0,
+	22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21,
+	2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0,
+	0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0,
+	42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18,
+	1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1,
+	0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0,
+	1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 0, 0, 1, 27,
+	0, 2, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0,
+	0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0,
+	23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21,
+	0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1,
+	0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0,
+	18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42,
+	4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1,
+	0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0,
+	1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39,
+	0, 0, 26, 0, 2, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1,
+	0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0,
+	23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21,
+	1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2,
+	0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0,
+	42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42,
+	5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0,
+	0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0,
+	1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 25,
+	0, 2, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1,
+	0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0,
+	22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20,
+	0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2,
+	0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0,
+	42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1,
+	0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2,
+	0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0,
+	18, 3, 0, 39, 0, 0, 24, 0, 2, 23, 0, 0, 23, 1, 0, 23,
+	2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2,
+	0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0,
+	20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19,
+	3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3,
+	0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0,
+	1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1,
+	3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3,
+	0, 39, 0, 0, 23, 0, 2, 22, 0, 0, 22, 1, 0, 22, 2, 0,
+	21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20,
+	1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3,
+	0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0,
+	42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1,
+	1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3,
+	0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0,
+	39, 0, 0, 22, 0, 2, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21,
+	3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1,
+	0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0,
+	42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18,
+	2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0,
+	1, 7, 0, 18, 3, 0, 39, 0, 0, 21, 0, 2, 20, 0, 0, 20,
+	1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3,
+	0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0,
+	42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1,
+	1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3,
+	0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0,
+	39, 0, 0, 21, 0, 3, 20, 0, 1, 19, 0, 0, 19, 1, 0, 19,
+	2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2,
+	0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0,
+	1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1,
+	2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7,
+	0, 18, 3, 0, 39, 0, 0, 19, 1, 4, 40, 0, 2, 40, 1, 2,
+	40, 1, 3, 41, 0, 2, 41, 0, 0, 28, 0, 0, 27, 0, 0, 27,
+	1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0,
+	0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0,
+	23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21,
+	0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1,
+	0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0,
+	18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42,
+	4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1,
+	0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0,
+	1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39,
+	0, 0, 41, 1, 0, 41, 0, 3, 19, 2, 2, 26, 0, 0, 26, 1,
+	0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0,
+	23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22,
+	0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2,
+	0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0,
+	19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42,
+	1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1,
+	0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1,
+	6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 19, 2, 4, 24, 1,
+	2, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0,
+	22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21,
+	2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0,
+	0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0,
+	42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18,
+	1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1,
+	0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0,
+	1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 23, 1, 2, 22,
+	0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2,
+	0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0,
+	19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42,
+	1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1,
+	0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1,
+	6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 22, 1, 2, 21, 0,
+	0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0,
+	20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18,
+	0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4,
+	0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0,
+	38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1,
+	4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0,
+	0, 21, 1, 2, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0,
+	19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42,
+	1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1,
+	0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1,
+	6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 21, 1, 3, 20, 1,
+	1, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0,
+	42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42,
+	5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0,
+	0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0,
+	1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 19,
+	3, 1, 18, 0, 1, 42, 0, 1, 42, 1, 1, 42, 2, 1, 42, 3,
+	1, 42, 4, 1, 42, 5, 1, 18, 1, 1, 27, 0, 0, 27, 1, 0,
+	26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24,
+	1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3,
+	0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0,
+	21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20,
+	2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0,
+	0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0,
+	42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38,
+	0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4,
+	0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0,
+	18, 1, 3, 1, 0, 2, 1, 0, 3, 1, 1, 2, 38, 0, 1, 38,
+	1, 1, 1, 2, 2, 1, 3, 2, 1, 4, 2, 1, 5, 2, 1, 6,
+	2, 1, 7, 2, 1, 7, 3, 18, 3, 1, 39, 0, 2, 21, 2, 2,
+	20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19,
+	2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2,
+	0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0,
+	1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1,
+	2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7,
+	0, 18, 3, 0, 39, 0, 0, 21, 2, 3, 21, 3, 1, 23, 2, 2,
+	22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21,
+	2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0,
+	0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0,
+	42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18,
+	1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1,
+	0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0,
+	1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 23, 3, 2, 22,
+	0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2,
+	0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0,
+	19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42,
+	1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1,
+	0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1,
+	6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 28, 0, 1, 27, 0,
+	1, 27, 1, 1, 26, 0, 1, 26, 1, 1, 25, 0, 1, 25, 1, 1,
+	24, 0, 1, 24, 1, 1, 24, 2, 1, 23, 0, 1, 23, 1, 1, 23,
+	2, 1, 23, 3, 1, 23, 4, 1, 22, 0, 1, 22, 1, 1, 22, 2,
+	1, 21, 0, 1, 21, 1, 1, 21, 2, 1, 20, 2, 1, 19, 0, 1,
+	19, 1, 1, 19, 2, 1, 18, 2, 1, 1, 0, 1, 1, 7, 1, 38,
+	0, 0, 38, 1, 0, 38, 2, 0, 39, 0, 1, 40, 0, 0, 40, 1,
+	0, 1, 1, 1, 1, 2, 1, 1, 3, 1, 1, 4, 1, 1, 5, 1,
+	1, 6, 1, 27, 0, 3, 26, 0, 1, 26, 0, 3, 25, 0, 1, 25,
+	0, 3, 24, 0, 1, 24, 1, 1, 24, 0, 3, 23, 0, 1, 23, 1,
+	1, 23, 2, 1, 23, 3, 1, 23, 0, 3, 22, 0, 1, 22, 1, 1,
+	22, 0, 3, 21, 0, 1, 21, 1, 1, 21, 2, 1, 20, 0, 2, 19,
+	0, 1, 19, 1, 1, 19, 2, 1, 40, 0, 1, 40, 1, 1, 41, 0,
+	0, 28, 0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0,
+	25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23,
+	0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0,
+	0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0,
+	21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19,
+	1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1,
+	0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0,
+	18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38,
+	2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6,
+	0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 41, 1, 0, 41, 0, 1,
+	41, 1, 1, 19, 2, 3, 26, 0, 1, 24, 1, 3, 23, 0, 1, 23,
+	1, 1, 23, 2, 1, 23, 3, 1, 23, 1, 3, 22, 0, 1, 22, 1,
+	1, 22, 1, 3, 21, 0, 1, 21, 1, 1, 21, 2, 1, 20, 1, 2,
+	19, 0, 1, 19, 1, 1, 19, 2, 1, 18, 1, 2, 27, 0, 1, 23,
+	2, 3, 22, 0, 1, 22, 1, 1, 23, 3, 3, 22, 0, 1, 22, 1,
+	1, 19, 0, 2, 19, 1, 2, 19, 0, 3, 19, 1, 3, 40, 0, 0,
+	40, 1, 0
+};
+
+static const std::uint32_t expressionStateTransitionOffsets[] =
+{
+	0, 26, 26, 50, 73, 95, 116, 136, 155, 173, 173, 188, 188, 188, 189, 189,
+	216, 216, 240, 240, 261, 281, 300, 318, 318, 333, 333, 333, 333, 333, 333, 333,
+	333, 333, 358, 358, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 360, 360,
+	360, 360, 378, 378, 378, 398, 418, 419, 420, 421, 423, 427, 429, 432, 434, 440,
+	446, 447, 448, 450, 454, 456, 459, 461, 489, 490, 492, 496, 498, 501, 503, 505,
+	507, 509, 510, 512
+};
+
+static const std::uint16_t expressionTransitions[] =
+{
+	0, 0, 0, 1, 21, 3, 0, 51, 20, 0, 0, 10, 20, 1, 0, 24,
+	19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28,
+	42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32,
+	18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47,
+	28, 0, 0, 54, 27, 1, 0, 55, 26, 1, 0, 56, 25, 1, 0, 57,
+	24, 2, 0, 58, 23, 4, 0, 59, 22, 2, 0, 60, 20, 2, 0, 61,
+	18, 2, 0, 62, 1, 1, 0, 63, 21, 3, 0, 51, 20, 0, 0, 10,
+	20, 1, 0, 24, 19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27,
+	42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31,
+	42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39,
+	18, 3, 0, 47, 27, 0, 2, 64, 26, 1, 0, 56, 25, 1, 0, 57,
+	24, 2, 0, 58, 23, 4, 0, 59, 22, 2, 0, 60, 20, 2, 0, 61,
+	18, 2, 0, 62, 1, 1, 0, 63, 21, 3, 0, 51, 20, 0, 0, 10,
+	20, 1, 0, 24, 19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27,
+	42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31,
+	42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39,
+	18, 3, 0, 47, 26, 0, 2, 65, 25, 1, 0, 57, 24, 2, 0, 58,
+	23, 4, 0, 59, 22, 2, 0, 60, 20, 2, 0, 61, 18, 2, 0, 62,
+	1, 1, 0, 63, 21, 3, 0, 51, 20, 0, 0, 10, 20, 1, 0, 24,
+	19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28,
+	42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32,
+	18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47,
+	25, 0, 2, 66, 24, 2, 0, 58, 23, 4, 0, 59, 22, 2, 0, 60,
+	20, 2, 0, 61, 18, 2, 0, 62, 1, 1, 0, 63, 21, 3, 0, 51,
+	20, 0, 0, 10, 20, 1, 0, 24, 19, 3, 0, 25, 18, 0, 0, 26,
+	42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30,
+	42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38,
+	38, 1, 0, 39, 18, 3, 0, 47, 24, 0, 2, 67, 23, 4, 0, 59,
+	22, 2, 0, 60, 20, 2, 0, 61, 18, 2, 0, 62, 1, 1, 0, 63,
+	21, 3, 0, 51, 20, 0, 0, 10, 20, 1, 0, 24, 19, 3, 0, 25,
+	18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29,
+	42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33,
+	38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47, 23, 0, 2, 68,
+	22, 2, 0, 60, 20, 2, 0, 61, 18, 2, 0, 62, 1, 1, 0, 63,
+	21, 3, 0, 51, 20, 0, 0, 10, 20, 1, 0, 24, 19, 3, 0, 25,
+	18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29,
+	42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33,
+	38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47, 22, 0, 2, 69,
+	20, 2, 0, 61, 18, 2, 0, 62, 1, 1, 0, 63, 21, 0, 2, 9,
+	20, 0, 0, 10, 20, 1, 0, 24, 19, 3, 0, 25, 18, 0, 0, 26,
+	42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30,
+	42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38,
+	38, 1, 0, 39, 18, 3, 0, 47, 20, 2, 0, 61, 18, 2, 0, 62,
+	1, 1, 0, 63, 19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27,
+	42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31,
+	42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39,
+	18, 3, 0, 47, 20, 0, 1, 70, 18, 2, 0, 62, 1, 1, 0, 63,
+	40, 1, 2, 14, 41, 0, 2, 16, 21, 3, 0, 51, 20, 0, 0, 10,
+	20, 1, 0, 24, 19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27,
+	42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31,
+	42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39,
+	18, 3, 0, 47, 41, 0, 0, 72, 28, 0, 0, 54, 27, 1, 0, 55,
+	26, 1, 0, 56, 25, 1, 0, 57, 24, 2, 0, 58, 23, 4, 0, 59,
+	22, 2, 0, 60, 20, 2, 0, 61, 18, 2, 0, 62, 1, 1, 0, 63,
+	21, 3, 0, 51, 20, 0, 0, 10, 20, 1, 0, 24, 19, 3, 0, 25,
+	18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29,
+	42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33,
+	38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47, 19, 2, 2, 73,
+	26, 1, 0, 56, 25, 1, 0, 57, 24, 2, 0, 58, 23, 4, 0, 59,
+	22, 2, 0, 60, 20, 2, 0, 61, 18, 2, 0, 62, 1, 1, 0, 63,
+	21, 3, 0, 51, 20, 0, 0, 10, 20, 1, 0, 24, 19, 3, 0, 25,
+	18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29,
+	42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33,
+	38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47, 24, 1, 2, 74,
+	23, 4, 0, 59, 22, 2, 0, 60, 20, 2, 0, 61, 18, 2, 0, 62,
+	1, 1, 0, 63, 21, 3, 0, 51, 20, 0, 0, 10, 20, 1, 0, 24,
+	19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28,
+	42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32,
+	18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47,
+	23, 1, 2, 75, 22, 2, 0, 60, 20, 2, 0, 61, 18, 2, 0, 62,
+	1, 1, 0, 63, 21, 3, 0, 51, 20, 0, 0, 10, 20, 1, 0, 24,
+	19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28,
+	42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32,
+	18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47,
+	22, 1, 2, 76, 20, 2, 0, 61, 18, 2, 0, 62, 1, 1, 0, 63,
+	21, 1, 2, 23, 20, 0, 0, 10, 20, 1, 0, 24, 19, 3, 0, 25,
+	18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29,
+	42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33,
+	38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47, 20, 2, 0, 61,
+	18, 2, 0, 62, 1, 1, 0, 63, 19, 3, 0, 25, 18, 0, 0, 26,
+	42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30,
+	42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38,
+	38, 1, 0, 39, 18, 3, 0, 47, 20, 1, 1, 77, 18, 2, 0, 62,
+	1, 1, 0, 63, 21, 3, 0, 51, 20, 0, 0, 10, 20, 1, 0, 24,
+	19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28,
+	42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32,
+	18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47,
+	18, 1, 1, 78, 27, 1, 0, 55, 26, 1, 0, 56, 25, 1, 0, 57,
+	24, 2, 0, 58, 23, 4, 0, 59, 22, 2, 0, 60, 20, 2, 0, 61,
+	18, 2, 0, 62, 1, 1, 0, 63, 1, 0, 2, 36, 1, 7, 2, 46,
+	21, 2, 2, 50, 20, 0, 0, 10, 20, 1, 0, 24, 19, 3, 0, 25,
+	18, 0, 0, 26, 42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29,
+	42, 3, 0, 30, 42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33,
+	38, 0, 0, 38, 38, 1, 0, 39, 18, 3, 0, 47, 20, 2, 0, 61,
+	18, 2, 0, 62, 1, 1, 0, 63, 21, 3, 0, 51, 20, 0, 0, 10,
+	20, 1, 0, 24, 19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27,
+	42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31,
+	42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39,
+	18, 3, 0, 47, 23, 2, 2, 79, 22, 2, 0, 60, 20, 2, 0, 61,
+	18, 2, 0, 62, 1, 1, 0, 63, 21, 3, 0, 51, 20, 0, 0, 10,
+	20, 1, 0, 24, 19, 3, 0, 25, 18, 0, 0, 26, 42, 0, 0, 27,
+	42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30, 42, 4, 0, 31,
+	42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38, 38, 1, 0, 39,
+	18, 3, 0, 47, 23, 3, 2, 80, 22, 2, 0, 60, 20, 2, 0, 61,
+	18, 2, 0, 62, 1, 1, 0, 63, 27, 0, 1, 2, 26, 0, 1, 3,
+	25, 0, 1, 4, 24, 0, 1, 5, 24, 1, 1, 19, 23, 0, 1, 6,
+	23, 1, 1, 20, 23, 2, 1, 52, 23, 3, 1, 53, 22, 0, 1, 7,
+	22, 1, 1, 21, 21, 0, 1, 8, 21, 1, 1, 22, 21, 2, 1, 49,
+	19, 2, 1, 17, 19, 0, 1, 81, 1, 0, 1, 35, 1, 7, 1, 45,
+	38, 0, 0, 38, 38, 1, 0, 39, 39, 0, 1, 48, 40, 0, 0, 71,
+	1, 1, 1, 37, 1, 2, 1, 40, 1, 3, 1, 41, 1, 4, 1, 42,
+	1, 5, 1, 43, 1, 6, 1, 44, 26, 0, 1, 3, 25, 0, 1, 4,
+	24, 0, 1, 5, 24, 1, 1, 19, 23, 0, 1, 6, 23, 1, 1, 20,
+	23, 2, 1, 52, 23, 3, 1, 53, 22, 0, 1, 7, 22, 1, 1, 21,
+	21, 0, 1, 8, 21, 1, 1, 22, 21, 2, 1, 49, 19, 2, 1, 17,
+	19, 0, 1, 81, 40, 0, 1, 12, 40, 1, 1, 13, 21, 3, 0, 51,
+	20, 0, 0, 10, 20, 1, 0, 24, 19, 3, 0, 25, 18, 0, 0, 26,
+	42, 0, 0, 27, 42, 1, 0, 28, 42, 2, 0, 29, 42, 3, 0, 30,
+	42, 4, 0, 31, 42, 5, 0, 32, 18, 1, 0, 33, 38, 0, 0, 38,
+	38, 1, 0, 39, 18, 3, 0, 47, 41, 0, 0, 72, 28, 0, 0, 54,
+	27, 1, 0, 55, 26, 1, 0, 56, 25, 1, 0, 57, 24, 2, 0, 58,
+	23, 4, 0, 59, 22, 2, 0, 60, 20, 2, 0, 61, 18, 2, 0, 62,
+	1, 1, 0, 63, 41, 0, 1, 15, 19, 2, 3, 18, 26, 0, 1, 3,
+	23, 0, 1, 6, 23, 1, 1, 20, 23, 2, 1, 52, 23, 3, 1, 53,
+	22, 0, 1, 7, 22, 1, 1, 21, 21, 0, 1, 8, 21, 1, 1, 22,
+	21, 2, 1, 49, 19, 2, 1, 17, 19, 0, 1, 81, 18, 1, 2, 34,
+	27, 0, 1, 2, 22, 0, 1, 7, 22, 1, 1, 21, 22, 0, 1, 7,
+	22, 1, 1, 21, 19, 0, 2, 82, 19, 1, 3, 11, 40, 0, 0, 71
+};
+
+const Parser::SLRParseTables expression =
+{
+	0xc62e102306d88ed9ull,
+	83,
+	expressionStateItemOffsets,
+	expressionItems,
+	expressionStateTransitionOffsets,
+	expressionTransitions
+};
+
+
+static const std::uint32_t statementStateItemOffsets[] =
+{
+	0, 66, 67, 68, 69, 70, 121, 170, 217, 261, 300, 336, 368, 369, 398, 399,
+	400, 401, 402, 458, 459, 510, 511, 555, 594, 630, 662, 663, 692, 693, 694, 695,
+	696, 697, 698, 699, 700, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763,
+	764, 765, 766, 767, 768, 769, 820, 821, 853, 854, 855, 894, 933, 934, 935, 936,
+	937, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1003, 1006, 1007, 1008, 1009, 1010,
+	1064, 1065, 1066, 1067, 1068, 1069, 1124, 1126, 1128, 1130, 1133, 1138, 1141, 1145, 1149, 1160,
+	1166, 1180, 1182, 1191, 1193, 1195, 1198, 1203, 1206, 1210, 1214, 1271, 1273, 1275, 1280, 1283,
+	1287, 1291, 1293, 1295, 1298, 1301, 1370, 1439, 1442, 1448, 1450, 1452, 1461, 1516, 1572, 1576,
+	1578, 1581, 1585, 1640, 1644, 1646
+};
+
+static const std::uint16_t statementItems[] =
+{
+	0, 0, 0, 47, 0, 0, 46, 0, 0, 46, 1, 0, 47, 1, 0, 28,
+	0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25, 0,
+	0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0,
+	23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22,
+	1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3,
+	0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0,
+	19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42,
+	2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2,
+	0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0,
+	1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1,
+	7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 47, 2,
+	0, 15, 0, 0, 15, 1, 0, 47, 3, 0, 31, 0, 0, 31, 1, 0,
+	47, 4, 0, 34, 0, 0, 0, 0, 1, 47, 0, 1, 47, 0, 2, 46,
+	1, 2, 27, 0, 2, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1,
+	0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0,
+	23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22,
+	2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0,
+	0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0,
+	19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42,
+	3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0,
+	0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0,
+	1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18,
+	3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 26, 0, 2, 25, 0,
+	0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0,
+	23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22,
+	1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3,
+	0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0,
+	19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42,
+	2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2,
+	0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0,
+	1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1,
+	7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 25, 0,
+	2, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0,
+	23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22,
+	2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0,
+	0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0,
+	19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42,
+	3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0,
+	0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0,
+	1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18,
+	3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 24, 0, 2, 23, 0,
+	0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0,
+	22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21,
+	3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1,
+	0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0,
+	42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18,
+	2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0,
+	1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 23,
+	0, 2, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1,
+	0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0,
+	19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42,
+	0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5,
+	0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0,
+	38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1,
+	5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4,
+	0, 18, 5, 0, 22, 0, 2, 21, 0, 0, 21, 1, 0, 21, 2, 0,
+	21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19,
+	1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1,
+	0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0,
+	18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38,
+	2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6,
+	0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0,
+	21, 0, 2, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19,
+	1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1,
+	0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0,
+	18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38,
+	2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6,
+	0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0,
+	21, 0, 3, 20, 0, 1, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19,
+	3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3,
+	0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0,
+	1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1,
+	3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3,
+	0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 19, 1, 4, 40, 0, 2,
+	40, 1, 2, 40, 1, 3, 41, 0, 2, 41, 0, 0, 28, 0, 0, 27,
+	0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1,
+	0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0,
+	23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22,
+	2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0,
+	0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0,
+	19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42,
+	3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0,
+	0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0,
+	1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18,
+	3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 41, 1, 0, 41, 0,
+	3, 19, 2, 2, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0,
+	24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23,
+	2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2,
+	0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0,
+	20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19,
+	3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3,
+	0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0,
+	1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1,
+	3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3,
+	0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 19, 2, 4, 24, 1, 2,
+	23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22,
+	0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2,
+	0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0,
+	19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42,
+	1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1,
+	0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1,
+	6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5,
+	0, 23, 1, 2, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0,
+	21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20,
+	2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0,
+	0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0,
+	42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38,
+	0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4,
+	0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0,
+	18, 4, 0, 18, 5, 0, 22, 1, 2, 21, 0, 0, 21, 1, 0, 21,
+	2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0,
+	0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0,
+	42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18,
+	1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1,
+	0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0,
+	1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18,
+	5, 0, 21, 1, 2, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0,
+	0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0,
+	42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18,
+	1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1,
+	0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0,
+	1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18,
+	5, 0, 21, 1, 3, 20, 1, 1, 19, 0, 0, 19, 1, 0, 19, 2,
+	0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0,
+	42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1,
+	0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2,
+	0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0,
+	18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 19, 3, 1, 18,
+	0, 1, 42, 0, 1, 42, 1, 1, 42, 2, 1, 42, 3, 1, 42, 4,
+	1, 42, 5, 1, 18, 1, 1, 27, 0, 0, 27, 1, 0, 26, 0, 0,
+	26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24,
+	2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4,
+	0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0,
+	21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19,
+	0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0,
+	0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0,
+	18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38,
+	1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5,
+	0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0,
+	18, 5, 0, 18, 1, 3, 1, 0, 2, 1, 0, 3, 1, 1, 2, 38,
+	0, 1, 38, 1, 1, 1, 2, 2, 1, 3, 2, 1, 4, 2, 1, 5,
+	2, 1, 6, 2, 1, 7, 2, 1, 7, 3, 18, 3, 1, 39, 0, 2,
+	18, 4, 2, 18, 5, 3, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25,
+	1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1,
+	0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0,
+	22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20,
+	0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2,
+	0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0,
+	42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1,
+	0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2,
+	0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0,
+	18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 18, 5, 5, 21,
+	2, 2, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1,
+	0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0,
+	42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18,
+	2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0,
+	1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 21,
+	2, 3, 21, 3, 1, 23, 2, 2, 22, 0, 0, 22, 1, 0, 22, 2,
+	0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0,
+	20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19,
+	3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3,
+	0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0,
+	1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1,
+	3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3,
+	0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 23, 3, 2, 22, 0, 0,
+	22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21,
+	3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1,
+	0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0,
+	42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18,
+	2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0,
+	1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 47,
+	1, 1, 47, 1, 2, 47, 2, 1, 47, 2, 2, 15, 1, 3, 28, 0,
+	0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0,
+	25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23,
+	1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1,
+	0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0,
+	20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19,
+	2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2,
+	0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0,
+	1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1,
+	2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7,
+	0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 15, 1, 4,
+	47, 3, 1, 48, 0, 2, 48, 0, 3, 49, 0, 2, 47, 4, 1, 34,
+	0, 1, 34, 0, 2, 34, 0, 3, 35, 0, 0, 35, 1, 0, 35, 2,
+	0, 34, 0, 4, 48, 0, 0, 48, 1, 0, 34, 0, 5, 48, 1, 2,
+	35, 0, 4, 35, 1, 6, 35, 2, 6, 28, 0, 0, 27, 0, 0, 27,
+	1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0,
+	0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0,
+	23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21,
+	0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1,
+	0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0,
+	18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42,
+	4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1,
+	0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0,
+	1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39,
+	0, 0, 18, 4, 0, 18, 5, 0, 35, 2, 7, 35, 2, 8, 31, 1,
+	6, 32, 0, 2, 32, 1, 2, 46, 0, 1, 46, 1, 1, 28, 0, 0,
+	27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25,
+	1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1,
+	0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0,
+	22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20,
+	0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2,
+	0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0,
+	42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1,
+	0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2,
+	0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0,
+	18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 28, 0, 1, 27,
+	0, 1, 27, 1, 1, 26, 0, 1, 26, 1, 1, 25, 0, 1, 25, 1,
+	1, 24, 0, 1, 24, 1, 1, 24, 2, 1, 23, 0, 1, 23, 1, 1,
+	23, 2, 1, 23, 3, 1, 23, 4, 1, 22, 0, 1, 22, 1, 1, 22,
+	2, 1, 21, 0, 1, 21, 1, 1, 21, 2, 1, 20, 2, 1, 19, 0,
+	1, 19, 1, 1, 19, 2, 1, 18, 2, 1, 1, 0, 1, 1, 7, 1,
+	38, 0, 0, 38, 1, 0, 38, 2, 0, 39, 0, 1, 40, 0, 0, 40,
+	1, 0, 15, 0, 1, 15, 1, 1, 1, 1, 1, 1, 2, 1, 1, 3,
+	1, 1, 4, 1, 1, 5, 1, 1, 6, 1, 18, 4, 1, 39, 0, 0,
+	1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1,
+	2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7,
+	0, 18, 5, 1, 31, 0, 1, 31, 1, 1, 18, 2, 1, 1, 0, 1,
+	1, 7, 1, 38, 0, 0, 38, 1, 0, 38, 2, 0, 39, 0, 1, 40,
+	0, 0, 40, 1, 0, 27, 0, 3, 26, 0, 1, 26, 0, 3, 25, 0,
+	1, 25, 0, 3, 24, 0, 1, 24, 1, 1, 24, 0, 3, 23, 0, 1,
+	23, 1, 1, 23, 2, 1, 23, 3, 1, 23, 0, 3, 22, 0, 1, 22,
+	1, 1, 22, 0, 3, 21, 0, 1, 21, 1, 1, 21, 2, 1, 20, 0,
+	2, 19, 0, 1, 19, 1, 1, 19, 2, 1, 40, 0, 1, 40, 1, 1,
+	41, 0, 0, 28, 0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26,
+	1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2,
+	0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0,
+	22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21,
+	2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0,
+	0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0,
+	42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18,
+	1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1,
+	0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0,
+	1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18,
+	5, 0, 41, 1, 0, 41, 0, 1, 41, 1, 1, 19, 2, 3, 26, 0,
+	1, 24, 1, 3, 23, 0, 1, 23, 1, 1, 23, 2, 1, 23, 3, 1,
+	23, 1, 3, 22, 0, 1, 22, 1, 1, 22, 1, 3, 21, 0, 1, 21,
+	1, 1, 21, 2, 1, 20, 1, 2, 19, 0, 1, 19, 1, 1, 19, 2,
+	1, 18, 1, 2, 27, 0, 1, 18, 5, 4, 26, 0, 1, 23, 2, 3,
+	22, 0, 1, 22, 1, 1, 23, 3, 3, 22, 0, 1, 22, 1, 1, 48,
+	0, 1, 49, 0, 0, 47, 0, 0, 46, 0, 0, 46, 1, 0, 47, 1,
+	0, 28, 0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0,
+	25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23,
+	0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0,
+	0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0,
+	21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19,
+	1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1,
+	0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0,
+	18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38,
+	2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6,
+	0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0,
+	47, 2, 0, 15, 0, 0, 15, 1, 0, 47, 3, 0, 31, 0, 0, 31,
+	1, 0, 47, 4, 0, 34, 0, 0, 49, 1, 0, 48, 1, 1, 49, 0,
+	1, 49, 0, 0, 47, 0, 0, 46, 0, 0, 46, 1, 0, 47, 1, 0,
+	28, 0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25,
+	0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0,
+	0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0,
+	22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21,
+	3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1,
+	0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0,
+	42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18,
+	2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0,
+	1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 47,
+	2, 0, 15, 0, 0, 15, 1, 0, 47, 3, 0, 31, 0, 0, 31, 1,
+	0, 47, 4, 0, 34, 0, 0, 49, 1, 0, 49, 1, 1, 35, 0, 1,
+	35, 1, 1, 35, 2, 1, 32, 0, 1, 31, 0, 0, 31, 1, 0, 32,
+	1, 1, 48, 0, 0, 48, 1, 0, 19, 0, 2, 19, 1, 2, 15, 0,
+	2, 15, 1, 2, 39, 0, 1, 40, 0, 0, 40, 1, 0, 1, 0, 1,
+	1, 7, 1, 38, 0, 0, 38, 1, 0, 38, 2, 0, 18, 5, 2, 31,
+	0, 2, 28, 0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1,
+	0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0,
+	23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22,
+	0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2,
+	0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0,
+	19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42,
+	1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1,
+	0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1,
+	6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5,
+	0, 31, 1, 2, 35, 0, 2, 28, 0, 0, 27, 0, 0, 27, 1, 0,
+	26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24,
+	1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3,
+	0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0,
+	21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20,
+	2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0,
+	0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0,
+	42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38,
+	0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4,
+	0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0,
+	18, 4, 0, 18, 5, 0, 35, 1, 2, 35, 2, 2, 19, 0, 3, 19,
+	1, 3, 40, 0, 0, 40, 1, 0, 31, 0, 3, 31, 1, 3, 35, 0,
+	3, 35, 1, 3, 35, 2, 3, 31, 0, 4, 48, 0, 0, 48, 1, 0,
+	31, 1, 4, 35, 1, 4, 28, 0, 0, 27, 0, 0, 27, 1, 0, 26,
+	0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1,
+	0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0,
+	23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21,
+	1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2,
+	0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0,
+	42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42,
+	5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0,
+	0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0,
+	1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18,
+	4, 0, 18, 5, 0, 35, 2, 4, 31, 0, 5, 31, 1, 5, 32, 0,
+	0, 32, 1, 0, 35, 1, 5, 35, 2, 5
+};
+
+static const std::uint32_t statementStateTransitionOffsets[] =
+{
+	0, 35, 35, 36, 36, 36, 61, 85, 108, 130, 151, 171, 190, 190, 206, 206,
+	206, 207, 207, 235, 235, 260, 260, 282, 303, 323, 342, 342, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 384, 384, 385, 385, 385, 385, 385, 385, 385, 385, 385,
+	385, 386, 386, 386, 386, 386, 411, 411, 430, 430, 430, 451, 472, 473, 473, 474,
+	474, 501, 501, 501, 502, 502, 502, 502, 503, 504, 506, 508, 508, 508, 508, 508,
+	535, 536, 536, 536, 536, 536, 563, 564, 565, 566, 568, 572, 574, 577, 579, 586,
+	592, 597, 598, 604, 605, 606, 608, 612, 614, 617, 619, 648, 649, 651, 655, 657,
+	660, 662, 664, 666, 668, 670, 707, 743, 744, 748, 749, 750, 757, 784, 811, 813,
+	814, 816, 818, 845, 847, 849
+};
+
+static const std::uint16_t statementTransitions[] =
+{
+	0, 0, 0, 1, 47, 0, 0, 2, 47, 1, 0, 60, 21, 3, 0, 57,
+	20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 47, 2, 0, 62, 47, 3, 0, 66,
+	47, 4, 0, 70, 34, 0, 0, 71, 46, 0, 0, 85, 28, 0, 0, 86,
+	27, 1, 0, 87, 26, 1, 0, 88, 25, 1, 0, 89, 24, 2, 0, 90,
+	23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93, 18, 2, 0, 94,
+	1, 1, 0, 95, 18, 4, 0, 96, 31, 0, 0, 97, 47, 0, 1, 3,
+	21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28,
+	18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32,
+	42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36,
+	38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50, 27, 0, 2, 99,
+	26, 1, 0, 88, 25, 1, 0, 89, 24, 2, 0, 90, 23, 4, 0, 91,
+	22, 2, 0, 92, 20, 2, 0, 93, 18, 2, 0, 98, 1, 1, 0, 95,
+	18, 4, 0, 96, 21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27,
+	19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31,
+	42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35,
+	18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50,
+	26, 0, 2, 100, 25, 1, 0, 89, 24, 2, 0, 90, 23, 4, 0, 91,
+	22, 2, 0, 92, 20, 2, 0, 93, 18, 2, 0, 98, 1, 1, 0, 95,
+	18, 4, 0, 96, 21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27,
+	19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31,
+	42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35,
+	18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50,
+	25, 0, 2, 101, 24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92,
+	20, 2, 0, 93, 18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96,
+	21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28,
+	18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32,
+	42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36,
+	38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50, 24, 0, 2, 102,
+	23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93, 18, 2, 0, 98,
+	1, 1, 0, 95, 18, 4, 0, 96, 21, 3, 0, 57, 20, 0, 0, 13,
+	20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30,
+	42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34,
+	42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42,
+	18, 3, 0, 50, 23, 0, 2, 103, 22, 2, 0, 92, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 21, 3, 0, 57,
+	20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 22, 0, 2, 104, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 21, 0, 2, 12,
+	20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 20, 2, 0, 93, 18, 2, 0, 98,
+	1, 1, 0, 95, 18, 4, 0, 96, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 20, 0, 1, 105, 18, 2, 0, 98,
+	1, 1, 0, 95, 18, 4, 0, 96, 40, 1, 2, 17, 41, 0, 2, 19,
+	21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28,
+	18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32,
+	42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36,
+	38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50, 41, 0, 0, 107,
+	28, 0, 0, 86, 27, 1, 0, 87, 26, 1, 0, 88, 25, 1, 0, 89,
+	24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 21, 3, 0, 57,
+	20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 19, 2, 2, 108, 26, 1, 0, 88,
+	25, 1, 0, 89, 24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92,
+	20, 2, 0, 93, 18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96,
+	21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28,
+	18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32,
+	42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36,
+	38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50, 24, 1, 2, 109,
+	23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93, 18, 2, 0, 98,
+	1, 1, 0, 95, 18, 4, 0, 96, 21, 3, 0, 57, 20, 0, 0, 13,
+	20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30,
+	42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34,
+	42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42,
+	18, 3, 0, 50, 23, 1, 2, 110, 22, 2, 0, 92, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 21, 3, 0, 57,
+	20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 22, 1, 2, 111, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 21, 1, 2, 26,
+	20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 20, 2, 0, 93, 18, 2, 0, 98,
+	1, 1, 0, 95, 18, 4, 0, 96, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 20, 1, 1, 112, 18, 2, 0, 98,
+	1, 1, 0, 95, 18, 4, 0, 96, 21, 3, 0, 57, 20, 0, 0, 13,
+	20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30,
+	42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34,
+	42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42,
+	18, 3, 0, 50, 18, 1, 1, 113, 27, 1, 0, 87, 26, 1, 0, 88,
+	25, 1, 0, 89, 24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92,
+	20, 2, 0, 93, 18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96,
+	1, 0, 2, 39, 1, 7, 2, 49, 21, 3, 0, 57, 20, 0, 0, 13,
+	20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30,
+	42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34,
+	42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42,
+	18, 3, 0, 50, 18, 5, 3, 114, 26, 1, 0, 88, 25, 1, 0, 89,
+	24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 21, 2, 2, 56,
+	20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 20, 2, 0, 93, 18, 2, 0, 98,
+	1, 1, 0, 95, 18, 4, 0, 96, 21, 3, 0, 57, 20, 0, 0, 13,
+	20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30,
+	42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34,
+	42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42,
+	18, 3, 0, 50, 23, 2, 2, 115, 22, 2, 0, 92, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 21, 3, 0, 57,
+	20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 23, 3, 2, 116, 22, 2, 0, 92,
+	20, 2, 0, 93, 18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96,
+	47, 1, 1, 61, 47, 2, 1, 63, 15, 1, 3, 65, 21, 3, 0, 57,
+	20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29,
+	42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33,
+	42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41,
+	38, 1, 0, 42, 18, 3, 0, 50, 28, 0, 0, 86, 27, 1, 0, 87,
+	26, 1, 0, 88, 25, 1, 0, 89, 24, 2, 0, 90, 23, 4, 0, 91,
+	22, 2, 0, 92, 20, 2, 0, 93, 18, 2, 0, 98, 1, 1, 0, 95,
+	18, 4, 0, 96, 48, 0, 2, 68, 34, 0, 1, 72, 34, 0, 2, 73,
+	34, 0, 3, 74, 35, 0, 0, 119, 34, 0, 4, 75, 48, 0, 0, 117,
+	35, 2, 6, 80, 21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27,
+	19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31,
+	42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35,
+	18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50,
+	28, 0, 0, 86, 27, 1, 0, 87, 26, 1, 0, 88, 25, 1, 0, 89,
+	24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 35, 2, 7, 81,
+	46, 1, 1, 4, 21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27,
+	19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31,
+	42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35,
+	18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50,
+	28, 0, 0, 86, 27, 1, 0, 87, 26, 1, 0, 88, 25, 1, 0, 89,
+	24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 27, 0, 1, 5,
+	26, 0, 1, 6, 25, 0, 1, 7, 24, 0, 1, 8, 24, 1, 1, 22,
+	23, 0, 1, 9, 23, 1, 1, 23, 23, 2, 1, 58, 23, 3, 1, 59,
+	22, 0, 1, 10, 22, 1, 1, 24, 21, 0, 1, 11, 21, 1, 1, 25,
+	21, 2, 1, 55, 19, 2, 1, 20, 19, 0, 1, 121, 1, 0, 1, 38,
+	1, 7, 1, 48, 38, 0, 0, 41, 38, 1, 0, 42, 39, 0, 1, 51,
+	40, 0, 0, 106, 15, 0, 1, 122, 1, 1, 1, 40, 1, 2, 1, 43,
+	1, 3, 1, 44, 1, 4, 1, 45, 1, 5, 1, 46, 1, 6, 1, 47,
+	18, 4, 1, 52, 38, 0, 0, 41, 38, 1, 0, 42, 39, 0, 0, 123,
+	1, 1, 0, 95, 31, 0, 1, 124, 1, 0, 1, 38, 1, 7, 1, 48,
+	38, 0, 0, 41, 38, 1, 0, 42, 39, 0, 1, 51, 40, 0, 0, 106,
+	26, 0, 1, 6, 25, 0, 1, 7, 24, 0, 1, 8, 24, 1, 1, 22,
+	23, 0, 1, 9, 23, 1, 1, 23, 23, 2, 1, 58, 23, 3, 1, 59,
+	22, 0, 1, 10, 22, 1, 1, 24, 21, 0, 1, 11, 21, 1, 1, 25,
+	21, 2, 1, 55, 19, 2, 1, 20, 19, 0, 1, 121, 40, 0, 1, 15,
+	40, 1, 1, 16, 21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27,
+	19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31,
+	42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35,
+	18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50,
+	41, 0, 0, 107, 28, 0, 0, 86, 27, 1, 0, 87, 26, 1, 0, 88,
+	25, 1, 0, 89, 24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92,
+	20, 2, 0, 93, 18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96,
+	41, 0, 1, 18, 19, 2, 3, 21, 26, 0, 1, 6, 23, 0, 1, 9,
+	23, 1, 1, 23, 23, 2, 1, 58, 23, 3, 1, 59, 22, 0, 1, 10,
+	22, 1, 1, 24, 21, 0, 1, 11, 21, 1, 1, 25, 21, 2, 1, 55,
+	19, 2, 1, 20, 19, 0, 1, 121, 18, 1, 2, 37, 27, 0, 1, 5,
+	18, 5, 4, 54, 26, 0, 1, 6, 22, 0, 1, 10, 22, 1, 1, 24,
+	22, 0, 1, 10, 22, 1, 1, 24, 48, 0, 1, 67, 47, 0, 0, 2,
+	47, 1, 0, 60, 21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27,
+	19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31,
+	42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35,
+	18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50,
+	47, 2, 0, 62, 47, 3, 0, 66, 47, 4, 0, 70, 34, 0, 0, 71,
+	48, 1, 1, 76, 49, 0, 0, 118, 46, 0, 0, 85, 28, 0, 0, 86,
+	27, 1, 0, 87, 26, 1, 0, 88, 25, 1, 0, 89, 24, 2, 0, 90,
+	23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93, 18, 2, 0, 94,
+	1, 1, 0, 95, 18, 4, 0, 96, 31, 0, 0, 97, 49, 0, 1, 69,
+	47, 0, 0, 2, 47, 1, 0, 60, 21, 3, 0, 57, 20, 0, 0, 13,
+	20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30,
+	42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34,
+	42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42,
+	18, 3, 0, 50, 47, 2, 0, 62, 47, 3, 0, 66, 47, 4, 0, 70,
+	34, 0, 0, 71, 49, 0, 0, 118, 46, 0, 0, 85, 28, 0, 0, 86,
+	27, 1, 0, 87, 26, 1, 0, 88, 25, 1, 0, 89, 24, 2, 0, 90,
+	23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93, 18, 2, 0, 94,
+	1, 1, 0, 95, 18, 4, 0, 96, 31, 0, 0, 97, 35, 0, 1, 125,
+	32, 0, 1, 83, 32, 1, 1, 84, 31, 0, 0, 97, 48, 0, 0, 117,
+	19, 0, 2, 126, 15, 1, 2, 64, 39, 0, 1, 51, 40, 0, 0, 106,
+	1, 0, 1, 38, 1, 7, 1, 48, 38, 0, 0, 41, 38, 1, 0, 42,
+	18, 5, 2, 53, 21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27,
+	19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31,
+	42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35,
+	18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50,
+	28, 0, 0, 86, 27, 1, 0, 87, 26, 1, 0, 88, 25, 1, 0, 89,
+	24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93,
+	18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96, 31, 0, 2, 127,
+	21, 3, 0, 57, 20, 0, 0, 13, 20, 1, 0, 27, 19, 3, 0, 28,
+	18, 0, 0, 29, 42, 0, 0, 30, 42, 1, 0, 31, 42, 2, 0, 32,
+	42, 3, 0, 33, 42, 4, 0, 34, 42, 5, 0, 35, 18, 1, 0, 36,
+	38, 0, 0, 41, 38, 1, 0, 42, 18, 3, 0, 50, 28, 0, 0, 86,
+	27, 1, 0, 87, 26, 1, 0, 88, 25, 1, 0, 89, 24, 2, 0, 90,
+	23, 4, 0, 91, 22, 2, 0, 92, 20, 2, 0, 93, 18, 2, 0, 98,
+	1, 1, 0, 95, 18, 4, 0, 96, 35, 0, 2, 128, 19, 1, 3, 14,
+	40, 0, 0, 106, 31, 0, 3, 129, 35, 0, 3, 77, 35, 1, 3, 130,
+	48, 0, 0, 117, 31, 0, 4, 131, 21, 3, 0, 57, 20, 0, 0, 13,
+	20, 1, 0, 27, 19, 3, 0, 28, 18, 0, 0, 29, 42, 0, 0, 30,
+	42, 1, 0, 31, 42, 2, 0, 32, 42, 3, 0, 33, 42, 4, 0, 34,
+	42, 5, 0, 35, 18, 1, 0, 36, 38, 0, 0, 41, 38, 1, 0, 42,
+	18, 3, 0, 50, 28, 0, 0, 86, 27, 1, 0, 87, 26, 1, 0, 88,
+	25, 1, 0, 89, 24, 2, 0, 90, 23, 4, 0, 91, 22, 2, 0, 92,
+	20, 2, 0, 93, 18, 2, 0, 98, 1, 1, 0, 95, 18, 4, 0, 96,
+	35, 1, 4, 132, 31, 1, 5, 82, 32, 0, 0, 120, 35, 1, 5, 78,
+	35, 2, 5, 79
+};
+
+const Parser::SLRParseTables statement =
+{
+	0xa36441b9d1f3c1f4ull,
+	133,
+	statementStateItemOffsets,
+	statementItems,
+	statementStateTransitionOffsets,
+	statementTransitions
+};
+
+
+static const std::uint32_t fullStateItemOffsets[] =
+{
+	0, 25, 26, 27, 28, 29, 30, 31, 32, 33, 36, 37, 38, 39, 40, 41,
+	42, 43, 94, 143, 190, 234, 273, 309, 341, 342, 371, 372, 373, 374, 375, 431,
+	432, 483, 484, 528, 567, 603, 635, 636, 665, 666, 667, 668, 669, 670, 671, 672,
+	673, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740,
+	741, 742, 793, 794, 826, 827, 828, 867, 906, 907, 908, 909, 910, 964, 965, 966,
+	967, 968, 969, 970, 971, 972, 973, 977, 980, 981, 982, 983, 1037, 1038, 1039, 1040,
+	1041, 1042, 1058, 1059, 1060, 1061, 1115, 1116, 1117, 1118, 1130, 1155, 1157, 1165, 1171, 1188,
+	1257, 1326, 1381, 1383, 1385, 1387, 1390, 1395, 1398, 1402, 1406, 1417, 1431, 1433, 1442, 1444,
+	1446, 1449, 1454, 1457, 1461, 1465, 1522, 1524, 1526, 1531, 1534, 1538, 1542, 1544, 1546, 1549,
+	1552, 1558, 1561, 1563, 1570, 1576, 1578, 1583, 1585, 1587, 1596, 1651, 1707, 1732, 1736, 1738,
+	1741, 1745, 1800, 1804, 1806
+};
+
+static const std::uint16_t fullItems[] =
+{
+	0, 0, 0, 5, 0, 0, 6, 0, 0, 7, 0, 0, 8, 0, 0, 8,
+	1, 0, 7, 1, 0, 12, 0, 0, 1, 0, 0, 1, 1, 0, 38, 0,
+	0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0,
+	1, 5, 0, 1, 6, 0, 1, 7, 0, 7, 2, 0, 16, 0, 0, 16,
+	1, 0, 7, 3, 0, 11, 0, 0, 6, 1, 0, 0, 0, 1, 5, 0,
+	1, 6, 0, 2, 7, 0, 1, 8, 0, 4, 8, 1, 4, 8, 1, 5,
+	7, 1, 1, 12, 0, 3, 48, 0, 0, 48, 1, 0, 12, 0, 4, 48,
+	0, 2, 48, 0, 3, 49, 0, 2, 47, 0, 1, 47, 0, 2, 46, 1,
+	2, 27, 0, 2, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0,
+	24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23,
+	2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2,
+	0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0,
+	20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19,
+	3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3,
+	0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0,
+	1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1,
+	3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3,
+	0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 26, 0, 2, 25, 0, 0,
+	25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23,
+	1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1,
+	0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0,
+	20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19,
+	2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2,
+	0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0,
+	1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1,
+	2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7,
+	0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 25, 0, 2,
+	24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23,
+	2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2,
+	0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0,
+	20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19,
+	3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3,
+	0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0,
+	1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1,
+	3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3,
+	0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 24, 0, 2, 23, 0, 0,
+	23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22,
+	1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3,
+	0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0,
+	19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42,
+	2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2,
+	0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0,
+	1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1,
+	7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 23, 0,
+	2, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0,
+	21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19,
+	0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0,
+	0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0,
+	18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38,
+	1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5,
+	0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0,
+	18, 5, 0, 22, 0, 2, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21,
+	3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1,
+	0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0,
+	42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18,
+	2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0,
+	1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 21,
+	0, 2, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1,
+	0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0,
+	42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18,
+	2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0,
+	1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 21,
+	0, 3, 20, 0, 1, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3,
+	0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0,
+	42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1,
+	1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3,
+	0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0,
+	39, 0, 0, 18, 4, 0, 18, 5, 0, 19, 1, 4, 40, 0, 2, 40,
+	1, 2, 40, 1, 3, 41, 0, 2, 41, 0, 0, 28, 0, 0, 27, 0,
+	0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0,
+	24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23,
+	2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2,
+	0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0,
+	20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19,
+	3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3,
+	0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0,
+	1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1,
+	3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3,
+	0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 41, 1, 0, 41, 0, 3,
+	19, 2, 2, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24,
+	0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2,
+	0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0,
+	21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20,
+	1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3,
+	0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0,
+	42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1,
+	1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3,
+	0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0,
+	39, 0, 0, 18, 4, 0, 18, 5, 0, 19, 2, 4, 24, 1, 2, 23,
+	0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0,
+	0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0,
+	21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19,
+	1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1,
+	0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0,
+	18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38,
+	2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6,
+	0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0,
+	23, 1, 2, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21,
+	1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2,
+	0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0,
+	42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42,
+	5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0,
+	0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0,
+	1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18,
+	4, 0, 18, 5, 0, 22, 1, 2, 21, 0, 0, 21, 1, 0, 21, 2,
+	0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0,
+	19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42,
+	1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1,
+	0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1,
+	6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5,
+	0, 21, 1, 2, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0,
+	19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42,
+	1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1,
+	0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1,
+	6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5,
+	0, 21, 1, 3, 20, 1, 1, 19, 0, 0, 19, 1, 0, 19, 2, 0,
+	19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42,
+	3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0,
+	0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0,
+	1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18,
+	3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 19, 3, 1, 18, 0,
+	1, 42, 0, 1, 42, 1, 1, 42, 2, 1, 42, 3, 1, 42, 4, 1,
+	42, 5, 1, 18, 1, 1, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26,
+	1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2,
+	0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0,
+	22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21,
+	2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0,
+	0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0,
+	42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18,
+	1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1,
+	0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0,
+	1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18,
+	5, 0, 18, 1, 3, 1, 0, 2, 1, 0, 3, 1, 1, 2, 38, 0,
+	1, 38, 1, 1, 1, 2, 2, 1, 3, 2, 1, 4, 2, 1, 5, 2,
+	1, 6, 2, 1, 7, 2, 1, 7, 3, 18, 3, 1, 39, 0, 2, 18,
+	4, 2, 18, 5, 3, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1,
+	0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0,
+	23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22,
+	2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0,
+	0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0,
+	19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42,
+	3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0,
+	0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0,
+	1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18,
+	3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 18, 5, 5, 21, 2,
+	2, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0,
+	19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42,
+	2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2,
+	0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0,
+	1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1,
+	7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 21, 2,
+	3, 21, 3, 1, 23, 2, 2, 22, 0, 0, 22, 1, 0, 22, 2, 0,
+	21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20,
+	1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3,
+	0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0,
+	42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1,
+	1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3,
+	0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0,
+	39, 0, 0, 18, 4, 0, 18, 5, 0, 23, 3, 2, 22, 0, 0, 22,
+	1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3,
+	0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0,
+	19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42,
+	2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2,
+	0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0,
+	1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1,
+	7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 47, 1,
+	1, 47, 1, 2, 47, 2, 1, 47, 2, 2, 15, 1, 3, 28, 0, 0,
+	27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25,
+	1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1,
+	0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0,
+	22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20,
+	0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2,
+	0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0,
+	42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1,
+	0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2,
+	0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0,
+	18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 15, 1, 4, 47,
+	3, 1, 48, 1, 2, 31, 1, 6, 32, 0, 2, 32, 1, 2, 47, 4,
+	1, 34, 0, 1, 34, 0, 2, 34, 0, 3, 35, 0, 0, 35, 1, 0,
+	35, 2, 0, 34, 0, 4, 48, 0, 0, 48, 1, 0, 34, 0, 5, 35,
+	0, 4, 35, 1, 6, 35, 2, 6, 28, 0, 0, 27, 0, 0, 27, 1,
+	0, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0,
+	24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23,
+	3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0,
+	0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0,
+	20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18,
+	0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4,
+	0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0,
+	38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1,
+	4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0,
+	0, 18, 4, 0, 18, 5, 0, 35, 2, 7, 35, 2, 8, 13, 0, 2,
+	13, 1, 2, 13, 1, 3, 14, 0, 2, 14, 0, 0, 15, 0, 0, 1,
+	0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2,
+	0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0,
+	15, 1, 0, 14, 1, 0, 14, 0, 3, 7, 2, 1, 7, 2, 2, 16,
+	1, 3, 28, 0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1,
+	0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0,
+	23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22,
+	0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2,
+	0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0,
+	19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42,
+	1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1,
+	0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1,
+	6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5,
+	0, 16, 1, 4, 7, 3, 1, 7, 3, 2, 11, 0, 1, 1, 0, 0,
+	1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1,
+	3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 6, 0,
+	1, 6, 0, 0, 7, 0, 0, 8, 0, 0, 8, 1, 0, 7, 1, 0,
+	12, 0, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38,
+	2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6,
+	0, 1, 7, 0, 7, 2, 0, 16, 0, 0, 16, 1, 0, 7, 3, 0,
+	11, 0, 0, 6, 1, 0, 6, 1, 1, 8, 0, 1, 8, 1, 1, 12,
+	0, 1, 1, 0, 1, 1, 7, 1, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 16, 0, 1, 16, 1, 1, 1, 1, 1, 1, 2, 1, 1, 3, 1,
+	1, 4, 1, 1, 5, 1, 1, 6, 1, 13, 0, 1, 13, 1, 1, 14,
+	0, 0, 15, 0, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1,
+	0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0,
+	1, 6, 0, 1, 7, 0, 15, 1, 0, 14, 1, 0, 48, 0, 1, 49,
+	0, 0, 47, 0, 0, 46, 0, 0, 46, 1, 0, 47, 1, 0, 28, 0,
+	0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0,
+	25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23,
+	1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1,
+	0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0,
+	20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19,
+	2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2,
+	0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0,
+	1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1,
+	2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7,
+	0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 47, 2, 0,
+	15, 0, 0, 15, 1, 0, 47, 3, 0, 31, 0, 0, 31, 1, 0, 47,
+	4, 0, 34, 0, 0, 49, 1, 0, 48, 1, 1, 49, 0, 1, 49, 0,
+	0, 47, 0, 0, 46, 0, 0, 46, 1, 0, 47, 1, 0, 28, 0, 0,
+	27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25,
+	1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1,
+	0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0,
+	22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20,
+	0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2,
+	0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0,
+	42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1,
+	0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2,
+	0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0,
+	18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 47, 2, 0, 15,
+	0, 0, 15, 1, 0, 47, 3, 0, 31, 0, 0, 31, 1, 0, 47, 4,
+	0, 34, 0, 0, 49, 1, 0, 49, 1, 1, 46, 0, 1, 46, 1, 1,
+	28, 0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25,
+	0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0,
+	0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0,
+	22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21,
+	3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1,
+	0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0,
+	42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18,
+	2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0,
+	1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 28,
+	0, 1, 27, 0, 1, 27, 1, 1, 26, 0, 1, 26, 1, 1, 25, 0,
+	1, 25, 1, 1, 24, 0, 1, 24, 1, 1, 24, 2, 1, 23, 0, 1,
+	23, 1, 1, 23, 2, 1, 23, 3, 1, 23, 4, 1, 22, 0, 1, 22,
+	1, 1, 22, 2, 1, 21, 0, 1, 21, 1, 1, 21, 2, 1, 20, 2,
+	1, 19, 0, 1, 19, 1, 1, 19, 2, 1, 18, 2, 1, 1, 0, 1,
+	1, 7, 1, 38, 0, 0, 38, 1, 0, 38, 2, 0, 39, 0, 1, 40,
+	0, 0, 40, 1, 0, 15, 0, 1, 15, 1, 1, 18, 4, 1, 39, 0,
+	0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0,
+	1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1,
+	7, 0, 18, 5, 1, 31, 0, 1, 31, 1, 1, 18, 2, 1, 1, 0,
+	1, 1, 7, 1, 38, 0, 0, 38, 1, 0, 38, 2, 0, 39, 0, 1,
+	40, 0, 0, 40, 1, 0, 27, 0, 3, 26, 0, 1, 26, 0, 3, 25,
+	0, 1, 25, 0, 3, 24, 0, 1, 24, 1, 1, 24, 0, 3, 23, 0,
+	1, 23, 1, 1, 23, 2, 1, 23, 3, 1, 23, 0, 3, 22, 0, 1,
+	22, 1, 1, 22, 0, 3, 21, 0, 1, 21, 1, 1, 21, 2, 1, 20,
+	0, 2, 19, 0, 1, 19, 1, 1, 19, 2, 1, 40, 0, 1, 40, 1,
+	1, 41, 0, 0, 28, 0, 0, 27, 0, 0, 27, 1, 0, 26, 0, 0,
+	26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1, 0, 24,
+	2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0, 23, 4,
+	0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21, 1, 0,
+	21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2, 0, 19,
+	0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0, 42, 0,
+	0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42, 5, 0,
+	18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0, 0, 38,
+	1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 1, 5,
+	0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18, 4, 0,
+	18, 5, 0, 41, 1, 0, 41, 0, 1, 41, 1, 1, 19, 2, 3, 26,
+	0, 1, 24, 1, 3, 23, 0, 1, 23, 1, 1, 23, 2, 1, 23, 3,
+	1, 23, 1, 3, 22, 0, 1, 22, 1, 1, 22, 1, 3, 21, 0, 1,
+	21, 1, 1, 21, 2, 1, 20, 1, 2, 19, 0, 1, 19, 1, 1, 19,
+	2, 1, 18, 1, 2, 27, 0, 1, 18, 5, 4, 26, 0, 1, 23, 2,
+	3, 22, 0, 1, 22, 1, 1, 23, 3, 3, 22, 0, 1, 22, 1, 1,
+	32, 0, 1, 31, 0, 0, 31, 1, 0, 32, 1, 1, 48, 0, 0, 48,
+	1, 0, 35, 0, 1, 35, 1, 1, 35, 2, 1, 14, 0, 1, 14, 1,
+	1, 15, 0, 1, 1, 0, 1, 1, 7, 1, 38, 0, 0, 38, 1, 0,
+	38, 2, 0, 15, 1, 1, 11, 0, 2, 1, 0, 1, 1, 7, 1, 38,
+	0, 0, 38, 1, 0, 38, 2, 0, 8, 0, 2, 8, 1, 2, 12, 0,
+	2, 13, 0, 0, 13, 1, 0, 16, 0, 2, 16, 1, 2, 19, 0, 2,
+	19, 1, 2, 15, 0, 2, 15, 1, 2, 39, 0, 1, 40, 0, 0, 40,
+	1, 0, 1, 0, 1, 1, 7, 1, 38, 0, 0, 38, 1, 0, 38, 2,
+	0, 18, 5, 2, 31, 0, 2, 28, 0, 0, 27, 0, 0, 27, 1, 0,
+	26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24,
+	1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3,
+	0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0,
+	21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20,
+	2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0,
+	0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0,
+	42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38,
+	0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4,
+	0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0,
+	18, 4, 0, 18, 5, 0, 31, 1, 2, 35, 0, 2, 28, 0, 0, 27,
+	0, 0, 27, 1, 0, 26, 0, 0, 26, 1, 0, 25, 0, 0, 25, 1,
+	0, 24, 0, 0, 24, 1, 0, 24, 2, 0, 23, 0, 0, 23, 1, 0,
+	23, 2, 0, 23, 3, 0, 23, 4, 0, 22, 0, 0, 22, 1, 0, 22,
+	2, 0, 21, 0, 0, 21, 1, 0, 21, 2, 0, 21, 3, 0, 20, 0,
+	0, 20, 1, 0, 20, 2, 0, 19, 0, 0, 19, 1, 0, 19, 2, 0,
+	19, 3, 0, 18, 0, 0, 42, 0, 0, 42, 1, 0, 42, 2, 0, 42,
+	3, 0, 42, 4, 0, 42, 5, 0, 18, 1, 0, 18, 2, 0, 1, 0,
+	0, 1, 1, 0, 38, 0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0,
+	1, 3, 0, 1, 4, 0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 18,
+	3, 0, 39, 0, 0, 18, 4, 0, 18, 5, 0, 35, 1, 2, 35, 2,
+	2, 8, 0, 3, 8, 1, 3, 6, 0, 0, 7, 0, 0, 8, 0, 0,
+	8, 1, 0, 7, 1, 0, 12, 0, 0, 1, 0, 0, 1, 1, 0, 38,
+	0, 0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4,
+	0, 1, 5, 0, 1, 6, 0, 1, 7, 0, 7, 2, 0, 16, 0, 0,
+	16, 1, 0, 7, 3, 0, 11, 0, 0, 6, 1, 0, 19, 0, 3, 19,
+	1, 3, 40, 0, 0, 40, 1, 0, 31, 0, 3, 31, 1, 3, 35, 0,
+	3, 35, 1, 3, 35, 2, 3, 31, 0, 4, 48, 0, 0, 48, 1, 0,
+	31, 1, 4, 35, 1, 4, 28, 0, 0, 27, 0, 0, 27, 1, 0, 26,
+	0, 0, 26, 1, 0, 25, 0, 0, 25, 1, 0, 24, 0, 0, 24, 1,
+	0, 24, 2, 0, 23, 0, 0, 23, 1, 0, 23, 2, 0, 23, 3, 0,
+	23, 4, 0, 22, 0, 0, 22, 1, 0, 22, 2, 0, 21, 0, 0, 21,
+	1, 0, 21, 2, 0, 21, 3, 0, 20, 0, 0, 20, 1, 0, 20, 2,
+	0, 19, 0, 0, 19, 1, 0, 19, 2, 0, 19, 3, 0, 18, 0, 0,
+	42, 0, 0, 42, 1, 0, 42, 2, 0, 42, 3, 0, 42, 4, 0, 42,
+	5, 0, 18, 1, 0, 18, 2, 0, 1, 0, 0, 1, 1, 0, 38, 0,
+	0, 38, 1, 0, 38, 2, 0, 1, 2, 0, 1, 3, 0, 1, 4, 0,
+	1, 5, 0, 1, 6, 0, 1, 7, 0, 18, 3, 0, 39, 0, 0, 18,
+	4, 0, 18, 5, 0, 35, 2, 4, 31, 0, 5, 31, 1, 5, 32, 0,
+	0, 32, 1, 0, 35, 1, 5, 35, 2, 5
+};
+
+static const std::uint32_t fullStateTransitionOffsets[] =
+{
+	0, 13, 13, 13, 13, 13, 13, 14, 14, 14, 16, 16, 17, 17, 17, 18,
+	18, 18, 43, 67, 90, 112, 133, 153, 172, 172, 188, 188, 188, 189, 189, 217,
+	217, 242, 242, 264, 285, 305, 324, 324, 340, 340, 340, 340, 340, 340, 340, 340,
+	340, 366, 366, 367, 367, 367, 367, 367, 367, 367, 367, 367, 367, 368, 368, 368,
+	368, 368, 393, 393, 412, 412, 412, 433, 454, 455, 455, 456, 456, 483, 483, 483,
+	483, 483, 483, 483, 483, 484, 485, 487, 489, 489, 489, 489, 516, 517, 517, 517,
+	518, 518, 524, 524, 525, 525, 552, 552, 553, 553, 557, 569, 570, 575, 581, 588,
+	625, 661, 688, 689, 690, 691, 693, 697, 699, 702, 704, 711, 716, 717, 723, 724,
+	725, 727, 731, 733, 736, 738, 767, 768, 770, 774, 776, 779, 781, 783, 785, 787,
+	789, 793, 794, 795, 800, 804, 805, 808, 809, 810, 817, 844, 871, 884, 886, 887,
+	889, 891, 918, 920, 922
+};
+
+static const std::uint16_t fullTransitions[] =
+{
+	0, 0, 0, 1, 5, 0, 0, 2, 7, 0, 0, 4, 7, 1, 0, 8,
+	38, 0, 0, 53, 38, 1, 0, 54, 7, 2, 0, 99, 7, 3, 0, 103,
+	11, 0, 0, 105, 6, 0, 0, 106, 8, 0, 0, 107, 12, 0, 0, 108,
+	1, 1, 0, 109, 8, 1, 4, 7, 12, 0, 3, 10, 48, 0, 0, 111,
+	48, 0, 2, 12, 47, 0, 1, 15, 21, 3, 0, 69, 20, 0, 0, 25,
+	20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42,
+	42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46,
+	42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54,
+	18, 3, 0, 62, 27, 0, 2, 126, 26, 1, 0, 116, 25, 1, 0, 117,
+	24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120, 20, 2, 0, 121,
+	18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123, 21, 3, 0, 69,
+	20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41,
+	42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45,
+	42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53,
+	38, 1, 0, 54, 18, 3, 0, 62, 26, 0, 2, 127, 25, 1, 0, 117,
+	24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120, 20, 2, 0, 121,
+	18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123, 21, 3, 0, 69,
+	20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41,
+	42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45,
+	42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53,
+	38, 1, 0, 54, 18, 3, 0, 62, 25, 0, 2, 128, 24, 2, 0, 118,
+	23, 4, 0, 119, 22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125,
+	1, 1, 0, 109, 18, 4, 0, 123, 21, 3, 0, 69, 20, 0, 0, 25,
+	20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42,
+	42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46,
+	42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54,
+	18, 3, 0, 62, 24, 0, 2, 129, 23, 4, 0, 119, 22, 2, 0, 120,
+	20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40,
+	18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44,
+	42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48,
+	38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62, 23, 0, 2, 130,
+	22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109,
+	18, 4, 0, 123, 21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	22, 0, 2, 131, 20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109,
+	18, 4, 0, 123, 21, 0, 2, 24, 20, 0, 0, 25, 20, 1, 0, 39,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	20, 0, 1, 132, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	40, 1, 2, 29, 41, 0, 2, 31, 21, 3, 0, 69, 20, 0, 0, 25,
+	20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42,
+	42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46,
+	42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54,
+	18, 3, 0, 62, 41, 0, 0, 134, 28, 0, 0, 114, 27, 1, 0, 115,
+	26, 1, 0, 116, 25, 1, 0, 117, 24, 2, 0, 118, 23, 4, 0, 119,
+	22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109,
+	18, 4, 0, 123, 21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	19, 2, 2, 135, 26, 1, 0, 116, 25, 1, 0, 117, 24, 2, 0, 118,
+	23, 4, 0, 119, 22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125,
+	1, 1, 0, 109, 18, 4, 0, 123, 21, 3, 0, 69, 20, 0, 0, 25,
+	20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42,
+	42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46,
+	42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54,
+	18, 3, 0, 62, 24, 1, 2, 136, 23, 4, 0, 119, 22, 2, 0, 120,
+	20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40,
+	18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44,
+	42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48,
+	38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62, 23, 1, 2, 137,
+	22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109,
+	18, 4, 0, 123, 21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	22, 1, 2, 138, 20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109,
+	18, 4, 0, 123, 21, 1, 2, 38, 20, 0, 0, 25, 20, 1, 0, 39,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	20, 1, 1, 139, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40,
+	18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44,
+	42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48,
+	38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62, 18, 1, 1, 140,
+	27, 1, 0, 115, 26, 1, 0, 116, 25, 1, 0, 117, 24, 2, 0, 118,
+	23, 4, 0, 119, 22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125,
+	1, 1, 0, 109, 18, 4, 0, 123, 1, 0, 2, 51, 1, 7, 2, 61,
+	21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40,
+	18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44,
+	42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48,
+	38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62, 18, 5, 3, 141,
+	26, 1, 0, 116, 25, 1, 0, 117, 24, 2, 0, 118, 23, 4, 0, 119,
+	22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109,
+	18, 4, 0, 123, 21, 2, 2, 68, 20, 0, 0, 25, 20, 1, 0, 39,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40,
+	18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44,
+	42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48,
+	38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62, 23, 2, 2, 142,
+	22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109,
+	18, 4, 0, 123, 21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	23, 3, 2, 143, 22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125,
+	1, 1, 0, 109, 18, 4, 0, 123, 47, 1, 1, 73, 47, 2, 1, 75,
+	15, 1, 3, 77, 21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	28, 0, 0, 114, 27, 1, 0, 115, 26, 1, 0, 116, 25, 1, 0, 117,
+	24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120, 20, 2, 0, 121,
+	18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123, 34, 0, 1, 85,
+	34, 0, 2, 86, 34, 0, 3, 87, 35, 0, 0, 145, 34, 0, 4, 88,
+	48, 0, 0, 111, 35, 2, 6, 92, 21, 3, 0, 69, 20, 0, 0, 25,
+	20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42,
+	42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46,
+	42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54,
+	18, 3, 0, 62, 28, 0, 0, 114, 27, 1, 0, 115, 26, 1, 0, 116,
+	25, 1, 0, 117, 24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120,
+	20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	35, 2, 7, 93, 13, 1, 2, 96, 14, 0, 2, 98, 38, 0, 0, 53,
+	38, 1, 0, 54, 14, 0, 0, 146, 15, 0, 0, 147, 1, 1, 0, 109,
+	7, 2, 1, 100, 16, 1, 3, 102, 21, 3, 0, 69, 20, 0, 0, 25,
+	20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42,
+	42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46,
+	42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54,
+	18, 3, 0, 62, 28, 0, 0, 114, 27, 1, 0, 115, 26, 1, 0, 116,
+	25, 1, 0, 117, 24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120,
+	20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	7, 3, 1, 104, 38, 0, 0, 53, 38, 1, 0, 54, 11, 0, 1, 148,
+	1, 1, 0, 109, 6, 0, 1, 3, 7, 0, 0, 4, 7, 1, 0, 8,
+	38, 0, 0, 53, 38, 1, 0, 54, 7, 2, 0, 99, 7, 3, 0, 103,
+	11, 0, 0, 105, 6, 0, 0, 106, 8, 0, 0, 107, 12, 0, 0, 108,
+	1, 1, 0, 109, 8, 0, 1, 149, 1, 0, 1, 50, 1, 7, 1, 60,
+	38, 0, 0, 53, 38, 1, 0, 54, 12, 0, 1, 150, 1, 1, 1, 52,
+	1, 2, 1, 55, 1, 3, 1, 56, 1, 4, 1, 57, 1, 5, 1, 58,
+	1, 6, 1, 59, 13, 0, 1, 94, 13, 1, 1, 95, 38, 0, 0, 53,
+	38, 1, 0, 54, 14, 0, 0, 146, 15, 0, 0, 147, 1, 1, 0, 109,
+	48, 0, 1, 11, 47, 0, 0, 14, 47, 1, 0, 72, 21, 3, 0, 69,
+	20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41,
+	42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45,
+	42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53,
+	38, 1, 0, 54, 18, 3, 0, 62, 47, 2, 0, 74, 47, 3, 0, 78,
+	47, 4, 0, 83, 34, 0, 0, 84, 48, 1, 1, 79, 49, 0, 0, 112,
+	46, 0, 0, 113, 28, 0, 0, 114, 27, 1, 0, 115, 26, 1, 0, 116,
+	25, 1, 0, 117, 24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120,
+	20, 2, 0, 121, 18, 2, 0, 122, 1, 1, 0, 109, 18, 4, 0, 123,
+	31, 0, 0, 124, 49, 0, 1, 13, 47, 0, 0, 14, 47, 1, 0, 72,
+	21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40,
+	18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44,
+	42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48,
+	38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62, 47, 2, 0, 74,
+	47, 3, 0, 78, 47, 4, 0, 83, 34, 0, 0, 84, 49, 0, 0, 112,
+	46, 0, 0, 113, 28, 0, 0, 114, 27, 1, 0, 115, 26, 1, 0, 116,
+	25, 1, 0, 117, 24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120,
+	20, 2, 0, 121, 18, 2, 0, 122, 1, 1, 0, 109, 18, 4, 0, 123,
+	31, 0, 0, 124, 46, 1, 1, 16, 21, 3, 0, 69, 20, 0, 0, 25,
+	20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42,
+	42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46,
+	42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54,
+	18, 3, 0, 62, 28, 0, 0, 114, 27, 1, 0, 115, 26, 1, 0, 116,
+	25, 1, 0, 117, 24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120,
+	20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123,
+	27, 0, 1, 17, 26, 0, 1, 18, 25, 0, 1, 19, 24, 0, 1, 20,
+	24, 1, 1, 34, 23, 0, 1, 21, 23, 1, 1, 35, 23, 2, 1, 70,
+	23, 3, 1, 71, 22, 0, 1, 22, 22, 1, 1, 36, 21, 0, 1, 23,
+	21, 1, 1, 37, 21, 2, 1, 67, 19, 2, 1, 32, 19, 0, 1, 151,
+	1, 0, 1, 50, 1, 7, 1, 60, 38, 0, 0, 53, 38, 1, 0, 54,
+	39, 0, 1, 63, 40, 0, 0, 133, 15, 0, 1, 152, 18, 4, 1, 64,
+	38, 0, 0, 53, 38, 1, 0, 54, 39, 0, 0, 153, 1, 1, 0, 109,
+	31, 0, 1, 154, 1, 0, 1, 50, 1, 7, 1, 60, 38, 0, 0, 53,
+	38, 1, 0, 54, 39, 0, 1, 63, 40, 0, 0, 133, 26, 0, 1, 18,
+	25, 0, 1, 19, 24, 0, 1, 20, 24, 1, 1, 34, 23, 0, 1, 21,
+	23, 1, 1, 35, 23, 2, 1, 70, 23, 3, 1, 71, 22, 0, 1, 22,
+	22, 1, 1, 36, 21, 0, 1, 23, 21, 1, 1, 37, 21, 2, 1, 67,
+	19, 2, 1, 32, 19, 0, 1, 151, 40, 0, 1, 27, 40, 1, 1, 28,
+	21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40,
+	18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44,
+	42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48,
+	38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62, 41, 0, 0, 134,
+	28, 0, 0, 114, 27, 1, 0, 115, 26, 1, 0, 116, 25, 1, 0, 117,
+	24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120, 20, 2, 0, 121,
+	18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123, 41, 0, 1, 30,
+	19, 2, 3, 33, 26, 0, 1, 18, 23, 0, 1, 21, 23, 1, 1, 35,
+	23, 2, 1, 70, 23, 3, 1, 71, 22, 0, 1, 22, 22, 1, 1, 36,
+	21, 0, 1, 23, 21, 1, 1, 37, 21, 2, 1, 67, 19, 2, 1, 32,
+	19, 0, 1, 151, 18, 1, 2, 49, 27, 0, 1, 17, 18, 5, 4, 66,
+	26, 0, 1, 18, 22, 0, 1, 22, 22, 1, 1, 36, 22, 0, 1, 22,
+	22, 1, 1, 36, 32, 0, 1, 81, 32, 1, 1, 82, 31, 0, 0, 124,
+	48, 0, 0, 111, 35, 0, 1, 155, 14, 0, 1, 97, 1, 0, 1, 50,
+	1, 7, 1, 60, 38, 0, 0, 53, 38, 1, 0, 54, 15, 0, 1, 152,
+	1, 0, 1, 50, 1, 7, 1, 60, 38, 0, 0, 53, 38, 1, 0, 54,
+	8, 0, 2, 156, 12, 0, 2, 9, 13, 0, 0, 110, 16, 1, 2, 101,
+	19, 0, 2, 157, 15, 1, 2, 76, 39, 0, 1, 63, 40, 0, 0, 133,
+	1, 0, 1, 50, 1, 7, 1, 60, 38, 0, 0, 53, 38, 1, 0, 54,
+	18, 5, 2, 65, 21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39,
+	19, 3, 0, 40, 18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43,
+	42, 2, 0, 44, 42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47,
+	18, 1, 0, 48, 38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62,
+	28, 0, 0, 114, 27, 1, 0, 115, 26, 1, 0, 116, 25, 1, 0, 117,
+	24, 2, 0, 118, 23, 4, 0, 119, 22, 2, 0, 120, 20, 2, 0, 121,
+	18, 2, 0, 125, 1, 1, 0, 109, 18, 4, 0, 123, 31, 0, 2, 158,
+	21, 3, 0, 69, 20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40,
+	18, 0, 0, 41, 42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44,
+	42, 3, 0, 45, 42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48,
+	38, 0, 0, 53, 38, 1, 0, 54, 18, 3, 0, 62, 28, 0, 0, 114,
+	27, 1, 0, 115, 26, 1, 0, 116, 25, 1, 0, 117, 24, 2, 0, 118,
+	23, 4, 0, 119, 22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125,
+	1, 1, 0, 109, 18, 4, 0, 123, 35, 0, 2, 159, 8, 0, 3, 5,
+	8, 1, 3, 6, 7, 0, 0, 4, 7, 1, 0, 8, 38, 0, 0, 53,
+	38, 1, 0, 54, 7, 2, 0, 99, 7, 3, 0, 103, 11, 0, 0, 105,
+	6, 0, 0, 106, 8, 0, 0, 107, 12, 0, 0, 108, 1, 1, 0, 109,
+	19, 1, 3, 26, 40, 0, 0, 133, 31, 0, 3, 160, 35, 0, 3, 89,
+	35, 1, 3, 161, 48, 0, 0, 111, 31, 0, 4, 162, 21, 3, 0, 69,
+	20, 0, 0, 25, 20, 1, 0, 39, 19, 3, 0, 40, 18, 0, 0, 41,
+	42, 0, 0, 42, 42, 1, 0, 43, 42, 2, 0, 44, 42, 3, 0, 45,
+	42, 4, 0, 46, 42, 5, 0, 47, 18, 1, 0, 48, 38, 0, 0, 53,
+	38, 1, 0, 54, 18, 3, 0, 62, 28, 0, 0, 114, 27, 1, 0, 115,
+	26, 1, 0, 116, 25, 1, 0, 117, 24, 2, 0, 118, 23, 4, 0, 119,
+	22, 2, 0, 120, 20, 2, 0, 121, 18, 2, 0, 125, 1, 1, 0, 109,
+	18, 4, 0, 123, 35, 1, 4, 163, 31, 1, 5, 80, 32, 0, 0, 144,
+	35, 1, 5, 90, 35, 2, 5, 91
+};
+
+const Parser::SLRParseTables full =
+{
+	0xc036b52aa4d749deull,
+	164,
+	fullStateItemOffsets,
+	fullItems,
+	fullStateTransitionOffsets,
+	fullTransitions
+};
+
+
+} //End namespace jitcat::Grammar::CatGrammarParseTables
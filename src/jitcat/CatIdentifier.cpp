@@ -17,6 +17,7 @@
 #include "jitcat/CustomTypeInfo.h"
 #include "jitcat/ExpressionErrorManager.h"
 #include "jitcat/StaticConstMemberInfo.h"
+#include "jitcat/SymbolTable.h"
 #include "jitcat/Tools.h"
 #include "jitcat/MemberInfo.h"
 
@@ -115,19 +116,19 @@ std::any CatIdentifier::executeAssignable(CatRuntimeContext* runtimeContext)
 
 bool CatIdentifier::typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErrorManager* errorManager, void* errorContext)
 {
-	std::string lowerName = Tools::toLowerCase(name);
+	SymbolId symbol = SymbolTable::find(name);
 	CatScopeID scopeId = InvalidScopeID;
-	if (compiletimeContext->findVariable(lowerName, scopeId) != nullptr)
+	if (compiletimeContext->findVariable(symbol, scopeId) != nullptr)
 	{
 		//Member variable
 		disambiguatedIdentifier = std::make_unique<CatMemberAccess>(new CatScopeRoot(scopeId, lexeme), name, lexeme);
 	}
-	else if (compiletimeContext->findStaticVariable(lowerName, scopeId) != nullptr)
+	else if (compiletimeContext->findStaticVariable(symbol, scopeId) != nullptr)
 	{
 		//Static variable
 		disambiguatedIdentifier = std::make_unique<CatStaticMemberAccess>(new CatStaticScope(true, nullptr, compiletimeContext->getScopeType(scopeId)->getTypeName(), lexeme, lexeme), lexeme, lexeme);
 	}
-	else if (StaticConstMemberInfo* staticConst = compiletimeContext->findStaticConstant(lowerName, scopeId); staticConst != nullptr)
+	else if (StaticConstMemberInfo* staticConst = compiletimeContext->findStaticConstant(symbol, scopeId); staticConst != nullptr)
 	{
 		//Static constant
 		disambiguatedIdentifier = std::make_unique<CatLiteral>(staticConst->getValue(), staticConst->getType(), getLexeme());
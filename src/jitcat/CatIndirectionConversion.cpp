@@ -70,7 +70,7 @@ std::any CatIndirectionConversion::execute(jitcat::CatRuntimeContext* runtimeCon
     std::any value = expressionToConvert->execute(runtimeContext);
     if (isReferenceConversionMode(conversionMode))
     {
-        return typeWithoutIndirection.doIndirectionConversion(runtimeContext->addTemporary(value), conversionMode);
+        return typeWithoutIndirection.doIndirectionConversion(runtimeContext->addTemporary(std::move(value)), conversionMode);
     }
     else
     {
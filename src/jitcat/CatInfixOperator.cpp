@@ -127,6 +127,30 @@ std::any CatInfixOperator::execute(CatRuntimeContext* runtimeContext)
 }
 
 
+CatValue CatInfixOperator::executeValue(CatRuntimeContext* runtimeContext)
+{
+	if (overloadedOperator != nullptr)
+	{
+		return overloadedOperator->executeValue(runtimeContext);
+	}
+	else if (oper == CatInfixOperatorType::LogicalAnd || oper == CatInfixOperatorType::LogicalOr)
+	{
+		return CatValue(calculateLogicalExpression(runtimeContext));
+	}
+	else if (!CatValue::canHold(lhs->getType()) || !CatValue::canHold(rhs->getType()))
+	{
+		//Strings are not held by a CatValue, calculate the result through std::any.
+		return CatValue::fromAny(calculateExpression(runtimeContext), resultType);
+	}
+	else
+	{
+		CatValue lValue = lhs->executeValue(runtimeContext);
+		CatValue rValue = rhs->executeValue(runtimeContext);
+		return calculateValue(lValue, rValue);
+	}
+}
+
+
 bool CatInfixOperator::typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErrorManager* errorManager, void* errorContext)
 {
 	if (overloadedOperator != nullptr)
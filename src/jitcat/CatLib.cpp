@@ -6,6 +6,7 @@
 */
 
 #include "jitcat/CatLib.h"
+#include "jitcat/ASTNode.h"
 #include "jitcat/CatSourceFile.h"
 #include "jitcat/CatRuntimeContext.h"
 #include "jitcat/CustomTypeInfo.h"
@@ -16,8 +17,10 @@
 #include "jitcat/SLRParseResult.h"
 #include "jitcat/Tools.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <set>
 
 using namespace jitcat;
 using namespace AST;
@@ -26,14 +29,17 @@ using namespace Reflection;
 CatLib::CatLib(const std::string& libName, std::shared_ptr<PrecompilationContext> precompilationContext, std::function<void(const std::string&, int, int, int)> errorHandler):
 	name(libName),
 	errorManager(std::make_unique<ExpressionErrorManager>(errorHandler)),
-	context(std::make_unique<CatRuntimeContext>(libName, errorManager.get()))
+	context(std::make_unique<CatRuntimeContext>(libName, errorManager.get())),
+	astMemory(0)
 {
 	context->setPrecompilationContext(precompilationContext);
+	MemoryStatisticsRegistry::registerCatLib(this);
 }
 
 
 CatLib::~CatLib()
 {
+	MemoryStatisticsRegistry::unregisterCatLib(this);
 }
 
 
@@ -59,19 +65,23 @@ AST::CatSourceFile* CatLib::addSource(const std::string& translationUnitName, To
 {
 	ErrorContext innerContext(context.get(), translationUnitName);
 	errorManager->setCurrentDocument(&translationUnitCode);
+	const std::ptrdiff_t previousASTMemory = ASTNode::getThreadAllocatedMemory();
 	std::unique_ptr<Parser::SLRParseResult> result = JitCat::get()->parseFull(translationUnitCode, context.get(), errorManager.get(), this);
+	CatSourceFile* compiledSourceFile = nullptr;
 	if (result->success)
 	{
+		astArenas.push_back(std::move(result->astArena));
 		CatSourceFile* sourceFile = result->releaseNode<CatSourceFile>();
 		sourceFiles.emplace_back(sourceFile);
 		if (sourceFile->compile(*this))
 		{
-			errorManager->setCurrentDocument(nullptr);
-			return sourceFile;
+			compiledSourceFile = sourceFile;
 		}
 	}
+	result.reset(nullptr);
+	astMemory += (std::size_t)std::max((std::ptrdiff_t)0, ASTNode::getThreadAllocatedMemory() - previousASTMemory);
 	errorManager->setCurrentDocument(nullptr);
-	return nullptr;
+	return compiledSourceFile;
 }
 
 
@@ -108,3 +118,46 @@ CatRuntimeContext* CatLib::getRuntimeContext() const
 {
 	return context.get();
 }
+
+
+void CatLib::setOptimizationLevel(LLVM::LLVMOptimizationLevel level)
+{
+	optimizationLevel = level;
+}
+
+
+LLVM::LLVMOptimizationLevel CatLib::getOptimizationLevel() const
+{
+	return optimizationLevel.value_or(JitCat::get()->getDefaultOptimizationLevel());
+}
+
+
+CatLibMemoryStatistics CatLib::getMemoryStatistics() const
+{
+	CatLibMemoryStatistics statistics;
+	statistics.libName = name;
+	statistics.numSourceFiles = sourceFiles.size();
+	statistics.astMemory = astMemory;
+	//Collect the types of the source files and the classes nested within them.
+	std::set<const TypeInfo*> types;
+	std::vector<const TypeInfo*> typesToVisit;
+	for (auto& iter : sourceFiles)
+	{
+		typesToVisit.push_back(iter->getCustomType());
+	}
+	while (!typesToVisit.empty())
+	{
+		const TypeInfo* typeInfo = typesToVisit.back();
+		typesToVisit.pop_back();
+		if (typeInfo != nullptr && types.insert(typeInfo).second)
+		{
+			statistics.typeInfoMemory += typeInfo->getMemoryUsage();
+			for (auto& nestedType : typeInfo->getTypes())
+			{
+				typesToVisit.push_back(nestedType.second);
+			}
+		}
+	}
+	statistics.numTypes = types.size();
+	return statistics;
+}
@@ -18,7 +18,8 @@ using namespace jitcat::Tools;
 jitcat::AST::CatLiteral::CatLiteral(const std::any& value, CatGenericType type, const Tokenizer::Lexeme& lexeme):
 	CatTypedExpression(lexeme),
 	type(type),
-	value(value)
+	value(value),
+	literalValue(createScalarValue(this->value, this->type))
 {
 }
 
@@ -26,7 +27,8 @@ jitcat::AST::CatLiteral::CatLiteral(const std::any& value, CatGenericType type,
 jitcat::AST::CatLiteral::CatLiteral(const Configuration::CatString& value, const Tokenizer::Lexeme& lexeme): 
 	CatTypedExpression(lexeme), 
 	type(CatGenericType::stringConstantValuePtrType),
-	value(TypeTraits<const Configuration::CatString*>::getCatValue(StringConstantPool::getString(value)))
+	value(TypeTraits<const Configuration::CatString*>::getCatValue(StringConstantPool::getString(value))),
+	literalValue(createScalarValue(this->value, type))
 {
 }
 
@@ -34,7 +36,8 @@ jitcat::AST::CatLiteral::CatLiteral(const Configuration::CatString& value, const
 jitcat::AST::CatLiteral::CatLiteral(float floatValue, const Tokenizer::Lexeme& lexeme):
 	CatTypedExpression(lexeme), 
 	type(CatGenericType::floatType),
-	value(floatValue)
+	value(floatValue),
+	literalValue(floatValue)
 {
 }
 
@@ -42,7 +45,8 @@ jitcat::AST::CatLiteral::CatLiteral(float floatValue, const Tokenizer::Lexeme& l
 jitcat::AST::CatLiteral::CatLiteral(double doubleValue, const Tokenizer::Lexeme& lexeme):
 	CatTypedExpression(lexeme), 
 	type(CatGenericType::doubleType),
-	value(doubleValue)
+	value(doubleValue),
+	literalValue(doubleValue)
 {
 }
 
@@ -50,7 +54,8 @@ jitcat::AST::CatLiteral::CatLiteral(double doubleValue, const Tokenizer::Lexeme&
 jitcat::AST::CatLiteral::CatLiteral(int intValue, const Tokenizer::Lexeme& lexeme):
 	CatTypedExpression(lexeme), 
 	type(CatGenericType::intType),
-	value(intValue)
+	value(intValue),
+	literalValue(intValue)
 {
 }
 
@@ -58,7 +63,8 @@ jitcat::AST::CatLiteral::CatLiteral(int intValue, const Tokenizer::Lexeme& lexem
 jitcat::AST::CatLiteral::CatLiteral(bool boolValue, const Tokenizer::Lexeme& lexeme): 
 	CatTypedExpression(lexeme), 
 	type(CatGenericType::boolType),
-	value(boolValue)
+	value(boolValue),
+	literalValue(boolValue)
 {
 }
 
@@ -66,7 +72,8 @@ jitcat::AST::CatLiteral::CatLiteral(bool boolValue, const Tokenizer::Lexeme& lex
 jitcat::AST::CatLiteral::CatLiteral(const CatLiteral& other):
 	CatTypedExpression(other),
 	type(other.type),
-	value(other.value)
+	value(other.value),
+	literalValue(other.literalValue)
 {
 }
 
@@ -93,3 +100,24 @@ const std::any& CatLiteral::getValue() const
 {
 	return value;
 }
+
+
+CatValue CatLiteral::executeValue(CatRuntimeContext* runtimeContext)
+{
+	if (literalValue.getTag() != CatValue::Tag::None)
+	{
+		return literalValue;
+	}
+	return CatValue::fromAny(value, type);
+}
+
+
+CatValue CatLiteral::createScalarValue(const std::any& value, const CatGenericType& type)
+{
+	switch (CatValue::getTag(type))
+	{
+		case CatValue::Tag::None:
+		case CatValue::Tag::Pointer:	return CatValue();
+		default:						return CatValue::fromAny(value, type);
+	}
+}
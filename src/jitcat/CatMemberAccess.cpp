@@ -82,6 +82,22 @@ std::any CatMemberAccess::execute(CatRuntimeContext* runtimeContext)
 }
 
 
+CatValue CatMemberAccess::executeValue(CatRuntimeContext* runtimeContext)
+{
+	if (memberInfo != nullptr && runtimeContext != nullptr)
+	{
+		if (CatValue::canHold(base->getType()))
+		{
+			return memberInfo->getMemberValue(reinterpret_cast<unsigned char*>(base->executeValue(runtimeContext).getPointer()));
+		}
+		//Handles can not be held by a CatValue.
+		return memberInfo->getMemberValue(reinterpret_cast<unsigned char*>(base->getType().getRawPointer(base->execute(runtimeContext))));
+	}
+	assert(false);
+	return CatValue();
+}
+
+
 std::any CatMemberAccess::executeAssignable(CatRuntimeContext* runtimeContext)
 {
 	std::any baseValue = base->execute(runtimeContext);
@@ -115,7 +131,7 @@ bool CatMemberAccess::typeCheck(CatRuntimeContext* compiletimeContext, Expressio
 			errorManager->compiledWithError(Tools::append("Expression to the left of '.' is not an object."), errorContext, compiletimeContext->getContextName(), getLexeme());
 			return false;
 		}
-		memberInfo = baseType.getPointeeType()->getObjectType()->getMemberInfo(Tools::toLowerCase(memberName));
+		memberInfo = baseType.getPointeeType()->getObjectType()->getMemberInfo(memberName);
 		if (memberInfo != nullptr)
 		{
 			type = memberInfo->getType();
@@ -35,7 +35,8 @@ CatMemberFunctionCall::CatMemberFunctionCall(const std::string& name, const Toke
 	nameLexeme(nameLexeme),
 	base(base),
 	arguments(arguments),
-	returnType(CatGenericType::unknownType)
+	returnType(CatGenericType::unknownType),
+	callWithValues(false)
 {
 	assert(arguments != nullptr);
 }
@@ -49,7 +50,8 @@ CatMemberFunctionCall::CatMemberFunctionCall(const CatMemberFunctionCall& other)
 	nameLexeme(other.nameLexeme),
 	base(other.base != nullptr ? static_cast<CatTypedExpression*>(other.base->copy()) : nullptr),
 	arguments(static_cast<CatArgumentList*>(other.arguments->copy())),
-	returnType(CatGenericType::unknownType)
+	returnType(CatGenericType::unknownType),
+	callWithValues(false)
 {
 }
 
@@ -112,6 +114,27 @@ std::any CatMemberFunctionCall::executeWithBase(CatRuntimeContext* runtimeContex
 }
 
 
+CatValue CatMemberFunctionCall::executeValue(CatRuntimeContext* runtimeContext)
+{
+	if (!callWithValues || runtimeContext == nullptr)
+	{
+		return CatValue::fromAny(execute(runtimeContext), returnType);
+	}
+	uintptr_t baseValue = base->executeValue(runtimeContext).getPointer();
+	bool wasReturning = runtimeContext->getIsReturning();
+	runtimeContext->setReturning(false);
+	CatValue argumentValues[MemberFunctionInfo::maxValueCallArguments];
+	std::size_t numArguments = arguments->getNumArguments();
+	for (std::size_t i = 0; i < numArguments; ++i)
+	{
+		argumentValues[i] = arguments->getArgumentReference(i)->executeValue(runtimeContext);
+	}
+	CatValue value = memberFunctionInfo->callValue(runtimeContext, baseValue, argumentValues);
+	runtimeContext->setReturning(wasReturning);
+	return value;
+}
+
+
 bool CatMemberFunctionCall::typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErrorManager* errorManager, void* errorContext)
 {
 	if (!arguments->typeCheck(compiletimeContext, errorManager, errorContext))
@@ -120,6 +143,7 @@ bool CatMemberFunctionCall::typeCheck(CatRuntimeContext* compiletimeContext, Exp
 	}
 	
 	returnType = CatGenericType::unknownType;
+	callWithValues = false;
 	if (base == nullptr)
 	{
 		//function call without a base. Check Scopes.
@@ -194,6 +218,18 @@ bool CatMemberFunctionCall::typeCheck(CatRuntimeContext* compiletimeContext, Exp
 			}
 
 			returnType = memberFunctionInfo->getReturnType();
+
+			//Scalar arguments are passed without boxing them in a std::any if their types match the argument types exactly.
+			callWithValues = memberFunctionInfo->canCallWithValues() 
+							 && CatValue::getTag(base->getType()) == CatValue::Tag::Pointer 
+							 && CatValue::canHold(returnType);
+			for (std::size_t i = 0; i < arguments->getNumArguments() && callWithValues; ++i)
+			{
+				CatValue::Tag argumentTag = CatValue::getTag(arguments->getArgument(i)->getType());
+				callWithValues = argumentTag != CatValue::Tag::None 
+								 && argumentTag != CatValue::Tag::Pointer 
+								 && argumentTag == CatValue::getTag(memberFunctionInfo->getArgumentType(i));
+			}
 			return true;
 		}
 	}
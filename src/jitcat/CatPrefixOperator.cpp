@@ -75,6 +75,21 @@ std::any CatPrefixOperator::execute(CatRuntimeContext* runtimeContext)
 }
 
 
+CatValue CatPrefixOperator::executeValue(CatRuntimeContext* runtimeContext)
+{
+	CatValue rValue = rhs->executeValue(runtimeContext);
+	switch (rValue.getTag())
+	{
+		case CatValue::Tag::Bool:	return CatValue(!rValue.getBool());
+		case CatValue::Tag::Int:	return CatValue(-rValue.getInt());
+		case CatValue::Tag::Float:	return CatValue(-rValue.getFloat());
+		case CatValue::Tag::Double:	return CatValue(-rValue.getDouble());
+		default:					assert(false);
+	}
+	return CatValue();
+}
+
+
 bool CatPrefixOperator::typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErrorManager* errorManager, void* errorContext)
 {
 	if (rhs->typeCheck(compiletimeContext, errorManager, errorContext))
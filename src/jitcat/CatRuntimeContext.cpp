@@ -7,14 +7,17 @@
 
 #include "jitcat/CatRuntimeContext.h"
 #include "jitcat/CatScopeBlock.h"
+#include "jitcat/CompileSession.h"
 #include "jitcat/CustomTypeInfo.h"
 #include "jitcat/ErrorContext.h"
 #include "jitcat/ExpressionErrorManager.h"
+#include "jitcat/FunctionSignature.h"
 #include "jitcat/JitCat.h"
 #ifdef ENABLE_LLVM
 	#include "jitcat/LLVMCodeGenerator.h"
 	#include "jitcat/LLVMJit.h"
 #endif
+#include "jitcat/MemoryStatistics.h"
 #include "jitcat/ObjectInstance.h"
 #include "jitcat/PrecompilationContext.h"
 #include "jitcat/Tools.h"
@@ -36,7 +39,9 @@ CatRuntimeContext::CatRuntimeContext(const std::string& contextName, ExpressionE
 	ownsErrorManager(false),
 	errorManager(errorManager),
 	contextName(contextName),
-	currentStackFrameOffset(0)
+	lookupCacheVersion(0),
+	currentStackFrameOffset(0),
+	memoryCounters(std::make_shared<ContextMemoryCounters>(contextName))
 #ifdef ENABLE_LLVM
 	,codeGenerator(nullptr)
 #endif
@@ -46,11 +51,19 @@ CatRuntimeContext::CatRuntimeContext(const std::string& contextName, ExpressionE
 		ownsErrorManager = true;
 		this->errorManager = new ExpressionErrorManager();
 	}
+	MemoryStatisticsRegistry::registerContext(memoryCounters);
 }
 
 
 CatRuntimeContext::~CatRuntimeContext()
 {
+	JitCat::cancelBackgroundCompilation(this);
+	//Cancelling removes the session from compileSessions.
+	while (!compileSessions.empty())
+	{
+		compileSessions.back()->cancel(this);
+	}
+	memoryCounters->setContextDestroyed();
 	if (ownsErrorManager)
 	{
 		delete errorManager;
@@ -179,12 +192,14 @@ void CatRuntimeContext::removeScope(CatScopeID id)
 		id = std::abs(id) - 2;
 		assert(id >= 0 && id < static_cast<CatScopeID>(staticScopes.size()));
 		staticScopes.erase(staticScopes.begin() + id);
+		invalidateLookupCache();
 	}
 	else if (id != InvalidScopeID)
 	{
 		id += currentStackFrameOffset;
 		assert(id >= 0 && id < static_cast<CatScopeID>(scopes.size()));
 		scopes.erase(scopes.begin() + id);
+		invalidateLookupCache();
 	}
 }
 
@@ -196,6 +211,30 @@ void CatRuntimeContext::setScopeObject(CatScopeID id, unsigned char* scopeObject
 }
 
 
+unsigned char* CatRuntimeContext::beginScopeObjectBatch(CatScopeID id)
+{
+	Scope* scope = getScope(id);
+	assert(!scope->isStatic);
+	unsigned char* previousScopeObject = scope->scopeObject.get();
+	scope->scopeObject.setReflectable(nullptr, scope->scopeObject.getObjectType());
+	return previousScopeObject;
+}
+
+
+void CatRuntimeContext::setBatchScopeObject(CatScopeID id, unsigned char* scopeObject)
+{
+	getScope(id)->scopeObject.setUntrackedReflectable(scopeObject);
+}
+
+
+void CatRuntimeContext::endScopeObjectBatch(CatScopeID id, unsigned char* previousScopeObject)
+{
+	Scope* scope = getScope(id);
+	scope->scopeObject.setUntrackedReflectable(nullptr);
+	scope->scopeObject.setReflectable(previousScopeObject, scope->scopeObject.getObjectType());
+}
+
+
 bool CatRuntimeContext::isStaticScope(CatScopeID id) const
 {
 	Scope* scope = getScope(id);
@@ -251,171 +290,82 @@ void CatRuntimeContext::popErrorContext(ErrorContext* context)
 }
 
 
-TypeMemberInfo* CatRuntimeContext::findVariable(const std::string& lowercaseName, CatScopeID& scopeId)
+TypeMemberInfo* CatRuntimeContext::findVariable(const std::string& name, CatScopeID& scopeId)
 {
-	for (int i = (int)scopes.size() - 1; i >= 0; i--)
-	{
-		TypeMemberInfo* memberInfo = scopes[i]->scopeObject.getObjectType()->getMemberInfo(lowercaseName);
-		if (memberInfo != nullptr)
-		{
-			scopeId = i;
-			return memberInfo;
-		}
-	}
-	for (int i = (int)staticScopes.size() - 1; i >= 0; i--)
-	{
-		TypeMemberInfo* memberInfo = staticScopes[i]->scopeObject.getObjectType()->getMemberInfo(lowercaseName);
-		if (memberInfo != nullptr)
-		{
-			scopeId = InvalidScopeID - i - 1;
-			return memberInfo;
-		}
-	}
-	return nullptr;
+	return findVariable(Reflection::SymbolTable::find(name), scopeId);
 }
 
 
-Reflection::StaticMemberInfo* jitcat::CatRuntimeContext::findStaticVariable(const std::string& lowercaseName, CatScopeID& scopeId)
+TypeMemberInfo* CatRuntimeContext::findVariable(Reflection::SymbolId symbol, CatScopeID& scopeId)
 {
-	for (int i = (int)scopes.size() - 1; i >= 0; i--)
-	{
-		StaticMemberInfo* staticMemberInfo = scopes[i]->scopeObject.getObjectType()->getStaticMemberInfo(lowercaseName);
-		if (staticMemberInfo != nullptr)
-		{
-			scopeId = i;
-			return staticMemberInfo;
-		}
-	}
-	for (int i = (int)staticScopes.size() - 1; i >= 0; i--)
-	{
-		StaticMemberInfo* staticMemberInfo = staticScopes[i]->scopeObject.getObjectType()->getStaticMemberInfo(lowercaseName);
-		if (staticMemberInfo != nullptr)
-		{
-			scopeId = InvalidScopeID - i - 1;
-			return staticMemberInfo;
-		}
-	}
-	return nullptr;
+	return findInScopes<TypeMemberInfo>(LookupKind::Variable, symbol, nullptr, scopeId, 
+		[symbol](TypeInfo* scopeType) {return scopeType->getMemberInfo(symbol);});
 }
 
 
-Reflection::StaticConstMemberInfo* CatRuntimeContext::findStaticConstant(const std::string& lowercaseName, CatScopeID& scopeId)
+Reflection::StaticMemberInfo* jitcat::CatRuntimeContext::findStaticVariable(const std::string& name, CatScopeID& scopeId)
 {
-	for (int i = (int)scopes.size() - 1; i >= 0; i--)
-	{
-		StaticConstMemberInfo* staticConstMemberInfo = scopes[i]->scopeObject.getObjectType()->getStaticConstMemberInfo(lowercaseName);
-		if (staticConstMemberInfo != nullptr)
-		{
-			scopeId = i;
-			return staticConstMemberInfo;
-		}
-	}
-	for (int i = (int)staticScopes.size() - 1; i >= 0; i--)
-	{
-		StaticConstMemberInfo* staticConstMemberInfo = staticScopes[i]->scopeObject.getObjectType()->getStaticConstMemberInfo(lowercaseName);
-		if (staticConstMemberInfo != nullptr)
-		{
-			scopeId = InvalidScopeID - i - 1;
-			return staticConstMemberInfo;
-		}
-	}
-	return nullptr;
+	return findStaticVariable(Reflection::SymbolTable::find(name), scopeId);
 }
 
 
-MemberFunctionInfo* CatRuntimeContext::findFirstMemberFunction(const std::string& lowercaseName, CatScopeID& scopeId)
+Reflection::StaticMemberInfo* jitcat::CatRuntimeContext::findStaticVariable(Reflection::SymbolId symbol, CatScopeID& scopeId)
 {
-	for (int i = (int)scopes.size() - 1; i >= 0; i--)
-	{
-		MemberFunctionInfo* memberFunctionInfo = scopes[i]->scopeObject.getObjectType()->getFirstMemberFunctionInfo(lowercaseName);
-		if (memberFunctionInfo != nullptr)
-		{
-			scopeId = i;
-			return memberFunctionInfo;
-		}
-	}
-	for (int i = (int)staticScopes.size() - 1; i >= 0; i--)
-	{
-		MemberFunctionInfo* memberFunctionInfo = staticScopes[i]->scopeObject.getObjectType()->getFirstMemberFunctionInfo(lowercaseName);
-		if (memberFunctionInfo != nullptr)
-		{
-			scopeId = InvalidScopeID - i - 1;
-			return memberFunctionInfo;
-		}
-	}
-	return nullptr;
+	return findInScopes<StaticMemberInfo>(LookupKind::StaticVariable, symbol, nullptr, scopeId, 
+		[symbol](TypeInfo* scopeType) {return scopeType->getStaticMemberInfo(symbol);});
+}
+
+
+Reflection::StaticConstMemberInfo* CatRuntimeContext::findStaticConstant(const std::string& name, CatScopeID& scopeId)
+{
+	return findStaticConstant(Reflection::SymbolTable::find(name), scopeId);
+}
+
+
+Reflection::StaticConstMemberInfo* CatRuntimeContext::findStaticConstant(Reflection::SymbolId symbol, CatScopeID& scopeId)
+{
+	return findInScopes<StaticConstMemberInfo>(LookupKind::StaticConstant, symbol, nullptr, scopeId, 
+		[symbol](TypeInfo* scopeType) {return scopeType->getStaticConstMemberInfo(symbol);});
+}
+
+
+MemberFunctionInfo* CatRuntimeContext::findFirstMemberFunction(const std::string& name, CatScopeID& scopeId)
+{
+	return findFirstMemberFunction(Reflection::SymbolTable::find(name), scopeId);
+}
+
+
+MemberFunctionInfo* CatRuntimeContext::findFirstMemberFunction(Reflection::SymbolId symbol, CatScopeID& scopeId)
+{
+	return findInScopes<MemberFunctionInfo>(LookupKind::FirstMemberFunction, symbol, nullptr, scopeId, 
+		[symbol](TypeInfo* scopeType) {return scopeType->getFirstMemberFunctionInfo(symbol);});
 }
 
 
 Reflection::MemberFunctionInfo* CatRuntimeContext::findMemberFunction(const FunctionSignature* functionSignature, CatScopeID& scopeId)
 {
-	for (int i = (int)scopes.size() - 1; i >= 0; i--)
-	{
-		MemberFunctionInfo* memberFunctionInfo = scopes[i]->scopeObject.getObjectType()->getMemberFunctionInfo(functionSignature);
-		if (memberFunctionInfo != nullptr)
-		{
-			scopeId = i;
-			return memberFunctionInfo;
-		}
-	}
-	for (int i = (int)staticScopes.size() - 1; i >= 0; i--)
-	{
-		MemberFunctionInfo* memberFunctionInfo = staticScopes[i]->scopeObject.getObjectType()->getMemberFunctionInfo(functionSignature);
-		if (memberFunctionInfo != nullptr)
-		{
-			scopeId = InvalidScopeID - i - 1;
-			return memberFunctionInfo;
-		}
-	}
-	return nullptr;
+	return findInScopes<MemberFunctionInfo>(LookupKind::MemberFunction, SymbolTable::find(functionSignature->getLowerCaseFunctionName()), functionSignature, scopeId, 
+		[functionSignature](TypeInfo* scopeType) {return scopeType->getMemberFunctionInfo(functionSignature);});
 }
 
 
 Reflection::StaticFunctionInfo* CatRuntimeContext::findStaticFunction(const Reflection::FunctionSignature* functionSignature, CatScopeID& scopeId)
 {
-	for (int i = (int)scopes.size() - 1; i >= 0; i--)
-	{
-		StaticFunctionInfo* memberFunctionInfo = scopes[i]->scopeObject.getObjectType()->getStaticMemberFunctionInfo(functionSignature);
-		if (memberFunctionInfo != nullptr)
-		{
-			scopeId = i;
-			return memberFunctionInfo;
-		}
-	}
-	for (int i = (int)staticScopes.size() - 1; i >= 0; i--)
-	{
-		StaticFunctionInfo* memberFunctionInfo = staticScopes[i]->scopeObject.getObjectType()->getStaticMemberFunctionInfo(functionSignature);
-		if (memberFunctionInfo != nullptr)
-		{
-			scopeId = InvalidScopeID - i - 1;
-			return memberFunctionInfo;
-		}
-	}
-	return nullptr;
+	return findInScopes<StaticFunctionInfo>(LookupKind::StaticFunction, SymbolTable::find(functionSignature->getLowerCaseFunctionName()), functionSignature, scopeId, 
+		[functionSignature](TypeInfo* scopeType) {return scopeType->getStaticMemberFunctionInfo(functionSignature);});
 }
 
 
-Reflection::TypeInfo* CatRuntimeContext::findType(const std::string& lowercaseName, CatScopeID& scopeId)
+Reflection::TypeInfo* CatRuntimeContext::findType(const std::string& name, CatScopeID& scopeId)
 {
-	for (int i = (int)scopes.size() - 1; i >= 0; i--)
-	{
-		TypeInfo* scopeInfo = scopes[i]->scopeObject.getObjectType()->getTypeInfo(lowercaseName);
-		if (scopeInfo != nullptr)
-		{
-			scopeId = i;
-			return scopeInfo;
-		}
-	}
-	for (int i = (int)staticScopes.size() - 1; i >= 0; i--)
-	{
-		TypeInfo* scopeInfo = staticScopes[i]->scopeObject.getObjectType()->getTypeInfo(lowercaseName);
-		if (scopeInfo != nullptr)
-		{
-			scopeId = InvalidScopeID - i - 1;
-			return scopeInfo;
-		}
-	}
-	return nullptr;
+	return findType(Reflection::SymbolTable::find(name), scopeId);
+}
+
+
+Reflection::TypeInfo* CatRuntimeContext::findType(Reflection::SymbolId symbol, CatScopeID& scopeId)
+{
+	return findInScopes<TypeInfo>(LookupKind::Type, symbol, nullptr, scopeId, 
+		[symbol](TypeInfo* scopeType) {return scopeType->getTypeInfo(symbol);});
 }
 
 
@@ -507,14 +457,22 @@ void CatRuntimeContext::setReturning(bool isReturning)
 
 std::any& CatRuntimeContext::addTemporary(const std::any& value)
 {
-	temporaries.emplace_back(std::make_unique<std::any>(value));
-	return *temporaries.back().get();
+	return temporaries.create<std::any>(value);
+}
+
+
+std::any& CatRuntimeContext::addTemporary(std::any&& value)
+{
+	return temporaries.create<std::any>(std::move(value));
 }
 
 
 void CatRuntimeContext::clearTemporaries()
 {
-	temporaries.clear();
+	if (!temporaries.isEmpty())
+	{
+		temporaries.reset();
+	}
 }
 
 
@@ -535,6 +493,39 @@ std::size_t CatRuntimeContext::getContextHash() const
 }
 
 
+std::vector<const void*> CatRuntimeContext::getScopeLayout() const
+{
+	std::vector<const void*> layout;
+	layout.reserve(scopes.size() + staticScopes.size() * 2);
+	for (const auto& iter : scopes)
+	{
+		layout.push_back(iter->scopeObject.getObjectType());
+	}
+	for (const auto& iter : staticScopes)
+	{
+		layout.push_back(iter->scopeObject.getObjectType());
+		layout.push_back(iter->scopeObject.get());
+	}
+	return layout;
+}
+
+
+std::vector<unsigned long long> CatRuntimeContext::getScopeVersions() const
+{
+	std::vector<unsigned long long> versions;
+	versions.reserve(scopes.size() + staticScopes.size());
+	for (const auto& iter : scopes)
+	{
+		versions.push_back(iter->scopeObject.getObjectType()->getVersion());
+	}
+	for (const auto& iter : staticScopes)
+	{
+		versions.push_back(iter->scopeObject.getObjectType()->getVersion());
+	}
+	return versions;
+}
+
+
 void CatRuntimeContext::setPrecompilationContext(std::shared_ptr<PrecompilationContext> precompilationContext_)
 {
 	precompilationContext = precompilationContext_;
@@ -547,6 +538,24 @@ std::shared_ptr<PrecompilationContext> CatRuntimeContext::getPrecompilationConte
 }
 
 
+const std::shared_ptr<ContextMemoryCounters>& CatRuntimeContext::getMemoryCounters() const
+{
+	return memoryCounters;
+}
+
+
+const LookupCacheStatistics& CatRuntimeContext::getLookupCacheStatistics() const
+{
+	return lookupCacheStatistics;
+}
+
+
+void CatRuntimeContext::resetLookupCacheStatistics()
+{
+	lookupCacheStatistics = LookupCacheStatistics();
+}
+
+
 CatRuntimeContext& CatRuntimeContext::getDefaultContext()
 {
 	static CatRuntimeContext defaultContext("default", nullptr);
@@ -558,6 +567,7 @@ CatScopeID CatRuntimeContext::createDynamicScope(unsigned char* scopeObject, Typ
 {
 	Scope* scope = new Scope(type, scopeObject, false, Tools::empty);
 	scopes.emplace_back(scope);
+	invalidateLookupCache();
 	return static_cast<CatScopeID>((int)scopes.size() - 1) - currentStackFrameOffset;
 }
 
@@ -566,6 +576,7 @@ CatScopeID CatRuntimeContext::createStaticScope(unsigned char* scopeObject, Type
 {
 	Scope* scope = new Scope(type, scopeObject, true, staticScopeUniqueName);
 	staticScopes.emplace_back(scope);
+	invalidateLookupCache();
 	if (JitCat::get()->getHasPrecompiledExpression())
 	{
 		JitCat::get()->setPrecompiledGlobalVariable(staticScopeUniqueName, scopeObject);
@@ -603,3 +614,97 @@ const std::string_view jitcat::CatRuntimeContext::getGlobalNameReference(const s
 }
 
 
+template<typename ResultT, typename LookupT>
+ResultT* CatRuntimeContext::findInScopes(LookupKind kind, SymbolId symbol, const FunctionSignature* functionSignature, CatScopeID& scopeId, const LookupT& lookup)
+{
+	//Every member, function and type name is interned when it is added to a type, so no scope contains a name without a symbol.
+	if (symbol == SymbolTable::noSymbol || (scopes.empty() && staticScopes.empty()))
+	{
+		return nullptr;
+	}
+	if (unsigned long long lookupVersion = TypeInfo::getLookupVersion(); lookupVersion != lookupCacheVersion)
+	{
+		invalidateLookupCache();
+		lookupCacheVersion = lookupVersion;
+	}
+	std::vector<LookupCacheEntry>& entries = lookupCache[((unsigned long long)kind << 32) | symbol];
+	for (const LookupCacheEntry& entry : entries)
+	{
+		if (functionSignature != nullptr)
+		{
+			if ((int)entry.parameterTypes.size() != functionSignature->getNumParameters())
+			{
+				continue;
+			}
+			bool parametersMatch = true;
+			for (int i = 0; i < functionSignature->getNumParameters() && parametersMatch; i++)
+			{
+				parametersMatch = entry.parameterTypes[i].compare(functionSignature->getParameterType(i), false, false);
+			}
+			if (!parametersMatch)
+			{
+				continue;
+			}
+		}
+		lookupCacheStatistics.numHits++;
+		if (entry.result != nullptr)
+		{
+			scopeId = entry.scopeId;
+		}
+		return static_cast<ResultT*>(entry.result);
+	}
+	lookupCacheStatistics.numMisses++;
+
+	LookupCacheEntry& entry = entries.emplace_back();
+	entry.result = nullptr;
+	entry.scopeId = InvalidScopeID;
+	if (functionSignature != nullptr)
+	{
+		for (int i = 0; i < functionSignature->getNumParameters(); i++)
+		{
+			entry.parameterTypes.push_back(functionSignature->getParameterType(i));
+		}
+	}
+	for (int i = (int)scopes.size() - 1; i >= 0 && entry.result == nullptr; i--)
+	{
+		if (ResultT* result = lookup(scopes[i]->scopeObject.getObjectType()); result != nullptr)
+		{
+			entry.result = result;
+			entry.scopeId = i;
+		}
+	}
+	for (int i = (int)staticScopes.size() - 1; i >= 0 && entry.result == nullptr; i--)
+	{
+		if (ResultT* result = lookup(staticScopes[i]->scopeObject.getObjectType()); result != nullptr)
+		{
+			entry.result = result;
+			entry.scopeId = InvalidScopeID - i - 1;
+		}
+	}
+	if (entry.result != nullptr)
+	{
+		scopeId = entry.scopeId;
+	}
+	return static_cast<ResultT*>(entry.result);
+}
+
+
+void CatRuntimeContext::invalidateLookupCache()
+{
+	if (!lookupCache.empty())
+	{
+		lookupCache.clear();
+		lookupCacheStatistics.numInvalidations++;
+	}
+}
+
+
+double LookupCacheStatistics::getHitRate() const
+{
+	std::size_t numLookups = numHits + numMisses;
+	if (numLookups == 0)
+	{
+		return 0.0;
+	}
+	return (double)numHits / (double)numLookups;
+}
@@ -53,6 +53,12 @@ std::any CatScopeRoot::execute(CatRuntimeContext* runtimeContext)
 }
 
 
+CatValue CatScopeRoot::executeValue(CatRuntimeContext* runtimeContext)
+{
+	return CatValue::fromPointer(reinterpret_cast<uintptr_t>(runtimeContext->getScopeObject(scopeId)));
+}
+
+
 bool CatScopeRoot::typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErrorManager* errorManager, void* errorContext)
 {
 	type = CatGenericType::unknownType;
@@ -146,6 +146,7 @@ bool CatSourceFile::compile(CatLib& catLib)
 	{
 		LLVM::LLVMCompileTimeContext llvmContext(compiletimeContext, LLVM::LLVMJit::get().getJitTargetConfig(), false);
 		llvmContext.options.enableDereferenceNullChecks = true;
+		llvmContext.options.optimizationLevel = catLib.getOptimizationLevel();
 		llvmContext.currentLib = &catLib;
 		compiletimeContext->getCodeGenerator()->generate(this, &llvmContext);
 		if (compiletimeContext->getPrecompilationContext() != nullptr)
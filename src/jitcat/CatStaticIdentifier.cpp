@@ -17,6 +17,7 @@
 #include "jitcat/ExpressionErrorManager.h"
 #include "jitcat/ReflectedTypeInfo.h"
 #include "jitcat/StaticConstMemberInfo.h"
+#include "jitcat/SymbolTable.h"
 #include "jitcat/TypeInfo.h"
 
 #include <cassert>
@@ -125,7 +126,7 @@ bool CatStaticIdentifier::typeCheck(CatRuntimeContext* compiletimeContext, Expre
 	{
 		return disambiguatedIdentifier->typeCheck(compiletimeContext, errorManager, errorContext);
 	}
-	std::string lowerName = Tools::toLowerCase(identifier);
+	SymbolId symbol = SymbolTable::find(identifier);
 	assert(baseScope != nullptr);
 	if (!baseScope->typeCheck(compiletimeContext, errorManager, errorContext))
 	{
@@ -133,11 +134,11 @@ bool CatStaticIdentifier::typeCheck(CatRuntimeContext* compiletimeContext, Expre
 	}
 	TypeInfo* typeInfo = baseScope->getScopeType();
 
-	if (typeInfo->getStaticMemberInfo(lowerName) != nullptr)
+	if (typeInfo->getStaticMemberInfo(symbol) != nullptr)
 	{
 		disambiguatedIdentifier = std::make_unique<CatStaticMemberAccess>(baseScope.release(), identifierLexeme, lexeme);
 	}
-	else if (StaticConstMemberInfo* constMemberInfo = typeInfo->getStaticConstMemberInfo(lowerName); constMemberInfo != nullptr)
+	else if (StaticConstMemberInfo* constMemberInfo = typeInfo->getStaticConstMemberInfo(symbol); constMemberInfo != nullptr)
 	{
 		disambiguatedIdentifier = std::make_unique<CatLiteral>(constMemberInfo->getValue(), constMemberInfo->getType(), lexeme);
 	}
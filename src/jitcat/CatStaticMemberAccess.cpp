@@ -13,6 +13,7 @@
 #include "jitcat/CustomTypeInfo.h"
 #include "jitcat/ExpressionErrorManager.h"
 #include "jitcat/ReflectedTypeInfo.h"
+#include "jitcat/SymbolTable.h"
 #include "jitcat/TypeInfo.h"
 
 #include <cassert>
@@ -115,7 +116,7 @@ std::any CatStaticMemberAccess::executeAssignable(CatRuntimeContext* runtimeCont
 
 bool CatStaticMemberAccess::typeCheck(CatRuntimeContext* compiletimeContext, ExpressionErrorManager* errorManager, void* errorContext)
 {
-	std::string lowerName = Tools::toLowerCase(identifier);
+	SymbolId symbol = SymbolTable::find(identifier);
 	staticMemberInfo = nullptr;
 	
 	type = CatGenericType::unknownType;
@@ -127,7 +128,7 @@ bool CatStaticMemberAccess::typeCheck(CatRuntimeContext* compiletimeContext, Exp
 	}
 	TypeInfo* typeInfo = baseScope->getScopeType();
 
-	staticMemberInfo = typeInfo->getStaticMemberInfo(lowerName);
+	staticMemberInfo = typeInfo->getStaticMemberInfo(symbol);
 
 	if (staticMemberInfo != nullptr)
 	{
@@ -9,6 +9,7 @@
 #include "jitcat/CatLog.h"
 #include "jitcat/CatRuntimeContext.h"
 #include "jitcat/ExpressionErrorManager.h"
+#include "jitcat/SymbolTable.h"
 #include "jitcat/Tools.h"
 
 using namespace jitcat;
@@ -84,11 +85,11 @@ bool CatStaticScope::typeCheck(CatRuntimeContext* compiletimeContext, Expression
 		else
 		{
 			CatScopeID scopeId = InvalidScopeID;
-			std::string lowerScopeName = Tools::toLowerCase(scopeName);
-			scopeType = compiletimeContext->findType(lowerScopeName, scopeId);
+			SymbolId scopeSymbol = SymbolTable::find(scopeName);
+			scopeType = compiletimeContext->findType(scopeSymbol, scopeId);
 			if (scopeType == nullptr)
 			{
-				scopeType = TypeRegistry::get()->getTypeInfo(lowerScopeName);
+				scopeType = TypeRegistry::get()->getTypeInfo(scopeSymbol);
 			}
 		}
 		if (scopeType == nullptr)
@@ -8,21 +8,112 @@
 #include "jitcat/CatTokenizer.h"
 #include "jitcat/CommentToken.h"
 #include "jitcat/ConstantToken.h"
+#include "jitcat/Document.h"
 #include "jitcat/ErrorToken.h"
 #include "jitcat/IdentifierToken.h"
 #include "jitcat/OneCharToken.h"
+#include "jitcat/Tools.h"
 #include "jitcat/TwoCharToken.h"
 #include "jitcat/WhitespaceToken.h"
 
+#include <cstring>
+
 using namespace jitcat::Tokenizer;
 
 
+namespace
+{
+	//Determines which tokens can start with a character.
+	//Characters are tried in the same order as the token factories: whitespace, comment, constant, identifier, two char, one char and error.
+	enum class CharacterClass: unsigned char
+	{
+		Other,			//Starts a two char, one char or error token.
+		Whitespace,
+		Slash,			//Starts a comment or an operator.
+		ConstantStart,	//Digits, '.', '"' and '\'' start a constant or an operator.
+		BoolStart,		//'t', 'f', 'T' and 'F' start a bool constant or an identifier.
+		IdentifierStart
+	};
+
+
+	struct CharacterTables
+	{
+		constexpr CharacterTables():
+			characterClasses{},
+			isIdentifierCharacter{}
+		{
+			for (int i = 0; i < 256; i++)
+			{
+				const char character = (char)i;
+				const bool isLetter = (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z');
+				const bool isDigit = character >= '0' && character <= '9';
+				isIdentifierCharacter[i] = isLetter || isDigit || character == '_';
+				if (character == ' ' || character == '\t' || character == '\n' || character == '\r')
+				{
+					characterClasses[i] = CharacterClass::Whitespace;
+				}
+				else if (character == '/')
+				{
+					characterClasses[i] = CharacterClass::Slash;
+				}
+				else if (isDigit || character == '.' || character == '"' || character == '\'')
+				{
+					characterClasses[i] = CharacterClass::ConstantStart;
+				}
+				else if (character == 't' || character == 'f' || character == 'T' || character == 'F')
+				{
+					characterClasses[i] = CharacterClass::BoolStart;
+				}
+				else if (isLetter || character == '_')
+				{
+					characterClasses[i] = CharacterClass::IdentifierStart;
+				}
+				else
+				{
+					characterClasses[i] = CharacterClass::Other;
+				}
+			}
+		}
+
+		CharacterClass characterClasses[256];
+		bool isIdentifierCharacter[256];
+	};
+
+	constexpr CharacterTables characterTables;
+
+
+	//Returns the length of the block comment that starts at text, including the "/*" and "*/".
+	//An unterminated block comment runs until the end of the document.
+	std::size_t getBlockCommentLength(const char* text, std::size_t textLength)
+	{
+		//The closing "*/" cannot share its '*' with the opening "/*".
+		std::size_t searchOffset = 3;
+		while (searchOffset < textLength)
+		{
+			const char* slash = static_cast<const char*>(std::memchr(text + searchOffset, '/', textLength - searchOffset));
+			if (slash == nullptr)
+			{
+				break;
+			}
+			if (slash[-1] == '*')
+			{
+				return (std::size_t)(slash - text) + 1;
+			}
+			searchOffset = (std::size_t)(slash - text) + 1;
+		}
+		return textLength;
+	}
+}
+
+
 CatTokenizer::CatTokenizer()
 {
+	std::unique_ptr<ConstantToken> constantTokenFactory = std::make_unique<ConstantToken>(constant);
+	constantToken = constantTokenFactory.get();
 	//The order of these matter because they determine which token gets matched first if there are multiple tokens that can create a match.
 	registerTokenFactory(std::make_unique<WhitespaceToken>(whiteSpace));
 	registerTokenFactory(std::make_unique<CommentToken>(comment));
-	registerTokenFactory(std::make_unique<ConstantToken>(constant));
+	registerTokenFactory(std::move(constantTokenFactory));
 	registerTokenFactory(std::make_unique<IdentifierToken>(identifier));
 	registerTokenFactory(std::make_unique<TwoCharToken>(twoChar));
 	registerTokenFactory(std::make_unique<OneCharToken>(oneChar));
@@ -30,6 +121,120 @@ CatTokenizer::CatTokenizer()
 }
 
 
+bool CatTokenizer::tokenize(Document& document)
+{
+	document.clearLineLookup();
+	const char* documentData = document.getDocumentData().c_str();
+	const std::size_t documentSize = document.getDocumentSize();
+	std::size_t currentPosition = 0;
+	while (currentPosition < documentSize)
+	{
+		const char* currentCharacter = documentData + currentPosition;
+		const std::size_t remainingLength = documentSize - currentPosition;
+		std::size_t length = 0;
+		const CharacterClass characterClass = characterTables.characterClasses[(unsigned char)currentCharacter[0]];
+		switch (characterClass)
+		{
+			case CharacterClass::Whitespace:
+			{
+				bool seenCarriageReturn = false;
+				for (; length < remainingLength && characterTables.characterClasses[(unsigned char)currentCharacter[length]] == CharacterClass::Whitespace; length++)
+				{
+					if (currentCharacter[length] == '\r' && !seenCarriageReturn)
+					{
+						seenCarriageReturn = true;
+					}
+					else if (currentCharacter[length] == '\r' || currentCharacter[length] == '\n')
+					{
+						seenCarriageReturn = false;
+						document.addNewLine((int)(currentPosition + length));
+					}
+				}
+				document.addToken(currentPosition, length, whiteSpace, 0);
+				currentPosition += length;
+				continue;
+			}
+			case CharacterClass::Slash:
+			{
+				if (remainingLength >= 2 && currentCharacter[1] == '/')
+				{
+					const void* lineEnd = std::memchr(currentCharacter + 2, '\n', remainingLength - 2);
+					length = lineEnd != nullptr ? (std::size_t)(static_cast<const char*>(lineEnd) - currentCharacter) : remainingLength;
+					document.addToken(currentPosition, length, comment, Tools::enumToUSHort(CommentType::SingleLine));
+					currentPosition += length;
+					continue;
+				}
+				else if (remainingLength >= 2 && currentCharacter[1] == '*')
+				{
+					length = getBlockCommentLength(currentCharacter, remainingLength);
+					document.addToken(currentPosition, length, comment, Tools::enumToUSHort(CommentType::Block));
+					currentPosition += length;
+					continue;
+				}
+				break;
+			}
+			case CharacterClass::ConstantStart:
+			case CharacterClass::BoolStart:
+			{
+				ConstantType constantType = constantToken->parseConstant(currentCharacter, remainingLength, length);
+				if (constantType != ConstantType::NoType)
+				{
+					document.addToken(currentPosition, length, constant, Tools::enumToUSHort(constantType));
+					currentPosition += length;
+					continue;
+				}
+				else if (characterClass == CharacterClass::ConstantStart)
+				{
+					break;
+				}
+			}
+			[[fallthrough]];
+			case CharacterClass::IdentifierStart:
+			{
+				length = 1;
+				while (length < remainingLength && characterTables.isIdentifierCharacter[(unsigned char)currentCharacter[length]])
+				{
+					length++;
+				}
+				document.addToken(currentPosition, length, identifier, Tools::enumToUSHort(IdentifierToken::getIdentifierType(currentCharacter, length)));
+				currentPosition += length;
+				continue;
+			}
+			case CharacterClass::Other:
+				break;
+		}
+		if (remainingLength > 1)
+		{
+			TwoChar twoCharType = TwoCharToken::getTwoCharType(currentCharacter[0], currentCharacter[1]);
+			if (twoCharType != TwoChar::Unknown)
+			{
+				document.addToken(currentPosition, 2, twoChar, Tools::enumToUSHort(twoCharType));
+				currentPosition += 2;
+				continue;
+			}
+		}
+		OneChar oneCharType = OneCharToken::getOneCharType(currentCharacter[0]);
+		if (oneCharType != OneChar::Unknown)
+		{
+			document.addToken(currentPosition, 1, oneChar, Tools::enumToUSHort(oneCharType));
+			currentPosition++;
+			continue;
+		}
+		//Anything else is an error token that runs until the next space, tab or newline.
+		length = 1;
+		while (length < remainingLength && currentCharacter[length] != ' ' && currentCharacter[length] != '\t' && currentCharacter[length] != '\n')
+		{
+			length++;
+		}
+		document.addToken(currentPosition, length, error, 0);
+		currentPosition += length;
+	}
+	document.addToken(ParseToken::getEofToken(document));
+	document.addNewLine((int)currentPosition);
+	return true;
+}
+
+
 const unsigned short CatTokenizer::whiteSpace = 0;
 const unsigned short CatTokenizer::comment = 1;
 const unsigned short CatTokenizer::constant = 2;
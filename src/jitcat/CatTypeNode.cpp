@@ -243,7 +243,7 @@ bool CatTypeNode::typeCheck(CatRuntimeContext* compileTimeContext, ExpressionErr
 			TypeInfo* typeInfo = nullptr;
 			if (parentScope == nullptr)
 			{
-				typeInfo = compileTimeContext->findType(Tools::toLowerCase(getTypeName()), typeScope);
+				typeInfo = compileTimeContext->findType(getTypeName(), typeScope);
 				if (typeInfo == nullptr)
 				{
 					typeInfo = TypeRegistry::get()->getTypeInfo(getTypeName());
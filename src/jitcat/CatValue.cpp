@@ -0,0 +1,102 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/CatValue.h"
+#include "jitcat/CatGenericType.h"
+#include "jitcat/TypeCaster.h"
+
+using namespace jitcat;
+
+
+CatValue::Tag CatValue::getTag(const CatGenericType& type)
+{
+	switch (type.specificType)
+	{
+		case CatGenericType::SpecificType::Basic:
+		{
+			switch (type.basicType)
+			{
+				case CatGenericType::BasicType::Bool:	return Tag::Bool;
+				case CatGenericType::BasicType::Char:	return Tag::Char;
+				case CatGenericType::BasicType::UChar:	return Tag::UChar;
+				case CatGenericType::BasicType::Int:	return Tag::Int;
+				case CatGenericType::BasicType::UInt:	return Tag::UInt;
+				case CatGenericType::BasicType::Int64:	return Tag::Int64;
+				case CatGenericType::BasicType::UInt64:	return Tag::UInt64;
+				case CatGenericType::BasicType::Float:	return Tag::Float;
+				case CatGenericType::BasicType::Double:	return Tag::Double;
+				default:								return Tag::None;
+			}
+		}
+		case CatGenericType::SpecificType::Pointer:
+		{
+			if (type.pointeeType->specificType == CatGenericType::SpecificType::ReflectableObject)
+			{
+				return Tag::Pointer;
+			}
+			return Tag::None;
+		}
+		default:	return Tag::None;
+	}
+}
+
+
+bool CatValue::canHold(const CatGenericType& type)
+{
+	return getTag(type) != Tag::None;
+}
+
+
+CatValue CatValue::fromPointer(uintptr_t pointer)
+{
+	CatValue value;
+	value.tag = Tag::Pointer;
+	value.storage.pointerValue = pointer;
+	return value;
+}
+
+
+CatValue CatValue::fromAny(const std::any& value, const CatGenericType& valueType)
+{
+	switch (getTag(valueType))
+	{
+		case Tag::Bool:		return CatValue(std::any_cast<bool>(value));
+		case Tag::Char:		return CatValue(std::any_cast<char>(value));
+		case Tag::UChar:	return CatValue(std::any_cast<unsigned char>(value));
+		case Tag::Int:		return CatValue(std::any_cast<int>(value));
+		case Tag::UInt:		return CatValue(std::any_cast<unsigned int>(value));
+		case Tag::Int64:	return CatValue(std::any_cast<int64_t>(value));
+		case Tag::UInt64:	return CatValue(std::any_cast<uint64_t>(value));
+		case Tag::Float:	return CatValue(std::any_cast<float>(value));
+		case Tag::Double:	return CatValue(std::any_cast<double>(value));
+		case Tag::Pointer:	return valueType.getPointeeType()->getTypeCaster()->castToValue(value);
+		default:
+		{
+			assert(false);
+			return CatValue();
+		}
+	}
+}
+
+
+std::any CatValue::toAny(const CatGenericType& valueType) const
+{
+	switch (tag)
+	{
+		case Tag::Bool:		return storage.boolValue;
+		case Tag::Char:		return storage.charValue;
+		case Tag::UChar:	return storage.uCharValue;
+		case Tag::Int:		return storage.intValue;
+		case Tag::UInt:		return storage.uIntValue;
+		case Tag::Int64:	return storage.int64Value;
+		case Tag::UInt64:	return storage.uInt64Value;
+		case Tag::Float:	return storage.floatValue;
+		case Tag::Double:	return storage.doubleValue;
+		case Tag::Pointer:	return valueType.getPointeeType()->getTypeCaster()->castFromValue(*this);
+		default:			return std::any();
+	}
+}
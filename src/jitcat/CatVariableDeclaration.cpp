@@ -99,7 +99,7 @@ bool CatVariableDeclaration::defineCheck(CatRuntimeContext* compiletimeContext,
 		return false;
 	}
 	CatScopeID id = InvalidScopeID;
-	if (memberInfo == nullptr && compiletimeContext->findVariable(Tools::toLowerCase(name), id) != nullptr)
+	if (memberInfo == nullptr && compiletimeContext->findVariable(name, id) != nullptr)
 	{
 		errorManager->compiledWithError(Tools::append("A variable with name \"", name, "\" already exists."), errorContext, compiletimeContext->getContextName(), getLexeme());
 		return false;
@@ -122,7 +122,7 @@ bool CatVariableDeclaration::typeCheck(CatRuntimeContext* compiletimeContext, Ex
 	CatScopeID id = InvalidScopeID;
 	if (memberInfo == nullptr)
 	{
-		if (compiletimeContext->findVariable(Tools::toLowerCase(name), id) != nullptr)
+		if (compiletimeContext->findVariable(name, id) != nullptr)
 		{
 			errorManager->compiledWithError(Tools::append("A variable with name \"", name, "\" already exists."), errorContext, compiletimeContext->getContextName(), getLexeme());
 			return false;
@@ -107,7 +107,7 @@ bool CatVariableDefinition::defineCheck(CatRuntimeContext* compileTimeContext, s
 	}
 
 	CatScopeID id = InvalidScopeID;
-	if (memberInfo == nullptr && compileTimeContext->findVariable(Tools::toLowerCase(name), id) != nullptr)
+	if (memberInfo == nullptr && compileTimeContext->findVariable(name, id) != nullptr)
 	{
 		errorManager->compiledWithError(Tools::append("A variable with name \"", name, "\" already exists."), this, compileTimeContext->getContextName(), getLexeme());
 		return false;
@@ -137,7 +137,7 @@ bool CatVariableDefinition::typeCheck(CatRuntimeContext* compileTimeContext)
 		return false;
 	}
 	CatScopeID id = InvalidScopeID;
-	if (memberInfo == nullptr && compileTimeContext->findVariable(Tools::toLowerCase(name), id) != nullptr)
+	if (memberInfo == nullptr && compileTimeContext->findVariable(name, id) != nullptr)
 	{
 		errorManager->compiledWithError(Tools::append("A variable with name \"", name, "\" already exists."), this, compileTimeContext->getContextName(), getLexeme());
 		return false;
@@ -0,0 +1,93 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/ColumnBinding.h"
+#include "jitcat/TypeInfo.h"
+#include "jitcat/TypeMemberInfo.h"
+
+#include <cassert>
+
+using namespace jitcat;
+using namespace jitcat::Reflection;
+
+
+ColumnBinding::ColumnBinding(TypeInfo* scopeType, std::size_t numRows):
+	scopeType(scopeType),
+	numRows(numRows)
+{
+	assert(scopeType != nullptr);
+}
+
+
+bool ColumnBinding::bindColumn(const std::string& memberName, const void* data, std::size_t stride)
+{
+	return bindColumn(scopeType->getMemberInfo(memberName), data, stride);
+}
+
+
+bool ColumnBinding::bindColumn(const TypeMemberInfo* member, const void* data, std::size_t stride)
+{
+	if (member == nullptr)
+	{
+		return false;
+	}
+	const CatGenericType& memberType = member->getType();
+	if (!(memberType.isBoolType() || memberType.isIntType() || memberType.isFloatType() || memberType.isDoubleType())
+		|| stride % memberType.getTypeSize() != 0)
+	{
+		return false;
+	}
+	const unsigned char* columnData = static_cast<const unsigned char*>(data);
+	for (auto& iter : columns)
+	{
+		if (iter.member == member)
+		{
+			iter.data = columnData;
+			iter.stride = stride;
+			return true;
+		}
+	}
+	columns.push_back({member, columnData, stride});
+	return true;
+}
+
+
+const ColumnBinding::Column* ColumnBinding::getColumn(const TypeMemberInfo* member) const
+{
+	for (auto& iter : columns)
+	{
+		if (iter.member == member)
+		{
+			return &iter;
+		}
+	}
+	return nullptr;
+}
+
+
+const std::vector<ColumnBinding::Column>& ColumnBinding::getColumns() const
+{
+	return columns;
+}
+
+
+TypeInfo* ColumnBinding::getScopeType() const
+{
+	return scopeType;
+}
+
+
+std::size_t ColumnBinding::getNumRows() const
+{
+	return numRows;
+}
+
+
+void ColumnBinding::setNumRows(std::size_t numRows_)
+{
+	numRows = numRows_;
+}
@@ -0,0 +1,175 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/CompileSession.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/ExpressionBase.h"
+#ifdef ENABLE_LLVM
+	#include "jitcat/LLVMCodeGenerator.h"
+	#include "jitcat/LLVMCompileTimeContext.h"
+	#include "jitcat/LLVMJit.h"
+#endif
+
+#include <algorithm>
+#include <cassert>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+
+
+thread_local CompileSession* CompileSession::currentSession = nullptr;
+
+
+CompileSession::CompileSession():
+	isOpen(true),
+	previousSession(currentSession)
+{
+	currentSession = this;
+}
+
+
+CompileSession::~CompileSession()
+{
+	finalize();
+}
+
+
+void CompileSession::finalize()
+{
+	if (!isOpen)
+	{
+		return;
+	}
+	isOpen = false;
+	//Sessions are usually finalized in the reverse order of their creation, but an outer session may be finalized first.
+	//The session is unlinked from wherever it is in the chain of open sessions, so that no session refers to it after it is destroyed.
+	if (currentSession == this)
+	{
+		currentSession = previousSession;
+	}
+	else
+	{
+		CompileSession* nextSession = currentSession;
+		while (nextSession != nullptr && nextSession->previousSession != this)
+		{
+			nextSession = nextSession->previousSession;
+		}
+		assert(nextSession != nullptr);
+		if (nextSession != nullptr)
+		{
+			nextSession->previousSession = previousSession;
+		}
+	}
+	previousSession = nullptr;
+
+	std::vector<Entry> sessionEntries = std::move(entries);
+	entries.clear();
+	releaseContexts(sessionEntries);
+	for (Entry& entry : sessionEntries)
+	{
+		entry.expression->compileSession = nullptr;
+	}
+	std::vector<uintptr_t> functionAddresses(sessionEntries.size(), 0);
+#ifdef ENABLE_LLVM
+	if (!sessionEntries.empty())
+	{
+		llvm::orc::ThreadSafeContext::Lock contextLock = LLVMJit::get().getThreadSafeContext().getLock();
+		//Each context has its own code generator, so one module is generated per context and optimization level.
+		std::vector<bool> generated(sessionEntries.size(), false);
+		for (std::size_t i = 0; i < sessionEntries.size(); i++)
+		{
+			if (generated[i])
+			{
+				continue;
+			}
+			CatRuntimeContext* context = sessionEntries[i].context;
+			LLVMOptimizationLevel optimizationLevel = sessionEntries[i].expression->getOptimizationLevel();
+			LLVMCompileTimeContext llvmCompileContext(context, LLVMJit::get().getJitTargetConfig(), false);
+			llvmCompileContext.options.enableDereferenceNullChecks = true;
+			llvmCompileContext.options.optimizationLevel = optimizationLevel;
+			std::shared_ptr<LLVMCodeGenerator> codeGenerator = context->getCodeGenerator();
+			codeGenerator->beginSession(&llvmCompileContext);
+			std::vector<std::size_t> moduleEntries;
+			for (std::size_t j = i; j < sessionEntries.size(); j++)
+			{
+				if (sessionEntries[j].context == context && sessionEntries[j].expression->getOptimizationLevel() == optimizationLevel)
+				{
+					sessionEntries[j].expression->addToCompileSession(codeGenerator, &llvmCompileContext, sessionEntries[j].expectedType);
+					moduleEntries.push_back(j);
+					generated[j] = true;
+				}
+			}
+			std::vector<intptr_t> moduleFunctionAddresses = codeGenerator->finalizeSession();
+			for (std::size_t j = 0; j < moduleEntries.size(); j++)
+			{
+				functionAddresses[moduleEntries[j]] = (uintptr_t)moduleFunctionAddresses[j];
+			}
+		}
+	}
+#endif //ENABLE_LLVM
+	for (std::size_t i = 0; i < sessionEntries.size(); i++)
+	{
+		sessionEntries[i].expression->finishSessionCompilation(functionAddresses[i]);
+	}
+}
+
+
+void CompileSession::cancel(const void* expressionOrContext)
+{
+	assert(expressionOrContext != nullptr);
+	std::vector<Entry> removedEntries;
+	for (Entry& entry : entries)
+	{
+		if (entry.expression == expressionOrContext || entry.context == expressionOrContext)
+		{
+			entry.expression->compileSession = nullptr;
+			removedEntries.push_back(entry);
+		}
+	}
+	entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const Entry& entry) {return entry.expression == expressionOrContext || entry.context == expressionOrContext;}), entries.end());
+	releaseContexts(removedEntries);
+}
+
+
+std::size_t CompileSession::getNumPendingExpressions() const
+{
+	return entries.size();
+}
+
+
+CompileSession* CompileSession::getCurrent()
+{
+	return currentSession;
+}
+
+
+void CompileSession::add(ExpressionBase* expression, CatRuntimeContext* context, const CatGenericType& expectedType)
+{
+	assert(isOpen);
+	entries.push_back({expression, context, expectedType});
+	expression->compileSession = this;
+	//Register with the context, so that destroying the context also cancels its expressions in sessions that are not the current session.
+	std::vector<CompileSession*>& contextSessions = context->compileSessions;
+	if (std::find(contextSessions.begin(), contextSessions.end(), this) == contextSessions.end())
+	{
+		contextSessions.push_back(this);
+	}
+}
+
+
+void CompileSession::releaseContexts(const std::vector<Entry>& removedEntries)
+{
+	for (const Entry& removedEntry : removedEntries)
+	{
+		CatRuntimeContext* context = removedEntry.context;
+		if (std::none_of(entries.begin(), entries.end(), [&](const Entry& entry) {return entry.context == context;}))
+		{
+			std::vector<CompileSession*>& contextSessions = context->compileSessions;
+			contextSessions.erase(std::remove(contextSessions.begin(), contextSessions.end(), this), contextSessions.end());
+		}
+	}
+}
@@ -12,6 +12,7 @@
 #include "jitcat/CustomObject.h"
 #include "jitcat/CustomTypeMemberInfo.h"
 #include "jitcat/CustomTypeMemberFunctionInfo.h"
+#include "jitcat/MemoryStatistics.h"
 #include "jitcat/ReflectableHandle.h"
 #include "jitcat/StaticMemberInfo.h"
 #include "jitcat/Tools.h"
@@ -279,7 +280,7 @@ StaticMemberInfo* CustomTypeInfo::addStaticDoubleMember(const std::string& membe
 	memcpy(memberData, &defaultValue, dataSize);
 	std::string lowerCaseMemberName = Tools::toLowerCase(memberName);
 	StaticMemberInfo* memberInfo = new StaticBasicTypeMemberInfo<double>(memberName, reinterpret_cast<double*>(memberData), CatGenericType::doubleType, getTypeName());
-	staticMembers.emplace(lowerCaseMemberName, memberInfo);
+	insertStaticMember(lowerCaseMemberName, memberInfo);
 	return memberInfo;
 }
 
@@ -292,7 +293,7 @@ StaticMemberInfo* CustomTypeInfo::addStaticFloatMember(const std::string& member
 	memcpy(memberData, &defaultValue, dataSize);
 	std::string lowerCaseMemberName = Tools::toLowerCase(memberName);
 	StaticMemberInfo* memberInfo = new StaticBasicTypeMemberInfo<float>(memberName, reinterpret_cast<float*>(memberData), CatGenericType::floatType, getTypeName());
-	staticMembers.emplace(lowerCaseMemberName, memberInfo);
+	insertStaticMember(lowerCaseMemberName, memberInfo);
 	return memberInfo;
 }
 
@@ -305,7 +306,7 @@ StaticMemberInfo* CustomTypeInfo::addStaticIntMember(const std::string& memberNa
 	memcpy(memberData, &defaultValue, dataSize);
 	std::string lowerCaseMemberName = Tools::toLowerCase(memberName);
 	StaticMemberInfo* memberInfo = new StaticBasicTypeMemberInfo<int>(memberName, reinterpret_cast<int*>(memberData), CatGenericType::intType, getTypeName());
-	staticMembers.emplace(lowerCaseMemberName, memberInfo);
+	insertStaticMember(lowerCaseMemberName, memberInfo);
 	return memberInfo;
 }
 
@@ -318,7 +319,7 @@ StaticMemberInfo* CustomTypeInfo::addStaticBoolMember(const std::string& memberN
 	memcpy(memberData, &defaultValue, dataSize);
 	std::string lowerCaseMemberName = Tools::toLowerCase(memberName);
 	StaticMemberInfo* memberInfo = new StaticBasicTypeMemberInfo<bool>(memberName, reinterpret_cast<bool*>(memberData), CatGenericType::boolType, getTypeName());
-	staticMembers.emplace(lowerCaseMemberName, memberInfo);
+	insertStaticMember(lowerCaseMemberName, memberInfo);
 	return memberInfo;
 }
 
@@ -331,7 +332,7 @@ StaticMemberInfo* CustomTypeInfo::addStaticStringMember(const std::string& membe
 	new (memberData) Configuration::CatString(defaultValue);
 	std::string lowerCaseMemberName = Tools::toLowerCase(memberName);
 	StaticMemberInfo* memberInfo = new StaticClassObjectMemberInfo(memberName, memberData, CatGenericType::createStringType(isWritable, isConst), getTypeName());
-	staticMembers.emplace(lowerCaseMemberName, memberInfo);
+	insertStaticMember(lowerCaseMemberName, memberInfo);
 	return memberInfo;
 }
 
@@ -349,7 +350,7 @@ StaticMemberInfo* CustomTypeInfo::addStaticObjectMember(const std::string& membe
 		type.copyConstruct(memberData, dataSize, reinterpret_cast<unsigned char*>(&handle), dataSize); 
 		StaticMemberInfo* memberInfo = new StaticClassHandleMemberInfo(memberName, reinterpret_cast<ReflectableHandle*>(memberData), type, getTypeName());
 		std::string lowerCaseMemberName = Tools::toLowerCase(memberName);
-		staticMembers.emplace(lowerCaseMemberName, memberInfo);
+		insertStaticMember(lowerCaseMemberName, memberInfo);
 		return memberInfo;
 	}
 	else
@@ -372,7 +373,7 @@ StaticMemberInfo* CustomTypeInfo::addStaticDataObjectMember(const std::string& m
 																	   TypeOwnershipSemantics::Value, false, false, false), getTypeName());
 
 		std::string lowerCaseMemberName = Tools::toLowerCase(memberName);
-		staticMembers.emplace(lowerCaseMemberName, memberInfo);
+		insertStaticMember(lowerCaseMemberName, memberInfo);
 
 		objectTypeInfo->addDependentType(this);
 
@@ -402,7 +403,7 @@ StaticMemberInfo* CustomTypeInfo::addStaticMember(const std::string& memberName,
 CustomTypeMemberFunctionInfo* CustomTypeInfo::addMemberFunction(const std::string& memberFunctionName, const CatGenericType& thisType, AST::CatFunctionDefinition* functionDefinition)
 {
 	CustomTypeMemberFunctionInfo* functionInfo = new CustomTypeMemberFunctionInfo(functionDefinition, thisType);
-	memberFunctions.emplace(Tools::toLowerCase(memberFunctionName), functionInfo);
+	insertMemberFunction(Tools::toLowerCase(memberFunctionName), functionInfo);
 	return functionInfo;
 }
 
@@ -600,6 +601,15 @@ bool CustomTypeInfo::canBeDeleted() const
 }
 
 
+std::size_t CustomTypeInfo::getMemoryUsage() const
+{
+	using namespace MemoryEstimation;
+	//The default data holds the default values of an instance. The sizes of static member data are not stored, only the pointers are counted.
+	return TypeInfo::getMemoryUsage() + (sizeof(CustomTypeInfo) - sizeof(TypeInfo)) + getTypeSize() + getTreeMemory(instances) 
+		   + getVectorMemory(staticData) + getVectorMemory(removedMembers) + removedMembers.size() * sizeof(TypeMemberInfo);
+}
+
+
 llvm::orc::JITDylib* CustomTypeInfo::getDylib() const
 {
 	return dylib;
@@ -71,12 +71,8 @@ llvm::Value* CustomTypeObjectMemberInfo::generateDereferenceCode(llvm::Value* pa
 #ifdef ENABLE_LLVM
 	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
 	{
-		//Convert to int so we can add the offset
-		llvm::Value* dataPointerAsInt = context->helper->convertToIntPtr(parentObjectPointer, "data_IntPtr");
-		//Create a constant with the offset of this member relative to the the data pointer
-		llvm::Value* memberOffsetValue = context->helper->createOffsetGlobalValue(context, getMemberOffsetVariableName(), memberOffset);
-		//Add the offset to the data pointer.
-		llvm::Value* addressValue = context->helper->createAdd(dataPointerAsInt, memberOffsetValue, memberName + "_IntPtr");
+		//Add the offset of this member to the data pointer.
+		llvm::Value* addressValue = context->helper->createMemberAddress(context, parentObjectPointer, getMemberOffsetVariableName(), memberOffset, memberName + "_Address");
 		//Pointer to a ReflectableHandle
 		llvm::Value* reflectableHandle = context->helper->convertToPointer(addressValue, "ReflectableHandle");
 		//Call function that gets the member
@@ -95,12 +91,8 @@ llvm::Value* CustomTypeObjectMemberInfo::generateAssignCode(llvm::Value* parentO
 #ifdef ENABLE_LLVM
 	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
 	{
-		//Convert to int so we can add the offset
-		llvm::Value* dataPointerAsInt = context->helper->convertToIntPtr(parentObjectPointer, "data_IntPtr");
-		//Create a constant with the offset of this member relative to the the data pointer
-		llvm::Value* memberOffsetValue = context->helper->createOffsetGlobalValue(context, getMemberOffsetVariableName(), memberOffset);
-		//Add the offset to the data pointer.
-		llvm::Value* addressValue = context->helper->createAdd(dataPointerAsInt, memberOffsetValue, memberName + "_IntPtr");
+		//Add the offset of this member to the data pointer.
+		llvm::Value* addressValue = context->helper->createMemberAddress(context, parentObjectPointer, getMemberOffsetVariableName(), memberOffset, memberName + "_Address");
 		//Pointer to a ReflectableHandle
 		llvm::Value* reflectableHandle = context->helper->convertToPointer(addressValue, "ReflectableHandle");
 		//Type info of the object that will be assigned
@@ -138,6 +130,16 @@ std::any CustomTypeObjectDataMemberInfo::getMemberReference(unsigned char* base)
 }
 
 
+CatValue CustomTypeObjectDataMemberInfo::getMemberValue(unsigned char* base)
+{
+	if (CatValue::getTag(catType) == CatValue::Tag::Pointer)
+	{
+		return CatValue::fromPointer(base != nullptr ? reinterpret_cast<uintptr_t>(&base[memberOffset]) : 0);
+	}
+	return CatValue::fromAny(getMemberReference(base), catType);
+}
+
+
 std::any CustomTypeObjectDataMemberInfo::getAssignableMemberReference(unsigned char* base)
 {
 	if (base != nullptr)
@@ -153,20 +155,8 @@ std::any CustomTypeObjectDataMemberInfo::getAssignableMemberReference(unsigned c
 llvm::Value* CustomTypeObjectDataMemberInfo::generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const
 {
 #ifdef ENABLE_LLVM
-	auto notNullCodeGen = [=](LLVM::LLVMCompileTimeContext* compileContext)
-	{
-		//Convert to int so we can add the offset
-		llvm::Value* dataPointerAsInt = context->helper->convertToIntPtr(parentObjectPointer, "data_IntPtr");
-		//Create a constant with the offset of this member relative to the the data pointer
-		llvm::Value* memberOffsetValue = context->helper->createOffsetGlobalValue(context, getMemberOffsetVariableName(), memberOffset);
-		//Add the offset to the data pointer.
-		llvm::Value* addressValue = context->helper->createAdd(dataPointerAsInt, memberOffsetValue, memberName + "_IntPtr");
-		//Pointer to a Reflectable
-		llvm::Value* reflectable = context->helper->convertToPointer(addressValue, memberName);
-		//Call function that gets the member
-		return reflectable;
-	};
-	return context->helper->createOptionalNullCheckSelect(parentObjectPointer, notNullCodeGen, context->targetConfig->getLLVMTypes().pointerType, context);
+	//The object is embedded in the parent's data, so its address is the data pointer plus the member offset.
+	return context->helper->createEmbeddedMemberAddress(context, parentObjectPointer, getMemberOffsetVariableName(), memberOffset, memberName);
 #else 
 	return nullptr;
 #endif //ENABLE_LLVM
@@ -180,6 +170,13 @@ llvm::Value* CustomTypeObjectDataMemberInfo::generateAssignCode(llvm::Value* par
 }
 
 
+DirectMemberAccess CustomTypeObjectDataMemberInfo::getDirectMemberAccess(std::size_t& offset) const
+{
+	offset = memberOffset;
+	return DirectMemberAccess::Address;
+}
+
+
 void jitcat::Reflection::CustomTypeObjectDataMemberInfo::assign(std::any& base, std::any& valueToSet)
 {
 	assert(false);
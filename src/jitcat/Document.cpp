@@ -15,30 +15,26 @@
 using namespace jitcat::Tokenizer;
 
 
-Document::Document():
-	currentLineIndex(0)
+Document::Document()
 {
 }
 
 
 Document::Document(const std::string& document):
-	document(document),
-	currentLineIndex(0)
+	document(document)
 {
 }
 
 
 Document::Document(const char* fileData, std::size_t fileSize):
-	document(fileData, fileSize),
-	currentLineIndex(0)
+	document(fileData, fileSize)
 {
 }
 
 
 Document::Document(Document&& other) noexcept:
 	document(std::move(other.document)),
-	lineNumberLookup(std::move(other.lineNumberLookup)),
-	currentLineIndex(other.currentLineIndex),
+	lineEndOffsets(std::move(other.lineEndOffsets)),
 	tokens(std::move(other.tokens))
 {
 }
@@ -52,8 +48,7 @@ Document::~Document()
 Document& Document::operator=(Document&& other) noexcept
 {
 	document = std::move(other.document);
-	lineNumberLookup = std::move(other.lineNumberLookup);
-	currentLineIndex = other.currentLineIndex;
+	lineEndOffsets = std::move(other.lineEndOffsets);
 	tokens = std::move(other.tokens);
 	return *this;
 }
@@ -118,48 +113,33 @@ std::tuple<int, int> Document::getLineAndColumnNumber(const Lexeme & lexeme) con
 
 std::tuple<int, int> Document::getLineAndColumnNumber(int offset) const
 {
-	auto iter = lineNumberLookup.upper_bound(offset);
-	if (iter != lineNumberLookup.end())
+	if (lineEndOffsets.empty())
 	{
-		int lineNumber = iter->second;
-		int lineStartOffset = 0;
-		if (iter != lineNumberLookup.begin())
-		{
-			--iter;
-			lineStartOffset = iter->first + 1;
-		}
-		int column = offset - lineStartOffset;
-		return std::tuple<int, int>(lineNumber, column);
+		return std::tuple<int, int>(0, 0);
 	}
-	else
+	auto iter = std::upper_bound(lineEndOffsets.begin(), lineEndOffsets.end(), offset);
+	if (iter == lineEndOffsets.end())
 	{
-		auto iter = lineNumberLookup.rbegin();
-		if (iter != lineNumberLookup.rend())
-		{
-			int lineNumber = iter->second;
-			int lineStartOffset = 0;
-			if (++iter != lineNumberLookup.rend())
-			{
-				lineStartOffset = iter->first + 1;
-			}
-			else
-			{
-				lineStartOffset = 0;
-			}
-			int column = offset - lineStartOffset;
-			return std::tuple<int, int>(lineNumber, column);
-		}
-		return std::tuple<int, int>(0, 0);
+		//Past the end of the last line, count from the start of the last line.
+		--iter;
+	}
+	int lineNumber = (int)(iter - lineEndOffsets.begin());
+	int lineStartOffset = 0;
+	if (iter != lineEndOffsets.begin())
+	{
+		lineStartOffset = *(iter - 1) + 1;
 	}
+	int column = offset - lineStartOffset;
+	return std::tuple<int, int>(lineNumber, column);
 }
 
 
 int Document::offsetToLineNumber(int offset) const
 {
-	auto iter = lineNumberLookup.upper_bound(offset);
-	if (iter != lineNumberLookup.end())
+	auto iter = std::upper_bound(lineEndOffsets.begin(), lineEndOffsets.end(), offset);
+	if (iter != lineEndOffsets.end())
 	{
-		return iter->second;
+		return (int)(iter - lineEndOffsets.begin());
 	}
 	else
 	{
@@ -170,15 +150,15 @@ int Document::offsetToLineNumber(int offset) const
 
 void Document::clearLineLookup()
 {
-	currentLineIndex = 0;
-	lineNumberLookup.clear();
+	lineEndOffsets.clear();
 }
 
 
 void Document::addNewLine(int offset)
 {
-	lineNumberLookup[offset] = currentLineIndex;
-	currentLineIndex++;
+	//The tokenizer adds lines in order.
+	assert(lineEndOffsets.empty() || offset > lineEndOffsets.back());
+	lineEndOffsets.push_back(offset);
 }
 
 
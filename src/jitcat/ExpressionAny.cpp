@@ -6,10 +6,12 @@
 */
 
 #include "jitcat/ExpressionAny.h"
+#include "jitcat/BytecodeProgram.h"
 #include "jitcat/CatASTNodes.h"
 #include "jitcat/Configuration.h"
 #include "jitcat/Document.h"
 #include "jitcat/ExpressionErrorManager.h"
+#include "jitcat/ExpressionProfiler.h"
 #include "jitcat/JitCat.h"
 #include "jitcat/SLRParseResult.h"
 #include "jitcat/Tools.h"
@@ -21,6 +23,7 @@ using namespace jitcat::AST;
 
 ExpressionAny::ExpressionAny():
 	getValuePtr(&ExpressionAny::getDefaultValue),
+	valueFunctionPtr(&ExpressionAny::getDefaultValue),
 	nativeFunctionAddress(0)
 {
 }
@@ -29,6 +32,7 @@ ExpressionAny::ExpressionAny():
 ExpressionAny::ExpressionAny(const char* expression):
 	ExpressionBase(expression),
 	getValuePtr(&ExpressionAny::getDefaultValue),
+	valueFunctionPtr(&ExpressionAny::getDefaultValue),
 	nativeFunctionAddress(0)
 {
 }
@@ -37,6 +41,7 @@ ExpressionAny::ExpressionAny(const char* expression):
 ExpressionAny::ExpressionAny(const std::string& expression):
 	ExpressionBase(expression),
 	getValuePtr(&ExpressionAny::getDefaultValue),
+	valueFunctionPtr(&ExpressionAny::getDefaultValue),
 	nativeFunctionAddress(0)
 {
 }
@@ -45,6 +50,7 @@ ExpressionAny::ExpressionAny(const std::string& expression):
 ExpressionAny::ExpressionAny(CatRuntimeContext* compileContext, const std::string& expression):
 	ExpressionBase(compileContext, expression),
 	getValuePtr(&ExpressionAny::getDefaultValue),
+	valueFunctionPtr(&ExpressionAny::getDefaultValue),
 	nativeFunctionAddress(0)
 {
 	compile(compileContext);
@@ -63,9 +69,9 @@ const std::any jitcat::ExpressionAny::getInterpretedValue(CatRuntimeContext* run
 	{
 		return cachedValue;
 	}
-	else if (parseResult.astRootNode != nullptr)
+	else if (parseResult->astRootNode != nullptr)
 	{
-		std::any result = parseResult.getNode<CatTypedExpression>()->execute(runtimeContext);
+		std::any result = parseResult->getNode<CatTypedExpression>()->execute(runtimeContext);
 		runtimeContext->clearTemporaries();
 		return result;
 	}
@@ -87,13 +93,22 @@ void ExpressionAny::compile(CatRuntimeContext* context)
 	{
 		if (isConstant)
 		{
-			cachedValue = parseResult.getNode<CatTypedExpression>()->execute(context);
-			getValuePtr = &ExpressionAny::getCachedValue;
+			cachedValue = parseResult->getNode<CatTypedExpression>()->execute(context);
+			setValueFunction(&ExpressionAny::getCachedValue);
 			discardAST();
 		}
+		else if (compileWhenHot)
+		{
+			setValueFunction(&ExpressionAny::getExecuteColdValue);
+		}
+		else if (compilationPending)
+		{
+			//Compiled when the CompileSession is finalized.
+			setInterpretedValueFunction();
+		}
 		else if (!Configuration::enableLLVM && !JitCat::get()->getHasPrecompiledExpression())
 		{
-			getValuePtr = &ExpressionAny::getExecuteInterpretedValue;
+			setInterpretedValueFunction();
 		}
 	}
 	else
@@ -108,24 +123,24 @@ void ExpressionAny::handleCompiledFunction(uintptr_t functionAddress)
 	nativeFunctionAddress = functionAddress;
 	if (nativeFunctionAddress == 0)
 	{
-		getValuePtr = &ExpressionAny::getExecuteInterpretedValue;
+		setInterpretedValueFunction();
 	}
 	else
 	{
-		if		(valueType.isIntType())						getValuePtr = &ExpressionAny::getExecuteIntValue;
-		else if (valueType.isVoidType())					getValuePtr = &ExpressionAny::getExecuteVoidValue;
-		else if (valueType.isFloatType())					getValuePtr = &ExpressionAny::getExecuteFloatValue;
-		else if (valueType.isDoubleType())					getValuePtr = &ExpressionAny::getExecuteDoubleValue;
-		else if (valueType.isBoolType())					getValuePtr = &ExpressionAny::getExecuteBoolValue;
-		else if (valueType.isReflectablePointerOrHandle())	getValuePtr = &ExpressionAny::getExecuteReflectablePtrValue;
+		if		(valueType.isIntType())						setValueFunction(&ExpressionAny::getExecuteIntValue);
+		else if (valueType.isVoidType())					setValueFunction(&ExpressionAny::getExecuteVoidValue);
+		else if (valueType.isFloatType())					setValueFunction(&ExpressionAny::getExecuteFloatValue);
+		else if (valueType.isDoubleType())					setValueFunction(&ExpressionAny::getExecuteDoubleValue);
+		else if (valueType.isBoolType())					setValueFunction(&ExpressionAny::getExecuteBoolValue);
+		else if (valueType.isReflectablePointerOrHandle())	setValueFunction(&ExpressionAny::getExecuteReflectablePtrValue);
 		else if (valueType.isPointerToPointerType() && valueType.getPointeeType()->isPointerToReflectableObjectType())
 		{
-			getValuePtr = &ExpressionAny::getExecutePtrPtrValue;
+			setValueFunction(&ExpressionAny::getExecutePtrPtrValue);
 		}
 		else 
 		{
 			assert(false);
-			getValuePtr = &ExpressionAny::getDefaultValue;
+			setValueFunction(&ExpressionAny::getDefaultValue);
 		}
 	}
 }
@@ -134,7 +149,13 @@ void ExpressionAny::handleCompiledFunction(uintptr_t functionAddress)
 void ExpressionAny::resetCompiledFunctionToDefault()
 {
 	nativeFunctionAddress = 0;
-	getValuePtr = &ExpressionAny::getDefaultValue;
+	setValueFunction(&ExpressionAny::getDefaultValue);
+}
+
+
+bool ExpressionAny::getSupportsDeferredCompilation() const
+{
+	return true;
 }
 
 
@@ -191,19 +212,78 @@ const std::any jitcat::ExpressionAny::getExecutePtrPtrValue(CatRuntimeContext* r
 const std::any ExpressionAny::getExecuteInterpretedValue(CatRuntimeContext* runtimeContext)
 {
 	if (runtimeContext == nullptr)	runtimeContext = &CatRuntimeContext::getDefaultContext();
-	std::any result = parseResult.getNode<CatTypedExpression>()->execute(runtimeContext);
+	std::any result = parseResult->getNode<CatTypedExpression>()->execute(runtimeContext);
 	runtimeContext->clearTemporaries();
 	return result;
 }
 
 
-const std::any ExpressionAny::getCachedValue(CatRuntimeContext* runtimeContext)
+const std::any ExpressionAny::getExecuteColdValue(CatRuntimeContext* runtimeContext)
+{
+	if (runtimeContext == nullptr)	runtimeContext = &CatRuntimeContext::getDefaultContext();
+	if (countExecution())
+	{
+		setInterpretedValueFunction();
+		if (compileDeferred(CatGenericType()) && !Configuration::enableLLVM)
+		{
+			setInterpretedValueFunction();
+		}
+		return (this->*valueFunctionPtr)(runtimeContext);
+	}
+	return getExecuteInterpretedValue(runtimeContext);
+}
+
+
+const std::any ExpressionAny::getExecuteBytecodeValue(CatRuntimeContext* runtimeContext)
+{
+	if (runtimeContext == nullptr)	runtimeContext = &CatRuntimeContext::getDefaultContext();
+	std::any result = bytecodeProgram->executeToAny(runtimeContext);
+	runtimeContext->clearTemporaries();
+	return result;
+}
+
+
+void ExpressionAny::setValueFunction(const std::any (ExpressionAny::*valueFunction)(CatRuntimeContext* runtimeContext))
+{
+	valueFunctionPtr = valueFunction;
+	if (profileRecord != nullptr)
+	{
+		getValuePtr = &ExpressionAny::getExecuteProfiledValue;
+	}
+	else
+	{
+		getValuePtr = valueFunction;
+	}
+}
+
+
+void ExpressionAny::setInterpretedValueFunction()
+{
+	if (bytecodeProgram != nullptr)
+	{
+		setValueFunction(&ExpressionAny::getExecuteBytecodeValue);
+	}
+	else
+	{
+		setValueFunction(&ExpressionAny::getExecuteInterpretedValue);
+	}
+}
+
+
+const std::any ExpressionAny::getExecuteProfiledValue(CatRuntimeContext* runtimeContext)
+{
+	ProfileScope profileScope(profileRecord.get());
+	return (this->*valueFunctionPtr)(runtimeContext);
+}
+
+
+const std::any ExpressionAny::getCachedValue([[maybe_unused]] CatRuntimeContext* runtimeContext)
 {
 	return cachedValue;
 }
 
 
-const std::any ExpressionAny::getDefaultValue(CatRuntimeContext* runtimeContext)
+const std::any ExpressionAny::getDefaultValue([[maybe_unused]] CatRuntimeContext* runtimeContext)
 {
 	return std::any();
 }
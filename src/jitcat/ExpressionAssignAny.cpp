@@ -11,6 +11,7 @@
 #include "jitcat/CatRuntimeContext.h"
 #include "jitcat/CatTypedExpression.h"
 #include "jitcat/Configuration.h"
+#include "jitcat/ExpressionProfiler.h"
 #include "jitcat/MemberFunctionInfo.h"
 #include "jitcat/SLRParseResult.h"
 #include "jitcat/TypeInfo.h"
@@ -58,6 +59,7 @@ ExpressionAssignAny::ExpressionAssignAny(CatRuntimeContext* compileContext, cons
 
 bool ExpressionAssignAny::assignValue(CatRuntimeContext* runtimeContext, std::any value, const CatGenericType& valueType)
 {
+	ProfileScope profileScope(profileRecord.get());
 	if (Configuration::enableLLVM || JitCat::get()->getHasPrecompiledExpression())
 	{
 		if (Configuration::enableLLVM || nativeFunctionAddress != 0)
@@ -113,9 +115,9 @@ bool ExpressionAssignAny::assignValue(CatRuntimeContext* runtimeContext, std::an
 
 bool ExpressionAssignAny::assignInterpretedValue(CatRuntimeContext* runtimeContext, std::any value, const CatGenericType& rValueType)
 {
-	if (parseResult.astRootNode != nullptr && parseResult.getNode<AST::CatTypedExpression>()->isAssignable())
+	if (parseResult->astRootNode != nullptr && parseResult->getNode<AST::CatTypedExpression>()->isAssignable())
 	{
-		jitcat::AST::CatAssignableExpression* assignable = parseResult.getNode<AST::CatAssignableExpression>();
+		jitcat::AST::CatAssignableExpression* assignable = parseResult->getNode<AST::CatAssignableExpression>();
 		if (assignmentOperatorFunction != nullptr)
 		{
 			if (valueType.compare(rValueType, false, true))
@@ -167,7 +169,7 @@ bool ExpressionAssignAny::assignInterpretedValue(CatRuntimeContext* runtimeConte
 void ExpressionAssignAny::compile(CatRuntimeContext* context)
 {
 	parse(context, context->getErrorManager(), this, CatGenericType());
-	if (parseResult.astRootNode != nullptr && parseResult.getNode<AST::CatTypedExpression>()->isAssignable())
+	if (parseResult->astRootNode != nullptr && parseResult->getNode<AST::CatTypedExpression>()->isAssignable())
 	{
 		if (getType().isPointerToReflectableObjectType() && getType().getOwnershipSemantics() == TypeOwnershipSemantics::Value)
 		{
@@ -175,8 +177,8 @@ void ExpressionAssignAny::compile(CatRuntimeContext* context)
 			assignmentOperatorFunction = getType().getPointeeType()->getObjectType()->getMemberFunctionInfo(signature);
 			if (assignmentOperatorFunction == nullptr)
 			{
-				parseResult.astRootNode.reset(nullptr);
-				parseResult.success = false;
+				parseResult = std::make_shared<Parser::SLRParseResult>();
+				memoryAccount.close();
 			}
 		}
 	}
@@ -6,6 +6,8 @@
 */
 
 #include "jitcat/ExpressionBase.h"
+#include "jitcat/BackgroundCompiler.h"
+#include "jitcat/BytecodeCompiler.h"
 #include "jitcat/CatArgumentList.h"
 #include "jitcat/CatAssignableExpression.h"
 #include "jitcat/CatBuiltInFunctionCall.h"
@@ -13,9 +15,12 @@
 #include "jitcat/CatPrefixOperator.h"
 #include "jitcat/CatRuntimeContext.h"
 #include "jitcat/CatTypedExpression.h"
+#include "jitcat/ColumnBinding.h"
+#include "jitcat/CompileSession.h"
 #include "jitcat/Configuration.h"
 #include "jitcat/ExpressionErrorManager.h"
 #include "jitcat/ExpressionHelperFunctions.h"
+#include "jitcat/ExpressionProfiler.h"
 #include "jitcat/Document.h"
 #include "jitcat/JitCat.h"
 #ifdef ENABLE_LLVM
@@ -26,8 +31,10 @@
 #include "jitcat/PrecompilationContext.h"
 #include "jitcat/SLRParseResult.h"
 #include "jitcat/Tools.h"
+#include "jitcat/TypeInfo.h"
 #include "jitcat/TypeRegistry.h"
 
+#include <algorithm>
 #include <cassert>
 
 using namespace jitcat;
@@ -39,42 +46,99 @@ using namespace jitcat::Tokenizer;
 
 
 ExpressionBase::ExpressionBase(bool expectAssignable):
+	parseResult(std::make_shared<SLRParseResult>()),
+	batchFunctionAddress(0),
+	batchFunctionScopeId(InvalidScopeID),
+	columnProgramScopeId(InvalidScopeID),
+	columnFunctionAddress(0),
+	keepAST(false),
 	expressionIsLiteral(false),
 	isConstant(false),
-	expectAssignable(expectAssignable)
+	expectAssignable(expectAssignable),
+	compilationPending(false),
+	compileWhenHot(false),
+	executionCount(0),
+	compileContext(nullptr),
+	backgroundFunctionAddress(0),
+	backgroundCompilationFinished(false),
+	compileSession(nullptr),
+	profileRecord(nullptr)
 {
 }
 
 
 ExpressionBase::ExpressionBase(const char* expression, bool expectAssignable):
 	expression(expression),
+	parseResult(std::make_shared<SLRParseResult>()),
+	batchFunctionAddress(0),
+	batchFunctionScopeId(InvalidScopeID),
+	columnProgramScopeId(InvalidScopeID),
+	columnFunctionAddress(0),
+	keepAST(false),
 	expressionIsLiteral(false),
 	isConstant(false),
-	expectAssignable(expectAssignable)
+	expectAssignable(expectAssignable),
+	compilationPending(false),
+	compileWhenHot(false),
+	executionCount(0),
+	compileContext(nullptr),
+	backgroundFunctionAddress(0),
+	backgroundCompilationFinished(false),
+	compileSession(nullptr),
+	profileRecord(nullptr)
 {
 }
 
 
 ExpressionBase::ExpressionBase(const std::string& expression, bool expectAssignable):
 	expression(expression),
+	parseResult(std::make_shared<SLRParseResult>()),
+	batchFunctionAddress(0),
+	batchFunctionScopeId(InvalidScopeID),
+	columnProgramScopeId(InvalidScopeID),
+	columnFunctionAddress(0),
+	keepAST(false),
 	expressionIsLiteral(false),
 	isConstant(false),
-	expectAssignable(expectAssignable)
+	expectAssignable(expectAssignable),
+	compilationPending(false),
+	compileWhenHot(false),
+	executionCount(0),
+	compileContext(nullptr),
+	backgroundFunctionAddress(0),
+	backgroundCompilationFinished(false),
+	compileSession(nullptr),
+	profileRecord(nullptr)
 {
 }
 
 
 ExpressionBase::ExpressionBase(CatRuntimeContext* compileContext, const std::string& expression, bool expectAssignable):
 	expression(expression),
+	parseResult(std::make_shared<SLRParseResult>()),
+	batchFunctionAddress(0),
+	batchFunctionScopeId(InvalidScopeID),
+	columnProgramScopeId(InvalidScopeID),
+	columnFunctionAddress(0),
+	keepAST(false),
 	expressionIsLiteral(false),
 	isConstant(false),
-	expectAssignable(expectAssignable)
+	expectAssignable(expectAssignable),
+	compilationPending(false),
+	compileWhenHot(false),
+	executionCount(0),
+	compileContext(nullptr),
+	backgroundFunctionAddress(0),
+	backgroundCompilationFinished(false),
+	compileSession(nullptr),
+	profileRecord(nullptr)
 {
 }
 
 
 ExpressionBase::~ExpressionBase()
 {
+	cancelDeferredCompilation();
 	if (errorManagerHandle.getIsValid())
 	{
 		reinterpret_cast<ExpressionErrorManager*>(errorManagerHandle.get())->errorSourceDeleted(this);
@@ -86,6 +150,7 @@ void ExpressionBase::setExpression(const std::string& expression_, CatRuntimeCon
 {
 	if (expression != expression_)
 	{
+		cancelDeferredCompilation();
 		expression = expression_;
 		if (compileContext != nullptr)
 		{
@@ -94,7 +159,12 @@ void ExpressionBase::setExpression(const std::string& expression_, CatRuntimeCon
 		else
 		{
 			valueType = CatGenericType::unknownType;
-			parseResult.clear();
+			bytecodeProgram.reset(nullptr);
+			columnProgram.reset(nullptr);
+			columnFunctionAddress = 0;
+			parseResult = std::make_shared<SLRParseResult>();
+			sharedExpression.reset();
+			memoryAccount.close();
 			isConstant = false;
 			expressionIsLiteral = false;
 		}
@@ -122,7 +192,7 @@ bool ExpressionBase::isConst() const
 
 bool ExpressionBase::hasError() const
 {
-	return !(parseResult.success);
+	return !(parseResult->success);
 }
 
 
@@ -132,6 +202,27 @@ const CatGenericType& ExpressionBase::getType() const
 }
 
 
+void ExpressionBase::setOptimizationLevel(LLVM::LLVMOptimizationLevel level)
+{
+	optimizationLevel = level;
+}
+
+
+LLVM::LLVMOptimizationLevel ExpressionBase::getOptimizationLevel() const
+{
+	return optimizationLevel.value_or(JitCat::get()->getDefaultOptimizationLevel());
+}
+
+
+LLVM::LLVMCompileOptions ExpressionBase::getCompileOptions() const
+{
+	LLVM::LLVMCompileOptions compileOptions;
+	compileOptions.enableDereferenceNullChecks = true;
+	compileOptions.optimizationLevel = getOptimizationLevel();
+	return compileOptions;
+}
+
+
 bool ExpressionBase::parse(CatRuntimeContext* context, ExpressionErrorManager* errorManager, void* errorContext, const CatGenericType& expectedType)
 {
 	if (context == nullptr)
@@ -139,6 +230,9 @@ bool ExpressionBase::parse(CatRuntimeContext* context, ExpressionErrorManager* e
 		context = &CatRuntimeContext::getDefaultContext();
 		context->getErrorManager()->clear();
 	}
+	//The AST that is about to be replaced may still be in use by the background compiler.
+	cancelDeferredCompilation();
+	compileContext = context;
 	//If this expressions is compiled multiple times, we need to clear any errors that were previously generated.
 	if (errorManagerHandle.getIsValid())
 	{
@@ -148,67 +242,248 @@ bool ExpressionBase::parse(CatRuntimeContext* context, ExpressionErrorManager* e
 
 	isConstant = false;
 	expressionIsLiteral = false;
+	batchFunctionAddress = 0;
+	batchFunctionScopeId = InvalidScopeID;
+	columnProgram.reset(nullptr);
+	columnFunctionAddress = 0;
+	profileRecord = nullptr;
+	//The previous AST is released first, so that the memory retained by the new AST can be measured.
+	parseResult.reset();
+	sharedExpression.reset();
+	memoryAccount.close();
+
+	//An open compile session takes precedence over the other forms of deferred compilation.
+	CompileSession* session = getSupportsDeferredCompilation() ? CompileSession::getCurrent() : nullptr;
+	const bool compileInBackground = JitCat::get()->getBackgroundCompilation() && getSupportsBackgroundCompilation();
+	const bool deferUntilHot = session == nullptr && JitCat::get()->getCompilationThreshold() > 0 && getSupportsDeferredCompilation();
+	//Only expressions that are compiled immediately are shared. 
+	//Expressions that are compiled as part of a function or class definition are not shared, because they can refer to its local variables.
+	std::optional<SharedExpressionCache::Key> sharedExpressionKey;
+	if (JitCat::get()->getExpressionSharing() && !keepAST && session == nullptr && !compileInBackground && !deferUntilHot
+		&& !JitCat::get()->getHasPrecompiledExpression() && context->getPrecompilationContext() == nullptr
+		&& context->getCurrentScope() == nullptr && context->getCurrentFunction() == nullptr && context->getCurrentClass() == nullptr)
+	{
+		sharedExpressionKey.emplace(expression, expectedType, expectAssignable, getCompileOptions(), context);
+		if (std::shared_ptr<const SharedExpression> shared = JitCat::get()->sharedExpressionCache->find(*sharedExpressionKey); shared != nullptr)
+		{
+			useSharedExpression(shared, context);
+			return true;
+		}
+	}
+
+	const std::ptrdiff_t previousASTMemory = ASTNode::getThreadAllocatedMemory();
+
+	//A shared expression records the types that it is resolved against, so that it is not reused after one of them has changed.
+	std::vector<TypeVersion> resolvedTypes;
+	std::vector<TypeVersion>* previousRecordedLookups = nullptr;
+	if (sharedExpressionKey.has_value())
+	{
+		previousRecordedLookups = TypeInfo::setRecordedLookups(&resolvedTypes);
+	}
 
 	Document document(expression.c_str(), expression.length());
 	context->getErrorManager()->setCurrentDocument(&document);
 	parseResult = JitCat::get()->parseExpression(document, context, errorManager, errorContext);
 
-	if (parseResult.success)
+	if (parseResult->success)
 	{
 		typeCheck(expectedType, context, errorManager, errorContext);
-		if (parseResult.success)
+		if (parseResult->success)
 		{
 			constCollapse(context, errorManager, errorContext);
 		}
 	}
+	if (sharedExpressionKey.has_value())
+	{
+		TypeInfo::setRecordedLookups(previousRecordedLookups);
+	}
 	handleParseErrors(context);
-	//typeCheck may have changed parseResult.success
-	if (parseResult.success && !isConstant)
+	if (parseResult->success)
 	{
-		compileToNativeCode(context, expectedType);
+		memoryAccount.open(context->getMemoryCounters(), (std::size_t)std::max((std::ptrdiff_t)0, ASTNode::getThreadAllocatedMemory() - previousASTMemory));
 	}
-	if (!parseResult.success)
+	//typeCheck may have changed parseResult->success
+	bytecodeProgram.reset(nullptr);
+	if (parseResult->success && !isConstant)
 	{
-		parseResult.astRootNode.reset(nullptr);
+		if (JitCat::get()->getProfilingEnabled())
+		{
+			profileRecord = JitCat::get()->getProfiler()->getRecord(expectAssignable ? ProfileRecordKind::Assignment : ProfileRecordKind::Expression, 
+																	 expression, context->getContextName());
+		}
+		if (session != nullptr || compileInBackground || deferUntilHot)
+		{
+			compilationPending = !linkPrecompiledFunction(context, expectedType);
+			compileWhenHot = compilationPending && deferUntilHot;
+			if (compileWhenHot)
+			{
+				JitCat::get()->numDeferredExpressions++;
+			}
+			else if (compilationPending && session != nullptr)
+			{
+				session->add(this, context, expectedType);
+			}
+		}
+		else
+		{
+			compileToBytecode();
+			uintptr_t functionAddress = compileToNativeCode(context, expectedType);
+			if (sharedExpressionKey.has_value() && (functionAddress != 0 || !Configuration::enableLLVM))
+			{
+				shareExpression(*sharedExpressionKey, functionAddress, std::move(resolvedTypes));
+			}
+		}
+	}
+	if (!parseResult->success)
+	{
+		parseResult->discardAST();
 	}
 	context->getErrorManager()->setCurrentDocument(nullptr);
-	return parseResult.success;
+	return parseResult->success;
 }
 
 
 void ExpressionBase::discardAST()
 {
-	parseResult.astRootNode = nullptr;
+	//The bytecode programs refer to the AST.
+	bytecodeProgram.reset(nullptr);
+	columnProgram.reset(nullptr);
+	//The parse result may be shared with other expressions, so it is replaced rather than cleared.
+	std::shared_ptr<SLRParseResult> discardedResult = std::make_shared<SLRParseResult>();
+	discardedResult->success = parseResult->success;
+	parseResult = discardedResult;
+	memoryAccount.releaseAST();
+}
+
+
+#ifdef ENABLE_LLVM
+template<typename GenerateFunctionT>
+uintptr_t ExpressionBase::generateLoopFunction(CatRuntimeContext* context, GenerateFunctionT generateFunction)
+{
+	llvm::orc::ThreadSafeContext::Lock contextLock = LLVM::LLVMJit::get().getThreadSafeContext().getLock();
+	LLVMCompileTimeContext llvmCompileContext(context, LLVM::LLVMJit::get().getJitTargetConfig(), false);
+	llvmCompileContext.options = getCompileOptions();
+	if (codeGenerator == nullptr)
+	{
+		codeGenerator = context->getCodeGenerator();
+	}
+	return (uintptr_t)generateFunction(&llvmCompileContext);
+}
+#endif //ENABLE_LLVM
+
+
+uintptr_t ExpressionBase::getBatchFunctionAddress([[maybe_unused]] CatRuntimeContext* context, CatScopeID batchScopeId, [[maybe_unused]] const CatGenericType& expectedType)
+{
+	//A failed attempt is remembered as well, so that code generation is not retried on every call.
+	if (batchFunctionScopeId == batchScopeId)
+	{
+		return batchFunctionAddress;
+	}
+	batchFunctionAddress = 0;
+#ifdef ENABLE_LLVM
+	if (!isConstant && !expectAssignable && ensureAST())
+	{
+		batchFunctionAddress = generateLoopFunction(context, [&](LLVMCompileTimeContext* llvmCompileContext)
+			{
+				return codeGenerator->generateAndGetBatchFunctionAddress(parseResult->getNode<CatTypedExpression>(), expression, expectedType, batchScopeId, llvmCompileContext);
+			});
+	}
+#endif //ENABLE_LLVM
+	batchFunctionScopeId = batchScopeId;
+	return batchFunctionAddress;
+}
+
+
+bool ExpressionBase::ensureAST()
+{
+	if (parseResult->success && parseResult->astRootNode == nullptr && !keepAST)
+	{
+		//The AST is type checked against the scopes of the context that the expression was compiled with, not those of the calling context.
+		CatRuntimeContext* context = getCompileContext();
+		if (context == nullptr)
+		{
+			return false;
+		}
+		keepAST = true;
+		compile(context);
+	}
+	return parseResult->success && parseResult->astRootNode != nullptr;
+}
+
+
+CatRuntimeContext* ExpressionBase::getCompileContext() const
+{
+	return memoryAccount.getContextExists() ? compileContext : nullptr;
+}
+
+
+bool ExpressionBase::prepareColumnEvaluation([[maybe_unused]] CatRuntimeContext* context, CatScopeID columnScopeId, const ColumnBinding& columns, [[maybe_unused]] const CatGenericType& expectedType)
+{
+	if (columnProgram != nullptr && columnProgramScopeId == columnScopeId)
+	{
+		bool allColumnsBound = true;
+		for (const TypeMemberInfo* member : columnProgram->getColumnMembers())
+		{
+			allColumnsBound = allColumnsBound && columns.getColumn(member) != nullptr;
+		}
+		if (allColumnsBound)
+		{
+			return true;
+		}
+	}
+	columnFunctionAddress = 0;
+	columnProgram.reset(nullptr);
+	if (isConstant || expectAssignable || !ensureAST())
+	{
+		return false;
+	}
+	columnProgram = Bytecode::BytecodeCompiler::compileColumns(parseResult->getNode<CatTypedExpression>(), columnScopeId, columns);
+	if (columnProgram == nullptr)
+	{
+		return false;
+	}
+	columnProgramScopeId = columnScopeId;
+#ifdef ENABLE_LLVM
+	if (columnProgram->getResultType() == expectedType)
+	{
+		columnFunctionAddress = generateLoopFunction(context, [&](LLVMCompileTimeContext* llvmCompileContext)
+			{
+				return codeGenerator->generateAndGetColumnFunctionAddress(parseResult->getNode<CatTypedExpression>(), expression, expectedType, columnScopeId, 
+																		  columnProgram->getColumnMembers(), llvmCompileContext);
+			});
+	}
+#endif //ENABLE_LLVM
+	return true;
 }
 
 
 void ExpressionBase::constCollapse(CatRuntimeContext* context, ExpressionErrorManager* errorManager, void* errorContext)
 {
-	CatTypedExpression* newExpression = static_cast<CatTypedExpression*>(parseResult.getNode<CatTypedExpression>()->constCollapse(context, errorManager, errorContext));
-	if (newExpression != parseResult.astRootNode.get())
+	CatTypedExpression* newExpression = static_cast<CatTypedExpression*>(parseResult->getNode<CatTypedExpression>()->constCollapse(context, errorManager, errorContext));
+	if (newExpression != parseResult->astRootNode.get())
 	{
-		parseResult.astRootNode.reset(newExpression);
+		parseResult->astRootNode.reset(newExpression);
 	}
 	//Const collapse may have changed the expression from a non-constant to a constant.
 	//For example, in an expression like 0.0 * aVariable
-	if (parseResult.success)
+	if (parseResult->success)
 	{
-		isConstant = parseResult.getNode<CatTypedExpression>()->isConst();
+		isConstant = parseResult->getNode<CatTypedExpression>()->isConst();
 	}
 }
 
 
 void ExpressionBase::typeCheck(const CatGenericType& expectedType, CatRuntimeContext* context, ExpressionErrorManager* errorManager, void* errorContext)
 {
-	if (!parseResult.getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext))
+	if (!parseResult->getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext))
 	{
-		parseResult.success = false;
+		parseResult->success = false;
 	}
 	else 
 	{	
 		calculateLiteralStatus();
-		valueType = parseResult.getNode<CatTypedExpression>()->getType();
-		Lexeme expressionLexeme = parseResult.getNode<CatTypedExpression>()->getLexeme();
+		valueType = parseResult->getNode<CatTypedExpression>()->getType();
+		Lexeme expressionLexeme = parseResult->getNode<CatTypedExpression>()->getLexeme();
 		if (!expectedType.isUnknown())
 		{
 			IndirectionConversionMode mode = expectedType.getIndirectionConversion(valueType);
@@ -217,23 +492,23 @@ void ExpressionBase::typeCheck(const CatGenericType& expectedType, CatRuntimeCon
 				if (mode == IndirectionConversionMode::AddressOfPointer
 					|| mode == IndirectionConversionMode::AddressOfValue)
 				{
-					parseResult.success = false;
+					parseResult->success = false;
 					errorManager->compiledWithError(std::string(Tools::append("Expression results in a value with a level of indirection that cannot be automatically converted. Trying to convert from ", valueType.toString(), " to ", expectedType.toString(), ".")), errorContext, context->getContextName(), expressionLexeme);
 					return;
 				}
 				else if (mode != IndirectionConversionMode::None)
 				{
 					//Create an AST node that handles the indirection conversion
-					std::unique_ptr<CatTypedExpression> previousNode(parseResult.releaseNode<CatTypedExpression>());
-					parseResult.astRootNode = std::make_unique<CatIndirectionConversion>(expressionLexeme, expectedType, mode, std::move(previousNode));
-					parseResult.getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
+					std::unique_ptr<CatTypedExpression> previousNode(parseResult->releaseNode<CatTypedExpression>());
+					parseResult->astRootNode = std::make_unique<CatIndirectionConversion>(expressionLexeme, expectedType, mode, std::move(previousNode));
+					parseResult->getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
 					
-					valueType = parseResult.getNode<CatTypedExpression>()->getType();					
+					valueType = parseResult->getNode<CatTypedExpression>()->getType();					
 				}
 			}
 			else if (mode != IndirectionConversionMode::ErrorTypeMismatch)
 			{
-				parseResult.success = false;
+				parseResult->success = false;
 				switch (mode)
 				{
 					case IndirectionConversionMode::ErrorNotCopyConstructible:	errorManager->compiledWithError(std::string(Tools::append("Expression result is not copy constructible.")), errorContext, context->getContextName(), expressionLexeme); return;
@@ -241,9 +516,9 @@ void ExpressionBase::typeCheck(const CatGenericType& expectedType, CatRuntimeCon
 					default: assert(isValidConversionMode(mode)); break;
 				}
 			}
-			if (expectAssignable && !parseResult.getNode<CatAssignableExpression>()->getAssignableType().isAssignableType())
+			if (expectAssignable && !parseResult->getNode<CatAssignableExpression>()->getAssignableType().isAssignableType())
 			{
-				parseResult.success = false;
+				parseResult->success = false;
  				errorManager->compiledWithError(std::string(Tools::append("Expression result is read only. Expected a writable ", expectedType.toString(), ".")), errorContext, context->getContextName(), expressionLexeme);
 			}
 			if (expectedType.isPointerToReflectableObjectType() || expectedType.isReflectableHandleType())
@@ -251,74 +526,74 @@ void ExpressionBase::typeCheck(const CatGenericType& expectedType, CatRuntimeCon
 				const std::string typeName = expectedType.getPointeeType()->getObjectTypeName();
 				if (!valueType.isPointerToReflectableObjectType() && !valueType.isReflectableHandleType())
 				{
-					parseResult.success = false;
+					parseResult->success = false;
 					errorManager->compiledWithError(Tools::append("Expected a ", expectedType.toString(), " got a ", valueType.toString()), errorContext, context->getContextName(), expressionLexeme);
 				}
 				else if (valueType.getPointeeType()->getObjectTypeName() != typeName)
 				{
-					parseResult.success = false;
+					parseResult->success = false;
 					errorManager->compiledWithError(Tools::append("Expected a ", typeName, ", got a ", valueType.getPointeeType()->getObjectTypeName()), errorContext, context->getContextName(), expressionLexeme);
 				}
 			}
 			else if (expectedType.isVoidType() && valueType.isVoidType())
 			{
-				parseResult.success = true;
+				parseResult->success = true;
 			}
 			else if (!expectAssignable && !valueType.compare(expectedType, true, true))
 			{
 				if (expectedType.isVoidType())
 				{
 					//Insert an automatic type conversion to void.
-					CatArgumentList* arguments = new CatArgumentList(expressionLexeme, std::vector<CatTypedExpression*>({parseResult.releaseNode<CatTypedExpression>()}));
+					CatArgumentList* arguments = new CatArgumentList(expressionLexeme, std::vector<CatTypedExpression*>({parseResult->releaseNode<CatTypedExpression>()}));
 
-					parseResult.astRootNode = std::make_unique<CatBuiltInFunctionCall>("toVoid", expressionLexeme, arguments, expressionLexeme);
-					parseResult.getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
+					parseResult->astRootNode = std::make_unique<CatBuiltInFunctionCall>("toVoid", expressionLexeme, arguments, expressionLexeme);
+					parseResult->getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
 					
-					valueType = parseResult.getNode<CatTypedExpression>()->getType();
+					valueType = parseResult->getNode<CatTypedExpression>()->getType();
 				}
 				else if (expectedType.isScalarType() && valueType.isScalarType())
 				{
 					//Insert an automatic type conversion if the scalar types do not match.
-					CatArgumentList* arguments = new CatArgumentList(expressionLexeme, std::vector<CatTypedExpression*>({ parseResult.releaseNode<CatTypedExpression>() }));
+					CatArgumentList* arguments = new CatArgumentList(expressionLexeme, std::vector<CatTypedExpression*>({ parseResult->releaseNode<CatTypedExpression>() }));
 
 					if (expectedType.isFloatType())
 					{
-						parseResult.astRootNode = std::make_unique<CatBuiltInFunctionCall>("toFloat", expressionLexeme, arguments, expressionLexeme);
-						parseResult.getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
+						parseResult->astRootNode = std::make_unique<CatBuiltInFunctionCall>("toFloat", expressionLexeme, arguments, expressionLexeme);
+						parseResult->getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
 					}
 					else if (expectedType.isDoubleType())
 					{
-						parseResult.astRootNode = std::make_unique<CatBuiltInFunctionCall>("toDouble", expressionLexeme, arguments, expressionLexeme);
-						parseResult.getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
+						parseResult->astRootNode = std::make_unique<CatBuiltInFunctionCall>("toDouble", expressionLexeme, arguments, expressionLexeme);
+						parseResult->getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
 					}
 					else if (expectedType.isIntType())
 					{
-						parseResult.astRootNode = std::make_unique<CatBuiltInFunctionCall>("toInt", expressionLexeme, arguments, expressionLexeme);
-						parseResult.getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
+						parseResult->astRootNode = std::make_unique<CatBuiltInFunctionCall>("toInt", expressionLexeme, arguments, expressionLexeme);
+						parseResult->getNode<CatTypedExpression>()->typeCheck(context, errorManager, errorContext);
 					}
 					else
 					{
 						assert(false);	//Missing a conversion here?
 					}
 					
-					valueType = parseResult.getNode<CatTypedExpression>()->getType();
+					valueType = parseResult->getNode<CatTypedExpression>()->getType();
 				}
 				else
 				{
-					parseResult.success = false;
+					parseResult->success = false;
 					errorManager->compiledWithError(std::string(Tools::append("Expected a ", expectedType.toString(), " got a ", valueType.toString(), ".")), errorContext, context->getContextName(), expressionLexeme);
 				}
 			}
 		}
 		else if (expectAssignable && 
-				!parseResult.getNode<CatTypedExpression>()->isAssignable())
+				!parseResult->getNode<CatTypedExpression>()->isAssignable())
 		{
-			parseResult.success = false;
+			parseResult->success = false;
 			errorManager->compiledWithError("Expression result is read only. Expected a writable value.", errorContext, context->getContextName(), expressionLexeme);
 		}
-		if (parseResult.success)
+		if (parseResult->success)
 		{
-			isConstant = parseResult.getNode<CatTypedExpression>()->isConst();
+			isConstant = parseResult->getNode<CatTypedExpression>()->isConst();
 		}
 	}
 }
@@ -326,7 +601,7 @@ void ExpressionBase::typeCheck(const CatGenericType& expectedType, CatRuntimeCon
 
 void ExpressionBase::handleParseErrors(CatRuntimeContext* context)
 {
-	if (!parseResult.success)
+	if (!parseResult->success)
 	{
 		expressionIsLiteral = false;
 		isConstant = false;
@@ -339,82 +614,265 @@ void ExpressionBase::handleParseErrors(CatRuntimeContext* context)
 }
 
 
-void ExpressionBase::compileToNativeCode(CatRuntimeContext* context, const CatGenericType& expectedType)
+uintptr_t ExpressionBase::compileToNativeCode(CatRuntimeContext* context, const CatGenericType& expectedType)
 {
-	if (!isConstant)
+	uintptr_t functionAddress = 0;
+	if (!isConstant && !linkPrecompiledFunction(context, expectedType))
 	{
-		if (JitCat::get()->getHasPrecompiledExpression())
-		{
-			//Can't use precompiled expressions if there is a precompilation context 
-			//because the expression would not be pre-compiled.
-			if (context->getPrecompilationContext() == nullptr)
-			{
-				//Lookup the symbol for the expression by its unique name.
-				uintptr_t symbolAddress = JitCat::get()->getPrecompiledSymbol(ExpressionHelperFunctions::getUniqueExpressionFunctionName(expression, context, expectAssignable, expectedType));
-				if (symbolAddress != 0 || !Configuration::enableLLVM)
-				{
-					//Expressions are expected to handle the case where symbolAddress == 0 and llvm is not available to JIT-compile the function.
-					handleCompiledFunction(symbolAddress);
-					if (symbolAddress != 0 && JitCat::get()->getDiscardASTAfterNativeCodeCompilation())
-					{
-						discardAST();
-					}
-					return;
-				}
-			}
-		}
 #ifdef ENABLE_LLVM
-
-		LLVMCompileTimeContext llvmCompileContext(context, LLVM::LLVMJit::get().getJitTargetConfig(), false);
-		llvmCompileContext.options.enableDereferenceNullChecks = true;
-		intptr_t functionAddress = 0;
 		codeGenerator = context->getCodeGenerator();
-		if (!expectAssignable)
+		functionAddress = generateNativeCode(context, expectedType);
+		if (functionAddress != 0)
 		{
- 			functionAddress = codeGenerator->generateAndGetFunctionAddress(parseResult.getNode<CatTypedExpression>(), expression, expectedType, &llvmCompileContext, expectedType.isValidType());
-			if (context->getPrecompilationContext() != nullptr)
+			handleCompiledFunction(functionAddress);
+			if (getDiscardASTAfterCompilation())
 			{
-				context->getPrecompilationContext()->precompileExpression(parseResult.getNode<CatTypedExpression>(), expression, expectedType, context);
+				discardAST();
 			}
 		}
-		else if (parseResult.getNode<CatTypedExpression>()->isAssignable())
+		else
 		{
-			functionAddress = codeGenerator->generateAndGetAssignFunctionAddress(parseResult.getNode<CatAssignableExpression>(), expression, expectedType, &llvmCompileContext);
-			if (context->getPrecompilationContext() != nullptr)
-			{
-				context->getPrecompilationContext()->precompileAssignmentExpression(parseResult.getNode<CatAssignableExpression>(), expression, expectedType, context);
-			}
+			assert(false);
 		}
-		if (functionAddress != 0)
+#endif //ENABLE_LLVM
+	}
+	return functionAddress;
+}
+
+
+bool ExpressionBase::linkPrecompiledFunction(CatRuntimeContext* context, const CatGenericType& expectedType)
+{
+	if (JitCat::get()->getHasPrecompiledExpression())
+	{
+		//Can't use precompiled expressions if there is a precompilation context 
+		//because the expression would not be pre-compiled.
+		if (context->getPrecompilationContext() == nullptr)
 		{
-			handleCompiledFunction(functionAddress);
-			if (JitCat::get()->getDiscardASTAfterNativeCodeCompilation())
+			//Lookup the symbol for the expression by its unique name.
+			uintptr_t symbolAddress = JitCat::get()->getPrecompiledSymbol(ExpressionHelperFunctions::getUniqueExpressionFunctionName(expression, context, expectAssignable, expectedType, getOptimizationLevel()));
+			if (symbolAddress != 0 || !Configuration::enableLLVM)
 			{
-				discardAST();
+				//Expressions are expected to handle the case where symbolAddress == 0 and llvm is not available to JIT-compile the function.
+				handleCompiledFunction(symbolAddress);
+				if (symbolAddress != 0 && getDiscardASTAfterCompilation())
+				{
+					discardAST();
+				}
+				return true;
 			}
 		}
-		else
+	}
+	return false;
+}
+
+
+#ifdef ENABLE_LLVM
+uintptr_t ExpressionBase::generateNativeCode(CatRuntimeContext* context, const CatGenericType& expectedType)
+{
+	//All code generators share a single LLVMContext, code generation is serialized by its lock.
+	//Parsing and type checking of expressions can still run on multiple threads.
+	llvm::orc::ThreadSafeContext::Lock contextLock = LLVM::LLVMJit::get().getThreadSafeContext().getLock();
+	LLVMCompileTimeContext llvmCompileContext(context, LLVM::LLVMJit::get().getJitTargetConfig(), false);
+	llvmCompileContext.options = getCompileOptions();
+	uintptr_t functionAddress = 0;
+	if (!expectAssignable)
+	{
+ 		functionAddress = codeGenerator->generateAndGetFunctionAddress(parseResult->getNode<CatTypedExpression>(), expression, expectedType, &llvmCompileContext, expectedType.isValidType());
+		if (context->getPrecompilationContext() != nullptr)
 		{
-			assert(false);
+			context->getPrecompilationContext()->precompileExpression(parseResult->getNode<CatTypedExpression>(), expression, expectedType, context);
+		}
+	}
+	else if (parseResult->getNode<CatTypedExpression>()->isAssignable())
+	{
+		functionAddress = codeGenerator->generateAndGetAssignFunctionAddress(parseResult->getNode<CatAssignableExpression>(), expression, expectedType, &llvmCompileContext);
+		if (context->getPrecompilationContext() != nullptr)
+		{
+			context->getPrecompilationContext()->precompileAssignmentExpression(parseResult->getNode<CatAssignableExpression>(), expression, expectedType, context);
 		}
+	}
+	return functionAddress;
+}
+
+
+void ExpressionBase::addToCompileSession(std::shared_ptr<LLVM::LLVMCodeGenerator> sessionCodeGenerator, LLVMCompileTimeContext* llvmCompileContext, const CatGenericType& expectedType)
+{
+	codeGenerator = sessionCodeGenerator;
+	codeGenerator->addToSession(parseResult->getNode<CatTypedExpression>(), expression, expectedType, llvmCompileContext, expectedType.isValidType());
+	CatRuntimeContext* context = llvmCompileContext->catContext;
+	if (context->getPrecompilationContext() != nullptr)
+	{
+		context->getPrecompilationContext()->precompileExpression(parseResult->getNode<CatTypedExpression>(), expression, expectedType, context);
+	}
+}
 #endif //ENABLE_LLVM
+
+
+void ExpressionBase::finishSessionCompilation(uintptr_t functionAddress)
+{
+	compilationPending = false;
+	if (functionAddress == 0)
+	{
+		compileToBytecode();
+	}
+	handleCompiledFunction(functionAddress);
+	if (functionAddress != 0 && getDiscardASTAfterCompilation())
+	{
+		discardAST();
+	}
+}
+
+
+bool ExpressionBase::getDiscardASTAfterCompilation() const
+{
+	return JitCat::get()->getDiscardASTAfterNativeCodeCompilation() && !keepAST;
+}
+
+
+bool ExpressionBase::getSupportsBackgroundCompilation() const
+{
+	return false;
+}
+
+
+void ExpressionBase::handleBackgroundCompilationQueued()
+{
+}
+
+
+bool ExpressionBase::finishBackgroundCompilation()
+{
+	if (!backgroundCompilationFinished.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+	backgroundCompilationFinished.store(false, std::memory_order_relaxed);
+	if (backgroundBytecodeProgram != nullptr)
+	{
+		bytecodeProgram = std::move(backgroundBytecodeProgram);
+	}
+	//If no function was compiled, this selects the bytecode program if there is one, or the tree-walking interpreter.
+	handleCompiledFunction(backgroundFunctionAddress);
+	backgroundFunctionAddress = 0;
+	return true;
+}
+
+
+void ExpressionBase::startBackgroundCompilation(CatRuntimeContext* context, const CatGenericType& expectedType)
+{
+	if (!compilationPending || compileSession != nullptr)
+	{
+		return;
+	}
+	compilationPending = false;
+#ifdef ENABLE_LLVM
+	//The code generator is assigned here so that the background thread only reads it.
+	codeGenerator = context->getCodeGenerator();
+#endif
+	//The background thread does not modify the members that are used to execute the expression. It only writes the results of the compilation,
+	//which are installed by finishBackgroundCompilation on the thread that executes the expression.
+	const bool useBytecode = getUsesBytecode();
+	JitCat::get()->getBackgroundCompiler()->enqueue(this, context, [this, context, expectedType, useBytecode]()
+	{
+#ifdef ENABLE_LLVM
+		(void)useBytecode;
+		backgroundFunctionAddress = generateNativeCode(context, expectedType);
+#else
+		(void)context;
+		if (useBytecode)
+		{
+			backgroundBytecodeProgram = Bytecode::BytecodeCompiler::compile(parseResult->getNode<CatTypedExpression>());
+		}
+#endif
+		backgroundCompilationFinished.store(true, std::memory_order_release);
+	});
+	handleBackgroundCompilationQueued();
+}
+
+
+bool ExpressionBase::getSupportsDeferredCompilation() const
+{
+	return false;
+}
+
+
+bool ExpressionBase::countExecution()
+{
+	JitCat::get()->numColdExecutions++;
+	return ++executionCount >= JitCat::get()->getCompilationThreshold();
+}
+
+
+bool ExpressionBase::compileDeferred(const CatGenericType& expectedType)
+{
+	compileWhenHot = false;
+	//The AST was type checked against the compile context, so the native code is generated using that context as well.
+	CatRuntimeContext* context = getCompileContext();
+	if (context == nullptr)
+	{
+		compilationPending = false;
+		return false;
+	}
+	JitCat::get()->numHotExpressions++;
+	if (JitCat::get()->getBackgroundCompilation() && getSupportsBackgroundCompilation())
+	{
+		startBackgroundCompilation(context, expectedType);
+		return false;
+	}
+	compilationPending = false;
+	compileToBytecode();
+	compileToNativeCode(context, expectedType);
+	return true;
+}
+
+
+void ExpressionBase::cancelDeferredCompilation()
+{
+	compilationPending = false;
+	compileWhenHot = false;
+	executionCount = 0;
+	if (compileSession != nullptr)
+	{
+		compileSession->cancel(this);
 	}
+	JitCat::cancelBackgroundCompilation(this);
+	//The background compiler is no longer running for this expression, a compilation result that has not been installed yet is discarded.
+	backgroundCompilationFinished.store(false, std::memory_order_relaxed);
+	backgroundFunctionAddress = 0;
+	backgroundBytecodeProgram.reset(nullptr);
+}
+
+
+void ExpressionBase::compileToBytecode()
+{
+	if (getUsesBytecode())
+	{
+		bytecodeProgram = Bytecode::BytecodeCompiler::compile(parseResult->getNode<CatTypedExpression>());
+	}
+}
+
+
+bool ExpressionBase::getUsesBytecode() const
+{
+	//The bytecode interpreter is only used when native code is not available.
+	//Assignable expressions are always executed by the tree-walking interpreter.
+	return !Configuration::enableLLVM && !expectAssignable && JitCat::get()->getInterpreterMode() == InterpreterMode::Bytecode;
 }
 
 
 void jitcat::ExpressionBase::calculateLiteralStatus()
 {
 	expressionIsLiteral = false;
-	if (parseResult.success)
+	if (parseResult->success)
 	{
-		if (parseResult.getNode<CatTypedExpression>()->getNodeType() == CatASTNodeType::Literal)
+		if (parseResult->getNode<CatTypedExpression>()->getNodeType() == CatASTNodeType::Literal)
 		{
 			expressionIsLiteral = true;
 		}
-		else if (parseResult.getNode<CatTypedExpression>()->getNodeType() == CatASTNodeType::PrefixOperator)
+		else if (parseResult->getNode<CatTypedExpression>()->getNodeType() == CatASTNodeType::PrefixOperator)
 		{
 			//If the expression is a minus prefix operator combined with a literal, then we need to count the whole expression as a literal.
-			CatPrefixOperator* prefixOp = parseResult.getNode<CatPrefixOperator>();
+			CatPrefixOperator* prefixOp = parseResult->getNode<CatPrefixOperator>();
 			if (prefixOp->getRHS() != nullptr
 				&& prefixOp->getOperator() == CatPrefixOperator::Operator::Minus
 				&& prefixOp->getRHS()->getNodeType() == CatASTNodeType::Literal)
@@ -425,3 +883,44 @@ void jitcat::ExpressionBase::calculateLiteralStatus()
 	}
 }
 
+
+void ExpressionBase::useSharedExpression(const std::shared_ptr<const SharedExpression>& shared, CatRuntimeContext* context)
+{
+	sharedExpression = shared;
+	parseResult = shared->parseResult;
+	valueType = shared->valueType;
+	expressionIsLiteral = shared->expressionIsLiteral;
+	//The AST is accounted to the context of the expression that compiled it.
+	memoryAccount.open(context->getMemoryCounters(), 0);
+	context->getErrorManager()->compiledWithoutErrors(this);
+	if (JitCat::get()->getProfilingEnabled())
+	{
+		profileRecord = JitCat::get()->getProfiler()->getRecord(expectAssignable ? ProfileRecordKind::Assignment : ProfileRecordKind::Expression, 
+																 expression, context->getContextName());
+	}
+	bytecodeProgram.reset(nullptr);
+	compileToBytecode();
+#ifdef ENABLE_LLVM
+	codeGenerator = shared->codeGenerator;
+	handleCompiledFunction(shared->functionAddress);
+#endif //ENABLE_LLVM
+}
+
+
+void ExpressionBase::shareExpression(const SharedExpressionCache::Key& key, uintptr_t functionAddress, std::vector<TypeVersion>&& resolvedTypes)
+{
+	std::shared_ptr<SharedExpression> shared = std::make_shared<SharedExpression>();
+	//The same type is usually looked up in more than once.
+	std::sort(resolvedTypes.begin(), resolvedTypes.end(), [](const TypeVersion& a, const TypeVersion& b){return a.type < b.type;});
+	resolvedTypes.erase(std::unique(resolvedTypes.begin(), resolvedTypes.end(), [](const TypeVersion& a, const TypeVersion& b){return a.type == b.type;}), resolvedTypes.end());
+	shared->resolvedTypes = std::move(resolvedTypes);
+	shared->parseResult = parseResult;
+	shared->valueType = valueType;
+	shared->expressionIsLiteral = expressionIsLiteral;
+	shared->functionAddress = functionAddress;
+#ifdef ENABLE_LLVM
+	shared->codeGenerator = codeGenerator;
+#endif //ENABLE_LLVM
+	JitCat::get()->sharedExpressionCache->add(key, shared);
+	sharedExpression = shared;
+}
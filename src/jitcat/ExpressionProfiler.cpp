@@ -0,0 +1,142 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/ExpressionProfiler.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+using namespace jitcat;
+
+
+ProfileRecord::ProfileRecord(ProfileRecordKind kind, const std::string& name, const std::string& contextName):
+	kind(kind),
+	name(name),
+	contextName(contextName),
+	numCalls(0),
+	totalTime(0)
+{
+}
+
+
+ExpressionProfiler::ExpressionProfiler():
+	recordPruneThreshold(64)
+{
+}
+
+
+ExpressionProfiler::~ExpressionProfiler()
+{
+}
+
+
+std::shared_ptr<ProfileRecord> ExpressionProfiler::getRecord(ProfileRecordKind kind, const std::string& name, const std::string& contextName)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::weak_ptr<ProfileRecord>& record = records[std::make_tuple(kind, name, contextName)];
+	std::shared_ptr<ProfileRecord> existingRecord = record.lock();
+	if (existingRecord != nullptr)
+	{
+		return existingRecord;
+	}
+	std::shared_ptr<ProfileRecord> newRecord = std::make_shared<ProfileRecord>(kind, name, contextName);
+	record = newRecord;
+	//Records of expressions and functions that no longer exist are removed once in a while.
+	if (records.size() >= recordPruneThreshold)
+	{
+		for (auto iter = records.begin(); iter != records.end();)
+		{
+			if (iter->second.expired())
+			{
+				iter = records.erase(iter);
+			}
+			else
+			{
+				++iter;
+			}
+		}
+		recordPruneThreshold = std::max((std::size_t)64, records.size() * 2);
+	}
+	return newRecord;
+}
+
+
+std::vector<ProfileReportEntry> ExpressionProfiler::getReport() const
+{
+	std::vector<ProfileReportEntry> report;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (const auto& iter : records)
+		{
+			std::shared_ptr<const ProfileRecord> record = iter.second.lock();
+			if (record == nullptr)
+			{
+				continue;
+			}
+			uint64_t numCalls = record->numCalls.load(std::memory_order_relaxed);
+			if (numCalls == 0)
+			{
+				continue;
+			}
+			uint64_t totalTime = record->totalTime.load(std::memory_order_relaxed);
+			report.push_back({record->kind, record->name, record->contextName, numCalls, totalTime, (double)totalTime / (double)numCalls});
+		}
+	}
+	std::stable_sort(report.begin(), report.end(), [](const ProfileReportEntry& a, const ProfileReportEntry& b) {return a.totalTime > b.totalTime;});
+	return report;
+}
+
+
+void ExpressionProfiler::writeReport(std::ostream& stream, std::size_t maxEntries) const
+{
+	std::vector<ProfileReportEntry> report = getReport();
+	if (maxEntries != 0 && report.size() > maxEntries)
+	{
+		report.resize(maxEntries);
+	}
+	std::ios_base::fmtflags previousFlags = stream.flags();
+	std::streamsize previousPrecision = stream.precision();
+	stream << std::left << std::setw(12) << "Kind" << std::right << std::setw(14) << "Calls" << std::setw(14) << "Total (ms)" << std::setw(14) << "Average (us)" << "  Context: Name\n";
+	stream << std::fixed << std::setprecision(3);
+	for (const ProfileReportEntry& entry : report)
+	{
+		stream << std::left << std::setw(12) << toString(entry.kind) << std::right
+			   << std::setw(14) << entry.numCalls
+			   << std::setw(14) << (double)entry.totalTime / 1000000.0
+			   << std::setw(14) << entry.averageTime / 1000.0
+			   << "  " << entry.contextName << ": " << entry.name << "\n";
+	}
+	stream.flags(previousFlags);
+	stream.precision(previousPrecision);
+}
+
+
+void ExpressionProfiler::reset()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto& iter : records)
+	{
+		if (std::shared_ptr<ProfileRecord> record = iter.second.lock(); record != nullptr)
+		{
+			record->numCalls.store(0, std::memory_order_relaxed);
+			record->totalTime.store(0, std::memory_order_relaxed);
+		}
+	}
+}
+
+
+const char* ExpressionProfiler::toString(ProfileRecordKind kind)
+{
+	switch (kind)
+	{
+		case ProfileRecordKind::Expression:	return "Expression";
+		case ProfileRecordKind::Assignment:	return "Assignment";
+		case ProfileRecordKind::Function:	return "Function";
+		default:							return "Unknown";
+	}
+}
@@ -15,6 +15,7 @@
 #include "jitcat/ProductionTerminalToken.h"
 #include "jitcat/ProductionTokenSet.h"
 #include "jitcat/SLRParser.h"
+#include "jitcat/SLRParseTables.h"
 #include "jitcat/TokenFlag.h"
 #include <iostream>
 
@@ -64,11 +65,68 @@ ProductionToken* GrammarBase::epsilon()
 std::unique_ptr<Parser::SLRParser> GrammarBase::createSLRParser() const
 {
 	std::unique_ptr<SLRParser> parser(std::make_unique<SLRParser>(this));
-	parser->createNFA();
+	const SLRParseTables* parseTables = getPrecomputedParseTables();
+	if (parseTables == nullptr || !parser->loadParseTables(*parseTables))
+	{
+		if (parseTables != nullptr)
+		{
+			CatLog::log("WARNING: The precomputed parse tables do not match the grammar. Build the JitCatParseTables target to regenerate them.\n");
+		}
+		parser->createNFA();
+	}
 	return parser;
 }
 
 
+const SLRParseTables* GrammarBase::getPrecomputedParseTables() const
+{
+	return nullptr;
+}
+
+
+std::uint64_t GrammarBase::getGrammarHash() const
+{
+	//64 bit FNV-1a. std::hash is not used because its results differ between standard library implementations.
+	std::uint64_t hash = 14695981039346656037ull;
+	auto hashValue = [&hash](std::uint64_t value)
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			hash ^= (value >> (i * 8)) & 0xff;
+			hash *= 1099511628211ull;
+		}
+	};
+	hashValue(rootProduction != nullptr ? rootProduction->getProductionID() : -1);
+	for (const auto& iter : productions)
+	{
+		const Production* production = iter.second;
+		hashValue(production->getProductionID());
+		hashValue(production->getNumRules());
+		for (unsigned int i = 0; i < production->getNumRules(); i++)
+		{
+			const ProductionRule& rule = production->getRule(i);
+			hashValue(rule.getNumTokens());
+			for (unsigned int j = 0; j < rule.getNumTokens(); j++)
+			{
+				const ProductionToken* token = rule.getToken(j);
+				hashValue((std::uint64_t)token->getType());
+				if (token->getType() == ProductionTokenType::Terminal)
+				{
+					const ProductionTerminalToken* terminal = static_cast<const ProductionTerminalToken*>(token);
+					hashValue(terminal->getTokenId());
+					hashValue(terminal->getTokenSubType());
+				}
+				else if (token->getType() == ProductionTokenType::NonTerminal)
+				{
+					hashValue(static_cast<const ProductionNonTerminalToken*>(token)->getProduction()->getProductionID());
+				}
+			}
+		}
+	}
+	return hash;
+}
+
+
 const Tokenizer::TokenizerBase* jitcat::Grammar::GrammarBase::getTokenizer() const
 {
 	return tokenizer;
@@ -11,9 +11,86 @@
 #include "jitcat/ParseHelper.h"
 #include "jitcat/Tools.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+using namespace jitcat;
 using namespace jitcat::Tokenizer;
 
 
+namespace
+{
+	//A perfect hash table of the keywords. The hash seed is chosen when the table is built, such that no two keywords share a slot.
+	//A lookup therefore hashes the identifier and does at most one string comparison.
+	class KeywordTable
+	{
+	public:
+		KeywordTable()
+		{
+			const IdentifierToken identifierToken(0);
+			for (unsigned short type = Tools::enumToUSHort(Identifier::Class); type < Tools::enumToUSHort(Identifier::Last); ++type)
+			{
+				keywords[type] = identifierToken.getSubTypeName(type);
+				maxKeywordLength = std::max(maxKeywordLength, keywords[type].size());
+			}
+			for (seed = 1; !tryBuild(); seed++)
+			{
+			}
+		}
+
+
+		Identifier find(const char* text, std::size_t length) const
+		{
+			if (length > maxKeywordLength)
+			{
+				return Identifier::Identifier;
+			}
+			Identifier type = slots[hash(text, length)];
+			if (type != Identifier::Identifier && keywords[Tools::enumToUSHort(type)] == std::string_view(text, length))
+			{
+				return type;
+			}
+			return Identifier::Identifier;
+		}
+
+	private:
+		bool tryBuild()
+		{
+			slots.fill(Identifier::Identifier);
+			for (unsigned short type = Tools::enumToUSHort(Identifier::Class); type < Tools::enumToUSHort(Identifier::Last); ++type)
+			{
+				Identifier& slot = slots[hash(keywords[type].data(), keywords[type].size())];
+				if (slot != Identifier::Identifier)
+				{
+					return false;
+				}
+				slot = (Identifier)type;
+			}
+			return true;
+		}
+
+
+		std::size_t hash(const char* text, std::size_t length) const
+		{
+			uint32_t value = seed;
+			for (std::size_t i = 0; i < length; i++)
+			{
+				value = (value * 33) ^ (unsigned char)text[i];
+			}
+			return (value ^ (value >> 11)) % numSlots;
+		}
+
+	private:
+		static constexpr std::size_t numSlots = 256;
+		std::array<Identifier, numSlots> slots;
+		std::array<std::string_view, Tools::enumToUSHort(Identifier::Last)> keywords;
+		std::size_t maxKeywordLength = 0;
+		uint32_t seed;
+	};
+}
+
 
 const char* IdentifierToken::getTokenName() const 
 {
@@ -96,16 +173,7 @@ bool IdentifierToken::createIfMatch(Document& document, std::size_t& currentPosi
 	}
 	if (offset > 0)
 	{
-		std::string idName(currentCharacter, offset);
-		Identifier idType = Identifier::Identifier;
-		for (unsigned short type = Tools::enumToUSHort(Identifier::Class); type < Tools::enumToUSHort(Identifier::Last); ++type)
-		{
-			if (idName == getSubTypeName(type))
-			{
-				idType = (Identifier)type;
-			}
-		}
-		document.addToken(currentPosition, offset, id, Tools::enumToUSHort(idType));
+		document.addToken(currentPosition, offset, id, Tools::enumToUSHort(getIdentifierType(currentCharacter, offset)));
 		currentPosition += offset;
 		return true;
 	}
@@ -113,4 +181,11 @@ bool IdentifierToken::createIfMatch(Document& document, std::size_t& currentPosi
 	{
 		return false;
 	}
-}
\ No newline at end of file
+}
+
+
+Identifier IdentifierToken::getIdentifierType(const char* text, std::size_t length)
+{
+	static const KeywordTable keywordTable;
+	return keywordTable.find(text, length);
+}
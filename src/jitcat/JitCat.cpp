@@ -7,27 +7,41 @@
 
 #include "jitcat/JitCat.h"
 
+#include "jitcat/ASTArena.h"
+#include "jitcat/BackgroundCompiler.h"
 #include "jitcat/CatASTNodes.h"
 #include "jitcat/CatGenericType.h"
 #include "jitcat/CatGrammar.h"
 #include "jitcat/CatLog.h"
+#include "jitcat/CatRuntimeContext.h"
 #include "jitcat/CatTokenizer.h"
 #include "jitcat/CommentToken.h"
+#include "jitcat/CompileSession.h"
 #include "jitcat/Configuration.h"
 #include "jitcat/Document.h"
+#include "jitcat/ExpressionBase.h"
 #include "jitcat/IdentifierToken.h"
 #include "jitcat/Lexeme.h"
 #include "jitcat/LLVMCatIntrinsics.h"
 #include "jitcat/OneCharToken.h"
 #include "jitcat/SLRParser.h"
+#include "jitcat/StringConstantPool.h"
+#include "jitcat/SymbolTable.h"
 #include "jitcat/ParseToken.h"
 #include "jitcat/Tools.h"
 #include "jitcat/TypeRegistry.h"
 #include "jitcat/WhitespaceToken.h"
 #ifdef ENABLE_LLVM
+#include "jitcat/LLVMCodeGenerator.h"
 #include "jitcat/LLVMJit.h"
+#include "jitcat/LLVMMemoryManager.h"
+#include "jitcat/LLVMObjectCache.h"
+#include "jitcat/LLVMProfilerSupport.h"
 #endif
+#include <algorithm>
+#include <atomic>
 #include <string>
+#include <thread>
 #include <time.h>
 #include <vector>
 #include <iostream>
@@ -154,7 +168,24 @@ JitCat::JitCat():
 	statementGrammar(std::make_unique<CatGrammar>(tokenizer.get(), CatGrammarType::Statement)),
 	fullGrammar(std::make_unique<CatGrammar>(tokenizer.get(), CatGrammarType::Full)),
 	hasPrecompiledExpressions(false),
-	discardASTAfterNativeCodeCompilation(true)
+	discardASTAfterNativeCodeCompilation(true),
+	interpreterMode(InterpreterMode::TreeWalking),
+	defaultOptimizationLevel(LLVM::LLVMOptimizationLevel::O1),
+	backgroundCompilation(false),
+	compilationThreshold(0),
+	perfMapEnabled(false),
+	gdbJitRegistrationEnabled(false),
+	profilingEnabled(false),
+	profiler(std::make_unique<ExpressionProfiler>()),
+	expressionSharing(false),
+	sharedExpressionCache(std::make_unique<SharedExpressionCache>()),
+	numDeferredExpressions(0),
+	numHotExpressions(0),
+	numColdExecutions(0),
+	numColumnFunctions(0),
+	numVectorizedColumnFunctions(0),
+	numNullChecks(0),
+	numElidedNullChecks(0)
 {
 	expressionParser = expressionGrammar->createSLRParser();
 	statementParser = statementGrammar->createSLRParser();
@@ -226,6 +257,55 @@ std::unique_ptr<Parser::SLRParseResult> JitCat::parseFull(Tokenizer::Document& e
 	tokenizer->tokenize(expression);	
 	return fullParser->parse(expression.getTokens(), CatTokenizer::whiteSpace, CatTokenizer::comment, 
 							 context, errorManager, errorContext);
+}
+
+
+void JitCat::compileAll(const std::vector<std::pair<ExpressionBase*, CatRuntimeContext*>>& expressions, unsigned int threadCount) const
+{
+	//Group the expressions by error manager. Error managers, and the contexts that use them, are not thread safe.
+	std::vector<std::vector<std::size_t>> groups;
+	std::unordered_map<ExpressionErrorManager*, std::size_t> groupIndices;
+	for (std::size_t i = 0; i < expressions.size(); i++)
+	{
+		auto [iter, inserted] = groupIndices.try_emplace(expressions[i].second->getErrorManager(), groups.size());
+		if (inserted)
+		{
+			groups.emplace_back();
+		}
+		groups[iter->second].push_back(i);
+	}
+	if (threadCount == 0)
+	{
+		threadCount = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threadCount = (unsigned int)std::min((std::size_t)threadCount, groups.size());
+
+	std::atomic<std::size_t> nextGroup(0);
+	auto compileGroups = [&]()
+	{
+		for (std::size_t group = nextGroup++; group < groups.size(); group = nextGroup++)
+		{
+			//Native code for the expressions of a group is generated in one module per context when the session is finalized.
+			//Finalizing takes the lock of the LLVMContext that is shared by all code generators, so only one thread at a time generates native code.
+			CompileSession session;
+			for (std::size_t index : groups[group])
+			{
+				expressions[index].first->compile(expressions[index].second);
+			}
+			session.finalize();
+		}
+	};
+	std::vector<std::thread> workers;
+	for (unsigned int i = 1; i < threadCount; i++)
+	{
+		workers.emplace_back(compileGroups);
+	}
+	//The calling thread also compiles expressions.
+	compileGroups();
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
 }
 
 
@@ -349,6 +429,242 @@ bool JitCat::getDiscardASTAfterNativeCodeCompilation() const
 }
 
 
+void JitCat::setInterpreterMode(InterpreterMode mode)
+{
+	interpreterMode = mode;
+}
+
+
+InterpreterMode JitCat::getInterpreterMode() const
+{
+	return interpreterMode;
+}
+
+
+void JitCat::setDefaultOptimizationLevel(LLVM::LLVMOptimizationLevel level)
+{
+	defaultOptimizationLevel = level;
+}
+
+
+LLVM::LLVMOptimizationLevel JitCat::getDefaultOptimizationLevel() const
+{
+	return defaultOptimizationLevel;
+}
+
+
+void JitCat::setBackgroundCompilation(bool enabled)
+{
+	backgroundCompilation = enabled;
+	if (enabled && backgroundCompiler == nullptr)
+	{
+		backgroundCompiler = std::make_unique<BackgroundCompiler>();
+	}
+}
+
+
+bool JitCat::getBackgroundCompilation() const
+{
+	return backgroundCompilation;
+}
+
+
+void JitCat::setCompilationThreshold(unsigned int numExecutions)
+{
+	compilationThreshold = numExecutions;
+}
+
+
+unsigned int JitCat::getCompilationThreshold() const
+{
+	return compilationThreshold;
+}
+
+
+TieringStatistics JitCat::getTieringStatistics() const
+{
+	return {numDeferredExpressions.load(), numHotExpressions.load(), numColdExecutions.load()};
+}
+
+
+void JitCat::resetTieringStatistics()
+{
+	numDeferredExpressions = 0;
+	numHotExpressions = 0;
+	numColdExecutions = 0;
+}
+
+
+void JitCat::setExpressionSharing(bool enabled)
+{
+	expressionSharing = enabled;
+}
+
+
+bool JitCat::getExpressionSharing() const
+{
+	return expressionSharing;
+}
+
+
+ExpressionSharingStatistics JitCat::getExpressionSharingStatistics() const
+{
+	return sharedExpressionCache->getStatistics();
+}
+
+
+void JitCat::resetExpressionSharingStatistics()
+{
+	sharedExpressionCache->resetStatistics();
+}
+
+
+BackgroundCompiler* JitCat::getBackgroundCompiler() const
+{
+	return backgroundCompiler.get();
+}
+
+
+void JitCat::waitForBackgroundCompilation()
+{
+	if (backgroundCompiler != nullptr)
+	{
+		backgroundCompiler->waitUntilIdle();
+	}
+}
+
+
+void JitCat::cancelBackgroundCompilation(const void* expressionOrContext)
+{
+	if (instance != nullptr && instance->backgroundCompiler != nullptr)
+	{
+		instance->backgroundCompiler->cancel(expressionOrContext);
+	}
+}
+
+
+void JitCat::setObjectCacheDirectory(const std::string& directory)
+{
+	objectCacheDirectory = directory;
+#ifdef ENABLE_LLVM
+	LLVMJit::get().getObjectCache()->setDirectory(directory);
+#endif
+}
+
+
+const std::string& JitCat::getObjectCacheDirectory() const
+{
+	return objectCacheDirectory;
+}
+
+
+void JitCat::setPerfMapEnabled(bool enabled)
+{
+	perfMapEnabled = enabled;
+#ifdef ENABLE_LLVM
+	LLVMJit::get().getProfilerSupport()->setPerfMapEnabled(enabled);
+#endif
+}
+
+
+bool JitCat::getPerfMapEnabled() const
+{
+	return perfMapEnabled;
+}
+
+
+void JitCat::setGDBJitRegistrationEnabled(bool enabled)
+{
+	gdbJitRegistrationEnabled = enabled;
+#ifdef ENABLE_LLVM
+	LLVMJit::get().getProfilerSupport()->setGDBRegistrationEnabled(enabled);
+#endif
+}
+
+
+bool JitCat::getGDBJitRegistrationEnabled() const
+{
+	return gdbJitRegistrationEnabled;
+}
+
+
+void JitCat::setProfilingEnabled(bool enabled)
+{
+	profilingEnabled = enabled;
+}
+
+
+bool JitCat::getProfilingEnabled() const
+{
+	return profilingEnabled;
+}
+
+
+ExpressionProfiler* JitCat::getProfiler() const
+{
+	return profiler.get();
+}
+
+
+std::vector<ProfileReportEntry> JitCat::getProfilingReport() const
+{
+	return profiler->getReport();
+}
+
+
+void JitCat::writeProfilingReport(std::ostream& stream, std::size_t maxEntries) const
+{
+	profiler->writeReport(stream, maxEntries);
+}
+
+
+void JitCat::resetProfilingStatistics()
+{
+	profiler->reset();
+}
+
+
+MemoryStatistics JitCat::getMemoryStatistics() const
+{
+	MemoryStatistics statistics;
+#ifdef ENABLE_LLVM
+	LLVMMemoryManager* memoryManager = LLVMCodeGenerator::getMemoryManager();
+	statistics.allocatedCodeMemory = memoryManager->getAllocatedCodeMemory();
+	statistics.reservedCodeMemory = memoryManager->getReservedCodeMemory();
+	statistics.allocatedDataMemory = memoryManager->getAllocatedDataMemory();
+	statistics.reservedDataMemory = memoryManager->getReservedDataMemory();
+#endif
+	statistics.numASTNodes = AST::ASTNode::getNumAllocatedNodes();
+	statistics.astMemory = AST::ASTNode::getAllocatedMemory();
+	statistics.astArenaMemory = AST::ASTArena::getTotalReservedMemory();
+	statistics.numTypeInfos = TypeRegistry::get()->getNumOwnedTypes();
+	statistics.typeInfoMemory = TypeRegistry::get()->getOwnedTypesMemoryUsage();
+	statistics.numPooledStrings = AST::StringConstantPool::getNumStrings();
+	statistics.stringConstantPoolMemory = AST::StringConstantPool::getMemoryUsage();
+	statistics.numSymbols = SymbolTable::getNumSymbols();
+	statistics.symbolTableMemory = SymbolTable::getMemoryUsage();
+	statistics.numCustomObjectObservers = ReflectableHandle::getNumCustomObjectObservers();
+	statistics.customObjectObserverMemory = ReflectableHandle::getCustomObjectObserverMemory();
+	MemoryStatisticsRegistry::collect(statistics);
+	return statistics;
+}
+
+
+CodeGenerationStatistics JitCat::getCodeGenerationStatistics() const
+{
+	return {numColumnFunctions.load(), numVectorizedColumnFunctions.load(), numNullChecks.load(), numElidedNullChecks.load()};
+}
+
+
+void JitCat::resetCodeGenerationStatistics()
+{
+	numColumnFunctions = 0;
+	numVectorizedColumnFunctions = 0;
+	numNullChecks = 0;
+	numElidedNullChecks = 0;
+}
+
+
 void JitCat::expressionEnumerationCallback(const char* name, uintptr_t address)
 {
 	if (name == std::string("default")
@@ -8,6 +8,7 @@
 #include "jitcat/LLVMCatIntrinsics.h"
 #include "jitcat/CatRuntimeContext.h"
 #include "jitcat/Configuration.h"
+#include "jitcat/ExpressionProfiler.h"
 #include "jitcat/Reflectable.h"
 #include "jitcat/ReflectableHandle.h"
 #include "jitcat/Tools.h"
@@ -176,7 +177,19 @@ unsigned char* CatLinkedIntrinsics::_jc_getObjectPointerFromHandle(const Reflect
 void CatLinkedIntrinsics::_jc_assignPointerToReflectableHandle(Reflection::ReflectableHandle& handle, unsigned char* reflectable, TypeInfo* reflectableType)
 {
 	handle.setReflectable(reflectable, reflectableType);
-}
+}
+
+
+uint64_t CatLinkedIntrinsics::_jc_getProfileTime()
+{
+	return ProfileRecord::getTime();
+}
+
+
+void CatLinkedIntrinsics::_jc_addProfiledCall(uint64_t profileRecord, uint64_t startTime)
+{
+	reinterpret_cast<ProfileRecord*>(profileRecord)->addCall(startTime);
+}
 
 
 Configuration::CatString LLVMCatIntrinsics::boolToString(bool boolean)
@@ -13,6 +13,7 @@
 #include "jitcat/CustomTypeMemberFunctionInfo.h"
 #include "jitcat/ErrorContext.h"
 #include "jitcat/ExpressionHelperFunctions.h"
+#include "jitcat/JitCat.h"
 #include "jitcat/LLVMCodeGeneratorHelper.h"
 #include "jitcat/LLVMCompileTimeContext.h"
 #include "jitcat/LLVMCatIntrinsics.h"
@@ -20,15 +21,19 @@
 #include "jitcat/LLVMTargetConfig.h"
 #include "jitcat/LLVMTargetConfigOptions.h"
 #include "jitcat/LLVMMemoryManager.h"
+#include "jitcat/LLVMObjectCache.h"
 #include "jitcat/LLVMPrecompilationContext.h"
 #include "jitcat/LLVMPreGeneratedExpression.h"
+#include "jitcat/LLVMProfilerSupport.h"
 #include "jitcat/LLVMTypes.h"
 #include "jitcat/MemberFunctionInfo.h"
 #include "jitcat/MemberInfo.h"
 #include "jitcat/StaticMemberInfo.h"
 #include "jitcat/StringConstantPool.h"
 
+#include <algorithm>
 #include <functional>
+#include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/ExecutionEngine/Orc/CompileUtils.h>
 #include <llvm/ExecutionEngine/Orc/Core.h>
 #include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
@@ -40,15 +45,22 @@
 #include <llvm/IR/Function.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/PassManager.h>
+#include <llvm/IR/InstIterator.h>
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Value.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetMachine.h>
 #include <llvm/Transforms/InstCombine/InstCombine.h>
+#include <llvm/Transforms/IPO.h>
+#include <llvm/Transforms/IPO/PassManagerBuilder.h>
 #include <llvm/Transforms/Scalar.h>
 #include <llvm/Transforms/Scalar/GVN.h>
 #include <llvm/Transforms/Utils.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+#include <llvm/Transforms/Vectorize.h>
+#include <set>
 
 using namespace jitcat;
 using namespace jitcat::AST;
@@ -90,8 +102,12 @@ LLVMCodeGenerator::LLVMCodeGenerator(const std::string& name, const LLVMTargetCo
 		executionSession = std::make_unique<llvm::orc::ExecutionSession>(LLVMJit::get().getSymbolStringPool());
 		objectLinkLayer = std::make_unique<llvm::orc::RTDyldObjectLinkingLayer>(*executionSession.get(),
 																				[]() {	return memoryManager->createExpressionAllocator();});
+		objectLinkLayer->setNotifyLoaded([](llvm::orc::VModuleKey key, const llvm::object::ObjectFile& object, const llvm::RuntimeDyld::LoadedObjectInfo& loadedObjectInfo)
+			{
+				LLVMJit::get().getProfilerSupport()->notifyObjectLoaded(key, object, loadedObjectInfo);
+			});
 		mangler = std::make_unique<llvm::orc::MangleAndInterner>(*executionSession, targetConfig->getDataLayout());
-		compileLayer = std::make_unique<llvm::orc::IRCompileLayer>(*executionSession.get(), *(objectLinkLayer.get()), std::make_unique<llvm::orc::ConcurrentIRCompiler>(*targetConfig->getTargetMachineBuilder()));
+		compileLayer = std::make_unique<llvm::orc::IRCompileLayer>(*executionSession.get(), *(objectLinkLayer.get()), std::make_unique<llvm::orc::ConcurrentIRCompiler>(*targetConfig->getTargetMachineBuilder(), LLVMJit::get().getObjectCache()));
 		llvm::orc::SymbolMap intrinsicSymbols;
 		runtimeLibraryDyLib = &executionSession->createJITDylib("runtimeLibrary");
 
@@ -173,7 +189,9 @@ LLVMCodeGenerator::LLVMCodeGenerator(const std::string& name, const LLVMTargetCo
 	// Create a new pass manager attached to it.
 	passManager = std::make_unique<llvm::legacy::FunctionPassManager>(currentModule.get());
 
-	createOptimisationPasses(passManager.get());
+	currentModuleOptimizationLevel = JitCat::get()->getDefaultOptimizationLevel();
+	currentModuleEmbedsAddresses = false;
+	createOptimisationPasses(passManager.get(), currentModuleOptimizationLevel);
 
 }
 
@@ -204,6 +222,7 @@ void LLVMCodeGenerator::generate(const AST::CatSourceFile* sourceFile, LLVMCompi
 	context->catContext->removeScope(staticScopeId);
 	if (!context->isPrecompilationContext)
 	{
+		runModuleOptimisationPasses();
 		llvm::cantFail(compileLayer->add(*dylib, llvm::orc::ThreadSafeModule(std::move(currentModule), LLVMJit::get().getThreadSafeContext())));
 		link(sourceFile->getCustomType());
 	}
@@ -248,6 +267,8 @@ llvm::Function* LLVMCodeGenerator::generateExpressionFunction(const CatTypedExpr
 	function->addFnAttr(llvm::Attribute::NoInline);
 	//Now, generate code for the function
 	context->currentFunction = function;
+	callsToInline.clear();
+	context->nonNullValues.clear();
 	
 	//Function entry block
 	llvm::BasicBlock::Create(LLVMJit::get().getContext(), "entry", function);
@@ -260,6 +281,7 @@ llvm::Function* LLVMCodeGenerator::generateExpressionFunction(const CatTypedExpr
 	generateFunctionReturn(expressionType, expressionValue, function, context, generateThisCall);
 
 	context->currentFunction = nullptr;
+	context->nonNullValues.clear();
 
 	//Verify the correctness of the function and execute optimization passes.
 	return verifyAndOptimizeFunction(function);
@@ -297,6 +319,8 @@ llvm::Function* LLVMCodeGenerator::generateExpressionAssignFunction(const CatAss
 
 	//Now, generate code for the function
 	context->currentFunction = function;
+	callsToInline.clear();
+	context->nonNullValues.clear();
 
 	//Function entry block
 	llvm::BasicBlock::Create(LLVMJit::get().getContext(), "entry", function);
@@ -316,13 +340,195 @@ llvm::Function* LLVMCodeGenerator::generateExpressionAssignFunction(const CatAss
 }
 
 
+llvm::Function* LLVMCodeGenerator::createLoopFunction(const std::string& name, const std::vector<llvm::Type*>& parameters)
+{
+	llvm::FunctionType* functionType = llvm::FunctionType::get(targetConfig->getLLVMTypes().voidType, parameters, false);		
+	llvm::Function* function = llvm::Function::Create(functionType, llvm::Function::LinkageTypes::ExternalLinkage, name.c_str(), currentModule.get());
+	function->setCallingConv(targetConfig->getOptions().defaultLLVMCallingConvention);
+	
+	if (targetConfig->getOptions().explicitEnableTailCalls)		function->addFnAttr("disable-tail-calls", "false");
+	if (targetConfig->getOptions().nonLeafFramePointer)			function->addFnAttr("frame-pointer", "non-leaf");
+	if (targetConfig->getOptions().strongStackProtection)		
+	{
+		function->addFnAttr(llvm::Attribute::StackProtectStrong);
+		function->addFnAttr("stack-protector-buffer-size", "8");
+	}
+
+	function->addFnAttr(llvm::Attribute::UWTable);
+	function->addFnAttr(llvm::Attribute::NoInline);
+	return function;
+}
+
+
+llvm::Function* LLVMCodeGenerator::generateExpressionBatchFunction(const CatTypedExpression* expression, CatScopeID batchScopeId, LLVMCompileTimeContext* context, const std::string& name)
+{
+	initContext(context);
+
+	CatGenericType expressionType = expression->getType();
+	assert(expressionType.isBasicType() && !expressionType.isStringValueType());
+	llvm::Type* resultType = helper->toLLVMType(expressionType);
+
+	//Batch functions always have four parameters: a CatRuntimeContext*, a pointer to an array of object pointers, 
+	//the number of objects and a pointer to an array that receives the results. It will always return void.
+	std::vector<llvm::Type*> parameters = {targetConfig->getLLVMTypes().pointerType, targetConfig->getLLVMTypes().pointerType->getPointerTo(), 
+										   targetConfig->getLLVMTypes().longintType, resultType->getPointerTo()};
+	llvm::Function* function = createLoopFunction(name, parameters);
+	//Name the parameters
+	llvm::Argument* argIter = function->arg_begin();
+	argIter->setName("RuntimeContext");
+	llvm::Argument* objectsArgument = ++argIter;
+	objectsArgument->setName("Objects");
+	llvm::Argument* numObjectsArgument = ++argIter;
+	numObjectsArgument->setName("NumObjects");
+	llvm::Argument* resultsArgument = ++argIter;
+	resultsArgument->setName("Results");
+
+	context->currentFunction = function;
+	callsToInline.clear();
+	context->nonNullValues.clear();
+
+	//Function entry block
+	llvm::BasicBlock* entryBlock = llvm::BasicBlock::Create(LLVMJit::get().getContext(), "entry", function);
+	llvm::BasicBlock* loopBlock = llvm::BasicBlock::Create(helper->getContext(), "loopBody", function);
+	llvm::BasicBlock* exitBlock = llvm::BasicBlock::Create(helper->getContext(), "exit");
+	builder->SetInsertPoint(entryBlock);
+	llvm::Value* zero = helper->createConstant((int64_t)0);
+	builder->CreateCondBr(builder->CreateICmpSGT(numObjectsArgument, zero), loopBlock, exitBlock);
+
+	//Loop body, the object pointer for the current index is used as the base address of the batch scope.
+	builder->SetInsertPoint(loopBlock);
+	llvm::PHINode* index = builder->CreatePHI(targetConfig->getLLVMTypes().longintType, 2, "index");
+	index->addIncoming(zero, entryBlock);
+	llvm::Value* objectAddress = builder->CreateGEP(objectsArgument, index, "objectAddress");
+	context->scopeValues[batchScopeId] = builder->CreateLoad(objectAddress, "object");
+
+	llvm::Value* expressionValue = generate(expression, context);
+	builder->CreateStore(expressionValue, builder->CreateGEP(resultsArgument, index, "resultAddress"));
+	//Destruct any heap allocations done by this iteration.
+	helper->generateBlockDestructors(context);
+
+	llvm::Value* nextIndex = builder->CreateAdd(index, helper->createConstant((int64_t)1), "nextIndex");
+	//Code generation of the expression may have added blocks, the back edge originates from the current block.
+	index->addIncoming(nextIndex, builder->GetInsertBlock());
+	builder->CreateCondBr(builder->CreateICmpSLT(nextIndex, numObjectsArgument), loopBlock, exitBlock);
+
+	function->getBasicBlockList().push_back(exitBlock);
+	builder->SetInsertPoint(exitBlock);
+	builder->CreateRetVoid();
+
+	context->scopeValues.erase(batchScopeId);
+	context->currentFunction = nullptr;
+	context->nonNullValues.clear();
+
+	//Verify the correctness of the function and execute optimization passes.
+	return verifyAndOptimizeFunction(function);
+}
+
+
+llvm::Function* LLVMCodeGenerator::generateExpressionColumnFunction(const CatTypedExpression* expression, CatScopeID columnScopeId, 
+																   const std::vector<const TypeMemberInfo*>& columnMembers, 
+																   LLVMCompileTimeContext* context, const std::string& name)
+{
+	initContext(context);
+
+	CatGenericType expressionType = expression->getType();
+	assert(expressionType.isBasicType() && !expressionType.isStringValueType());
+	const LLVMTypes& llvmTypes = targetConfig->getLLVMTypes();
+	llvm::Type* resultType = helper->toLLVMType(expressionType);
+
+	//Column functions always have five parameters: a CatRuntimeContext*, a pointer to an array of column data pointers,
+	//a pointer to an array of column strides, the number of rows and a pointer to an array that receives the results. It will always return void.
+	std::vector<llvm::Type*> parameters = {llvmTypes.pointerType, llvmTypes.pointerType->getPointerTo(), llvmTypes.longintType->getPointerTo(), 
+										   llvmTypes.longintType, resultType->getPointerTo()};
+	llvm::Function* function = createLoopFunction(name, parameters);
+	//The results never overlap with the columns, this allows the vectorizer to omit runtime alias checks.
+	function->addParamAttr(4, llvm::Attribute::NoAlias);
+	//Name the parameters
+	llvm::Argument* argIter = function->arg_begin();
+	argIter->setName("RuntimeContext");
+	llvm::Argument* columnDataArgument = ++argIter;
+	columnDataArgument->setName("ColumnData");
+	llvm::Argument* columnStridesArgument = ++argIter;
+	columnStridesArgument->setName("ColumnStrides");
+	llvm::Argument* numRowsArgument = ++argIter;
+	numRowsArgument->setName("NumRows");
+	llvm::Argument* resultsArgument = ++argIter;
+	resultsArgument->setName("Results");
+
+	context->currentFunction = function;
+	callsToInline.clear();
+	context->nonNullValues.clear();
+	context->columnScopeId = columnScopeId;
+
+	llvm::BasicBlock* entryBlock = llvm::BasicBlock::Create(LLVMJit::get().getContext(), "entry", function);
+	llvm::BasicBlock* loopBlock = llvm::BasicBlock::Create(helper->getContext(), "loopBody", function);
+	llvm::BasicBlock* exitBlock = llvm::BasicBlock::Create(helper->getContext(), "exit");
+	builder->SetInsertPoint(entryBlock);
+
+	//The column pointers and strides are loop invariant and are loaded in the entry block.
+	//Strides are converted from bytes to elements so that the loop vectorizer can version the loop for tightly packed columns.
+	std::vector<llvm::Value*> columnPointers;
+	std::vector<llvm::Value*> columnStrides;
+	for (std::size_t i = 0; i < columnMembers.size(); ++i)
+	{
+		const CatGenericType& columnType = columnMembers[i]->getType();
+		llvm::Value* columnIndex = helper->createConstant((int64_t)i);
+		llvm::Value* columnData = builder->CreateLoad(builder->CreateGEP(columnDataArgument, columnIndex), Tools::append("column_", i));
+		columnPointers.push_back(builder->CreatePointerCast(columnData, helper->toLLVMType(columnType)->getPointerTo()));
+		llvm::Value* byteStride = builder->CreateLoad(builder->CreateGEP(columnStridesArgument, columnIndex), Tools::append("stride_", i));
+		columnStrides.push_back(builder->CreateExactUDiv(byteStride, helper->createConstant((int64_t)columnType.getTypeSize())));
+	}
+	llvm::Value* zero = helper->createConstant((int64_t)0);
+	builder->CreateCondBr(builder->CreateICmpSGT(numRowsArgument, zero), loopBlock, exitBlock);
+
+	builder->SetInsertPoint(loopBlock);
+	llvm::PHINode* index = builder->CreatePHI(llvmTypes.longintType, 2, "index");
+	index->addIncoming(zero, entryBlock);
+	for (std::size_t i = 0; i < columnMembers.size(); ++i)
+	{
+		llvm::Value* valueAddress = builder->CreateGEP(columnPointers[i], builder->CreateMul(index, columnStrides[i]));
+		context->columnValues[columnMembers[i]] = builder->CreateLoad(valueAddress, columnMembers[i]->getMemberName());
+	}
+
+	llvm::Value* expressionValue = generate(expression, context);
+	builder->CreateStore(expressionValue, builder->CreateGEP(resultsArgument, index, "resultAddress"));
+	helper->generateBlockDestructors(context);
+
+	llvm::Value* nextIndex = builder->CreateAdd(index, helper->createConstant((int64_t)1), "nextIndex");
+	index->addIncoming(nextIndex, builder->GetInsertBlock());
+	builder->CreateCondBr(builder->CreateICmpSLT(nextIndex, numRowsArgument), loopBlock, exitBlock);
+
+	function->getBasicBlockList().push_back(exitBlock);
+	builder->SetInsertPoint(exitBlock);
+	builder->CreateRetVoid();
+
+	context->columnValues.clear();
+	context->columnScopeId = InvalidScopeID;
+	context->currentFunction = nullptr;
+	context->nonNullValues.clear();
+
+	if (verifyAndVectorizeFunction(function) == nullptr)
+	{
+		return nullptr;
+	}
+	//No vector math library is made available to the vectorizers, so a loop that calls Sin or Cos can only be vectorized by scalarizing those calls.
+	//Whether the loop was vectorized is recorded in the code generation statistics, see JitCat::getCodeGenerationStatistics.
+	JitCat::get()->numColumnFunctions++;
+	if (std::any_of(llvm::inst_begin(function), llvm::inst_end(function), [](const llvm::Instruction& instruction){return instruction.getType()->isVectorTy();}))
+	{
+		JitCat::get()->numVectorizedColumnFunctions++;
+	}
+	return function;
+}
+
+
 intptr_t LLVMCodeGenerator::generateAndGetFunctionAddress(const CatTypedExpression* expression, const std::string& expressionStr, 
 														  const CatGenericType& expectedType, LLVMCompileTimeContext* context,
 														  bool generateThisCall)
 {
 	initContext(context);
 	createNewModule(context);
-	std::string functionName = ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, context->catContext, false, expectedType);
+	std::string functionName = ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, context->catContext, false, expectedType, context->options.optimizationLevel);
 
 	if (auto lookupResult = executionSession->lookup({dylib}, mangler->operator()(functionName)))
 	{
@@ -335,6 +541,9 @@ intptr_t LLVMCodeGenerator::generateAndGetFunctionAddress(const CatTypedExpressi
 		//To silence unused variable warning in release builds.
 		(void)function;
 		assert(function != nullptr);
+		LLVMJit::get().getProfilerSupport()->setFunctionDescription(functionName, expressionStr);
+		runModuleOptimisationPasses();
+		setModuleCacheKey(functionName);
 		llvm::cantFail(compileLayer->add(*dylib, llvm::orc::ThreadSafeModule(std::move(currentModule), LLVMJit::get().getThreadSafeContext())));
 		return (intptr_t)getSymbolAddress(functionName.c_str(), *dylib);
 	}
@@ -345,7 +554,7 @@ intptr_t LLVMCodeGenerator::generateAndGetAssignFunctionAddress(const CatAssigna
 {
 	initContext(context);
 	createNewModule(context);
-	std::string functionName = ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, context->catContext, true, expectedType);
+	std::string functionName = ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, context->catContext, true, expectedType, context->options.optimizationLevel);
 
 	if (auto lookupResult = executionSession->lookup({dylib}, mangler->operator()(functionName)))
 	{
@@ -358,12 +567,130 @@ intptr_t LLVMCodeGenerator::generateAndGetAssignFunctionAddress(const CatAssigna
 		//To silence unused variable warning in release builds.
 		(void)function;
 		assert(function != nullptr);
+		LLVMJit::get().getProfilerSupport()->setFunctionDescription(functionName, Tools::append(expressionStr, " (assign)"));
+		runModuleOptimisationPasses();
+		setModuleCacheKey(functionName);
 		llvm::cantFail(compileLayer->add(*dylib, llvm::orc::ThreadSafeModule(std::move(currentModule), LLVMJit::get().getThreadSafeContext())));
 		return (intptr_t)getSymbolAddress(functionName.c_str(), *dylib);
 	}
 }
 
 
+void LLVMCodeGenerator::beginSession(LLVMCompileTimeContext* context)
+{
+	initContext(context);
+	createNewModule(context);
+	sessionFunctionNames.clear();
+	sessionGeneratedFunctions.clear();
+}
+
+
+void LLVMCodeGenerator::addToSession(const CatTypedExpression* expression, const std::string& expressionStr, const CatGenericType& expectedType, 
+									 LLVMCompileTimeContext* context, bool generateThisCall)
+{
+	std::string functionName = ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, context->catContext, false, expectedType, context->options.optimizationLevel);
+	sessionFunctionNames.push_back(functionName);
+	//The same expression may be added more than once, or it may already have been compiled before the session.
+	if (sessionGeneratedFunctions.find(functionName) != sessionGeneratedFunctions.end())
+	{
+		return;
+	}
+	if (auto lookupResult = executionSession->lookup({dylib}, mangler->operator()(functionName)))
+	{
+		return;
+	}
+	else
+	{
+		llvm::handleAllErrors(lookupResult.takeError(), [](const llvm::orc::SymbolsNotFound& err){});
+		llvm::Function* function = generateExpressionFunction(expression, context, functionName, generateThisCall);
+		//To silence unused variable warning in release builds.
+		(void)function;
+		assert(function != nullptr);
+		LLVMJit::get().getProfilerSupport()->setFunctionDescription(functionName, expressionStr);
+		sessionGeneratedFunctions.insert(functionName);
+	}
+}
+
+
+std::vector<intptr_t> LLVMCodeGenerator::finalizeSession()
+{
+	if (!sessionGeneratedFunctions.empty())
+	{
+		std::string cacheKeySource;
+		for (const std::string& functionName : sessionGeneratedFunctions)
+		{
+			cacheKeySource.append(functionName);
+		}
+		runModuleOptimisationPasses();
+		setModuleCacheKey(cacheKeySource);
+		llvm::cantFail(compileLayer->add(*dylib, llvm::orc::ThreadSafeModule(std::move(currentModule), LLVMJit::get().getThreadSafeContext())));
+	}
+	currentModule.reset(nullptr);
+	//Resolve all symbols with a single lookup, which materializes the module.
+	//An expression can be added to a session more than once, but each symbol may only be looked up once.
+	std::set<std::string> uniqueFunctionNames(sessionFunctionNames.begin(), sessionFunctionNames.end());
+	llvm::orc::SymbolLookupSet lookupSet;
+	for (const std::string& functionName : uniqueFunctionNames)
+	{
+		lookupSet.add(mangler->operator()(functionName), llvm::orc::SymbolLookupFlags::RequiredSymbol);
+	}
+	llvm::orc::SymbolMap symbols = llvm::cantFail(executionSession->lookup(llvm::orc::makeJITDylibSearchOrder({dylib}), lookupSet));
+	std::vector<intptr_t> functionAddresses;
+	functionAddresses.reserve(sessionFunctionNames.size());
+	for (const std::string& functionName : sessionFunctionNames)
+	{
+		functionAddresses.push_back((intptr_t)symbols[mangler->operator()(functionName)].getAddress());
+	}
+	sessionFunctionNames.clear();
+	sessionGeneratedFunctions.clear();
+	return functionAddresses;
+}
+
+
+intptr_t LLVMCodeGenerator::generateAndGetBatchFunctionAddress(const CatTypedExpression* expression, const std::string& expressionStr, 
+															   const CatGenericType& expectedType, CatScopeID batchScopeId, LLVMCompileTimeContext* context)
+{
+	std::string functionName = Tools::append(ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, context->catContext, false, expectedType, context->options.optimizationLevel), "_batch", batchScopeId);
+	return getOrGenerateLoopFunctionAddress(functionName, Tools::append(expressionStr, " (batch)"), context,
+											[&]() {return generateExpressionBatchFunction(expression, batchScopeId, context, functionName);});
+}
+
+
+intptr_t LLVMCodeGenerator::generateAndGetColumnFunctionAddress(const CatTypedExpression* expression, const std::string& expressionStr, const CatGenericType& expectedType, 
+																CatScopeID columnScopeId, const std::vector<const TypeMemberInfo*>& columnMembers, 
+																LLVMCompileTimeContext* context)
+{
+	//The column members are determined by the expression, so the name of the expression is sufficient to identify the function.
+	std::string functionName = Tools::append(ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, context->catContext, false, expectedType, context->options.optimizationLevel), "_columns", columnScopeId);
+	return getOrGenerateLoopFunctionAddress(functionName, Tools::append(expressionStr, " (columns)"), context,
+											[&]() {return generateExpressionColumnFunction(expression, columnScopeId, columnMembers, context, functionName);});
+}
+
+
+intptr_t LLVMCodeGenerator::getOrGenerateLoopFunctionAddress(const std::string& functionName, const std::string& description, LLVMCompileTimeContext* context, 
+															 const std::function<llvm::Function*()>& generateFunction)
+{
+	initContext(context);
+	createNewModule(context);
+	if (auto lookupResult = executionSession->lookup({dylib}, mangler->operator()(functionName)))
+	{
+		return (intptr_t)lookupResult.get().getAddress();
+	}
+	else
+	{
+		llvm::handleAllErrors(lookupResult.takeError(), [](const llvm::orc::SymbolsNotFound& err){});
+		if (generateFunction() == nullptr)
+		{
+			return 0;
+		}
+		LLVMJit::get().getProfilerSupport()->setFunctionDescription(functionName, description);
+		runModuleOptimisationPasses();
+		llvm::cantFail(compileLayer->add(*dylib, llvm::orc::ThreadSafeModule(std::move(currentModule), LLVMJit::get().getThreadSafeContext())));
+		return (intptr_t)getSymbolAddress(functionName.c_str(), *dylib);
+	}
+}
+
+
 void LLVMCodeGenerator::emitModuleToObjectFile(const std::string& objectFileName)
 {
 	llvm::legacy::PassManager pass;
@@ -977,6 +1304,7 @@ llvm::Value* LLVMCodeGenerator::generate(const CatLiteral* literal, LLVMCompileT
 		if (!context->isPrecompilationContext)
 		{
 			uintptr_t pointerConstant = literalType.getRawPointer(literal->getValue());
+			currentModuleEmbedsAddresses = true;
 			llvm::Value* reflectableAddress = helper->createIntPtrConstant(context, pointerConstant, "literalObjectAddress");
 			return builder->CreateIntToPtr(reflectableAddress, targetConfig->getLLVMTypes().pointerType);
 		}
@@ -1003,10 +1331,27 @@ llvm::Value* LLVMCodeGenerator::generate(const CatLiteral* literal, LLVMCompileT
 
 llvm::Value* LLVMCodeGenerator::generate(const CatMemberAccess* memberAccess, LLVMCompileTimeContext* context)
 {
+	if (context->columnScopeId != InvalidScopeID
+		&& memberAccess->getBase()->getNodeType() == CatASTNodeType::ScopeRoot
+		&& static_cast<const CatScopeRoot*>(memberAccess->getBase())->getScopeId() == context->columnScopeId)
+	{
+		//Generating a column function, the member is loaded from a column.
+		auto iter = context->columnValues.find(memberAccess->getMemberInfo());
+		assert(iter != context->columnValues.end());
+		return iter->second;
+	}
 	llvm::Value* base = generate(memberAccess->getBase(), context);
 	if (base != nullptr)
 	{
-		return memberAccess->getMemberInfo()->generateDereferenceCode(base, context);
+		const TypeMemberInfo* memberInfo = memberAccess->getMemberInfo();
+		//If the base is non-null, there is no null check and the result is the loaded member value.
+		bool resultIsNonNull = memberInfo->getIsTrustedNonNull() && context->isKnownNonNull(base);
+		llvm::Value* result = memberInfo->generateDereferenceCode(base, context);
+		if (resultIsNonNull && result != nullptr)
+		{
+			context->markNonNull(result);
+		}
+		return result;
 	}
 	else
 	{
@@ -1088,6 +1433,10 @@ llvm::Value* LLVMCodeGenerator::generate(const AST::CatStaticMemberAccess* stati
 	llvm::Value* result = staticMemberInfo->generateDereferenceCode(context);
 	if (result != nullptr)
 	{
+		if (staticMemberInfo->trustedNonNull)
+		{
+			context->markNonNull(result);
+		}
 		return result;
 	}
 	else
@@ -1529,11 +1878,18 @@ llvm::Function* LLVMCodeGenerator::generate(const AST::CatFunctionDefinition* fu
 	}
 
 	context->currentFunction = function;
+	callsToInline.clear();
+	context->nonNullValues.clear();
 	//Function entry block
 	llvm::BasicBlock::Create(LLVMJit::get().getContext(), "entry", function);
 	builder->SetInsertPoint(&function->getEntryBlock());
 
 	context->currentFunctionDefinition = functionDefinition;
+	//Profile record addresses are only valid in the current process, so precompiled functions are not profiled.
+	if (functionDefinition->getProfileRecord() != nullptr && !context->isPrecompilationContext)
+	{
+		context->profileStartTime = helper->createIntrinsicCall(context, &CatLinkedIntrinsics::_jc_getProfileTime, {}, "_jc_getProfileTime", true);
+	}
 
 	CatScopeID classScopeId = InvalidScopeID;
 	if (isThisCall)
@@ -1552,6 +1908,8 @@ llvm::Function* LLVMCodeGenerator::generate(const AST::CatFunctionDefinition* fu
 		{
 			context->scopeValues[classScopeId] = function->arg_begin();
 		}
+		//Member functions are only called on non-null objects.
+		context->markNonNull(context->scopeValues[classScopeId]);
 	}
 
 	CatScopeBlock* scopeBlock = functionDefinition->getScopeBlock();
@@ -1581,6 +1939,8 @@ llvm::Function* LLVMCodeGenerator::generate(const AST::CatFunctionDefinition* fu
 	}
 
 	context->currentFunction = nullptr;
+	context->nonNullValues.clear();
+	context->profileStartTime = nullptr;
 
 	context->blockDestructorGenerators.clear();
 
@@ -1717,6 +2077,7 @@ llvm::Value* LLVMCodeGenerator::getBaseAddress(CatScopeID scopeId, LLVMCompileTi
 		else
 		{
 			unsigned char* object = context->catContext->getScopeObject(scopeId);
+			currentModuleEmbedsAddresses = true;
 			parentObjectAddress = llvm::ConstantInt::get(LLVMJit::get().getContext(), llvm::APInt(sizeof(std::uintptr_t) * 8, (uint64_t)reinterpret_cast<std::uintptr_t>(object), false));
 		}
 	}
@@ -1760,18 +2121,29 @@ void LLVMCodeGenerator::initContext(LLVMCompileTimeContext* context)
 void LLVMCodeGenerator::createNewModule(LLVMCompileTimeContext* context)
 {
 	currentModule.reset(new llvm::Module(context->catContext->getContextName(), LLVMJit::get().getContext()));
+	//Calls that were collected by a failed generation point into the discarded module.
+	callsToInline.clear();
 	currentModule->setTargetTriple(targetConfig->getTargetMachine().getTargetTriple().str());
 	currentModule->setDataLayout(targetConfig->getDataLayout());
 
 	// Create a new pass manager attached to it.
 	passManager = std::make_unique<llvm::legacy::FunctionPassManager>(currentModule.get());
 
-	createOptimisationPasses(passManager.get());
+	currentModuleOptimizationLevel = context->options.optimizationLevel;
+	currentModuleEmbedsAddresses = false;
+	createOptimisationPasses(passManager.get(), currentModuleOptimizationLevel);
 }
 
 
 llvm::Function* LLVMCodeGenerator::verifyAndOptimizeFunction(llvm::Function* function)
 {
+	//Inlined before the function passes run, so that they can optimize the inlined code together with the rest of the function.
+	for (llvm::CallInst* call : callsToInline)
+	{
+		llvm::InlineFunctionInfo inlineFunctionInfo;
+		llvm::InlineFunction(call, inlineFunctionInfo);
+	}
+	callsToInline.clear();
 	if (!llvm::verifyFunction(*function, &llvm::outs()))
 	{
 		passManager->run(*function);
@@ -1793,6 +2165,30 @@ llvm::Function* LLVMCodeGenerator::verifyAndOptimizeFunction(llvm::Function* fun
 }
 
 
+llvm::Function* LLVMCodeGenerator::verifyAndVectorizeFunction(llvm::Function* function)
+{
+	if (verifyAndOptimizeFunction(function) == nullptr)
+	{
+		return nullptr;
+	}
+	//The vectorizers need target information to determine the vector width.
+	llvm::legacy::FunctionPassManager vectorizePassManager(currentModule.get());
+	vectorizePassManager.add(llvm::createTargetTransformInfoWrapperPass(targetConfig->getTargetMachine().getTargetIRAnalysis()));
+	vectorizePassManager.add(llvm::createLoopVectorizePass());
+	vectorizePassManager.add(llvm::createSLPVectorizerPass());
+	vectorizePassManager.add(llvm::createInstructionCombiningPass());
+	vectorizePassManager.add(llvm::createCFGSimplificationPass());
+	vectorizePassManager.doInitialization();
+	vectorizePassManager.run(*function);
+	vectorizePassManager.doFinalization();
+	if constexpr (Configuration::dumpFunctionIR)
+	{
+		function->dump();
+	}
+	return function;
+}
+
+
 uint64_t LLVMCodeGenerator::getSymbolAddress(const std::string& name, llvm::orc::JITDylib& dyLib) const
 {
 	return llvm::cantFail(executionSession->lookup({&dyLib}, mangler->operator()(name))).getAddress();
@@ -1907,6 +2303,12 @@ llvm::Function* LLVMCodeGenerator::generateFunctionPrototype(const std::string&
 void LLVMCodeGenerator::generateFunctionReturn(const CatGenericType& returnType, llvm::Value* expressionValue, llvm::Function* function, 
 											   LLVMCompileTimeContext* context, bool hasThisArgument)
 {
+	if (context->profileStartTime != nullptr)
+	{
+		currentModuleEmbedsAddresses = true;
+		llvm::Value* profileRecordAddress = helper->createConstant((uint64_t)reinterpret_cast<uintptr_t>(context->currentFunctionDefinition->getProfileRecord()));
+		helper->createIntrinsicCall(context, &CatLinkedIntrinsics::_jc_addProfiledCall, {profileRecordAddress, context->profileStartTime}, "_jc_addProfiledCall", true);
+	}
 	//If the expression returns a string or a reflectable object, copy construct it into the StructRet parameter and return void.
 	//If it is some other type, just return the value.
 	if (returnType.isReflectableObjectType())
@@ -1955,10 +2357,13 @@ void LLVMCodeGenerator::link(CustomTypeInfo* customType)
 	}
 	for (auto& iter : customType->getMemberFunctions())
 	{
-		if (!iter.second->isDeferredFunctionCall())
+		for (auto& memberFunction : iter.second)
 		{
-			const std::string& mangledName = static_cast<CustomTypeMemberFunctionInfo*>(iter.second.get())->getFunctionDefinition()->getMangledFunctionName(targetConfig->sretBeforeThis);
-			static_cast<CustomTypeMemberFunctionInfo*>(iter.second.get())->setFunctionNativeAddress((intptr_t)getSymbolAddress(mangledName, *dylib));
+			if (!memberFunction->isDeferredFunctionCall())
+			{
+				const std::string& mangledName = static_cast<CustomTypeMemberFunctionInfo*>(memberFunction.get())->getFunctionDefinition()->getMangledFunctionName(targetConfig->sretBeforeThis);
+				static_cast<CustomTypeMemberFunctionInfo*>(memberFunction.get())->setFunctionNativeAddress((intptr_t)getSymbolAddress(mangledName, *dylib));
+			}
 		}
 	}
 }
@@ -1982,21 +2387,63 @@ llvm::Value* LLVMCodeGenerator::booleanCast(llvm::Value* boolean)
 }
 
 
-void LLVMCodeGenerator::createOptimisationPasses(llvm::legacy::FunctionPassManager* passManager)
-{
-	// Do simple "peephole" and bit-twiddling optimizations.
-	passManager->add(llvm::createInstructionCombiningPass());
-	// Reassociate expressions.
-	passManager->add(llvm::createReassociatePass());
-	// Eliminate Common SubExpressions.
-	passManager->add(llvm::createGVNPass());
-	// Simplify the control flow graph (deleting unreachable blocks, etc).
-	passManager->add(llvm::createCFGSimplificationPass());
+void LLVMCodeGenerator::createOptimisationPasses(llvm::legacy::FunctionPassManager* passManager, LLVMOptimizationLevel optimizationLevel)
+{
+	if (optimizationLevel != LLVMOptimizationLevel::O0)
+	{
+		// Do simple "peephole" and bit-twiddling optimizations.
+		passManager->add(llvm::createInstructionCombiningPass());
+		// Reassociate expressions.
+		passManager->add(llvm::createReassociatePass());
+		// Eliminate Common SubExpressions.
+		passManager->add(llvm::createGVNPass());
+		// Simplify the control flow graph (deleting unreachable blocks, etc).
+		passManager->add(llvm::createCFGSimplificationPass());
+	}
 	// Move some alloca's to registers
 	passManager->add(llvm::createPromoteMemoryToRegisterPass());
 
 	//Initialize the passManager
-	passManager->doInitialization();
+	passManager->doInitialization();
+}
+
+
+void LLVMCodeGenerator::runModuleOptimisationPasses()
+{
+	//At O0 and O1 only the function passes are run, see createOptimisationPasses.
+	if (currentModuleOptimizationLevel != LLVMOptimizationLevel::O2 && currentModuleOptimizationLevel != LLVMOptimizationLevel::O3)
+	{
+		return;
+	}
+	const unsigned int optimizationLevel = currentModuleOptimizationLevel == LLVMOptimizationLevel::O3 ? 3 : 2;
+	//The standard pipeline includes inlining, LICM and loop unrolling. Vectorization is enabled explicitly, as clang does.
+	llvm::PassManagerBuilder passManagerBuilder;
+	passManagerBuilder.OptLevel = optimizationLevel;
+	passManagerBuilder.SizeLevel = 0;
+	passManagerBuilder.Inliner = llvm::createFunctionInliningPass(optimizationLevel, 0, false);
+	passManagerBuilder.LoopVectorize = true;
+	passManagerBuilder.SLPVectorize = true;
+	targetConfig->getTargetMachine().adjustPassManager(passManagerBuilder);
+
+	llvm::legacy::PassManager modulePassManager;
+	modulePassManager.add(llvm::createTargetTransformInfoWrapperPass(targetConfig->getTargetMachine().getTargetIRAnalysis()));
+	passManagerBuilder.populateModulePassManager(modulePassManager);
+	modulePassManager.run(*currentModule);
+}
+
+
+void LLVMCodeGenerator::setModuleCacheKey(const std::string& keySource)
+{
+	if (!currentModuleEmbedsAddresses)
+	{
+		LLVMJit::get().getObjectCache()->setCacheKey(currentModule.get(), keySource, currentModuleOptimizationLevel, targetConfig);
+	}
+}
+
+
+LLVMMemoryManager* LLVMCodeGenerator::getMemoryManager()
+{
+	return memoryManager.get();
 }
 
 
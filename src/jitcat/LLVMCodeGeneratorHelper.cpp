@@ -12,6 +12,7 @@
 #include "jitcat/CatTypedExpression.h"
 #include "jitcat/Configuration.h"
 #include "jitcat/CustomTypeInfo.h"
+#include "jitcat/JitCat.h"
 #include "jitcat/LLVMCodeGenerator.h"
 #include "jitcat/LLVMCompileTimeContext.h"
 #include "jitcat/LLVMJit.h"
@@ -23,6 +24,7 @@
 #include "jitcat/TypeInfo.h"
 
 #include <cassert>
+#include <set>
 
 #include <llvm/IR/Constant.h>
 #include <llvm/IR/Constants.h>
@@ -35,6 +37,9 @@
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Value.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Transforms/Scalar.h>
 #include <llvm/Transforms/Scalar/GVN.h>
@@ -144,6 +149,13 @@ llvm::Value* LLVMCodeGeneratorHelper::createNullCheckSelect(llvm::Value* valueTo
 
 llvm::Value* LLVMCodeGeneratorHelper::createNullCheckSelect(llvm::Value* valueToCheck, std::function<llvm::Value* (LLVMCompileTimeContext*)> codeGenIfNotNull, std::function<llvm::Value* (LLVMCompileTimeContext*)> codeGenIfNull, LLVMCompileTimeContext* context)
 {
+	if (context->isKnownNonNull(valueToCheck))
+	{
+		//For example a static scope, the this pointer, or a pointer that has already been checked by an enclosing null check.
+		JitCat::get()->numElidedNullChecks++;
+		return codeGenIfNotNull(context);
+	}
+	JitCat::get()->numNullChecks++;
 	auto builder = codeGenerator->getBuilder();
 	llvm::Value* isNotNull = nullptr;
 	if (valueToCheck->getType() != llvmTypes.boolType)
@@ -172,7 +184,12 @@ llvm::Value* LLVMCodeGeneratorHelper::createNullCheckSelect(llvm::Value* valueTo
 	branchInst->setMetadata(llvm::LLVMContext::MD_prof, branchPredictNode);
 
 	builder->SetInsertPoint(thenBlock);
+	//Within the then block, valueToCheck is known to be non-null, so nested checks on the same value are omitted.
+	//Values that are marked non-null within the then block, including valueToCheck, are not known to be non-null after it.
+	std::set<const llvm::Value*> nonNullValues = context->nonNullValues;
+	context->markNonNull(valueToCheck);
 	llvm::Value* thenResult = codeGenIfNotNull(context);
+	context->nonNullValues = std::move(nonNullValues);
 	builder->CreateBr(continuationBlock);
 	thenBlock = builder->GetInsertBlock();
 
@@ -957,11 +974,50 @@ llvm::Value* LLVMCodeGeneratorHelper::createOffsetGlobalValue(LLVMCompileTimeCon
 }
 
 
+llvm::Value* LLVMCodeGeneratorHelper::createMemberAddress(LLVMCompileTimeContext* context, llvm::Value* objectPointer, const std::string& offsetGlobalName, std::uintptr_t offset, const std::string& name)
+{
+	if (!context->isPrecompilationContext)
+	{
+		llvm::Value* objectBytePointer = convertToPointer(objectPointer, Tools::append(name, "_Parent_Ptr"));
+		return getBuilder()->CreateConstInBoundsGEP1_64(objectBytePointer, offset, name);
+	}
+	else
+	{
+		llvm::Value* memberOffset = createOffsetGlobalValue(context, offsetGlobalName, offset);
+		llvm::Value* objectPointerInt = convertToIntPtr(objectPointer, Tools::append(name, "_Parent_IntPtr"));
+		llvm::Value* addressValue = createAdd(objectPointerInt, memberOffset, Tools::append(name, "_IntPtr"));
+		return convertToPointer(addressValue, name);
+	}
+}
+
+
+llvm::Value* LLVMCodeGeneratorHelper::createEmbeddedMemberAddress(LLVMCompileTimeContext* context, llvm::Value* objectPointer, const std::string& offsetGlobalName, std::uintptr_t offset, const std::string& name)
+{
+	llvm::Value* memberAddress = createMemberAddress(context, objectPointer, offsetGlobalName, offset, name);
+	if (context->isKnownNonNull(objectPointer))
+	{
+		//An object that is embedded in a non-null object is also non-null.
+		JitCat::get()->numElidedNullChecks++;
+		context->markNonNull(memberAddress);
+		return memberAddress;
+	}
+	else if (!context->options.enableDereferenceNullChecks)
+	{
+		return memberAddress;
+	}
+	JitCat::get()->numNullChecks++;
+	llvm::Value* objectBytePointer = convertToPointer(objectPointer, Tools::append(name, "_Parent_Ptr"));
+	llvm::Value* isNull = getBuilder()->CreateIsNull(objectBytePointer, Tools::append(name, "_ParentIsNull"));
+	return getBuilder()->CreateSelect(isNull, createNullPtrConstant(llvmTypes.pointerType), memberAddress, Tools::append(name, "_OrNull"));
+}
+
+
 llvm::Value* LLVMCodeGeneratorHelper::createTypeInfoGlobalValue(LLVMCompileTimeContext* context, Reflection::TypeInfo* typeInfo)
 {
 	std::string constantName = Tools::append("_TypeInfo:", typeInfo->getTypeName());
 	if (!context->isPrecompilationContext)
 	{
+		codeGenerator->currentModuleEmbedsAddresses = true;
 		llvm::Constant* typeInfoConstant = createIntPtrConstant(context, reinterpret_cast<uintptr_t>(typeInfo), constantName);
 		return convertToPointer(typeInfoConstant, Tools::append(constantName, "_Ptr"));
 	}
@@ -1121,6 +1177,7 @@ llvm::GlobalVariable* LLVMCodeGeneratorHelper::createGlobalPointerSymbol(const s
 llvm::Value* LLVMCodeGeneratorHelper::createPtrConstant(LLVMCompileTimeContext* context, unsigned long long address, const std::string& name, llvm::PointerType* pointerType)
 {
 	assert(!context->isPrecompilationContext && "Pointer constants are not allowed during precompilation.");
+	codeGenerator->currentModuleEmbedsAddresses = true;
 	llvm::Constant* constant = createIntPtrConstant(context, address, Tools::append(name, "_IntPtr"));
 	return convertToPointer(constant, Tools::append(name, "_Ptr"), pointerType); 
 }
@@ -1348,6 +1405,24 @@ llvm::Value* LLVMCodeGeneratorHelper::generateMemberFunctionCall(Reflection::Mem
 
 	auto notNullCodeGen = [&](LLVMCompileTimeContext* compileContext)
 	{
+		const MemberFunctionInfo* bodyFunction = memberFunction;
+		if (memberFunction->isDeferredFunctionCall())
+		{
+			bodyFunction = static_cast<DeferredMemberFunctionInfo*>(memberFunction)->getDeferredFunction();
+		}
+		if (bodyFunction->hasInlineBody() && !returnType.isReflectableObjectType())
+		{
+			std::vector<llvm::Value*> inlineArguments = argumentList;
+			if (callData.callType == MemberFunctionCallType::ThisCallThroughStaticFunction)
+			{
+				//The inline body does not take the MemberFunctionInfo argument.
+				inlineArguments.erase(inlineArguments.begin() + 1);
+			}
+			if (llvm::Value* inlinedResult = generateInlinedMemberFunctionCall(bodyFunction, inlineArguments, context); inlinedResult != nullptr)
+			{
+				return inlinedResult;
+			}
+		}
 		if (callData.callType != MemberFunctionCallType::InlineFunctionGenerator)
 		{
 			if (!callData.linkDylib)
@@ -1510,6 +1585,96 @@ void LLVMCodeGeneratorHelper::generateLoop(LLVMCompileTimeContext* context,
 }
 
 
+llvm::Value* LLVMCodeGeneratorHelper::generateInlinedMemberFunctionCall(const Reflection::MemberFunctionInfo* memberFunction, const std::vector<llvm::Value*>& arguments, LLVMCompileTimeContext* context)
+{
+	llvm::Function* body = linkInlineFunctionBody(memberFunction);
+	if (body == nullptr || body->arg_size() != arguments.size())
+	{
+		return nullptr;
+	}
+	//Pointers may be of a different type, for example because the body was generated by clang from the C++ class, any other type must match.
+	auto isCompatible = [](llvm::Type* type, llvm::Type* expectedType)
+	{
+		return type == expectedType || (type->isPointerTy() && expectedType->isPointerTy());
+	};
+	llvm::Type* returnLLVMType = toLLVMType(memberFunction->getReturnType());
+	if (!isCompatible(body->getReturnType(), returnLLVMType))
+	{
+		return nullptr;
+	}
+	for (std::size_t i = 0; i < arguments.size(); i++)
+	{
+		if (!isCompatible(arguments[i]->getType(), body->getFunctionType()->getParamType((unsigned int)i)))
+		{
+			return nullptr;
+		}
+	}
+	auto builder = codeGenerator->getBuilder();
+	std::vector<llvm::Value*> castArguments;
+	for (std::size_t i = 0; i < arguments.size(); i++)
+	{
+		castArguments.push_back(builder->CreatePointerBitCastOrAddrSpaceCast(arguments[i], body->getFunctionType()->getParamType((unsigned int)i)));
+	}
+	llvm::CallInst* call = builder->CreateCall(body, castArguments);
+	codeGenerator->callsToInline.push_back(call);
+	if (call->getType() != returnLLVMType)
+	{
+		return builder->CreatePointerCast(call, returnLLVMType, memberFunction->getMemberFunctionName());
+	}
+	if (!call->getType()->isVoidTy())
+	{
+		call->setName(memberFunction->getMemberFunctionName());
+	}
+	return call;
+}
+
+
+llvm::Function* LLVMCodeGeneratorHelper::linkInlineFunctionBody(const Reflection::MemberFunctionInfo* memberFunction)
+{
+	llvm::Module* currentModule = codeGenerator->getCurrentModule();
+	const std::string& functionName = memberFunction->getInlineBodyFunctionName();
+	if (llvm::Function* existingFunction = currentModule->getFunction(functionName); existingFunction != nullptr)
+	{
+		//Either the body was linked by an earlier call, or the name is used by something else.
+		return existingFunction->isDeclaration() ? nullptr : existingFunction;
+	}
+	llvm::SMDiagnostic diagnostic;
+	//parseIR accepts both textual IR and bitcode.
+	std::unique_ptr<llvm::Module> bodyModule = llvm::parseIR(llvm::MemoryBufferRef(memberFunction->getInlineBody(), functionName), diagnostic, llvmContext);
+	if (bodyModule == nullptr)
+	{
+		LLVMJit::logError("ERROR: Failed to parse the inline body of ", memberFunction->getMemberFunctionName(), ": ", diagnostic.getMessage().str());
+		return nullptr;
+	}
+	llvm::Function* bodyFunction = bodyModule->getFunction(functionName);
+	if (bodyFunction == nullptr || bodyFunction->isDeclaration())
+	{
+		LLVMJit::logError("ERROR: The inline body of ", memberFunction->getMemberFunctionName(), " does not define ", functionName);
+		return nullptr;
+	}
+	bodyModule->setDataLayout(currentModule->getDataLayout());
+	bodyModule->setTargetTriple(currentModule->getTargetTriple());
+	//Declare the function, so that only the function and whatever it references is linked.
+	llvm::Function::Create(bodyFunction->getFunctionType(), llvm::Function::LinkageTypes::ExternalLinkage, functionName, currentModule);
+	if (llvm::Linker::linkModules(*currentModule, std::move(bodyModule), llvm::Linker::Flags::LinkOnlyNeeded))
+	{
+		LLVMJit::logError("ERROR: Failed to link the inline body of ", memberFunction->getMemberFunctionName());
+		return nullptr;
+	}
+	llvm::Function* linkedFunction = currentModule->getFunction(functionName);
+	if (linkedFunction == nullptr || linkedFunction->isDeclaration())
+	{
+		return nullptr;
+	}
+	//Internal linkage, so that the body does not conflict with the same body in other modules.
+	linkedFunction->setLinkage(llvm::GlobalValue::InternalLinkage);
+	linkedFunction->removeFnAttr(llvm::Attribute::NoInline);
+	linkedFunction->removeFnAttr(llvm::Attribute::OptimizeNone);
+	linkedFunction->addFnAttr(llvm::Attribute::AlwaysInline);
+	return linkedFunction;
+}
+
+
 void LLVMCodeGeneratorHelper::defineWeakSymbol(LLVMCompileTimeContext* context, intptr_t functionAddress, const std::string& mangledFunctionName, bool isDirectlyLinked)
 {
 	if (!context->isPrecompilationContext)
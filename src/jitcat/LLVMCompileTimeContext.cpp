@@ -6,6 +6,12 @@
 */
 
 #include "jitcat/LLVMCompileTimeContext.h"
+#include "jitcat/JitCat.h"
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Operator.h>
 
 using namespace jitcat;
 using namespace jitcat::LLVM;
@@ -18,9 +24,12 @@ LLVMCompileTimeContext::LLVMCompileTimeContext(CatRuntimeContext* catContext, co
 	currentClass(nullptr),
 	currentFunctionDefinition(nullptr),
 	currentFunction(nullptr),
+	profileStartTime(nullptr),
 	currentScope(nullptr),
-	helper(nullptr)
+	helper(nullptr),
+	columnScopeId(InvalidScopeID)
 {
+	options.optimizationLevel = JitCat::get()->getDefaultOptimizationLevel();
 }
 
 
@@ -32,7 +41,52 @@ void LLVMCompileTimeContext::clearState()
 	currentScope = nullptr;
 	currentFunctionDefinition = nullptr;
 	currentFunction = nullptr;
+	profileStartTime = nullptr;
 	helper = nullptr;
 	blockDestructorGenerators.clear();
 	scopeValues.clear();
-}
+	nonNullValues.clear();
+	columnScopeId = InvalidScopeID;
+	columnValues.clear();
+}
+
+
+bool LLVMCompileTimeContext::isKnownNonNull(const llvm::Value* value) const
+{
+	while (value != nullptr)
+	{
+		if (nonNullValues.find(value) != nonNullValues.end())
+		{
+			return true;
+		}
+		else if (const llvm::Constant* constant = llvm::dyn_cast<llvm::Constant>(value); constant != nullptr
+				 && !llvm::isa<llvm::GlobalValue>(constant) && !llvm::isa<llvm::ConstantExpr>(constant))
+		{
+			return !constant->isNullValue();
+		}
+		else if (const llvm::LoadInst* load = llvm::dyn_cast<llvm::LoadInst>(value); load != nullptr
+				 && load->getMetadata(llvm::LLVMContext::MD_nonnull) != nullptr)
+		{
+			return true;
+		}
+		else if (const llvm::Operator* castOperator = llvm::dyn_cast<llvm::Operator>(value); castOperator != nullptr
+				 && (castOperator->getOpcode() == llvm::Instruction::BitCast
+					 || castOperator->getOpcode() == llvm::Instruction::PtrToInt
+					 || castOperator->getOpcode() == llvm::Instruction::IntToPtr))
+		{
+			value = castOperator->getOperand(0);
+		}
+		else
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+
+void LLVMCompileTimeContext::markNonNull(const llvm::Value* value)
+{
+	nonNullValues.insert(value);
+}
+
@@ -7,7 +7,9 @@
 
 #include "jitcat/LLVMJit.h"
 #include "jitcat/Configuration.h"
+#include "jitcat/LLVMObjectCache.h"
 #include "jitcat/LLVMPrecompilationContext.h"
+#include "jitcat/LLVMProfilerSupport.h"
 #include "jitcat/LLVMTypes.h"
 #include "jitcat/LLVMTargetConfig.h"
 #include "jitcat/Tools.h"
@@ -21,7 +23,9 @@ using namespace jitcat::LLVM;
 
 LLVMJit::LLVMJit():
 	context(std::make_unique<llvm::orc::ThreadSafeContext>(std::make_unique<llvm::LLVMContext>())),
-	symbolStringPool(std::make_shared<llvm::orc::SymbolStringPool>())
+	symbolStringPool(std::make_shared<llvm::orc::SymbolStringPool>()),
+	objectCache(std::make_unique<LLVMObjectCache>()),
+	profilerSupport(std::make_unique<LLVMProfilerSupport>())
 {
 }
 
@@ -67,6 +71,18 @@ const LLVMTargetConfig* LLVMJit::getJitTargetConfig() const
 }
 
 
+LLVMObjectCache* LLVMJit::getObjectCache() const
+{
+	return objectCache.get();
+}
+
+
+LLVMProfilerSupport* LLVMJit::getProfilerSupport() const
+{
+	return profilerSupport.get();
+}
+
+
 void LLVM::LLVMJit::cleanup()
 {
 	context.reset(nullptr);
@@ -143,18 +143,21 @@ std::unique_ptr<LLVMExpressionMemoryAllocator> LLVMMemoryManager::createExpressi
 
 SectionMemoryAllocation* LLVMMemoryManager::allocateCodeSection(uintptr_t size, unsigned int alignment, LLVMExpressionMemoryAllocator* allocator)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	return alloccateFromSection(size, alignment, allocator, SectionPurpose::Code, codeSectionBlocks, freedCodeSectionAllocations);
 }
 
 
 SectionMemoryAllocation* jitcat::LLVM::LLVMMemoryManager::allocateDataSection(uintptr_t size, unsigned int alignment, LLVMExpressionMemoryAllocator* allocator)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	return alloccateFromSection(size, alignment, allocator, SectionPurpose::Data, dataSectionBlocks, freedDataSectionAllocations);
 }
 
 
 void jitcat::LLVM::LLVMMemoryManager::finalizeSection(SectionMemoryAllocation* allocation)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	allocation->status = SectionMemoryAllocationStatus::Finalized;
 	updateBlockPermissions(allocation->block);
 }
@@ -162,6 +165,7 @@ void jitcat::LLVM::LLVMMemoryManager::finalizeSection(SectionMemoryAllocation* a
 
 void LLVMMemoryManager::freeCodeSection(SectionMemoryAllocation* allocation)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	allocation->status = SectionMemoryAllocationStatus::Freed;
 	auto iter = freedCodeSectionAllocations.find(allocation->alignment);
 	if (iter != freedCodeSectionAllocations.end())
@@ -178,6 +182,7 @@ void LLVMMemoryManager::freeCodeSection(SectionMemoryAllocation* allocation)
 
 void jitcat::LLVM::LLVMMemoryManager::freeDataSection(SectionMemoryAllocation* allocation)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	allocation->status = SectionMemoryAllocationStatus::Freed;
 	auto iter = freedDataSectionAllocations.find(allocation->alignment);
 	if (iter != freedDataSectionAllocations.end())
@@ -194,6 +199,7 @@ void jitcat::LLVM::LLVMMemoryManager::freeDataSection(SectionMemoryAllocation* a
 
 std::size_t jitcat::LLVM::LLVMMemoryManager::getAllocatedCodeMemory()
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	std::size_t total = 0;
 	for (auto& iter : codeSectionBlocks)
 	{
@@ -208,6 +214,7 @@ std::size_t jitcat::LLVM::LLVMMemoryManager::getAllocatedCodeMemory()
 
 std::size_t jitcat::LLVM::LLVMMemoryManager::getReservedCodeMemory()
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	std::size_t total = 0;
 	for (auto& iter : codeSectionBlocks)
 	{
@@ -217,6 +224,33 @@ std::size_t jitcat::LLVM::LLVMMemoryManager::getReservedCodeMemory()
 }
 
 
+std::size_t jitcat::LLVM::LLVMMemoryManager::getAllocatedDataMemory()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::size_t total = 0;
+	for (auto& iter : dataSectionBlocks)
+	{
+		for (auto& iter2 : iter->allocations)
+		{
+			total += iter2->size;
+		}
+	}
+	return total;
+}
+
+
+std::size_t jitcat::LLVM::LLVMMemoryManager::getReservedDataMemory()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::size_t total = 0;
+	for (auto& iter : dataSectionBlocks)
+	{
+		total += iter->blockSize;
+	}
+	return total;
+}
+
+
 void jitcat::LLVM::LLVMMemoryManager::updateBlockPermissions(SectionMemoryBlock* block)
 {
 	bool allFinalizedOrFree = true;
@@ -0,0 +1,201 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/LLVMObjectCache.h"
+#include "jitcat/Configuration.h"
+#include "jitcat/LLVMTargetConfig.h"
+#include "jitcat/Tools.h"
+
+#include <llvm/Config/llvm-config.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetMachine.h>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+
+
+namespace
+{
+	//Module identifiers that start with this prefix are followed by the name of the object file in the cache directory.
+	const std::string cacheModulePrefix = "jitcat_object_cache:";
+
+	//Computes an FNV-1a hash of everything that is written to it, so that a module can be hashed without storing its printed IR.
+	//Unlike std::hash, the hash is the same in every run and in every build of the program.
+	class HashingStream: public llvm::raw_ostream
+	{
+	public:
+		HashingStream():
+			hash(14695981039346656037ull),
+			size(0)
+		{
+		}
+
+		virtual ~HashingStream() override
+		{
+			flush();
+		}
+
+		std::size_t getHash()
+		{
+			flush();
+			return (std::size_t)hash;
+		}
+
+	private:
+		virtual void write_impl(const char* data, std::size_t dataSize) override final
+		{
+			for (std::size_t i = 0; i < dataSize; i++)
+			{
+				hash = (hash ^ (unsigned char)data[i]) * 1099511628211ull;
+			}
+			size += dataSize;
+		}
+
+		virtual uint64_t current_pos() const override final
+		{
+			return size;
+		}
+
+	private:
+		uint64_t hash;
+		uint64_t size;
+	};
+}
+
+
+LLVMObjectCache::LLVMObjectCache():
+	numLoadedObjects(0),
+	numStoredObjects(0)
+{
+}
+
+
+LLVMObjectCache::~LLVMObjectCache()
+{
+}
+
+
+void LLVMObjectCache::setDirectory(const std::string& directory_)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	directory = directory_;
+	if (!directory.empty())
+	{
+		llvm::sys::fs::create_directories(directory);
+	}
+}
+
+
+std::string LLVMObjectCache::getDirectory() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return directory;
+}
+
+
+void LLVMObjectCache::setCacheKey(llvm::Module* module, const std::string& keySource, LLVMOptimizationLevel optimizationLevel, const LLVMTargetConfig* targetConfig) const
+{
+	if (getDirectory().empty())
+	{
+		return;
+	}
+	//The key names a file that is read by later runs of the program, so it must be hashed the same way in every run.
+	//The parts of the key are separated by a null character.
+	const llvm::TargetMachine& targetMachine = targetConfig->getTargetMachine();
+	HashingStream keyStream;
+	keyStream << keySource << '\0' << (int)optimizationLevel << '\0' << targetMachine.getTargetTriple().str() << '\0' << targetMachine.getTargetCPU() << '\0'
+			  << targetMachine.getTargetFeatureString() << '\0' << LLVM_VERSION_STRING << '\0' << Configuration::jitcatABIVersion;
+	std::size_t keyHash = keyStream.getHash();
+
+	HashingStream irStream;
+	module->print(irStream, nullptr);
+	std::size_t irHash = irStream.getHash();
+
+	module->setModuleIdentifier(Tools::append(cacheModulePrefix, Tools::toHexBytes(keyHash), "_", Tools::toHexBytes(irHash), ".o"));
+}
+
+
+std::size_t LLVMObjectCache::getNumLoadedObjects() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return numLoadedObjects;
+}
+
+
+std::size_t LLVMObjectCache::getNumStoredObjects() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return numStoredObjects;
+}
+
+
+void LLVMObjectCache::notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef object)
+{
+	std::string filePath = getObjectFilePath(module);
+	if (filePath.empty())
+	{
+		return;
+	}
+	//Write to a temporary file first so that another process never reads a partially written object.
+	std::string temporaryPath = Tools::append(filePath, ".tmp", llvm::sys::Process::getProcessId());
+	{
+		std::error_code errorCode;
+		llvm::raw_fd_ostream objectFile(temporaryPath, errorCode, llvm::sys::fs::OF_None);
+		if (errorCode)
+		{
+			return;
+		}
+		objectFile.write(object.getBufferStart(), object.getBufferSize());
+	}
+	if (llvm::sys::fs::rename(temporaryPath, filePath))
+	{
+		llvm::sys::fs::remove(temporaryPath);
+		return;
+	}
+	std::lock_guard<std::mutex> lock(mutex);
+	numStoredObjects++;
+}
+
+
+std::unique_ptr<llvm::MemoryBuffer> LLVMObjectCache::getObject(const llvm::Module* module)
+{
+	std::string filePath = getObjectFilePath(module);
+	if (filePath.empty())
+	{
+		return nullptr;
+	}
+	llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> objectFile = llvm::MemoryBuffer::getFile(filePath, -1, false);
+	if (!objectFile)
+	{
+		return nullptr;
+	}
+	std::lock_guard<std::mutex> lock(mutex);
+	numLoadedObjects++;
+	return std::move(objectFile.get());
+}
+
+
+std::string LLVMObjectCache::getObjectFilePath(const llvm::Module* module) const
+{
+	const std::string& moduleIdentifier = module->getModuleIdentifier();
+	if (moduleIdentifier.compare(0, cacheModulePrefix.size(), cacheModulePrefix) != 0)
+	{
+		return "";
+	}
+	std::string cacheDirectory = getDirectory();
+	if (cacheDirectory.empty())
+	{
+		return "";
+	}
+	llvm::SmallString<256> filePath(cacheDirectory);
+	llvm::sys::path::append(filePath, moduleIdentifier.substr(cacheModulePrefix.size()));
+	return filePath.str().str();
+}
@@ -82,7 +82,7 @@ void LLVMPrecompilationContext::precompileExpression(const CatTypedExpression* e
 		currentTarget->compileContext->clearState();
 		currentTarget->compileContext->catContext = context;
 		context->setCodeGenerator(currentTarget->codeGenerator);
-		const std::string expressionName = ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, currentTarget->compileContext->catContext, false, expectedType);
+		const std::string expressionName = ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, currentTarget->compileContext->catContext, false, expectedType, currentTarget->compileContext->options.optimizationLevel);
 		if (currentTarget->compiledExpressionFunctions.find(expressionName) == currentTarget->compiledExpressionFunctions.end())
 		{
 			llvm::Function* function = currentTarget->codeGenerator->generateExpressionFunction(expression, currentTarget->compileContext.get(), expressionName, expectedType.isValidType());
@@ -102,7 +102,7 @@ void LLVMPrecompilationContext::precompileAssignmentExpression(const CatAssignab
 		currentTarget->compileContext->clearState();
 		currentTarget->compileContext->catContext = context;
 		context->setCodeGenerator(currentTarget->codeGenerator);
-		const std::string expressionName = ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, iter->compileContext->catContext, true, expectedType);
+		const std::string expressionName = ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionStr, iter->compileContext->catContext, true, expectedType, iter->compileContext->options.optimizationLevel);
 		if (iter->compiledExpressionFunctions.find(expressionName) == iter->compiledExpressionFunctions.end())
 		{
 			llvm::Function* function = iter->codeGenerator->generateExpressionAssignFunction(expression, iter->compileContext.get(), expressionName);
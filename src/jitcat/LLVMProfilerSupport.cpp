@@ -0,0 +1,155 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/LLVMProfilerSupport.h"
+#include "jitcat/Tools.h"
+
+#include <llvm/Object/SymbolSize.h>
+#include <llvm/Support/Process.h>
+
+#include <algorithm>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+
+
+LLVMProfilerSupport::LLVMProfilerSupport():
+	perfMapEnabled(false),
+	gdbRegistrationEnabled(false),
+	perfMapFile(nullptr),
+	gdbListener(nullptr)
+{
+}
+
+
+LLVMProfilerSupport::~LLVMProfilerSupport()
+{
+	if (perfMapFile != nullptr)
+	{
+		fclose(perfMapFile);
+	}
+}
+
+
+void LLVMProfilerSupport::setPerfMapEnabled(bool enabled)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	perfMapEnabled = enabled;
+	if (!enabled)
+	{
+		functionDescriptions.clear();
+	}
+}
+
+
+bool LLVMProfilerSupport::getPerfMapEnabled() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return perfMapEnabled;
+}
+
+
+void LLVMProfilerSupport::setGDBRegistrationEnabled(bool enabled)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	gdbRegistrationEnabled = enabled;
+	if (enabled && gdbListener == nullptr)
+	{
+		gdbListener = llvm::JITEventListener::createGDBRegistrationListener();
+	}
+}
+
+
+bool LLVMProfilerSupport::getGDBRegistrationEnabled() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return gdbRegistrationEnabled;
+}
+
+
+void LLVMProfilerSupport::setFunctionDescription(const std::string& functionName, const std::string& description)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (perfMapEnabled)
+	{
+		//Each perf map entry must be on a single line.
+		std::string singleLineDescription = description;
+		std::replace(singleLineDescription.begin(), singleLineDescription.end(), '\n', ' ');
+		std::replace(singleLineDescription.begin(), singleLineDescription.end(), '\r', ' ');
+		functionDescriptions[functionName] = singleLineDescription;
+	}
+}
+
+
+void LLVMProfilerSupport::notifyObjectLoaded(llvm::orc::VModuleKey key, const llvm::object::ObjectFile& object, const llvm::RuntimeDyld::LoadedObjectInfo& loadedObjectInfo)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (gdbRegistrationEnabled)
+	{
+		gdbListener->notifyObjectLoaded(key, object, loadedObjectInfo);
+	}
+	if (perfMapEnabled)
+	{
+		//The debug object has its sections relocated to the addresses at which they were loaded.
+		llvm::object::OwningBinary<llvm::object::ObjectFile> debugObject = loadedObjectInfo.getObjectForDebug(object);
+		if (debugObject.getBinary() != nullptr)
+		{
+			writePerfMapEntries(*debugObject.getBinary());
+		}
+	}
+}
+
+
+void LLVMProfilerSupport::writePerfMapEntries(const llvm::object::ObjectFile& debugObject)
+{
+	if (perfMapFile == nullptr)
+	{
+		std::string perfMapPath = Tools::append("/tmp/perf-", llvm::sys::Process::getProcessId(), ".map");
+		perfMapFile = fopen(perfMapPath.c_str(), "a");
+		if (perfMapFile == nullptr)
+		{
+			return;
+		}
+	}
+	for (const std::pair<llvm::object::SymbolRef, uint64_t>& symbolAndSize : llvm::object::computeSymbolSizes(debugObject))
+	{
+		const llvm::object::SymbolRef& symbol = symbolAndSize.first;
+		llvm::Expected<llvm::object::SymbolRef::Type> symbolType = symbol.getType();
+		if (!symbolType)
+		{
+			llvm::consumeError(symbolType.takeError());
+			continue;
+		}
+		if (*symbolType != llvm::object::SymbolRef::ST_Function)
+		{
+			continue;
+		}
+		llvm::Expected<llvm::StringRef> symbolName = symbol.getName();
+		llvm::Expected<uint64_t> symbolAddress = symbol.getAddress();
+		if (!symbolName || !symbolAddress)
+		{
+			llvm::consumeError(symbolName.takeError());
+			llvm::consumeError(symbolAddress.takeError());
+			continue;
+		}
+		std::string name = symbolName->str();
+		auto iter = functionDescriptions.find(name);
+		//Some targets prefix global symbols with an underscore.
+		if (iter == functionDescriptions.end() && !name.empty() && name[0] == '_')
+		{
+			iter = functionDescriptions.find(name.substr(1));
+		}
+		const std::string& description = iter != functionDescriptions.end() ? iter->second : name;
+		fprintf(perfMapFile, "%llx %llx jitcat:%s\n", (unsigned long long)*symbolAddress, (unsigned long long)symbolAndSize.second, description.c_str());
+		if (iter != functionDescriptions.end())
+		{
+			functionDescriptions.erase(iter);
+		}
+	}
+	//Flush immediately so that the map is complete when perf reads it, even if the process is killed.
+	fflush(perfMapFile);
+}
@@ -112,6 +112,31 @@ void MemberFunctionInfo::addParameterType(const CatGenericType& type)
 }
 
 
+void MemberFunctionInfo::setInlineBody(const std::string& llvmIROrBitcode, const std::string& functionName)
+{
+	inlineBody = llvmIROrBitcode;
+	inlineBodyFunctionName = functionName;
+}
+
+
+bool MemberFunctionInfo::hasInlineBody() const
+{
+	return !inlineBody.empty() && !inlineBodyFunctionName.empty();
+}
+
+
+const std::string& MemberFunctionInfo::getInlineBody() const
+{
+	return inlineBody;
+}
+
+
+const std::string& MemberFunctionInfo::getInlineBodyFunctionName() const
+{
+	return inlineBodyFunctionName;
+}
+
+
 DeferredMemberFunctionInfo::DeferredMemberFunctionInfo(TypeMemberInfo* baseMember, TypeInfo* baseType, const MemberFunctionInfo* deferredFunction):
 	MemberFunctionInfo(deferredFunction->getMemberFunctionName(), deferredFunction->getReturnType()),
 	baseType(baseType),
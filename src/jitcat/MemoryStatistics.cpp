@@ -0,0 +1,224 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/MemoryStatistics.h"
+#include "jitcat/CatLib.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+using namespace jitcat;
+
+
+std::size_t MemoryStatistics::getTotalMemory() const
+{
+	std::size_t total = reservedCodeMemory + reservedDataMemory + astMemory + typeInfoMemory + stringConstantPoolMemory + symbolTableMemory + customObjectObserverMemory;
+	for (const CatLibMemoryStatistics& catLib : catLibs)
+	{
+		total += catLib.typeInfoMemory;
+	}
+	return total;
+}
+
+
+void MemoryStatistics::write(std::ostream& stream) const
+{
+	stream << "JIT code memory:           " << allocatedCodeMemory << " bytes allocated, " << reservedCodeMemory << " bytes reserved\n";
+	stream << "JIT data memory:           " << allocatedDataMemory << " bytes allocated, " << reservedDataMemory << " bytes reserved\n";
+	stream << "AST memory:                " << astMemory << " bytes in " << numASTNodes << " nodes\n";
+	stream << "AST arena memory:          " << astArenaMemory << " bytes reserved\n";
+	stream << "Type info memory:          " << typeInfoMemory << " bytes in " << numTypeInfos << " types\n";
+	stream << "String constant pool:      " << stringConstantPoolMemory << " bytes in " << numPooledStrings << " strings\n";
+	stream << "Symbol table:              " << symbolTableMemory << " bytes in " << numSymbols << " symbols\n";
+	stream << "Custom object observers:   " << customObjectObserverMemory << " bytes for " << numCustomObjectObservers << " objects\n";
+	stream << "Total:                     " << getTotalMemory() << " bytes\n";
+	if (!catLibs.empty())
+	{
+		stream << "\nCatLib                         Sources     AST bytes   Types   Type info bytes\n";
+		for (const CatLibMemoryStatistics& catLib : catLibs)
+		{
+			stream << std::left << std::setw(30) << catLib.libName << std::right
+				   << std::setw(9) << catLib.numSourceFiles
+				   << std::setw(14) << catLib.astMemory
+				   << std::setw(8) << catLib.numTypes
+				   << std::setw(18) << catLib.typeInfoMemory << "\n";
+		}
+	}
+	if (!contexts.empty())
+	{
+		stream << "\nContext                        Expressions   Retained ASTs   AST bytes\n";
+		for (const ContextMemoryStatistics& context : contexts)
+		{
+			stream << std::left << std::setw(30) << (context.contextExists ? context.contextName : context.contextName + " (destroyed)") << std::right
+				   << std::setw(13) << context.numExpressions
+				   << std::setw(16) << context.numRetainedASTs
+				   << std::setw(12) << context.astMemory << "\n";
+		}
+	}
+}
+
+
+std::string MemoryStatistics::toString() const
+{
+	std::stringstream stream;
+	write(stream);
+	return stream.str();
+}
+
+
+ContextMemoryCounters::ContextMemoryCounters(const std::string& contextName):
+	contextName(contextName),
+	contextExists(true),
+	numExpressions(0),
+	numRetainedASTs(0),
+	astMemory(0)
+{
+}
+
+
+void ContextMemoryCounters::setContextDestroyed()
+{
+	contextExists = false;
+}
+
+
+ContextMemoryStatistics ContextMemoryCounters::getStatistics() const
+{
+	ContextMemoryStatistics statistics;
+	statistics.contextName = contextName;
+	statistics.contextExists = contextExists;
+	statistics.numExpressions = numExpressions;
+	statistics.numRetainedASTs = numRetainedASTs;
+	statistics.astMemory = astMemory;
+	return statistics;
+}
+
+
+ExpressionMemoryAccount::ExpressionMemoryAccount():
+	astMemory(0),
+	hasAST(false)
+{
+}
+
+
+ExpressionMemoryAccount::~ExpressionMemoryAccount()
+{
+	close();
+}
+
+
+void ExpressionMemoryAccount::open(std::shared_ptr<ContextMemoryCounters> counters_, std::size_t astMemory_)
+{
+	close();
+	counters = std::move(counters_);
+	if (counters != nullptr)
+	{
+		astMemory = astMemory_;
+		hasAST = true;
+		counters->numExpressions++;
+		counters->numRetainedASTs++;
+		counters->astMemory += astMemory;
+	}
+}
+
+
+void ExpressionMemoryAccount::releaseAST()
+{
+	if (counters != nullptr && hasAST)
+	{
+		counters->numRetainedASTs--;
+		counters->astMemory -= astMemory;
+		astMemory = 0;
+		hasAST = false;
+	}
+}
+
+
+void ExpressionMemoryAccount::close()
+{
+	if (counters != nullptr)
+	{
+		releaseAST();
+		counters->numExpressions--;
+		counters = nullptr;
+	}
+}
+
+
+bool ExpressionMemoryAccount::getContextExists() const
+{
+	return counters != nullptr && counters->contextExists;
+}
+
+
+void MemoryStatisticsRegistry::registerContext(std::weak_ptr<ContextMemoryCounters> counters)
+{
+	Registry& registry = getRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	//Counters that are no longer referenced by a context or an expression are removed once in a while.
+	if (registry.contexts.size() >= registry.contextPruneThreshold)
+	{
+		registry.contexts.erase(std::remove_if(registry.contexts.begin(), registry.contexts.end(), [](const std::weak_ptr<ContextMemoryCounters>& context) {return context.expired();}), registry.contexts.end());
+		registry.contextPruneThreshold = std::max((std::size_t)64, registry.contexts.size() * 2);
+	}
+	registry.contexts.push_back(std::move(counters));
+}
+
+
+void MemoryStatisticsRegistry::registerCatLib(const CatLib* catLib)
+{
+	Registry& registry = getRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.catLibs.push_back(catLib);
+}
+
+
+void MemoryStatisticsRegistry::unregisterCatLib(const CatLib* catLib)
+{
+	Registry& registry = getRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.catLibs.erase(std::remove(registry.catLibs.begin(), registry.catLibs.end(), catLib), registry.catLibs.end());
+}
+
+
+void MemoryStatisticsRegistry::collect(MemoryStatistics& statistics)
+{
+	Registry& registry = getRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	for (const std::weak_ptr<ContextMemoryCounters>& context : registry.contexts)
+	{
+		if (std::shared_ptr<ContextMemoryCounters> counters = context.lock(); counters != nullptr)
+		{
+			statistics.contexts.push_back(counters->getStatistics());
+		}
+	}
+	for (const CatLib* catLib : registry.catLibs)
+	{
+		statistics.catLibs.push_back(catLib->getMemoryStatistics());
+	}
+}
+
+
+MemoryStatisticsRegistry::Registry& MemoryStatisticsRegistry::getRegistry()
+{
+	static Registry* registry = new Registry();
+	return *registry;
+}
+
+
+std::size_t MemoryEstimation::getStringMemory(const std::string& string)
+{
+	const char* data = string.data();
+	const char* stringObject = reinterpret_cast<const char*>(&string);
+	if (data >= stringObject && data < stringObject + sizeof(std::string))
+	{
+		return 0;
+	}
+	return string.capacity() + 1;
+}
@@ -99,32 +99,7 @@ bool OneCharToken::createIfMatch(Document& document, std::size_t& currentPositio
 	const char* currentCharacter = &document.getDocumentData()[currentPosition];
 	if (remainingLength > 0)
 	{
-		OneChar type = OneChar::Unknown;
-		switch (currentCharacter[0])
-		{
-			case '{':	type = OneChar::BraceOpen;			break;
-			case '}':	type = OneChar::BraceClose;			break;
-			case '(':	type = OneChar::ParenthesesOpen;	break;
-			case ')':	type = OneChar::ParenthesesClose;	break;
-			case '[':	type = OneChar::BracketOpen;		break;
-			case ']':	type = OneChar::BracketClose;		break;
-			case '=':	type = OneChar::Assignment;			break;
-			case '+':	type = OneChar::Plus;				break;
-			case '*':	type = OneChar::Times;				break;
-			case '/':	type = OneChar::Divide;				break;
-			case '-':	type = OneChar::Minus;				break;
-			case '%':	type = OneChar::Modulo;				break;
-			case '<':	type = OneChar::Smaller;			break;
-			case '>':	type = OneChar::Greater;			break;
-			case ',':	type = OneChar::Comma;				break;
-			case ';':	type = OneChar::Semicolon;			break;
-			case '&':	type = OneChar::BitwiseAnd;			break;
-			case '|':	type = OneChar::BitwiseOr;			break;
-			case '^':	type = OneChar::BitwiseXor;			break;
-			case '!':	type = OneChar::Not;				break;
-			case '.':	type = OneChar::Dot;				break;
-			case '@':	type = OneChar::At;					break;
-		}
+		OneChar type = getOneCharType(currentCharacter[0]);
 		if (type != OneChar::Unknown)
 		{
 			document.addToken(currentPosition, 1, id, Tools::enumToUSHort(type));
@@ -133,4 +108,35 @@ bool OneCharToken::createIfMatch(Document& document, std::size_t& currentPositio
 		}
 	}
 	return false;
-}
\ No newline at end of file
+}
+
+
+OneChar OneCharToken::getOneCharType(char character)
+{
+	switch (character)
+	{
+		case '{':	return OneChar::BraceOpen;
+		case '}':	return OneChar::BraceClose;
+		case '(':	return OneChar::ParenthesesOpen;
+		case ')':	return OneChar::ParenthesesClose;
+		case '[':	return OneChar::BracketOpen;
+		case ']':	return OneChar::BracketClose;
+		case '=':	return OneChar::Assignment;
+		case '+':	return OneChar::Plus;
+		case '*':	return OneChar::Times;
+		case '/':	return OneChar::Divide;
+		case '-':	return OneChar::Minus;
+		case '%':	return OneChar::Modulo;
+		case '<':	return OneChar::Smaller;
+		case '>':	return OneChar::Greater;
+		case ',':	return OneChar::Comma;
+		case ';':	return OneChar::Semicolon;
+		case '&':	return OneChar::BitwiseAnd;
+		case '|':	return OneChar::BitwiseOr;
+		case '^':	return OneChar::BitwiseXor;
+		case '!':	return OneChar::Not;
+		case '.':	return OneChar::Dot;
+		case '@':	return OneChar::At;
+		default:	return OneChar::Unknown;
+	}
+}
@@ -8,6 +8,7 @@
 #include "jitcat/ReflectableHandle.h"
 #include "jitcat/Configuration.h"
 #include "jitcat/CustomTypeInfo.h"
+#include "jitcat/MemoryStatistics.h"
 #include "jitcat/Reflectable.h"
 #include "jitcat/TypeCaster.h"
 #include "jitcat/TypeInfo.h"
@@ -92,6 +93,13 @@ void ReflectableHandle::setReflectable(unsigned char* other, TypeInfo* reflectab
 }
 
 
+void ReflectableHandle::setUntrackedReflectable(unsigned char* other)
+{
+	assert(nextHandle == nullptr && previousHandle == nullptr);
+	reflectable = other;
+}
+
+
 ReflectableHandle& jitcat::Reflection::ReflectableHandle::operator=(std::nullptr_t other)
 {
 	assert(other == nullptr);
@@ -152,6 +160,18 @@ void ReflectableHandle::nullifyObjectHandles(unsigned char* object, CustomTypeIn
 }
 
 
+std::size_t ReflectableHandle::getNumCustomObjectObservers()
+{
+	return customObjectObservers->size();
+}
+
+
+std::size_t ReflectableHandle::getCustomObjectObserverMemory()
+{
+	return MemoryEstimation::getHashMemory(*customObjectObservers);
+}
+
+
 TypeInfo* jitcat::Reflection::ReflectableHandle::getObjectType() const
 {
 	return reflectableType;
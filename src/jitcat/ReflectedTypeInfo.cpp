@@ -6,6 +6,11 @@
 */
 
 #include "jitcat/ReflectedTypeInfo.h"
+#include "jitcat/MemberFunctionInfo.h"
+#include "jitcat/Tools.h"
+
+#include <cassert>
+#include <iterator>
 
 using namespace jitcat;
 using namespace jitcat::Reflection;
@@ -135,6 +140,19 @@ ReflectedTypeInfo& ReflectedTypeInfo::setTypeSize(std::size_t newSize)
 }
 
 
+ReflectedTypeInfo& ReflectedTypeInfo::setInlineFunctionBody(const std::string& identifier, const std::string& llvmIROrBitcode, const std::string& functionName)
+{
+	auto iter = memberFunctions.find(SymbolTable::find(identifier));
+	assert(iter != memberFunctions.end());
+	if (iter != memberFunctions.end())
+	{
+		//Functions with the same name are added to the back of the overloads.
+		iter->second.back()->setInlineBody(llvmIROrBitcode, functionName);
+	}
+	return *this;
+}
+
+
 bool ReflectedTypeInfo::isReflectedType() const
 {
 	return true;
@@ -6,6 +6,7 @@
 */
 
 #include "jitcat/SLRParseResult.h"
+#include "jitcat/ASTArena.h"
 #include "jitcat/ASTNode.h"
 
 using namespace jitcat::Parser;
@@ -24,6 +25,7 @@ SLRParseResult::~SLRParseResult()
 
 
 SLRParseResult::SLRParseResult(SLRParseResult&& other):
+	astArena(std::move(other.astArena)),
 	astRootNode(std::move(other.astRootNode)),
 	success(other.success)
 {
@@ -33,7 +35,9 @@ SLRParseResult::SLRParseResult(SLRParseResult&& other):
 SLRParseResult& SLRParseResult::operator=(SLRParseResult&& other)
 {
 	success = other.success;
+	//The previous AST is deleted before the arena it lives in.
 	astRootNode = std::move(other.astRootNode);
+	astArena = std::move(other.astArena);
 	return *this;
 }
 
@@ -43,6 +47,7 @@ SLRParseResult& jitcat::Parser::SLRParseResult::operator=(std::unique_ptr<SLRPar
 	SLRParseResult* otherPtr = other.release();
 	success = otherPtr->success;
 	astRootNode = std::move(otherPtr->astRootNode);
+	astArena = std::move(otherPtr->astArena);
 	delete otherPtr;
 	return *this;
 }
@@ -51,6 +56,13 @@ SLRParseResult& jitcat::Parser::SLRParseResult::operator=(std::unique_ptr<SLRPar
 void SLRParseResult::clear()
 {
 	success = false;
+	discardAST();
+}
+
+
+void SLRParseResult::discardAST()
+{
 	astRootNode.reset(nullptr);
+	astArena.reset(nullptr);
 }
 
@@ -6,6 +6,7 @@
 */
 
 #include "jitcat/SLRParser.h"
+#include "jitcat/ASTArena.h"
 #include "jitcat/ASTNode.h"
 #include "jitcat/ASTNodeParser.h"
 #include "jitcat/CatLog.h"
@@ -23,12 +24,14 @@
 #include "jitcat/ProductionTokenSet.h"
 #include "jitcat/RuntimeContext.h"
 #include "jitcat/SLRParseResult.h"
-#include "jitcat/StackItemProduction.h"
-#include "jitcat/StackItemToken.h"
+#include "jitcat/SLRParseTables.h"
+#include "jitcat/StackItem.h"
 #include "jitcat/TokenizerBase.h"
 #include "jitcat/Tools.h"
 
+#include <algorithm>
 #include <cassert>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -82,6 +85,7 @@ void SLRParser::createNFA()
 			}
 		}
 		scanForConflicts();
+		buildActionTables();
 	}
 	else
 	{
@@ -90,6 +94,158 @@ void SLRParser::createNFA()
 }
 
 
+bool SLRParser::loadParseTables(const SLRParseTables& tables)
+{
+	if (!dfa.empty() || tables.numStates == 0 || tables.grammarHash != grammar->getGrammarHash())
+	{
+		return false;
+	}
+	//Tables that match the grammar hash should always be valid, but the items are checked anyway because a bad table would crash the parser.
+	auto readItem = [this](const std::uint16_t* values, Item& item)
+	{
+		auto iter = grammar->productions.find(values[0]);
+		if (iter == grammar->productions.end() || values[1] >= iter->second->getNumRules())
+		{
+			return false;
+		}
+		item.production = iter->second;
+		item.rule = &iter->second->getRule(values[1]);
+		item.tokenOffset = values[2];
+		return item.tokenOffset <= item.rule->getNumTokens();
+	};
+
+	std::vector<DFAState*> states;
+	states.reserve(tables.numStates);
+	for (std::size_t i = 0; i < tables.numStates; i++)
+	{
+		DFAState* state = new DFAState();
+		state->stateIndex = i;
+		state->reachable = true;
+		state->isEpsilonClosed = true;
+		states.push_back(state);
+	}
+	bool valid = true;
+	for (std::size_t i = 0; i < tables.numStates && valid; i++)
+	{
+		DFAState* state = states[i];
+		state->items.reserve(tables.stateItemOffsets[i + 1] - tables.stateItemOffsets[i]);
+		for (std::uint32_t j = tables.stateItemOffsets[i]; j < tables.stateItemOffsets[i + 1] && valid; j++)
+		{
+			Item item;
+			valid = readItem(&tables.items[j * 3], item);
+			state->items.push_back(item);
+		}
+		state->transitions.reserve(tables.stateTransitionOffsets[i + 1] - tables.stateTransitionOffsets[i]);
+		for (std::uint32_t j = tables.stateTransitionOffsets[i]; j < tables.stateTransitionOffsets[i + 1] && valid; j++)
+		{
+			const std::uint16_t* values = &tables.transitions[j * 4];
+			DFAState::DFAStateTransition transition;
+			valid = readItem(values, transition.item) 
+					&& transition.item.tokenOffset < transition.item.rule->getNumTokens()
+					&& values[3] < tables.numStates;
+			if (valid)
+			{
+				transition.transitionToken = transition.item.rule->getToken(transition.item.tokenOffset);
+				transition.nextState = states[values[3]];
+				state->transitions.push_back(transition);
+			}
+		}
+	}
+	if (!valid)
+	{
+		Tools::deleteElements(states);
+		return false;
+	}
+	dfa = std::move(states);
+	buildActionTables();
+	return true;
+}
+
+
+namespace
+{
+	template<typename T>
+	void writeArray(std::ostream& stream, const char* elementType, const std::string& name, const std::vector<T>& values)
+	{
+		stream << "static const " << elementType << " " << name << "[] =\n{";
+		for (std::size_t i = 0; i < values.size(); i++)
+		{
+			stream << (i % 16 == 0 ? "\n\t" : " ") << values[i] << (i + 1 < values.size() ? "," : "");
+		}
+		stream << "\n};\n\n";
+	}
+}
+
+
+bool SLRParser::writeParseTables(std::ostream& stream, const std::string& tablesName) const
+{
+	if (dfa.empty() || dfa.size() > 0xffff)
+	{
+		return false;
+	}
+	std::vector<std::uint32_t> stateItemOffsets;
+	std::vector<std::uint32_t> items;
+	std::vector<std::uint32_t> stateTransitionOffsets;
+	std::vector<std::uint32_t> transitions;
+	auto writeItem = [](const Item& item, std::vector<std::uint32_t>& values)
+	{
+		if (item.production == nullptr || item.production->getProductionID() < 0 || item.production->getProductionID() > 0xffff)
+		{
+			return false;
+		}
+		values.push_back(item.production->getProductionID());
+		values.push_back((std::uint32_t)getRuleIndex(item));
+		values.push_back(item.tokenOffset);
+		return true;
+	};
+	for (std::size_t i = 0; i < dfa.size(); i++)
+	{
+		assert(dfa[i]->stateIndex == i);
+		stateItemOffsets.push_back((std::uint32_t)(items.size() / 3));
+		for (const Item& item : dfa[i]->items)
+		{
+			if (!writeItem(item, items))
+			{
+				return false;
+			}
+		}
+		stateTransitionOffsets.push_back((std::uint32_t)(transitions.size() / 4));
+		for (const DFAState::DFAStateTransition& transition : dfa[i]->transitions)
+		{
+			//The transition token is stored as an item of the state that moves past that token.
+			//The item of the transition itself is not used, because it is not always such an item.
+			auto moveItem = std::find_if(dfa[i]->items.begin(), dfa[i]->items.end(), [&](const Item& item)
+				{
+					return item.tokenOffset < item.rule->getNumTokens()
+						   && *item.rule->getToken(item.tokenOffset) == *transition.transitionToken;
+				});
+			if (moveItem == dfa[i]->items.end()
+				|| !writeItem(*moveItem, transitions))
+			{
+				return false;
+			}
+			transitions.push_back((std::uint32_t)transition.nextState->stateIndex);
+		}
+	}
+	stateItemOffsets.push_back((std::uint32_t)(items.size() / 3));
+	stateTransitionOffsets.push_back((std::uint32_t)(transitions.size() / 4));
+
+	writeArray(stream, "std::uint32_t", tablesName + "StateItemOffsets", stateItemOffsets);
+	writeArray(stream, "std::uint16_t", tablesName + "Items", items);
+	writeArray(stream, "std::uint32_t", tablesName + "StateTransitionOffsets", stateTransitionOffsets);
+	writeArray(stream, "std::uint16_t", tablesName + "Transitions", transitions);
+	stream << "const Parser::SLRParseTables " << tablesName << " =\n{\n";
+	stream << "\t0x" << std::hex << std::setw(16) << std::setfill('0') << grammar->getGrammarHash() << std::dec << std::setfill(' ') << "ull,\n";
+	stream << "\t" << dfa.size() << ",\n";
+	stream << "\t" << tablesName << "StateItemOffsets,\n";
+	stream << "\t" << tablesName << "Items,\n";
+	stream << "\t" << tablesName << "StateTransitionOffsets,\n";
+	stream << "\t" << tablesName << "Transitions\n";
+	stream << "};\n";
+	return true;
+}
+
+
 void SLRParser::buildNFA(DFAState* currentState, std::vector<DFAState*>& nfa)
 {
 	for (unsigned int i = 0; i < currentState->items.size(); i++)
@@ -275,6 +431,20 @@ void SLRParser::markReachableStates(DFAState* currentState)
 }
 
 
+std::size_t SLRParser::getRuleIndex(const Item& item)
+{
+	for (std::size_t i = 0; i < item.production->getNumRules(); i++)
+	{
+		if (&item.production->getRule((unsigned int)i) == item.rule)
+		{
+			return i;
+		}
+	}
+	assert(false);
+	return 0;
+}
+
+
 bool SLRParser::hasMultipleTransitionsWithToken(DFAState* state, ProductionToken* token) const
 {
 	int numTransitionsWithToken = 0;
@@ -316,161 +486,157 @@ void SLRParser::aggregateTokenTransitionIntoNewState(DFAState* state, Production
 }
 
 
-bool SLRParser::tryReduce(DFAState* currentState, std::vector<StackItem*>& stack, StackItem* nextToken, RuntimeContext* context) const
+void SLRParser::buildActionTables()
 {
-	for (unsigned int i = 0; i < currentState->items.size(); i++)
+	//Terminal columns are assigned to the terminals of the grammar and to the terminals in the follow sets. 
+	//The last column is used for all other tokens, it only contains errors.
+	std::vector<std::pair<unsigned short, unsigned short>> terminals;
+	auto addTerminal = [&terminals](const ProductionTerminalToken* terminal)
+	{
+		std::pair<unsigned short, unsigned short> terminalId(terminal->getTokenId(), terminal->getTokenSubType());
+		if (std::find(terminals.begin(), terminals.end(), terminalId) == terminals.end())
+		{
+			terminals.push_back(terminalId);
+		}
+	};
+	for (const ProductionTerminalToken* terminal : grammar->terminals)
 	{
-		const Item& item = currentState->items[i];
-		//Check for possible reduce move
-		//Reduce only if the next token is in the follow set of the production.
-		if ((item.tokenOffset >= item.rule->getNumTokens()
-			|| (item.rule->getNumTokens() == 1 && item.rule->getToken(0)->getType() == ProductionTokenType::Epsilon))
-			&& isStackItemInFollowSet(nextToken, item.production->getFollowSet()))
+		addTerminal(terminal);
+	}
+	int maxProductionId = 0;
+	for (const auto& iter : grammar->productions)
+	{
+		maxProductionId = std::max(maxProductionId, iter.first);
+		const ProductionTokenSet& followSet = iter.second->getFollowSet();
+		for (unsigned int i = 0; i < followSet.getNumMembers(); i++)
 		{
-			if (item.rule->getNumTokens() == 0 && canShift(currentState, nextToken))
+			if (followSet.getMember(i)->getType() == ProductionTokenType::Terminal)
 			{
-				//If the rule is empty, prefer to shift if possible.
-				return false;
+				addTerminal(static_cast<const ProductionTerminalToken*>(followSet.getMember(i)));
 			}
-			if constexpr (Configuration::debugGrammar)
+		}
+	}
+	numTerminalColumns = terminals.size() + 1;
+	maxTokenId = 0;
+	maxTokenSubType = 0;
+	for (const auto& terminal : terminals)
+	{
+		maxTokenId = std::max(maxTokenId, (std::size_t)terminal.first);
+		maxTokenSubType = std::max(maxTokenSubType, (std::size_t)terminal.second);
+	}
+	terminalColumns.assign((maxTokenId + 1) * (maxTokenSubType + 1), (std::uint16_t)terminals.size());
+	for (std::size_t i = 0; i < terminals.size(); i++)
+	{
+		terminalColumns[terminals[i].first * (maxTokenSubType + 1) + terminals[i].second] = (std::uint16_t)i;
+	}
+	auto getColumn = [&](const ProductionTerminalToken* terminal)
+	{
+		return terminalColumns[terminal->getTokenId() * (maxTokenSubType + 1) + terminal->getTokenSubType()];
+	};
+
+	numGotoColumns = (std::size_t)maxProductionId + 1;
+	actionTable.assign(dfa.size() * numTerminalColumns, 0);
+	gotoTable.assign(dfa.size() * numGotoColumns, 0);
+	reduceActions.clear();
+	std::vector<bool> decided(numTerminalColumns);
+	for (std::size_t i = 0; i < dfa.size(); i++)
+	{
+		const DFAState* state = dfa[i];
+		std::int32_t* actions = &actionTable[i * numTerminalColumns];
+		//Shift moves and gotos. If there are several transitions for the same token, the first one is used.
+		std::vector<std::int32_t> shifts(numTerminalColumns, 0);
+		for (const DFAState::DFAStateTransition& transition : state->transitions)
+		{
+			const ProductionToken* transitionToken = transition.transitionToken;
+			if (transitionToken->getType() == ProductionTokenType::Terminal)
 			{
-				if (nextToken->getProductionIfProduction())
-				{
-					CatLog::log("Reduce move state: ");
-					CatLog::log(currentState->stateIndex);
-					CatLog::log(" item: ");
-					CatLog::log(item.toString().c_str());
-					CatLog::log(" because ");
-					CatLog::log(nextToken->getProductionIfProduction()->getProductionName());
-					CatLog::log(" is in the follow set of ");
-					CatLog::log(item.production->getProductionName());
-					CatLog::log("\n");
-				}
-				else
+				std::int32_t& shift = shifts[getColumn(static_cast<const ProductionTerminalToken*>(transitionToken))];
+				if (shift == 0)
 				{
-					CatLog::log("Reduce move state: ");
-					CatLog::log(currentState->stateIndex);
-					CatLog::log(" item: ");
-					CatLog::log(item.toString().c_str());
-					CatLog::log(" because ");
-					CatLog::log(grammar->getTokenizer()->getTokenName(nextToken->getTokenIfToken()->tokenID, nextToken->getTokenIfToken()->subType));
-					CatLog::log(" is in the follow set of ");
-					CatLog::log(item.production->getProductionName());
-					CatLog::log("\n");
+					shift = (std::int32_t)transition.nextState->stateIndex + 1;
 				}
 			}
-			
-			StackItemProduction* reducedProduction = new StackItemProduction(item.production, item.rule);
-
-			ASTNodeParser nodeParser(stack, item.rule->getNumTokens(), context);
-
-			reducedProduction->astNode = item.rule->executeSemanticAction(nodeParser);
-			std::size_t numTokensInRule = item.rule->getNumTokens();
-			for (int j = (int)stack.size() - (int)numTokensInRule; j < (int)stack.size(); j++)
-			{
-				reducedProduction->addChildItem(stack[j]);
-			}
-			for (unsigned int j = 0; j < item.rule->getNumTokens(); j++)
+			else if (transitionToken->getType() == ProductionTokenType::NonTerminal)
 			{
-				stack.pop_back();
+				int productionId = static_cast<const ProductionNonTerminalToken*>(transitionToken)->getProduction()->getProductionID();
+				std::uint16_t& nextState = gotoTable[i * numGotoColumns + productionId];
+				if (nextState == 0)
+				{
+					nextState = (std::uint16_t)(transition.nextState->stateIndex + 1);
+				}
 			}
-			stack.push_back(reducedProduction);
-			return true;
 		}
-	}
-	return false;
-}
-
-
-DFAState* SLRParser::canShift(DFAState* currentState, StackItem* tokenToShift) const
-{
-	const ParseToken* token = tokenToShift->getTokenIfToken();
-	const Production* production = tokenToShift->getProductionIfProduction();
-
-	for (unsigned int i = 0; i < currentState->transitions.size(); i++)
-	{
-		const DFAState::DFAStateTransition& transition = currentState->transitions[i];
-		//Check for possible reduce move
-		//Reduce only if the next token is in the follow set of the production.
-		ProductionTokenType transitionTokenType = transition.transitionToken->getType();
-
-		if (transitionTokenType == ProductionTokenType::Terminal
-			&& token != nullptr)
+		//Reduce moves. A completed item is reduced if the next token is in the follow set of its production.
+		//The first item that can be reduced wins, but if its rule is empty, shifting is preferred.
+		std::fill(decided.begin(), decided.end(), false);
+		for (const Item& item : state->items)
 		{
-			const ProductionTerminalToken* terminal = static_cast<const ProductionTerminalToken*>(transition.transitionToken); 
-			if (terminal->getTokenId() == token->tokenID
-				&& terminal->getTokenSubType() == token->subType)
+			if (item.tokenOffset < item.rule->getNumTokens()
+				&& !(item.rule->getNumTokens() == 1 && item.rule->getToken(0)->getType() == ProductionTokenType::Epsilon))
+			{
+				continue;
+			}
+			std::int32_t reduceAction = 0;
+			const ProductionTokenSet& followSet = item.production->getFollowSet();
+			for (unsigned int j = 0; j < followSet.getNumMembers(); j++)
 			{
-				if constexpr (Configuration::debugGrammar)
+				if (followSet.getMember(j)->getType() != ProductionTokenType::Terminal)
+				{
+					continue;
+				}
+				std::size_t column = getColumn(static_cast<const ProductionTerminalToken*>(followSet.getMember(j)));
+				if (decided[column])
+				{
+					continue;
+				}
+				decided[column] = true;
+				if (item.rule->getNumTokens() == 0 && shifts[column] != 0)
+				{
+					actions[column] = shifts[column];
+				}
+				else
 				{
-					CatLog::log("Shift terminal, state: ");
-					CatLog::log(currentState->stateIndex);
-					CatLog::log(" terminal: ");
-					CatLog::log(grammar->getTokenizer()->getTokenSymbol(token->tokenID, token->subType));
-					CatLog::log("\n");
+					if (reduceAction == 0)
+					{
+						reduceActions.push_back({item.production, item.rule});
+						reduceAction = -(std::int32_t)reduceActions.size();
+					}
+					actions[column] = reduceAction;
 				}
-				return transition.nextState;
 			}
 		}
-		else if (transitionTokenType == ProductionTokenType::NonTerminal
-				 && production != nullptr)
+		for (std::size_t j = 0; j < numTerminalColumns; j++)
 		{
-			const ProductionNonTerminalToken* nonTerminal = static_cast<const ProductionNonTerminalToken*>(transition.transitionToken);
-			if (nonTerminal->getProduction()->getProductionID() == production->getProductionID())
+			if (!decided[j])
 			{
-				if constexpr (Configuration::debugGrammar)
-				{
-					CatLog::log("Shift non-terminal, state: ");
-					CatLog::log(currentState->stateIndex);
-					CatLog::log(" production: ");
-					CatLog::log(production->getProductionName());
-					CatLog::log("\n");
-				}
-				return transition.nextState;
+				actions[j] = shifts[j];
 			}
 		}
 	}
-	return nullptr;
 }
 
 
-bool SLRParser::isStackItemInFollowSet(StackItem* item, const ProductionTokenSet& followSet) const
+std::size_t SLRParser::getTerminalColumn(const ParseToken& token) const
 {
-	const ParseToken* token = item->getTokenIfToken();
-	if (token != nullptr)
-	{
-		return followSet.isInSet(token);
-	}
-	else
+	if (token.tokenID > maxTokenId || token.subType > maxTokenSubType)
 	{
-		const Production* production = item->getProductionIfProduction();
-		if (production != nullptr)
-		{
-			return followSet.isInSet(production);
-		}
+		return numTerminalColumns - 1;
 	}
-	//We should never get here
-	assert(false);
-	return false;
+	return terminalColumns[token.tokenID * (maxTokenSubType + 1) + token.subType];
 }
 
 
-void SLRParser::printStack(const std::vector<StackItem*> stack) const
+void SLRParser::printStack(const std::vector<StackItem>& stack) const
 {
-	for (unsigned int i = 0; i < stack.size(); i++)
+	for (const StackItem& item : stack)
 	{
-		const ParseToken* token = stack[i]->getTokenIfToken();
-		if (token != nullptr)
+		if (item.token != nullptr)
 		{
-			CatLog::log(grammar->getTokenizer()->getTokenSymbol(token->tokenID, token->subType));
+			CatLog::log(grammar->getTokenizer()->getTokenSymbol(item.token->tokenID, item.token->subType));
 		}
-		else 
+		else if (item.production != nullptr)
 		{
-			const Production* production = stack[i]->getProductionIfProduction();
-			if (production != nullptr)
-			{
-				CatLog::log(production->getProductionName());
-			}
+			CatLog::log(item.production->getProductionName());
 		}
 	}
 }
@@ -759,16 +925,16 @@ std::string jitcat::Parser::SLRParser::getShiftErrorMessage(DFAState* currentSta
 std::unique_ptr<SLRParseResult> SLRParser::parse(const std::vector<ParseToken>& tokens, int whiteSpaceTokenID, int commentTokenID, RuntimeContext* context, ExpressionErrorManager* errorManager, void* errorSource) const
 {
 	std::unique_ptr<SLRParseResult> parseResult = std::make_unique<SLRParseResult>();
+	//The AST nodes are allocated from the arena of the parse result, so that they are freed together with the AST.
+	parseResult->astArena = std::make_unique<ASTArena>();
+	ASTArena::Scope arenaScope(parseResult->astArena.get());
 
-	std::vector<StackItem*> parseStack;
-	int tokenIndex = 0;
-	DFAState* currentState = dfa[0];
+	std::vector<StackItem> parseStack;
+	parseStack.reserve(32);
+	parseStack.emplace_back();
+	std::size_t currentState = 0;
+	std::size_t tokenIndex = 0;
 
-	StackItem* startingStackItem = new StackItem();
-	startingStackItem->state = currentState;
-	parseStack.push_back(startingStackItem);
-
-	const Production* finalProduction = currentState->items[0].production;
 	if constexpr (Configuration::debugGrammar)
 	{
 		CatLog::log("###############\n");
@@ -780,105 +946,89 @@ std::unique_ptr<SLRParseResult> SLRParser::parse(const std::vector<ParseToken>&
 		if constexpr (Configuration::debugGrammar)
 		{
 			CatLog::log("State ");
-			CatLog::log(currentState->stateIndex);
+			CatLog::log(currentState);
 			CatLog::log(" Stack: ");
 			printStack(parseStack);
 			CatLog::log("\n\n");
 		}
 		//Skip whitespace
-		while (tokenIndex < (int)tokens.size()
+		while (tokenIndex < tokens.size()
 			   && (tokens[tokenIndex].tokenID == whiteSpaceTokenID
 			       || tokens[tokenIndex].tokenID == commentTokenID))
 		{
 			tokenIndex++;
 		}
-		StackItemToken* token = nullptr;
-		if (tokenIndex < (int)tokens.size())
+		if (tokenIndex >= tokens.size())
+		{
+			//The tokens should always end with an end of file token.
+			assert(false);
+			return parseResult;
+		}
+		const ParseToken& token = tokens[tokenIndex];
+		const std::int32_t action = actionTable[currentState * numTerminalColumns + getTerminalColumn(token)];
+		if (action > 0)
 		{
-			token = new StackItemToken(&tokens[tokenIndex]);
-			token->state = nullptr;
+			//Shift move
+			currentState = (std::size_t)(action - 1);
+			StackItem& shiftedItem = parseStack.emplace_back();
+			shiftedItem.state = currentState;
+			shiftedItem.token = &token;
+			tokenIndex++;
 		}
-		bool reduced = tryReduce(currentState, parseStack, token, context);
-		if (reduced)
+		else if (action < 0)
 		{
-			delete token;
+			//Reduce move
+			const ReduceAction& reduce = reduceActions[(std::size_t)(-action - 1)];
+			if constexpr (Configuration::debugGrammar)
+			{
+				CatLog::log("Reduce move state: ");
+				CatLog::log(currentState);
+				CatLog::log(" production: ");
+				CatLog::log(reduce.production->getProductionName());
+				CatLog::log("\n");
+			}
+			const std::size_t numTokensInRule = reduce.rule->getNumTokens();
+			StackItem reducedItem;
+			reducedItem.production = reduce.production;
+			{
+				ASTNodeParser nodeParser(parseStack, numTokensInRule, context);
+				reducedItem.astNode = reduce.rule->executeSemanticAction(nodeParser);
+			}
+			parseStack.resize(parseStack.size() - std::min(numTokensInRule, parseStack.size()));
+			parseStack.push_back(reducedItem);
 			if (parseStack.size() == 1)
 			{
 				//Succesful parse
 				parseResult->success = true;
-				parseResult->astRootNode.reset(parseStack[0]->astNode);
-				Tools::deleteElements(parseStack);
+				parseResult->astRootNode.reset(parseStack[0].astNode);
 				return parseResult;
 			}
-			else if (parseStack.size() > 1)
+			const std::size_t previousState = parseStack[parseStack.size() - 2].state;
+			const std::uint16_t nextState = gotoTable[previousState * numGotoColumns + reduce.production->getProductionID()];
+			if (nextState != 0)
 			{
-				std::size_t previousStackItem = parseStack.size() - 2;
-				DFAState* state = parseStack[previousStackItem]->state;
-				DFAState* newState = canShift(state, parseStack[parseStack.size() - 1]);
-				if (newState != nullptr)
-				{
-					parseStack[parseStack.size() - 1]->state = newState;
-					currentState = newState;
-				}
-				else if (parseStack.size() == 2
-						 && parseStack[1]->getProductionIfProduction() != nullptr
-						 && parseStack[1]->getProductionIfProduction()->getProductionID() == finalProduction->getProductionID())
-				{
-					//Succesful parse
-					parseResult->success = true;
-					parseResult->astRootNode.reset(parseStack[1]->astNode);
-					Tools::deleteElements(parseStack);
-					return parseResult;
-				}
-				else
-				{
-					Tools::deleteElements(parseStack);
-					return parseResult;
-				}
+				currentState = nextState - 1;
+				parseStack.back().state = currentState;
 			}
-			else
+			else if (parseStack.size() == 2
+					 && reduce.production == dfa[0]->items[0].production)
 			{
-				assert(false);
-				Tools::deleteElements(parseStack);
+				//Succesful parse
+				parseResult->success = true;
+				parseResult->astRootNode.reset(parseStack[1].astNode);
 				return parseResult;
 			}
-
-		}
-		else
-		{
-			//Check for shift move
-			DFAState* newState = canShift(currentState, token);
-			if (newState != nullptr)
-			{
-				token->state = newState;
-				currentState = newState;
-				parseStack.push_back(token);
-				tokenIndex++;
-			}
 			else
 			{
-				if (token != nullptr)
-				{
-					if (token->getTokenIfToken())
-					{
-						const Lexeme& errorLexeme = token->getTokenIfToken()->lexeme;
-						errorManager->compiledWithError(getShiftErrorMessage(currentState, std::string(errorLexeme)), errorSource, context->getContextName(), errorLexeme);
-					}
-					else if (token->getProductionIfProduction())
-					{
-						const Production* errorProduction = token->getProductionIfProduction();
-						errorManager->compiledWithError(getShiftErrorMessage(currentState, errorProduction->getProductionName()), errorSource, context->getContextName(), token->astNode->getLexeme());
-					}
-					delete token;
-				}
-				Tools::deleteElements(parseStack);
 				return parseResult;
 			}
-			
+		}
+		else
+		{
+			errorManager->compiledWithError(getShiftErrorMessage(dfa[currentState], std::string(token.lexeme)), errorSource, context->getContextName(), token.lexeme);
+			return parseResult;
 		}
 	}
-	Tools::deleteElements(parseStack);
-	return parseResult;
 }
 
 
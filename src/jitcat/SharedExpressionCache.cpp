@@ -0,0 +1,125 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/SharedExpressionCache.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/SLRParseResult.h"
+#include "jitcat/Tools.h"
+#include "jitcat/TypeInfo.h"
+
+#include <algorithm>
+#include <functional>
+
+using namespace jitcat;
+using namespace jitcat::Reflection;
+
+
+SharedExpressionCache::Key::Key(const std::string& expression, const CatGenericType& expectedType, bool isAssignment, const LLVM::LLVMCompileOptions& compileOptions, const CatRuntimeContext* context):
+	expression(expression),
+	expectedType(expectedType),
+	isAssignment(isAssignment),
+	compileOptions(compileOptions),
+	scopeLayout(context->getScopeLayout()),
+	scopeVersions(context->getScopeVersions())
+{
+	std::hash<std::string> stringHasher;
+	hash = Tools::hashCombine(stringHasher(expression), stringHasher(expectedType.toString()));
+	hash = Tools::hashCombine(hash, context->getContextHash());
+	hash = Tools::hashCombine(hash, (std::size_t)isAssignment);
+	hash = Tools::hashCombine(hash, (std::size_t)compileOptions.optimizationLevel);
+	hash = Tools::hashCombine(hash, (std::size_t)compileOptions.enableDereferenceNullChecks);
+}
+
+
+bool SharedExpressionCache::Key::operator==(const Key& other) const
+{
+	return hash == other.hash
+		   && isAssignment == other.isAssignment
+		   && scopeVersions == other.scopeVersions
+		   && compileOptions == other.compileOptions
+		   && expression == other.expression
+		   && scopeLayout == other.scopeLayout
+		   && expectedType == other.expectedType;
+}
+
+
+std::size_t SharedExpressionCache::Key::getHash() const
+{
+	return hash;
+}
+
+
+SharedExpressionCache::SharedExpressionCache():
+	pruneThreshold(64),
+	numHits(0),
+	numMisses(0)
+{
+}
+
+
+std::shared_ptr<const SharedExpression> SharedExpressionCache::find(const Key& key)
+{
+	std::scoped_lock<std::mutex> lock(mutex);
+	auto iter = expressions.find(key);
+	if (iter != expressions.end())
+	{
+		if (std::shared_ptr<const SharedExpression> sharedExpression = iter->second.lock(); sharedExpression != nullptr
+			&& std::all_of(sharedExpression->resolvedTypes.begin(), sharedExpression->resolvedTypes.end(), 
+						   [](const TypeVersion& resolvedType){return resolvedType.type->getVersion() == resolvedType.version;}))
+		{
+			numHits++;
+			return sharedExpression;
+		}
+		expressions.erase(iter);
+	}
+	numMisses++;
+	return nullptr;
+}
+
+
+void SharedExpressionCache::add(const Key& key, const std::shared_ptr<const SharedExpression>& sharedExpression)
+{
+	std::scoped_lock<std::mutex> lock(mutex);
+	expressions.insert_or_assign(key, sharedExpression);
+	if (expressions.size() >= pruneThreshold)
+	{
+		prune();
+		pruneThreshold = std::max((std::size_t)64, expressions.size() * 2);
+	}
+}
+
+
+ExpressionSharingStatistics SharedExpressionCache::getStatistics() const
+{
+	std::scoped_lock<std::mutex> lock(mutex);
+	std::size_t numSharedExpressions = std::count_if(expressions.begin(), expressions.end(), [](const auto& entry){return !entry.second.expired();});
+	return {numSharedExpressions, numHits, numMisses};
+}
+
+
+void SharedExpressionCache::resetStatistics()
+{
+	std::scoped_lock<std::mutex> lock(mutex);
+	numHits = 0;
+	numMisses = 0;
+}
+
+
+void SharedExpressionCache::prune()
+{
+	for (auto iter = expressions.begin(); iter != expressions.end();)
+	{
+		if (iter->second.expired())
+		{
+			iter = expressions.erase(iter);
+		}
+		else
+		{
+			++iter;
+		}
+	}
+}
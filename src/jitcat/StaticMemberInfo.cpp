@@ -19,6 +19,7 @@ using namespace jitcat::Reflection;
 StaticMemberInfo::StaticMemberInfo(const std::string & memberName, const CatGenericType & type, const char * parentTypeName): 
 	catType(type), 
 	visibility(MemberVisibility::Public), 
+	trustedNonNull(false),
 	parentTypeName(parentTypeName),
 	memberName(memberName)  
 {
@@ -6,6 +6,7 @@
 */
 
 #include "jitcat/StringConstantPool.h"
+#include "jitcat/MemoryStatistics.h"
 
 using namespace jitcat;
 using namespace jitcat::AST;
@@ -13,6 +14,7 @@ using namespace jitcat::AST;
 
 const Configuration::CatString* StringConstantPool::getString(const Configuration::CatString& string)
 {
+    std::lock_guard<std::mutex> lock(poolMutex);
     const auto& poolItem = pool.find(string);
     if (poolItem == pool.end())
     {
@@ -25,8 +27,29 @@ const Configuration::CatString* StringConstantPool::getString(const Configuratio
 
 void StringConstantPool::clearPool()
 {
+    std::lock_guard<std::mutex> lock(poolMutex);
     pool.clear();
 }
 
 
-std::unordered_set<Configuration::CatString> StringConstantPool::pool = std::unordered_set<Configuration::CatString>();
\ No newline at end of file
+std::size_t StringConstantPool::getNumStrings()
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    return pool.size();
+}
+
+
+std::size_t StringConstantPool::getMemoryUsage()
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    std::size_t memory = MemoryEstimation::getHashMemory(pool);
+    for (const Configuration::CatString& string : pool)
+    {
+        memory += MemoryEstimation::getStringMemory(string);
+    }
+    return memory;
+}
+
+
+std::unordered_set<Configuration::CatString> StringConstantPool::pool = std::unordered_set<Configuration::CatString>();
+std::mutex StringConstantPool::poolMutex;
\ No newline at end of file
@@ -0,0 +1,219 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/SymbolTable.h"
+#include "jitcat/MemoryStatistics.h"
+#include "jitcat/Tools.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace jitcat;
+using namespace jitcat::Reflection;
+
+
+namespace
+{
+	struct CaseInsensitiveHash
+	{
+		std::size_t operator()(const std::string_view& name) const
+		{
+			//FNV-1a on the lower case characters.
+			std::size_t hash = 14695981039346656037ULL;
+			for (char character : name)
+			{
+				hash ^= (unsigned char)Tools::toLowerCase(character);
+				hash *= 1099511628211ULL;
+			}
+			return hash;
+		}
+	};
+
+
+	struct CaseInsensitiveEquals
+	{
+		bool operator()(const std::string_view& name1, const std::string_view& name2) const
+		{
+			if (name1.size() != name2.size())
+			{
+				return false;
+			}
+			for (std::size_t i = 0; i < name1.size(); ++i)
+			{
+				if (Tools::toLowerCase(name1[i]) != Tools::toLowerCase(name2[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+
+	struct Symbol
+	{
+		std::string lowerCaseName;
+		std::size_t hash;
+		SymbolId id;
+	};
+
+
+	//An open addressing hash table. A slot is filled once and is never changed or emptied afterwards, 
+	//so that it can be read without locking while another thread adds symbols.
+	struct SymbolSlots
+	{
+		SymbolSlots(std::size_t capacity):
+			capacity(capacity),
+			slots(std::make_unique<std::atomic<const Symbol*>[]>(capacity))
+		{
+			for (std::size_t i = 0; i < capacity; ++i)
+			{
+				slots[i].store(nullptr, std::memory_order_relaxed);
+			}
+		}
+
+		//Must be called with the mutex of the Symbols locked.
+		void insert(const Symbol* symbol)
+		{
+			std::size_t index = symbol->hash & (capacity - 1);
+			while (slots[index].load(std::memory_order_relaxed) != nullptr)
+			{
+				index = (index + 1) & (capacity - 1);
+			}
+			slots[index].store(symbol, std::memory_order_release);
+		}
+
+		const Symbol* find(const std::string_view& name, std::size_t hash) const
+		{
+			for (std::size_t index = hash & (capacity - 1);; index = (index + 1) & (capacity - 1))
+			{
+				const Symbol* symbol = slots[index].load(std::memory_order_acquire);
+				if (symbol == nullptr || (symbol->hash == hash && CaseInsensitiveEquals()(symbol->lowerCaseName, name)))
+				{
+					return symbol;
+				}
+			}
+		}
+
+		//A power of two. The table is replaced before it is half full, so a search always ends at an empty slot.
+		std::size_t capacity;
+		std::unique_ptr<std::atomic<const Symbol*>[]> slots;
+	};
+
+
+	struct Symbols
+	{
+		Symbols():
+			numSymbols(0)
+		{
+			tables.push_back(std::make_unique<SymbolSlots>(1024));
+			currentTable.store(tables.back().get(), std::memory_order_release);
+		}
+
+		//The table that lookups search. Replaced by a table of twice the size when it is half full.
+		std::atomic<const SymbolSlots*> currentTable;
+		//Replaced tables are kept, because a lookup on another thread may still be searching them. Their total size is less than that of the current table.
+		std::vector<std::unique_ptr<SymbolSlots>> tables;
+		//A deque never moves its elements when it grows.
+		std::deque<Symbol> symbols;
+		std::atomic<std::size_t> numSymbols;
+		//Only taken when adding a symbol.
+		std::mutex mutex;
+	};
+
+
+	//The table is created on first use because types can be reflected during static initialization.
+	//It is intentionally leaked because types can also be destroyed during static destruction.
+	Symbols& getSymbols()
+	{
+		static Symbols* symbols = new Symbols();
+		return *symbols;
+	}
+}
+
+
+SymbolId SymbolTable::intern(const std::string_view& name)
+{
+	SymbolId symbol = find(name);
+	if (symbol != noSymbol)
+	{
+		return symbol;
+	}
+	Symbols& symbols = getSymbols();
+	std::lock_guard<std::mutex> lock(symbols.mutex);
+	//Another thread may have interned the name in the mean time.
+	const std::size_t hash = CaseInsensitiveHash()(name);
+	SymbolSlots* table = symbols.tables.back().get();
+	if (const Symbol* existingSymbol = table->find(name, hash); existingSymbol != nullptr)
+	{
+		return existingSymbol->id;
+	}
+	const Symbol* newSymbol = &symbols.symbols.emplace_back(Symbol{Tools::toLowerCase(name), hash, (SymbolId)symbols.symbols.size() + 1});
+	if (symbols.symbols.size() * 2 > table->capacity)
+	{
+		//The new table is completely filled before it is published.
+		symbols.tables.push_back(std::make_unique<SymbolSlots>(table->capacity * 2));
+		table = symbols.tables.back().get();
+		for (const Symbol& existingSymbol : symbols.symbols)
+		{
+			table->insert(&existingSymbol);
+		}
+		symbols.currentTable.store(table, std::memory_order_release);
+	}
+	else
+	{
+		table->insert(newSymbol);
+	}
+	symbols.numSymbols.store(symbols.symbols.size(), std::memory_order_relaxed);
+	return newSymbol->id;
+}
+
+
+SymbolId SymbolTable::find(const std::string_view& name)
+{
+	const SymbolSlots* table = getSymbols().currentTable.load(std::memory_order_acquire);
+	if (const Symbol* symbol = table->find(name, CaseInsensitiveHash()(name)); symbol != nullptr)
+	{
+		return symbol->id;
+	}
+	return noSymbol;
+}
+
+
+const std::string& SymbolTable::getName(SymbolId symbol)
+{
+	Symbols& symbols = getSymbols();
+	std::lock_guard<std::mutex> lock(symbols.mutex);
+	return symbols.symbols[symbol - 1].lowerCaseName;
+}
+
+
+std::size_t SymbolTable::getNumSymbols()
+{
+	return getSymbols().numSymbols.load(std::memory_order_relaxed);
+}
+
+
+std::size_t SymbolTable::getMemoryUsage()
+{
+	Symbols& symbols = getSymbols();
+	std::lock_guard<std::mutex> lock(symbols.mutex);
+	std::size_t memory = 0;
+	for (const std::unique_ptr<SymbolSlots>& table : symbols.tables)
+	{
+		memory += sizeof(SymbolSlots) + table->capacity * sizeof(std::atomic<const Symbol*>);
+	}
+	for (const Symbol& symbol : symbols.symbols)
+	{
+		memory += sizeof(Symbol) + MemoryEstimation::getStringMemory(symbol.lowerCaseName);
+	}
+	return memory;
+}
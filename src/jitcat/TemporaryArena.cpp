@@ -0,0 +1,100 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "jitcat/TemporaryArena.h"
+
+#include <algorithm>
+
+using namespace jitcat;
+
+
+namespace
+{
+	//Most expressions create no temporaries, or a few strings, so the first block is small.
+	constexpr std::size_t firstBlockSize = 256;
+}
+
+
+TemporaryArena::TemporaryArena():
+	currentPosition(nullptr),
+	currentBlockEnd(nullptr),
+	allocatedMemory(0),
+	reservedMemory(0)
+{
+}
+
+
+TemporaryArena::~TemporaryArena()
+{
+	reset();
+	for (char* block : blocks)
+	{
+		::operator delete(block);
+	}
+}
+
+
+void TemporaryArena::reset()
+{
+	for (auto iter = destructors.rbegin(); iter != destructors.rend(); ++iter)
+	{
+		iter->destroy(iter->temporary);
+	}
+	destructors.clear();
+	if (blocks.size() > 1)
+	{
+		//Coalesce the blocks, so that the same temporaries fit in a single block next time.
+		for (char* block : blocks)
+		{
+			::operator delete(block);
+		}
+		blocks.clear();
+		reservedMemory = 0;
+		allocateBlock(allocatedMemory);
+	}
+	if (!blocks.empty())
+	{
+		currentPosition = blocks.front();
+	}
+	allocatedMemory = 0;
+}
+
+
+bool TemporaryArena::isEmpty() const
+{
+	return allocatedMemory == 0;
+}
+
+
+std::size_t TemporaryArena::getReservedMemory() const
+{
+	return reservedMemory;
+}
+
+
+void* TemporaryArena::allocate(std::size_t size)
+{
+	size = (size + alignment - 1) & ~(alignment - 1);
+	if ((std::size_t)(currentBlockEnd - currentPosition) < size)
+	{
+		//The remainder of the current block is abandoned.
+		allocateBlock(std::max({size, firstBlockSize, reservedMemory}));
+	}
+	void* memory = currentPosition;
+	currentPosition += size;
+	allocatedMemory += size;
+	return memory;
+}
+
+
+void TemporaryArena::allocateBlock(std::size_t size)
+{
+	currentPosition = static_cast<char*>(::operator new(size));
+	currentBlockEnd = currentPosition + size;
+	blocks.push_back(currentPosition);
+	reservedMemory += size;
+}
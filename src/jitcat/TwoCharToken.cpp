@@ -83,29 +83,7 @@ bool TwoCharToken::createIfMatch(Document& document, std::size_t& currentPositio
 	const char* currentCharacter = &document.getDocumentData()[currentPosition];
 	if (remainingLength > 1)
 	{
-		std::string lex(currentCharacter, 2);
-		TwoChar type = TwoChar::Unknown;
-		
-		if (lex == "==")			type = TwoChar::Equals;
-		else if (lex == "!=")		type = TwoChar::NotEquals;
-		else if (lex == "<=")		type = TwoChar::SmallerOrEqual;
-		else if (lex == ">=")		type = TwoChar::GreaterOrEqual;
-		else if (lex == "&&")		type = TwoChar::LogicalAnd;
-		else if (lex == "||")		type = TwoChar::LogicalOr;
-		else if (lex == "+=")		type = TwoChar::PlusAssign;
-		else if (lex == "-=")		type = TwoChar::MinusAssign;
-		else if (lex == "*=")		type = TwoChar::TimesAssign;
-		else if (lex == "\\=")		type = TwoChar::DivideAssign;
-		else if (lex == "|=")		type = TwoChar::BitwiseOrAssign;
-		else if (lex == "&=")		type = TwoChar::BitwiseAndAssign;
-		else if (lex == "^=")		type = TwoChar::BitwiseXorAssign;
-		else if (lex == "<<")		type = TwoChar::BitshiftLeft;
-		else if (lex == ">>")		type = TwoChar::BitshiftRight;
-		else if (lex == "++")		type = TwoChar::Increment;
-		else if (lex == "--")		type = TwoChar::Decrement;
-		else if (lex == "::")		type = TwoChar::StaticAccessor;
-		else if (lex == "[]")		type = TwoChar::ArrayBrackets;
-
+		TwoChar type = getTwoCharType(currentCharacter[0], currentCharacter[1]);
 		if (type != TwoChar::Unknown)
 		{
 			document.addToken(currentPosition, 2, id, Tools::enumToUSHort(type));
@@ -114,4 +92,62 @@ bool TwoCharToken::createIfMatch(Document& document, std::size_t& currentPositio
 		}
 	}
 	return false;
-}
\ No newline at end of file
+}
+
+
+TwoChar TwoCharToken::getTwoCharType(char first, char second)
+{
+	switch (first)
+	{
+		case '=':	return second == '=' ? TwoChar::Equals : TwoChar::Unknown;
+		case '!':	return second == '=' ? TwoChar::NotEquals : TwoChar::Unknown;
+		case '<':
+			switch (second)
+			{
+				case '=':	return TwoChar::SmallerOrEqual;
+				case '<':	return TwoChar::BitshiftLeft;
+				default:	return TwoChar::Unknown;
+			}
+		case '>':
+			switch (second)
+			{
+				case '=':	return TwoChar::GreaterOrEqual;
+				case '>':	return TwoChar::BitshiftRight;
+				default:	return TwoChar::Unknown;
+			}
+		case '&':
+			switch (second)
+			{
+				case '&':	return TwoChar::LogicalAnd;
+				case '=':	return TwoChar::BitwiseAndAssign;
+				default:	return TwoChar::Unknown;
+			}
+		case '|':
+			switch (second)
+			{
+				case '|':	return TwoChar::LogicalOr;
+				case '=':	return TwoChar::BitwiseOrAssign;
+				default:	return TwoChar::Unknown;
+			}
+		case '+':
+			switch (second)
+			{
+				case '=':	return TwoChar::PlusAssign;
+				case '+':	return TwoChar::Increment;
+				default:	return TwoChar::Unknown;
+			}
+		case '-':
+			switch (second)
+			{
+				case '=':	return TwoChar::MinusAssign;
+				case '-':	return TwoChar::Decrement;
+				default:	return TwoChar::Unknown;
+			}
+		case '*':	return second == '=' ? TwoChar::TimesAssign : TwoChar::Unknown;
+		case '\\':	return second == '=' ? TwoChar::DivideAssign : TwoChar::Unknown;
+		case '^':	return second == '=' ? TwoChar::BitwiseXorAssign : TwoChar::Unknown;
+		case ':':	return second == ':' ? TwoChar::StaticAccessor : TwoChar::Unknown;
+		case '[':	return second == ']' ? TwoChar::ArrayBrackets : TwoChar::Unknown;
+		default:	return TwoChar::Unknown;
+	}
+}
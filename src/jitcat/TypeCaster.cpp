@@ -13,6 +13,19 @@
 using namespace jitcat;
 using namespace jitcat::Reflection;
 
+
+CatValue TypeCaster::castToValue(const std::any& pointer) const
+{
+	return CatValue::fromPointer(castToRawPointer(pointer));
+}
+
+
+std::any TypeCaster::castFromValue(const CatValue& value) const
+{
+	return castFromRawPointer(value.getPointer());
+}
+
+
 CustomObjectTypeCaster::CustomObjectTypeCaster(CustomTypeInfo* customType): 
     customType(customType) 
 {}
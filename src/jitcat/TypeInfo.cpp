@@ -11,6 +11,7 @@
 #include "jitcat/JitCat.h"
 #include "jitcat/MemberInfo.h"
 #include "jitcat/MemberFunctionInfo.h"
+#include "jitcat/MemoryStatistics.h"
 #include "jitcat/StaticConstMemberInfo.h"
 #include "jitcat/StaticMemberInfo.h"
 #include "jitcat/StaticMemberFunctionInfo.h"
@@ -30,7 +31,8 @@ TypeInfo::TypeInfo(const char* typeName, std::size_t typeSize, std::unique_ptr<T
 	typeName(typeName),
 	caster(std::move(caster)),
 	parentType(nullptr),
-	typeSize(typeSize)
+	typeSize(typeSize),
+	version(++lookupVersion)
 {
 	if (JitCat::get()->getHasPrecompiledExpression())
 	{
@@ -48,7 +50,7 @@ TypeInfo::~TypeInfo()
 	{
 		if ((iter.second->getType().isPointerToReflectableObjectType()
 			|| iter.second->getType().isReflectableHandleType())
-			&& (Tools::startsWith(iter.first, "$") || iter.second->getType().getOwnershipSemantics() == TypeOwnershipSemantics::Value))
+			&& (Tools::startsWith(iter.second->getMemberName(), "$") || iter.second->getType().getOwnershipSemantics() == TypeOwnershipSemantics::Value))
 		{
 			TypeInfo* typeInfo = iter.second->getType().getPointeeType()->getObjectType();
 			typeInfo->removeDependentType(this);
@@ -102,12 +104,31 @@ void TypeInfo::updateTypeDestruction()
 }
 
 
+unsigned long long TypeInfo::getLookupVersion()
+{
+	return lookupVersion;
+}
+
+
+unsigned long long TypeInfo::getVersion() const
+{
+	return version;
+}
+
+
+std::vector<TypeVersion>* TypeInfo::setRecordedLookups(std::vector<TypeVersion>* lookups)
+{
+	std::vector<TypeVersion>* previousLookups = recordedLookups;
+	recordedLookups = lookups;
+	return previousLookups;
+}
+
+
 bool TypeInfo::addType(TypeInfo* type)
 {
-	std::string lowercaseTypeName = Tools::toLowerCase(type->getTypeName());
-	if (types.find(lowercaseTypeName) == types.end())
+	if (types.emplace(SymbolTable::intern(type->getTypeName()), type).second)
 	{
-		types[lowercaseTypeName] = type;
+		updateLookupVersion();
 		type->setParentType(this);
 		return true;
 	}
@@ -117,11 +138,13 @@ bool TypeInfo::addType(TypeInfo* type)
 
 StaticConstMemberInfo* TypeInfo::addConstant(const std::string& name, const CatGenericType& type, const std::any& value)
 {
-	std::string lowercaseTypeName = Tools::toLowerCase(name);
-	if (staticConstMembers.find(lowercaseTypeName) == staticConstMembers.end())
+	SymbolId symbol = SymbolTable::intern(name);
+	if (staticConstMembers.find(symbol) == staticConstMembers.end())
 	{
-		staticConstMembers.emplace(std::make_pair(lowercaseTypeName, std::make_unique<StaticConstMemberInfo>(name, type, value)));
-		return staticConstMembers[lowercaseTypeName].get();
+		StaticConstMemberInfo* constMemberInfo = new StaticConstMemberInfo(name, type, value);
+		staticConstMembers.emplace(symbol, constMemberInfo);
+		updateLookupVersion();
+		return constMemberInfo;
 	}
 	return nullptr;
 }
@@ -135,11 +158,12 @@ void TypeInfo::setParentType(TypeInfo* type)
 
 bool TypeInfo::removeType(const std::string& typeName)
 {
-	auto iter = types.find(Tools::toLowerCase(typeName));
+	auto iter = types.find(SymbolTable::find(typeName));
 	if (iter != types.end())
 	{
 		iter->second->setParentType(nullptr);
 		types.erase(iter);
+		updateLookupVersion();
 		return true;
 	}
 	return false;
@@ -148,29 +172,25 @@ bool TypeInfo::removeType(const std::string& typeName)
 
 void TypeInfo::addDeserializedMember(TypeMemberInfo* memberInfo)
 {
-	std::string lowerCaseMemberName = Tools::toLowerCase(memberInfo->getMemberName());
-	members.emplace(lowerCaseMemberName,  memberInfo);
+	insertMember(Tools::toLowerCase(memberInfo->getMemberName()), memberInfo);
 }
 
 
 void TypeInfo::addDeserializedStaticMember(StaticMemberInfo* staticMemberInfo)
 {
-	std::string lowerCaseMemberName = Tools::toLowerCase(staticMemberInfo->memberName);
-	staticMembers.emplace(lowerCaseMemberName,  staticMemberInfo);
+	insertStaticMember(Tools::toLowerCase(staticMemberInfo->memberName), staticMemberInfo);
 }
 
 
 void TypeInfo::addDeserializedMemberFunction(MemberFunctionInfo* memberFunction)
 {
-	std::string lowerCaseMemberFunctionName = Tools::toLowerCase(memberFunction->getMemberFunctionName());
-	memberFunctions.emplace(lowerCaseMemberFunctionName, memberFunction);
+	insertMemberFunction(Tools::toLowerCase(memberFunction->getMemberFunctionName()), memberFunction);
 }
 
 
 void TypeInfo::addDeserializedStaticMemberFunction(StaticFunctionInfo* staticFunction)
 {
-	std::string lowerCaseMemberFunctionName = Tools::toLowerCase(staticFunction->getNormalFunctionName());
-	staticFunctions.emplace(lowerCaseMemberFunctionName, staticFunction);
+	insertStaticFunction(Tools::toLowerCase(staticFunction->getNormalFunctionName()), staticFunction);
 }
 
 
@@ -193,7 +213,7 @@ const CatGenericType& TypeInfo::getType(const std::vector<std::string>& indirect
 	int indirectionListSize = (int)indirectionList.size();
 	if (indirectionListSize > 0)
 	{
-		std::map<std::string, std::unique_ptr<TypeMemberInfo>>::const_iterator iter = members.find(indirectionList[offset]);
+		auto iter = members.find(SymbolTable::find(indirectionList[offset]));
 		if (iter != members.end())
 		{
 			TypeMemberInfo* memberInfo = iter->second.get();
@@ -219,7 +239,14 @@ const CatGenericType& TypeInfo::getType(const std::vector<std::string>& indirect
 
 TypeMemberInfo* TypeInfo::getMemberInfo(const std::string& identifier) const
 {
-	auto iter = members.find(Tools::toLowerCase(identifier));
+	return getMemberInfo(SymbolTable::find(identifier));
+}
+
+
+TypeMemberInfo* TypeInfo::getMemberInfo(SymbolId symbol) const
+{
+	recordLookup();
+	auto iter = members.find(symbol);
 	if (iter != members.end())
 	{
 		return iter->second.get();
@@ -233,7 +260,14 @@ TypeMemberInfo* TypeInfo::getMemberInfo(const std::string& identifier) const
 
 StaticMemberInfo* TypeInfo::getStaticMemberInfo(const std::string& identifier) const
 {
-	auto iter = staticMembers.find(Tools::toLowerCase(identifier));
+	return getStaticMemberInfo(SymbolTable::find(identifier));
+}
+
+
+StaticMemberInfo* TypeInfo::getStaticMemberInfo(SymbolId symbol) const
+{
+	recordLookup();
+	auto iter = staticMembers.find(symbol);
 	if (iter != staticMembers.end())
 	{
 		return iter->second.get();
@@ -247,7 +281,14 @@ StaticMemberInfo* TypeInfo::getStaticMemberInfo(const std::string& identifier) c
 
 StaticConstMemberInfo* TypeInfo::getStaticConstMemberInfo(const std::string& identifier) const
 {
-	auto iter = staticConstMembers.find(Tools::toLowerCase(identifier));
+	return getStaticConstMemberInfo(SymbolTable::find(identifier));
+}
+
+
+StaticConstMemberInfo* TypeInfo::getStaticConstMemberInfo(SymbolId symbol) const
+{
+	recordLookup();
+	auto iter = staticConstMembers.find(symbol);
 	if (iter != staticConstMembers.end())
 	{
 		return iter->second.get();
@@ -261,10 +302,17 @@ StaticConstMemberInfo* TypeInfo::getStaticConstMemberInfo(const std::string& ide
 
 MemberFunctionInfo* TypeInfo::getFirstMemberFunctionInfo(const std::string& identifier) const
 {
-	auto iter = memberFunctions.find(Tools::toLowerCase(identifier));
+	return getFirstMemberFunctionInfo(SymbolTable::find(identifier));
+}
+
+
+MemberFunctionInfo* TypeInfo::getFirstMemberFunctionInfo(SymbolId symbol) const
+{
+	recordLookup();
+	auto iter = memberFunctions.find(symbol);
 	if (iter != memberFunctions.end())
 	{
-		return iter->second.get();
+		return iter->second.front().get();
 	}
 	else
 	{
@@ -275,15 +323,17 @@ MemberFunctionInfo* TypeInfo::getFirstMemberFunctionInfo(const std::string& iden
 
 std::vector<MemberFunctionInfo*> jitcat::Reflection::TypeInfo::getMemberFunctionsByName(const std::string& functionName) const
 {
-	std::vector<MemberFunctionInfo*> foundFunctions;
-	std::string lowerCaseFunctionName = Tools::toLowerCase(functionName);
-	auto lowerBound = memberFunctions.lower_bound(lowerCaseFunctionName);
-	auto upperBound = memberFunctions.upper_bound(lowerCaseFunctionName);
-	for (auto& iter = lowerBound; iter != upperBound; ++iter)
+	recordLookup();
+	std::vector<MemberFunctionInfo*> functions;
+	auto iter = memberFunctions.find(SymbolTable::find(functionName));
+	if (iter != memberFunctions.end())
 	{
-		foundFunctions.push_back(iter->second.get());
+		for (const std::unique_ptr<MemberFunctionInfo>& memberFunction : iter->second)
+		{
+			functions.push_back(memberFunction.get());
+		}
 	}
-	return foundFunctions;
+	return functions;
 }
 
 
@@ -295,14 +345,16 @@ MemberFunctionInfo* TypeInfo::getMemberFunctionInfo(const FunctionSignature* fun
 
 MemberFunctionInfo* TypeInfo::getMemberFunctionInfo(const FunctionSignature& functionSignature) const
 {
-	std::string lowerCaseFunctionName = functionSignature.getLowerCaseFunctionName();
-	auto lowerBound = memberFunctions.lower_bound(lowerCaseFunctionName);
-	auto upperBound = memberFunctions.upper_bound(lowerCaseFunctionName);
-	for (auto& iter = lowerBound; iter != upperBound; ++iter)
+	recordLookup();
+	auto iter = memberFunctions.find(SymbolTable::find(functionSignature.getLowerCaseFunctionName()));
+	if (iter != memberFunctions.end())
 	{
-		if (iter->second->compare(functionSignature))
+		for (const std::unique_ptr<MemberFunctionInfo>& memberFunction : iter->second)
 		{
-			return iter->second.get();
+			if (memberFunction->compare(functionSignature))
+			{
+				return memberFunction.get();
+			}
 		}
 	}
 	return nullptr;
@@ -311,10 +363,11 @@ MemberFunctionInfo* TypeInfo::getMemberFunctionInfo(const FunctionSignature& fun
 
 StaticFunctionInfo* TypeInfo::getFirstStaticMemberFunctionInfo(const std::string& identifier) const
 {
-	auto iter = staticFunctions.find(Tools::toLowerCase(identifier));
+	recordLookup();
+	auto iter = staticFunctions.find(SymbolTable::find(identifier));
 	if (iter != staticFunctions.end())
 	{
-		return iter->second.get();
+		return iter->second.front().get();
 	}
 	else
 	{
@@ -331,14 +384,16 @@ StaticFunctionInfo* TypeInfo::getStaticMemberFunctionInfo(const FunctionSignatur
 
 StaticFunctionInfo* TypeInfo::getStaticMemberFunctionInfo(const FunctionSignature& functionSignature) const
 {
-	std::string lowerCaseFunctionName = functionSignature.getLowerCaseFunctionName();
-	auto lowerBound = staticFunctions.lower_bound(lowerCaseFunctionName);
-	auto upperBound = staticFunctions.upper_bound(lowerCaseFunctionName);
-	for (auto& iter = lowerBound; iter != upperBound; ++iter)
+	recordLookup();
+	auto iter = staticFunctions.find(SymbolTable::find(functionSignature.getLowerCaseFunctionName()));
+	if (iter != staticFunctions.end())
 	{
-		if (iter->second->compare(functionSignature))
+		for (const std::unique_ptr<StaticFunctionInfo>& staticFunction : iter->second)
 		{
-			return iter->second.get();
+			if (staticFunction->compare(functionSignature))
+			{
+				return staticFunction.get();
+			}
 		}
 	}
 	return nullptr;
@@ -347,7 +402,14 @@ StaticFunctionInfo* TypeInfo::getStaticMemberFunctionInfo(const FunctionSignatur
 
 TypeInfo* TypeInfo::getTypeInfo(const std::string& typeName) const
 {
-	auto iter = types.find(Tools::toLowerCase(typeName));
+	return getTypeInfo(SymbolTable::find(typeName));
+}
+
+
+TypeInfo* TypeInfo::getTypeInfo(SymbolId symbol) const
+{
+	recordLookup();
+	auto iter = types.find(symbol);
 	if (iter != types.end())
 	{
 		return iter->second;
@@ -386,39 +448,42 @@ void TypeInfo::setTypeName(const char* newTypeName)
 
 void TypeInfo::enumerateVariables(VariableEnumerator* enumerator, bool allowEmptyStructs) const
 {
-	for (auto& iter : memberFunctions)
+	for (const auto* overloads : SymbolTable::sortByName(memberFunctions))
 	{
-		std::stringstream result;
-		result << iter.second->getMemberFunctionName();
-		result << "(";
-		std::size_t numArguments = iter.second->getNumberOfArguments();
-		for (std::size_t i = 0; i < numArguments; i++)
+		for (const std::unique_ptr<MemberFunctionInfo>& memberFunction : overloads->second)
 		{
-			if (i > 0)
+			std::stringstream result;
+			result << memberFunction->getMemberFunctionName();
+			result << "(";
+			std::size_t numArguments = memberFunction->getNumberOfArguments();
+			for (std::size_t i = 0; i < numArguments; i++)
 			{
-				result << ", ";
+				if (i > 0)
+				{
+					result << ", ";
+				}
+				result << memberFunction->getArgumentType(i).toString();
 			}
-			result << iter.second->getArgumentType(i).toString();
+			result << ")";
+			enumerator->addFunction(memberFunction->getMemberFunctionName(), result.str());
 		}
-		result << ")";
-		enumerator->addFunction(iter.second->getMemberFunctionName(), result.str());
 	}
 
-	auto last = members.end();
-	for (auto iter = members.begin(); iter != last; ++iter)
+	for (const auto* member : SymbolTable::sortByName(members))
 	{
-		const CatGenericType& memberType = iter->second->getType();
+		const TypeMemberInfo* memberInfo = member->second.get();
+		const CatGenericType& memberType = memberInfo->getType();
 		if (memberType.isBasicType() || memberType.isStringType() || memberType.isEnumType())
 		{
 			std::string catTypeName = memberType.toString();
-			enumerator->addVariable(iter->second->getMemberName(), catTypeName, iter->second->getType().isWritable(), iter->second->getType().isConst());
+			enumerator->addVariable(memberInfo->getMemberName(), catTypeName, memberInfo->getType().isWritable(), memberInfo->getType().isConst());
 		}
 		else if (memberType.isPointerToReflectableObjectType() || memberType.isReflectableHandleType())
 		{
 			std::string nestedTypeName = memberType.toString();
 			if (allowEmptyStructs || memberType.getPointeeType()->getObjectType()->getMembers().size() > 0)
 			{
-				enumerator->enterNameSpace(iter->second->getMemberName(), nestedTypeName, NamespaceType::Object);
+				enumerator->enterNameSpace(memberInfo->getMemberName(), nestedTypeName, NamespaceType::Object);
 				if (!Tools::isInList(enumerator->loopDetectionTypeStack, nestedTypeName))
 				{
 					enumerator->loopDetectionTypeStack.push_back(nestedTypeName);
@@ -472,13 +537,13 @@ bool Reflection::TypeInfo::isTriviallyConstructable() const
 }
 
 
-const std::map<std::string, std::unique_ptr<TypeMemberInfo>>& TypeInfo::getMembers() const
+const std::unordered_map<SymbolId, std::unique_ptr<TypeMemberInfo>>& TypeInfo::getMembers() const
 {
 	return members;
 }
 
 
-const std::map<std::string, std::unique_ptr<StaticMemberInfo>>& jitcat::Reflection::TypeInfo::getStaticMembers() const
+const std::unordered_map<SymbolId, std::unique_ptr<StaticMemberInfo>>& jitcat::Reflection::TypeInfo::getStaticMembers() const
 {
 	return staticMembers;
 }
@@ -490,19 +555,19 @@ const std::map<unsigned long long, TypeMemberInfo*>& jitcat::Reflection::TypeInf
 }
 
 
-const std::multimap<std::string, std::unique_ptr<MemberFunctionInfo>>& TypeInfo::getMemberFunctions() const
+const std::unordered_map<SymbolId, std::vector<std::unique_ptr<MemberFunctionInfo>>>& TypeInfo::getMemberFunctions() const
 {
 	return memberFunctions;
 }
 
 
-const std::multimap<std::string, std::unique_ptr<StaticFunctionInfo>>& TypeInfo::getStaticMemberFunctions() const
+const std::unordered_map<SymbolId, std::vector<std::unique_ptr<StaticFunctionInfo>>>& TypeInfo::getStaticMemberFunctions() const
 {
 	return staticFunctions;
 }
 
 
-const std::map<std::string, TypeInfo*>& TypeInfo::getTypes() const
+const std::unordered_map<SymbolId, TypeInfo*>& TypeInfo::getTypes() const
 {
 	return types;
 }
@@ -611,6 +676,40 @@ bool TypeInfo::canBeDeleted() const
 }
 
 
+std::size_t TypeInfo::getMemoryUsage() const
+{
+	using namespace MemoryEstimation;
+	std::size_t memory = sizeof(TypeInfo) + getHashMemory(members) + getTreeMemory(membersByOrdinal) + getHashMemory(memberFunctions) 
+						 + getHashMemory(staticMembers) + getHashMemory(staticConstMembers) + getHashMemory(staticFunctions) 
+						 + getHashMemory(types) + getTreeMemory(dependentTypes);
+	//Member infos are counted by the size of their base class, their actual size is not known here.
+	for (auto& iter : members)
+	{
+		memory += sizeof(TypeMemberInfo) + getStringMemory(iter.second->getMemberName());
+	}
+	for (auto& iter : memberFunctions)
+	{
+		memory += getVectorMemory(iter.second);
+		for (const std::unique_ptr<MemberFunctionInfo>& function : iter.second)
+		{
+			memory += sizeof(MemberFunctionInfo) + getStringMemory(function->getMemberFunctionName()) 
+					  + getStringMemory(function->getLowerCaseFunctionName()) + getVectorMemory(function->getArgumentTypes())
+					  + getStringMemory(function->getInlineBody()) + getStringMemory(function->getInlineBodyFunctionName());
+		}
+	}
+	memory += staticMembers.size() * sizeof(StaticMemberInfo);
+	for (auto& iter : staticConstMembers)
+	{
+		memory += sizeof(StaticConstMemberInfo) + getStringMemory(iter.second->getName()) + getStringMemory(iter.second->getLowerCaseName());
+	}
+	for (auto& iter : staticFunctions)
+	{
+		memory += getVectorMemory(iter.second) + iter.second.size() * sizeof(StaticFunctionInfo);
+	}
+	return memory;
+}
+
+
 bool jitcat::Reflection::TypeInfo::canBeAssignedBy(const CatGenericType& type) const
 {
 	SearchFunctionSignature searchSignature("=", {type.removeIndirection().toPointer()});
@@ -630,14 +729,13 @@ void TypeInfo::addDependentType(TypeInfo* otherType)
 
 void TypeInfo::renameMember(const std::string& oldMemberName, const std::string& newMemberName)
 {
-	auto iter = members.find(Tools::toLowerCase(oldMemberName));
-	if (iter != members.end() && members.find(Tools::toLowerCase(newMemberName)) == members.end() && !iter->second->isDeferred())
+	auto iter = members.find(SymbolTable::find(oldMemberName));
+	if (iter != members.end() && members.find(SymbolTable::find(newMemberName)) == members.end() && !iter->second->isDeferred())
 	{
 		std::unique_ptr<TypeMemberInfo> memberInfo = std::move(iter->second);
 		memberInfo->setMemberName(newMemberName);
 		members.erase(iter);
-		std::string lowerCaseMemberName = Tools::toLowerCase(newMemberName);
-		members.emplace(lowerCaseMemberName, std::move(memberInfo));
+		insertMember(Tools::toLowerCase(newMemberName), memberInfo.release());
 	}
 }
 
@@ -662,15 +760,18 @@ void TypeInfo::addDeferredMembers(TypeMemberInfo* deferredMember)
 		if (member.second->getMemberVisibility() == MemberVisibility::Public
 			|| member.second->getMemberVisibility() == MemberVisibility::Protected)
 		{
-			members.emplace(member.first, member.second->toDeferredTypeMemberInfo(deferredMember));
+			insertMember(member.first, member.second->toDeferredTypeMemberInfo(deferredMember));
 		}
 	}
-	for (auto& memberFunction : deferredMemberFunctions)
+	for (auto& overloads : deferredMemberFunctions)
 	{
-		if (memberFunction.second->getVisibility() == MemberVisibility::Public
-			|| memberFunction.second->getVisibility() == MemberVisibility::Protected)
+		for (auto& memberFunction : overloads.second)
 		{
-			memberFunctions.emplace(memberFunction.first, memberFunction.second->toDeferredMemberFunction(deferredMember, this));
+			if (memberFunction->getVisibility() == MemberVisibility::Public
+				|| memberFunction->getVisibility() == MemberVisibility::Protected)
+			{
+				insertMemberFunction(overloads.first, memberFunction->toDeferredMemberFunction(deferredMember, this));
+			}
 		}
 	}
 }
@@ -679,18 +780,19 @@ void TypeInfo::addDeferredMembers(TypeMemberInfo* deferredMember)
 void TypeInfo::addMember(const std::string& memberName, TypeMemberInfo* memberInfo)
 {
 	membersByOrdinal[memberInfo->getOrdinal()] = memberInfo;
-	members.emplace(memberName, memberInfo);
+	insertMember(memberName, memberInfo);
 }
 
 
 TypeMemberInfo* TypeInfo::releaseMember(const std::string& memberName)
 {
-	auto iter = members.find(memberName);
+	auto iter = members.find(SymbolTable::find(memberName));
 	if (iter != members.end())
 	{
 		TypeMemberInfo* memberInfo = iter->second.release();
 
 		members.erase(iter);
+		updateLookupVersion();
 
 		auto oridinalIter = membersByOrdinal.find(memberInfo->getOrdinal());
 		if (oridinalIter != membersByOrdinal.end())
@@ -704,4 +806,69 @@ TypeMemberInfo* TypeInfo::releaseMember(const std::string& memberName)
 }
 
 
-std::vector<TypeInfo*> TypeInfo::typeDeletionList = std::vector<TypeInfo*>();
\ No newline at end of file
+bool TypeInfo::insertMember(const std::string& lowerCaseName, TypeMemberInfo* memberInfo)
+{
+	return insertMember(SymbolTable::intern(lowerCaseName), memberInfo);
+}
+
+
+bool TypeInfo::insertMember(SymbolId symbol, TypeMemberInfo* memberInfo)
+{
+	if (members.emplace(symbol, memberInfo).second)
+	{
+		updateLookupVersion();
+		return true;
+	}
+	return false;
+}
+
+
+bool TypeInfo::insertStaticMember(const std::string& lowerCaseName, StaticMemberInfo* staticMemberInfo)
+{
+	if (staticMembers.emplace(SymbolTable::intern(lowerCaseName), staticMemberInfo).second)
+	{
+		updateLookupVersion();
+		return true;
+	}
+	return false;
+}
+
+
+void TypeInfo::insertMemberFunction(const std::string& lowerCaseName, MemberFunctionInfo* memberFunctionInfo)
+{
+	insertMemberFunction(SymbolTable::intern(lowerCaseName), memberFunctionInfo);
+}
+
+
+void TypeInfo::insertMemberFunction(SymbolId symbol, MemberFunctionInfo* memberFunctionInfo)
+{
+	memberFunctions[symbol].emplace_back(memberFunctionInfo);
+	updateLookupVersion();
+}
+
+
+void TypeInfo::insertStaticFunction(const std::string& lowerCaseName, StaticFunctionInfo* staticFunctionInfo)
+{
+	staticFunctions[SymbolTable::intern(lowerCaseName)].emplace_back(staticFunctionInfo);
+	updateLookupVersion();
+}
+
+
+void TypeInfo::recordLookup() const
+{
+	if (recordedLookups != nullptr)
+	{
+		recordedLookups->push_back({this, version});
+	}
+}
+
+
+void TypeInfo::updateLookupVersion()
+{
+	version = ++lookupVersion;
+}
+
+
+std::vector<TypeInfo*> TypeInfo::typeDeletionList = std::vector<TypeInfo*>();
+std::atomic<unsigned long long> TypeInfo::lookupVersion = 0;
+thread_local std::vector<TypeVersion>* TypeInfo::recordedLookups = nullptr;
\ No newline at end of file
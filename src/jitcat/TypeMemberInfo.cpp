@@ -24,6 +24,12 @@ std::any TypeMemberInfo::getAssignableMemberReference(unsigned char* base)
 }
 
 
+CatValue TypeMemberInfo::getMemberValue(unsigned char* base)
+{
+	return CatValue::fromAny(getMemberReference(base), catType);
+}
+
+
 llvm::Value* TypeMemberInfo::generateDereferenceCode(llvm::Value* parentObjectPointer, LLVM::LLVMCompileTimeContext* context) const
 {
 	return nullptr;
@@ -76,3 +82,15 @@ void TypeMemberInfo::setVisibility(MemberVisibility newVisibility)
 {
 	visibility = newVisibility;
 }
+
+
+bool TypeMemberInfo::getIsTrustedNonNull() const
+{
+	return trustedNonNull;
+}
+
+
+void TypeMemberInfo::setIsTrustedNonNull(bool isTrustedNonNull)
+{
+	trustedNonNull = isTrustedNonNull;
+}
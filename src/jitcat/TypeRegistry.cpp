@@ -49,10 +49,18 @@ void TypeRegistry::recreate()
 
 TypeInfo* TypeRegistry::getTypeInfo(const std::string& typeName)
 {
-	std::string lowerName = Tools::toLowerCase(typeName);;
-	std::map<std::string, TypeInfo*>::iterator iter = types.find(lowerName);
+	return getTypeInfo(SymbolTable::find(typeName));
+}
+
+
+TypeInfo* TypeRegistry::getTypeInfo(SymbolId symbol)
+{
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	auto iter = types.find(symbol);
 	if (iter != types.end())
 	{
+		//The result of this lookup only changes if the type is removed, which changes the version of the type.
+		iter->second->recordLookup();
 		return iter->second;
 	}
 	else
@@ -62,51 +70,67 @@ TypeInfo* TypeRegistry::getTypeInfo(const std::string& typeName)
 }
 
 
-const std::map<std::string, TypeInfo*>& TypeRegistry::getTypes() const
+const std::unordered_map<SymbolId, TypeInfo*>& TypeRegistry::getTypes() const
 {
 	return types;
 }
 
 
+std::size_t TypeRegistry::getNumOwnedTypes() const
+{
+	return ownedTypes.size();
+}
+
+
+std::size_t TypeRegistry::getOwnedTypesMemoryUsage() const
+{
+	std::size_t memory = 0;
+	for (auto& iter : ownedTypes)
+	{
+		memory += iter->getMemoryUsage();
+	}
+	return memory;
+}
+
+
 void TypeRegistry::registerType(const char* typeName, TypeInfo* typeInfo)
 {
-	std::string lowerName = Tools::toLowerCase(typeName);
-	std::map<std::string, TypeInfo*>::iterator iter = types.find(lowerName);
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	auto iter = types.find(SymbolTable::find(typeName));
 	if (iter == types.end())
 	{
-		types[lowerName] = typeInfo;
+		insertType(typeName, typeInfo);
 	}
 	else
 	{
-		std::cout << "ERROR: duplicate type definition: " << iter->first << ".\n";
+		std::cout << "ERROR: duplicate type definition: " << SymbolTable::getName(iter->first) << ".\n";
 	}
 }
 
 
 void TypeRegistry::removeType(const char* typeName)
 {
-	std::string lowerName = Tools::toLowerCase(typeName);
-	std::map<std::string, TypeInfo*>::iterator iter = types.find(lowerName);
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	auto iter = types.find(SymbolTable::find(typeName));
 	if (iter != types.end())
 	{
 		//TypeInfo is leaked here, but since removing types is very rare and TypeInfo* are stored everywhere, this accepable.
 		//Deleting it would likely cause crashes. Fixing this properly requires a large time investment.
-		types.erase(iter);
+		eraseType(iter);
 	}
 }
 
 
 void TypeRegistry::renameType(const std::string& oldName, const char* newTypeName)
 {
-	std::string oldLower = Tools::toLowerCase(oldName);
-	std::string newLower = Tools::toLowerCase(newTypeName);
-	std::map<std::string, TypeInfo*>::iterator iter = types.find(oldLower);
-	if (iter != types.end() && types.find(newLower) == types.end())
+	std::lock_guard<std::recursive_mutex> lock(mutex);
+	auto iter = types.find(SymbolTable::find(oldName));
+	if (iter != types.end() && types.find(SymbolTable::find(newTypeName)) == types.end())
 	{
 		TypeInfo* oldTypeInfo = iter->second;
-		types.erase(iter);
+		eraseType(iter);
 		oldTypeInfo->setTypeName(newTypeName);
-		types[newLower] = oldTypeInfo;
+		insertType(newTypeName, oldTypeInfo);
 	}
 }
 
@@ -134,7 +158,7 @@ bool TypeRegistry::loadRegistryFromXML(const std::string& filepath)
 		TypeInfo* currentTypeInfo = nullptr;
 
 		std::map<std::string, TypeInfo*> typeInfos;
-		auto iter = types.find("string");
+		auto iter = types.find(SymbolTable::find("string"));
 		if (iter != types.end())
 		{
 			typeInfos["string"] = iter->second;
@@ -195,9 +219,9 @@ bool TypeRegistry::loadRegistryFromXML(const std::string& filepath)
 						}
 						else if (currentTypeInfo != nullptr && tagType == XMLLineType::CloseTag && tagName == "Type")
 						{
-							if (types.find(currentTypeInfo->getTypeName()) == types.end())
+							if (types.find(SymbolTable::find(currentTypeInfo->getTypeName())) == types.end())
 							{
-								types[Tools::toLowerCase(currentTypeInfo->getTypeName())] = currentTypeInfo;
+								insertType(currentTypeInfo->getTypeName(), currentTypeInfo);
 								currentTypeInfo = nullptr;
 								readState = XMLReadState::ReadingRegistry;
 							}
@@ -292,21 +316,24 @@ void TypeRegistry::exportRegistyToXML(const std::string& filepath)
 	std::ofstream xmlFile;
 	xmlFile.open(filepath);
 	xmlFile << "<TypeRegistry>\n";
-	for (auto& iter : types)
+	//Sorted by name so that exporting the same types always produces the same file.
+	const SymbolId stringSymbol = SymbolTable::find("string");
+	for (const auto* type : SymbolTable::sortByName(types))
 	{
-		if (iter.first == "string") continue;
+		const auto& iter = *type;
+		if (iter.first == stringSymbol) continue;
 
 		xmlFile << "\t<Type>\n";
 		xmlFile << "\t\t<Name>" << Tools::toXMLCompatible(iter.second->getTypeName()) << "</Name>\n";
 		if (iter.second->getMembers().size() > 0)
 		{
 			xmlFile << "\t\t<Members>\n";
-			for (auto& member : iter.second->getMembers())
+			for (const auto* member : SymbolTable::sortByName(iter.second->getMembers()))
 			{
 				xmlFile << "\t\t\t<Member>\n";
-				xmlFile << "\t\t\t\t<Name>" << member.second->getMemberName() << "</Name>\n";
+				xmlFile << "\t\t\t\t<Name>" << member->second->getMemberName() << "</Name>\n";
 
-				member.second->getType().writeToXML(xmlFile, "\t\t\t\t");
+				member->second->getType().writeToXML(xmlFile, "\t\t\t\t");
 			
 				xmlFile << "\t\t\t</Member>\n";
 			}
@@ -315,12 +342,12 @@ void TypeRegistry::exportRegistyToXML(const std::string& filepath)
 		if (iter.second->getStaticMembers().size() > 0)
 		{
 			xmlFile << "\t\t<StaticMembers>\n";
-			for (auto& member : iter.second->getStaticMembers())
+			for (const auto* member : SymbolTable::sortByName(iter.second->getStaticMembers()))
 			{
 				xmlFile << "\t\t\t<StaticMember>\n";
-				xmlFile << "\t\t\t\t<Name>" << member.second->memberName << "</Name>\n";
+				xmlFile << "\t\t\t\t<Name>" << member->second->memberName << "</Name>\n";
 
-				member.second->catType.writeToXML(xmlFile, "\t\t\t\t");
+				member->second->catType.writeToXML(xmlFile, "\t\t\t\t");
 			
 				xmlFile << "\t\t\t</StaticMember>\n";
 			}
@@ -329,44 +356,50 @@ void TypeRegistry::exportRegistyToXML(const std::string& filepath)
 		if (iter.second->getMemberFunctions().size() > 0)
 		{
 			xmlFile << "\t\t<MemberFunctions>\n";
-			for (auto& member : iter.second->getMemberFunctions())
+			for (const auto* overloads : SymbolTable::sortByName(iter.second->getMemberFunctions()))
 			{
-				xmlFile << "\t\t\t<MemberFunction>\n";
-				xmlFile << "\t\t\t\t<Name>" << Tools::toXMLCompatible(member.second->getMemberFunctionName()) << "</Name>\n";		
-				xmlFile << "\t\t\t\t<ReturnType>\n";
-				member.second->getReturnType().writeToXML(xmlFile, "\t\t\t\t\t");
-				xmlFile << "\t\t\t\t</ReturnType>\n";
-				xmlFile << "\t\t\t\t<Arguments>\n";
-				for (auto& argument : member.second->getArgumentTypes())
+				for (auto& member : overloads->second)
 				{
-					xmlFile << "\t\t\t\t\t<Argument>\n";
-					argument.writeToXML(xmlFile, "\t\t\t\t\t\t");
-					xmlFile << "\t\t\t\t\t</Argument>\n";
+					xmlFile << "\t\t\t<MemberFunction>\n";
+					xmlFile << "\t\t\t\t<Name>" << Tools::toXMLCompatible(member->getMemberFunctionName()) << "</Name>\n";		
+					xmlFile << "\t\t\t\t<ReturnType>\n";
+					member->getReturnType().writeToXML(xmlFile, "\t\t\t\t\t");
+					xmlFile << "\t\t\t\t</ReturnType>\n";
+					xmlFile << "\t\t\t\t<Arguments>\n";
+					for (auto& argument : member->getArgumentTypes())
+					{
+						xmlFile << "\t\t\t\t\t<Argument>\n";
+						argument.writeToXML(xmlFile, "\t\t\t\t\t\t");
+						xmlFile << "\t\t\t\t\t</Argument>\n";
+					}
+					xmlFile << "\t\t\t\t</Arguments>\n";
+					xmlFile << "\t\t\t</MemberFunction>\n";
 				}
-				xmlFile << "\t\t\t\t</Arguments>\n";
-				xmlFile << "\t\t\t</MemberFunction>\n";
 			}
 			xmlFile << "\t\t</MemberFunctions>\n";
 		}
 		if (iter.second->getStaticMemberFunctions().size() > 0)
 		{
 			xmlFile << "\t\t<StaticMemberFunctions>\n";
-			for (auto& member : iter.second->getStaticMemberFunctions())
+			for (const auto* overloads : SymbolTable::sortByName(iter.second->getStaticMemberFunctions()))
 			{
-				xmlFile << "\t\t\t<StaticMemberFunction>\n";
-				xmlFile << "\t\t\t\t<Name>" << Tools::toXMLCompatible(member.second->getNormalFunctionName()) << "</Name>\n";		
-				xmlFile << "\t\t\t\t<ReturnType>\n";
-				member.second->getReturnType().writeToXML(xmlFile, "\t\t\t\t\t");
-				xmlFile << "\t\t\t\t</ReturnType>\n";
-				xmlFile << "\t\t\t\t<Arguments>\n";
-				for (auto& argument : member.second->getArgumentTypes())
+				for (auto& member : overloads->second)
 				{
-					xmlFile << "\t\t\t\t\t<Argument>\n";
-					argument.writeToXML(xmlFile, "\t\t\t\t\t\t");
-					xmlFile << "\t\t\t\t\t</Argument>\n";
+					xmlFile << "\t\t\t<StaticMemberFunction>\n";
+					xmlFile << "\t\t\t\t<Name>" << Tools::toXMLCompatible(member->getNormalFunctionName()) << "</Name>\n";		
+					xmlFile << "\t\t\t\t<ReturnType>\n";
+					member->getReturnType().writeToXML(xmlFile, "\t\t\t\t\t");
+					xmlFile << "\t\t\t\t</ReturnType>\n";
+					xmlFile << "\t\t\t\t<Arguments>\n";
+					for (auto& argument : member->getArgumentTypes())
+					{
+						xmlFile << "\t\t\t\t\t<Argument>\n";
+						argument.writeToXML(xmlFile, "\t\t\t\t\t\t");
+						xmlFile << "\t\t\t\t\t</Argument>\n";
+					}
+					xmlFile << "\t\t\t\t</Arguments>\n";
+					xmlFile << "\t\t\t</StaticMemberFunction>\n";
 				}
-				xmlFile << "\t\t\t\t</Arguments>\n";
-				xmlFile << "\t\t\t</StaticMemberFunction>\n";
 			}
 			xmlFile << "\t\t</StaticMemberFunctions>\n";
 		}
@@ -417,4 +450,17 @@ ReflectedEnumTypeInfo* jitcat::Reflection::TypeRegistry::castToReflectedEnumType
 }
 
 
+void TypeRegistry::insertType(const std::string& typeName, TypeInfo* typeInfo)
+{
+	types[SymbolTable::intern(typeName)] = typeInfo;
+}
+
+
+void TypeRegistry::eraseType(std::unordered_map<SymbolId, TypeInfo*>::iterator typeIterator)
+{
+	typeIterator->second->updateLookupVersion();
+	types.erase(typeIterator);
+}
+
+
 TypeRegistry* TypeRegistry::instance = nullptr;
@@ -0,0 +1,154 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+using namespace Benchmarks;
+
+
+BenchmarkRunner::BenchmarkRunner():
+	minimumTime(0.1),
+	numRepetitions(3)
+{
+}
+
+
+void BenchmarkRunner::add(const std::string& name, BenchmarkFunction function)
+{
+	benchmarks.push_back({name, function});
+}
+
+
+void BenchmarkRunner::addContext(const std::string& key, const std::string& value)
+{
+	context.emplace_back(key, value);
+}
+
+
+void BenchmarkRunner::setFilter(const std::string& filter_)
+{
+	filter = filter_;
+}
+
+
+void BenchmarkRunner::setMinimumTime(double seconds)
+{
+	minimumTime = seconds;
+}
+
+
+void BenchmarkRunner::setNumRepetitions(std::size_t repetitions)
+{
+	numRepetitions = std::max<std::size_t>(1, repetitions);
+}
+
+
+void BenchmarkRunner::run(std::ostream& progressStream)
+{
+	results.clear();
+	for (const Benchmark& benchmark : benchmarks)
+	{
+		if (!filter.empty() && benchmark.name.find(filter) == std::string::npos)
+		{
+			continue;
+		}
+		//Also warms up caches and compiles expressions that are compiled on first use.
+		std::size_t numIterations = 1;
+		double elapsed = runTimed(benchmark.function, numIterations);
+		while (elapsed < minimumTime * 1000000000.0 && numIterations < ((std::size_t)1 << 40))
+		{
+			//Aim for the minimum time, but grow by at most a factor of ten per step in case the first runs were not representative.
+			double factor = elapsed > 0.0 ? std::min(10.0, std::max(2.0, 1.4 * minimumTime * 1000000000.0 / elapsed)) : 10.0;
+			numIterations = (std::size_t)((double)numIterations * factor);
+			elapsed = runTimed(benchmark.function, numIterations);
+		}
+		std::vector<double> times;
+		times.push_back(elapsed / (double)numIterations);
+		while (times.size() < numRepetitions)
+		{
+			times.push_back(runTimed(benchmark.function, numIterations) / (double)numIterations);
+		}
+		std::sort(times.begin(), times.end());
+		Result result = {benchmark.name, numIterations, times[times.size() / 2], times.front(), times.back()};
+		results.push_back(result);
+		progressStream << std::left << std::setw(64) << result.name << std::right << std::setw(16) << std::fixed << std::setprecision(1) 
+					   << result.medianTime << " ns" << std::setw(14) << result.numIterations << "\n";
+		progressStream.flush();
+	}
+}
+
+
+void BenchmarkRunner::writeJSON(std::ostream& stream) const
+{
+	stream << "{\n  \"context\": {\n";
+	for (std::size_t i = 0; i < context.size(); ++i)
+	{
+		stream << "    \"" << escapeJSON(context[i].first) << "\": \"" << escapeJSON(context[i].second) << "\"" << (i + 1 < context.size() ? ",\n" : "\n");
+	}
+	stream << "  },\n  \"benchmarks\": [\n";
+	for (std::size_t i = 0; i < results.size(); ++i)
+	{
+		const Result& result = results[i];
+		stream << "    {\n"
+			   << "      \"name\": \"" << escapeJSON(result.name) << "\",\n"
+			   << "      \"run_type\": \"aggregate\",\n"
+			   << "      \"aggregate_name\": \"median\",\n"
+			   << "      \"repetitions\": " << numRepetitions << ",\n"
+			   << "      \"iterations\": " << result.numIterations << ",\n"
+			   << std::setprecision(3) << std::fixed
+			   << "      \"real_time\": " << result.medianTime << ",\n"
+			   << "      \"min_time\": " << result.minimumTime << ",\n"
+			   << "      \"max_time\": " << result.maximumTime << ",\n"
+			   << "      \"time_unit\": \"ns\",\n"
+			   << "      \"items_per_second\": " << (result.medianTime > 0.0 ? 1000000000.0 / result.medianTime : 0.0) << "\n"
+			   << "    }" << (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	stream << "  ]\n}\n";
+}
+
+
+double BenchmarkRunner::runTimed(const BenchmarkFunction& function, std::size_t numIterations)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	function(numIterations);
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+
+std::string BenchmarkRunner::escapeJSON(const std::string& text)
+{
+	std::ostringstream escaped;
+	for (char character : text)
+	{
+		switch (character)
+		{
+			case '"':	escaped << "\\\""; break;
+			case '\\':	escaped << "\\\\"; break;
+			case '\n':	escaped << "\\n"; break;
+			case '\r':	escaped << "\\r"; break;
+			case '\t':	escaped << "\\t"; break;
+			default:
+				if ((unsigned char)character < 0x20)
+				{
+					escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)(unsigned char)character << std::dec << std::setfill(' ');
+				}
+				else
+				{
+					escaped << character;
+				}
+				break;
+		}
+	}
+	return escaped.str();
+}
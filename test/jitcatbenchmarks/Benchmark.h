@@ -0,0 +1,125 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace Benchmarks
+{
+	//Prevents the compiler from optimizing away the computation of value.
+	template<typename T>
+	inline void doNotOptimize(const T& value)
+	{
+#if defined(_MSC_VER)
+		static const volatile void* sink;
+		sink = &value;
+#else
+		asm volatile("" : : "r"(&value) : "memory");
+#endif
+	}
+
+
+	//Runs benchmarks and reports the time per iteration. A benchmark is a function that executes its workload the given number of times.
+	//The number of iterations is doubled until a run takes at least the minimum time, after which the benchmark is repeated
+	//and the median time per iteration is reported.
+	class BenchmarkRunner
+	{
+	public:
+		using BenchmarkFunction = std::function<void(std::size_t numIterations)>;
+
+		BenchmarkRunner();
+
+		//Benchmark names are grouped with slashes, for example "Frontend/Parse/MemberChain".
+		void add(const std::string& name, BenchmarkFunction function);
+
+		//Adds a key and value to the context section of the JSON output.
+		void addContext(const std::string& key, const std::string& value);
+
+		//Only benchmarks of which the name contains filter are run. An empty filter runs all benchmarks.
+		void setFilter(const std::string& filter);
+		void setMinimumTime(double seconds);
+		void setNumRepetitions(std::size_t repetitions);
+
+		//Runs the benchmarks, printing progress to progressStream.
+		void run(std::ostream& progressStream);
+
+		//Writes the results in the JSON format of Google Benchmark, so that existing tools can compare results of different releases.
+		void writeJSON(std::ostream& stream) const;
+
+	private:
+		struct Benchmark
+		{
+			std::string name;
+			BenchmarkFunction function;
+		};
+		struct Result
+		{
+			std::string name;
+			std::size_t numIterations;
+			//In nanoseconds.
+			double medianTime;
+			double minimumTime;
+			double maximumTime;
+		};
+
+		static double runTimed(const BenchmarkFunction& function, std::size_t numIterations);
+		static std::string escapeJSON(const std::string& text);
+
+	private:
+		std::vector<Benchmark> benchmarks;
+		std::vector<std::pair<std::string, std::string>> context;
+		std::vector<Result> results;
+		std::string filter;
+		double minimumTime;
+		std::size_t numRepetitions;
+	};
+
+
+	//Expression shapes that are benchmarked by both the frontend and the expression benchmarks.
+	//They are compiled in a context that has a TestObjects::ReflectedObject, with nested objects, as a static scope.
+	namespace Shapes
+	{
+		//int
+		constexpr const char* arithmetic = "theInt * 3 + largeInt / 7 - 11";
+		//int
+		constexpr const char* memberChain = "nestedSelfObject.nestedObject.someInt + nestedObjectPointer.someInt";
+		//int
+		constexpr const char* memberFunctionCall = "getInt() * 2 + getConstInt()";
+		//float
+		constexpr const char* builtInFunctionCall = "sqrt(aFloat) + abs(negativeFloat)";
+		//std::string
+		constexpr const char* stringConcatenation = "text + theInt + \"!\"";
+		//float, indexing yields a float pointer that is dereferenced because it is the result of the expression.
+		constexpr const char* vectorIndexing = "floatVector[1]";
+		constexpr const char* mapIndexing = "intToFloatMap[42]";
+
+		const std::vector<std::pair<const char*, const char*>> all = {
+			{"Arithmetic", arithmetic},
+			{"MemberChain", memberChain},
+			{"MemberFunctionCall", memberFunctionCall},
+			{"BuiltInFunctionCall", builtInFunctionCall},
+			{"StringConcatenation", stringConcatenation},
+			{"VectorIndexing", vectorIndexing},
+			{"MapIndexing", mapIndexing}
+		};
+	}
+
+
+	void registerFrontendBenchmarks(BenchmarkRunner& runner);
+	void registerExpressionBenchmarks(BenchmarkRunner& runner);
+	void registerCatLibBenchmarks(BenchmarkRunner& runner);
+	void registerReflectableHandleBenchmarks(BenchmarkRunner& runner);
+
+} //End namespace Benchmarks
@@ -0,0 +1,81 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "Benchmark.h"
+#include "jitcat/CatLib.h"
+#include "jitcat/CatTokenizer.h"
+#include "jitcat/Document.h"
+#include "jitcat/Tools.h"
+
+#include <string>
+
+using namespace Benchmarks;
+using namespace jitcat;
+
+
+namespace
+{
+	std::string createClassSource(const std::string& className)
+	{
+		return Tools::append(
+			"class ", className, "\n"
+			"{\n"
+			"	float aFloat = 42.0f;\n"
+			"	int anInt = -1;\n"
+			"	string aString = \"Hello!\";\n"
+			"\n"
+			"	float getFloat() { return aFloat;}\n"
+			"	int addToInt(int value) { return anInt + value;}\n"
+			"	string getString() { return aString + anInt;}\n"
+			"	int sum(int count)\n"
+			"	{\n"
+			"		int total = 0;\n"
+			"		for i in range(count)\n"
+			"		{\n"
+			"			total = total + i;\n"
+			"		}\n"
+			"		return total;\n"
+			"	}\n"
+			"}\n");
+	}
+
+
+	void addCatLibBenchmark(BenchmarkRunner& runner, const std::string& name, const std::string& source)
+	{
+		runner.add(name, [source](std::size_t numIterations)
+			{
+				for (std::size_t i = 0; i < numIterations; ++i)
+				{
+					CatLib library("BenchmarkLib", nullptr);
+					Tokenizer::Document document(source);
+					doNotOptimize(library.addSource("benchmark.jc", document));
+				}
+			});
+	}
+}
+
+
+void Benchmarks::registerCatLibBenchmarks(BenchmarkRunner& runner)
+{
+	addCatLibBenchmark(runner, "CatLib/AddSource/OneClass", createClassSource("BenchmarkClass"));
+	std::string tenClasses;
+	for (int i = 0; i < 10; ++i)
+	{
+		tenClasses.append(createClassSource(Tools::append("BenchmarkClass", i)));
+	}
+	addCatLibBenchmark(runner, "CatLib/AddSource/TenClasses", tenClasses);
+	runner.add("CatLib/Tokenize/TenClasses", [tenClasses](std::size_t numIterations)
+		{
+			Tokenizer::CatTokenizer tokenizer;
+			for (std::size_t i = 0; i < numIterations; ++i)
+			{
+				Tokenizer::Document document(tenClasses);
+				tokenizer.tokenize(document);
+				doNotOptimize(document.getTokens().size());
+			}
+		});
+}
@@ -0,0 +1,91 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "Benchmark.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/Configuration.h"
+#include "jitcat/Expression.h"
+#include "jitcat/ExpressionErrorManager.h"
+#include "jitcat/Tools.h"
+#include "TestObjects.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace Benchmarks;
+using namespace jitcat;
+using namespace TestObjects;
+
+
+namespace
+{
+	struct ExpressionFixture
+	{
+		ExpressionFixture():
+			context("expressionBenchmarks", &errorManager)
+		{
+			reflectedObject.createNestedObjects();
+			context.addStaticScope(&reflectedObject, "expressionBenchmarkStaticScope");
+		}
+		ReflectedObject reflectedObject;
+		ExpressionErrorManager errorManager;
+		CatRuntimeContext context;
+	};
+
+
+	//Adds a benchmark that executes the expression with the tree-walking interpreter and one that executes it using getValue, 
+	//which runs native code if LLVM is enabled and bytecode otherwise. The expression is compiled when the benchmark first runs.
+	template<typename ResultT>
+	void addGetValueBenchmarks(BenchmarkRunner& runner, std::shared_ptr<ExpressionFixture> fixture, const std::string& shapeName, const std::string& text)
+	{
+		std::shared_ptr<std::unique_ptr<Expression<ResultT>>> expression = std::make_shared<std::unique_ptr<Expression<ResultT>>>();
+		auto getExpression = [fixture, expression, text]()
+			{
+				if (*expression == nullptr)
+				{
+					*expression = std::make_unique<Expression<ResultT>>(&fixture->context, text);
+					if ((*expression)->hasError())
+					{
+						std::cerr << "Benchmark expression has an error: " << text << "\n";
+						std::exit(1);
+					}
+				}
+				return expression->get();
+			};
+		runner.add(Tools::append("GetValue/", shapeName, "/TreeWalking"), [fixture, getExpression](std::size_t numIterations)
+			{
+				Expression<ResultT>* compiledExpression = getExpression();
+				for (std::size_t i = 0; i < numIterations; ++i)
+				{
+					doNotOptimize(compiledExpression->getInterpretedValue(&fixture->context));
+				}
+			});
+		runner.add(Tools::append("GetValue/", shapeName, Configuration::enableLLVM ? "/Native" : "/Bytecode"), [fixture, getExpression](std::size_t numIterations)
+			{
+				Expression<ResultT>* compiledExpression = getExpression();
+				for (std::size_t i = 0; i < numIterations; ++i)
+				{
+					doNotOptimize(compiledExpression->getValue(&fixture->context));
+				}
+			});
+	}
+}
+
+
+void Benchmarks::registerExpressionBenchmarks(BenchmarkRunner& runner)
+{
+	std::shared_ptr<ExpressionFixture> fixture = std::make_shared<ExpressionFixture>();
+	addGetValueBenchmarks<int>(runner, fixture, "Arithmetic", Shapes::arithmetic);
+	addGetValueBenchmarks<int>(runner, fixture, "MemberChain", Shapes::memberChain);
+	addGetValueBenchmarks<int>(runner, fixture, "MemberFunctionCall", Shapes::memberFunctionCall);
+	addGetValueBenchmarks<float>(runner, fixture, "BuiltInFunctionCall", Shapes::builtInFunctionCall);
+	addGetValueBenchmarks<std::string>(runner, fixture, "StringConcatenation", Shapes::stringConcatenation);
+	addGetValueBenchmarks<float>(runner, fixture, "VectorIndexing", Shapes::vectorIndexing);
+	addGetValueBenchmarks<float>(runner, fixture, "MapIndexing", Shapes::mapIndexing);
+}
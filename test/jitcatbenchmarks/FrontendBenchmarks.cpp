@@ -0,0 +1,93 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "Benchmark.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/CatTokenizer.h"
+#include "jitcat/Document.h"
+#include "jitcat/ExpressionAny.h"
+#include "jitcat/ExpressionErrorManager.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/SLRParseResult.h"
+#include "TestObjects.h"
+
+#include <limits>
+#include <memory>
+
+using namespace Benchmarks;
+using namespace jitcat;
+using namespace TestObjects;
+
+
+namespace
+{
+	struct FrontendFixture
+	{
+		FrontendFixture():
+			context("frontendBenchmarks", &errorManager)
+		{
+			reflectedObject.createNestedObjects();
+			context.addStaticScope(&reflectedObject, "frontendBenchmarkStaticScope");
+		}
+		ReflectedObject reflectedObject;
+		ExpressionErrorManager errorManager;
+		CatRuntimeContext context;
+	};
+}
+
+
+void Benchmarks::registerFrontendBenchmarks(BenchmarkRunner& runner)
+{
+	std::shared_ptr<FrontendFixture> fixture = std::make_shared<FrontendFixture>();
+	for (const auto& [shapeName, expressionText] : Shapes::all)
+	{
+		std::string text = expressionText;
+		runner.add(std::string("Frontend/Tokenize/") + shapeName, [text](std::size_t numIterations)
+			{
+				Tokenizer::CatTokenizer tokenizer;
+				for (std::size_t i = 0; i < numIterations; ++i)
+				{
+					Tokenizer::Document document(text);
+					tokenizer.tokenize(document);
+					doNotOptimize(document.getTokens().size());
+				}
+			});
+		runner.add(std::string("Frontend/Parse/") + shapeName, [text, fixture](std::size_t numIterations)
+			{
+				for (std::size_t i = 0; i < numIterations; ++i)
+				{
+					Tokenizer::Document document(text);
+					std::unique_ptr<Parser::SLRParseResult> result = JitCat::get()->parseExpression(document, &fixture->context, &fixture->errorManager, fixture.get());
+					doNotOptimize(result->success);
+				}
+			});
+		//Parses and type checks the expression. Compilation is deferred by setting a compilation threshold that is never reached.
+		runner.add(std::string("Frontend/ParseAndTypeCheck/") + shapeName, [text, fixture](std::size_t numIterations)
+			{
+				unsigned int previousThreshold = JitCat::get()->getCompilationThreshold();
+				JitCat::get()->setCompilationThreshold(std::numeric_limits<unsigned int>::max());
+				for (std::size_t i = 0; i < numIterations; ++i)
+				{
+					ExpressionAny expression(&fixture->context, text);
+					doNotOptimize(expression.hasError());
+				}
+				JitCat::get()->setCompilationThreshold(previousThreshold);
+			});
+		//Parses, type checks and compiles the expression to native code, or to bytecode if LLVM is not enabled.
+		//Each iteration uses a new context, because native code is shared by the expressions of a context that have the same text.
+		runner.add(std::string("Frontend/Compile/") + shapeName, [text, fixture](std::size_t numIterations)
+			{
+				for (std::size_t i = 0; i < numIterations; ++i)
+				{
+					CatRuntimeContext context("frontendCompileBenchmark", &fixture->errorManager);
+					context.addStaticScope(&fixture->reflectedObject, "frontendBenchmarkStaticScope");
+					ExpressionAny expression(&context, text);
+					doNotOptimize(expression.hasError());
+				}
+			});
+	}
+}
@@ -0,0 +1,72 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include "Benchmark.h"
+#include "jitcat/ReflectableHandle.h"
+#include "jitcat/TypeRegistry.h"
+#include "NestedReflectedObject.h"
+
+#include <memory>
+#include <vector>
+
+using namespace Benchmarks;
+using namespace jitcat;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+void Benchmarks::registerReflectableHandleBenchmarks(BenchmarkRunner& runner)
+{
+	runner.add("ReflectableHandle/CreateDestroy", [](std::size_t numIterations)
+		{
+			NestedReflectedObject object;
+			TypeInfo* typeInfo = TypeRegistry::get()->registerType<NestedReflectedObject>();
+			for (std::size_t i = 0; i < numIterations; ++i)
+			{
+				ReflectableHandle handle(reinterpret_cast<unsigned char*>(&object), typeInfo);
+				doNotOptimize(handle);
+			}
+		});
+	runner.add("ReflectableHandle/Copy", [](std::size_t numIterations)
+		{
+			NestedReflectedObject object;
+			TypeInfo* typeInfo = TypeRegistry::get()->registerType<NestedReflectedObject>();
+			ReflectableHandle handle(reinterpret_cast<unsigned char*>(&object), typeInfo);
+			for (std::size_t i = 0; i < numIterations; ++i)
+			{
+				ReflectableHandle copy(handle);
+				doNotOptimize(copy);
+			}
+		});
+	runner.add("ReflectableHandle/Reassign", [](std::size_t numIterations)
+		{
+			NestedReflectedObject objects[2];
+			TypeInfo* typeInfo = TypeRegistry::get()->registerType<NestedReflectedObject>();
+			ReflectableHandle handle;
+			for (std::size_t i = 0; i < numIterations; ++i)
+			{
+				handle.setReflectable(reinterpret_cast<unsigned char*>(&objects[i & 1]), typeInfo);
+				doNotOptimize(handle);
+			}
+		});
+	//Destroying an object clears all the handles that refer to it.
+	runner.add("ReflectableHandle/DestroyObjectWith64Handles", [](std::size_t numIterations)
+		{
+			TypeInfo* typeInfo = TypeRegistry::get()->registerType<NestedReflectedObject>();
+			std::vector<ReflectableHandle> handles(64);
+			for (std::size_t i = 0; i < numIterations; ++i)
+			{
+				std::unique_ptr<NestedReflectedObject> object = std::make_unique<NestedReflectedObject>();
+				for (ReflectableHandle& handle : handles)
+				{
+					handle.setReflectable(reinterpret_cast<unsigned char*>(object.get()), typeInfo);
+				}
+				object.reset();
+				doNotOptimize(handles.front());
+			}
+		});
+}
@@ -0,0 +1,108 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+//Runs the JitCat microbenchmarks. Supported command line arguments:
+//--filter=<text>		Only run benchmarks whose name contains <text>.
+//--min-time=<seconds>	Minimum time each repetition of a benchmark runs (default 0.1).
+//--repetitions=<n>		Number of repetitions of each benchmark, the median is reported (default 3).
+//--out=<file>			Write the results as Google Benchmark compatible JSON to <file>.
+//--json				Write the results as JSON to stdout instead of a progress report.
+
+#include "Benchmark.h"
+#include "jitcat/Configuration.h"
+#include "jitcat/JitCat.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace Benchmarks;
+
+
+namespace
+{
+	bool getArgumentValue(const std::string& argument, const std::string& name, std::string& value)
+	{
+		if (argument.compare(0, name.size(), name) == 0)
+		{
+			value = argument.substr(name.size());
+			return true;
+		}
+		return false;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	std::string filter;
+	std::string outputFile;
+	bool jsonToStdOut = false;
+	double minimumTime = 0.1;
+	std::size_t numRepetitions = 3;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument(argv[i]);
+		std::string value;
+		if		(getArgumentValue(argument, "--filter=", value))		filter = value;
+		else if (getArgumentValue(argument, "--out=", value))			outputFile = value;
+		else if (getArgumentValue(argument, "--min-time=", value))		minimumTime = std::atof(value.c_str());
+		else if (getArgumentValue(argument, "--repetitions=", value))	numRepetitions = (std::size_t)std::max(1, std::atoi(value.c_str()));
+		else if (argument == "--json")									jsonToStdOut = true;
+		else
+		{
+			std::cerr << "Unknown argument: " << argument << "\n";
+			return 1;
+		}
+	}
+
+	//Keep expression ASTs after native code compilation so that the tree-walking interpreter can also be measured.
+	jitcat::JitCat::get()->setDiscardASTAfterNativeCodeCompilation(false);
+	jitcat::JitCat::get()->setInterpreterMode(jitcat::InterpreterMode::Bytecode);
+
+	{
+		BenchmarkRunner runner;
+		runner.setFilter(filter);
+		runner.setMinimumTime(minimumTime);
+		runner.setNumRepetitions(numRepetitions);
+		runner.addContext("llvm_enabled", jitcat::Configuration::enableLLVM ? "true" : "false");
+	#ifdef NDEBUG
+		runner.addContext("library_build_type", "release");
+	#else
+		runner.addContext("library_build_type", "debug");
+	#endif
+		runner.addContext("interpreter_mode", "bytecode");
+
+		registerFrontendBenchmarks(runner);
+		registerExpressionBenchmarks(runner);
+		registerCatLibBenchmarks(runner);
+		registerReflectableHandleBenchmarks(runner);
+
+		//When writing JSON to stdout, the progress report goes to stderr.
+		runner.run(jsonToStdOut ? std::cerr : std::cout);
+		if (jsonToStdOut)
+		{
+			runner.writeJSON(std::cout);
+		}
+		if (!outputFile.empty())
+		{
+			std::ofstream jsonFile(outputFile);
+			if (!jsonFile)
+			{
+				std::cerr << "Could not open " << outputFile << " for writing.\n";
+				return 1;
+			}
+			runner.writeJSON(jsonFile);
+		}
+	}
+	//Make sure everything the benchmarks created is destroyed before JitCat::destroy is called.
+	jitcat::JitCat::get()->destroy();
+	return 0;
+}
@@ -0,0 +1,96 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/ASTArena.h"
+#include "jitcat/CatLiteral.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace jitcat;
+using namespace jitcat::AST;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("AST arena", "[astarena]" )
+{
+	SECTION("Allocation")
+	{
+		ASTArena arena;
+		CHECK(arena.getNumBlocks() == 0);
+		std::vector<void*> objects;
+		for (int i = 0; i < 1000; i++)
+		{
+			void* object = ASTArena::allocateObject(24, &arena);
+			CHECK((reinterpret_cast<std::uintptr_t>(object) % alignof(std::max_align_t)) == 0);
+			objects.push_back(object);
+		}
+		CHECK(arena.getNumBlocks() > 1);
+		CHECK(arena.getAllocatedMemory() >= 1000 * 24);
+		CHECK(arena.getReservedMemory() >= arena.getAllocatedMemory());
+		CHECK(ASTArena::getTotalReservedMemory() >= arena.getReservedMemory());
+		//Freeing objects that live in an arena does not free any memory.
+		for (void* object : objects)
+		{
+			ASTArena::freeObject(object);
+		}
+		CHECK(arena.getAllocatedMemory() >= 1000 * 24);
+		//Objects that are not allocated from an arena live on the heap.
+		void* heapObject = ASTArena::allocateObject(24, nullptr);
+		CHECK(heapObject != nullptr);
+		ASTArena::freeObject(heapObject);
+	}
+	SECTION("Scopes")
+	{
+		CHECK(ASTArena::getCurrent() == nullptr);
+		ASTArena outerArena;
+		ASTArena innerArena;
+		{
+			ASTArena::Scope outerScope(&outerArena);
+			CHECK(ASTArena::getCurrent() == &outerArena);
+			std::unique_ptr<CatLiteral> outerLiteral = std::make_unique<CatLiteral>(1, Tokenizer::Lexeme());
+			{
+				ASTArena::Scope innerScope(&innerArena);
+				CHECK(ASTArena::getCurrent() == &innerArena);
+				std::unique_ptr<CatLiteral> innerLiteral = std::make_unique<CatLiteral>(2, Tokenizer::Lexeme());
+				CHECK(innerArena.getAllocatedMemory() >= sizeof(CatLiteral));
+			}
+			CHECK(ASTArena::getCurrent() == &outerArena);
+			CHECK(outerArena.getAllocatedMemory() >= sizeof(CatLiteral));
+		}
+		CHECK(ASTArena::getCurrent() == nullptr);
+	}
+	SECTION("Parsed expressions")
+	{
+		ReflectedObject reflectedObject;
+		reflectedObject.createNestedObjects();
+		ExpressionErrorManager errorManager;
+		CatRuntimeContext context("astArena", &errorManager);
+		context.addDynamicScope(&reflectedObject);
+		const std::size_t previousArenaMemory = ASTArena::getTotalReservedMemory();
+		{
+			//The AST is retained, so that the nodes of the arena are still in use after type checking.
+			const bool discardAST = JitCat::get()->getDiscardASTAfterNativeCodeCompilation();
+			ScopeGuard discardASTScope([discardAST]{JitCat::get()->setDiscardASTAfterNativeCodeCompilation(discardAST);});
+			JitCat::get()->setDiscardASTAfterNativeCodeCompilation(false);
+			Expression<int> testExpression(&context, "theInt * 3 + nestedObjectPointer.someInt - getInt()");
+			REQUIRE_FALSE(testExpression.hasError());
+			CHECK(ASTArena::getTotalReservedMemory() > previousArenaMemory);
+			CHECK(testExpression.getValue(&context) == 42 * 3 + 21 - 42);
+			CHECK(testExpression.getInterpretedValue(&context) == 42 * 3 + 21 - 42);
+		}
+		CHECK(ASTArena::getTotalReservedMemory() == previousArenaMemory);
+	}
+}
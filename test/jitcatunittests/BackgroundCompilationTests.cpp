@@ -0,0 +1,119 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/BackgroundCompiler.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Background compilation", "[background]" )
+{
+	JitCat::get()->setBackgroundCompilation(true);
+	ScopeGuard backgroundCompilationScope([]{JitCat::get()->waitForBackgroundCompilation(); JitCat::get()->setBackgroundCompilation(false);});
+
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("background", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	context.addStaticScope(&reflectedObject, "backgroundStaticScope");
+
+	SECTION("Value before and after compilation")
+	{
+		Expression<float> testExpression(&context, "aFloat * 2.0f + nestedObjectPointer.someFloat");
+		REQUIRE_FALSE(testExpression.hasError());
+		for (int i = 0; i < 1000; i++)
+		{
+			CHECK(testExpression.getValue(&context) == Approx(999.9f * 2.0f + 1.1f));
+		}
+		JitCat::get()->waitForBackgroundCompilation();
+		CHECK(JitCat::get()->getBackgroundCompiler()->getNumQueuedJobs() == 0);
+		CHECK(testExpression.getValue(&context) == Approx(999.9f * 2.0f + 1.1f));
+		CHECK(testExpression.getInterpretedValue(&context) == Approx(999.9f * 2.0f + 1.1f));
+	}
+	SECTION("String")
+	{
+		Expression<std::string> testExpression(&context, "text + theInt");
+		JitCat::get()->waitForBackgroundCompilation();
+		CHECK(testExpression.getValue(&context) == "Hello!42");
+	}
+	SECTION("Constant")
+	{
+		Expression<int> testExpression(&context, "3 * 4");
+		CHECK(testExpression.isConst());
+		CHECK(testExpression.getValue(&context) == 12);
+	}
+	SECTION("Error")
+	{
+		Expression<int> testExpression(&context, "theInt + notAnInt");
+		CHECK(testExpression.hasError());
+		CHECK(testExpression.getValue(&context) == 0);
+	}
+	SECTION("Executed on another thread")
+	{
+		//The compiled function is installed by the thread that executes the expression, while the background compiler may still be running.
+		Expression<int> testExpression(&context, "theInt * 3 - nestedObjectPointer.someInt");
+		REQUIRE_FALSE(testExpression.hasError());
+		int numWrongValues = 0;
+		std::thread executingThread([&]()
+			{
+				for (int i = 0; i < 10000; i++)
+				{
+					numWrongValues += testExpression.getValue(&context) != 42 * 3 - 21 ? 1 : 0;
+				}
+			});
+		executingThread.join();
+		JitCat::get()->waitForBackgroundCompilation();
+		CHECK(numWrongValues == 0);
+		CHECK(testExpression.getValue(&context) == 42 * 3 - 21);
+	}
+	SECTION("Recompile")
+	{
+		Expression<int> testExpression(&context, "theInt + 1");
+		testExpression.setExpression("theInt - 1", &context);
+		CHECK(testExpression.getValue(&context) == 41);
+		JitCat::get()->waitForBackgroundCompilation();
+		CHECK(testExpression.getValue(&context) == 41);
+	}
+	SECTION("Destroyed before compilation")
+	{
+		for (int i = 0; i < 100; i++)
+		{
+			std::unique_ptr<Expression<int>> testExpression = std::make_unique<Expression<int>>(&context, "theInt * largeInt - zeroInt");
+			CHECK(testExpression->getValue(&context) == 42 * 1234567);
+		}
+		JitCat::get()->waitForBackgroundCompilation();
+	}
+	SECTION("Context destroyed before compilation")
+	{
+		std::vector<std::unique_ptr<Expression<bool>>> expressions;
+		{
+			ExpressionErrorManager temporaryErrorManager;
+			CatRuntimeContext temporaryContext("temporary", &temporaryErrorManager);
+			temporaryContext.addStaticScope(&reflectedObject, "temporaryStaticScope");
+			for (int i = 0; i < 100; i++)
+			{
+				expressions.emplace_back(std::make_unique<Expression<bool>>(&temporaryContext, "theInt > 40 && aBoolean"));
+			}
+		}
+		CHECK(JitCat::get()->getBackgroundCompiler()->getNumQueuedJobs() == 0);
+	}
+}
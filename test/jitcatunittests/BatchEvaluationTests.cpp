@@ -0,0 +1,114 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <memory>
+#include <vector>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Batch evaluation", "[batch]" )
+{
+	ReflectedObject reflectedObject;
+	std::vector<ReflectedObject> objects(4);
+	std::vector<unsigned char*> objectPointers;
+	for (std::size_t i = 0; i < objects.size(); i++)
+	{
+		objects[i].theInt = static_cast<int>(i) * 10;
+		objects[i].aFloat = 0.5f * i;
+		objectPointers.push_back(reinterpret_cast<unsigned char*>(&objects[i]));
+	}
+	objects[1].createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("batch", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	CatScopeID batchScopeId = context.addDynamicScope(&reflectedObject);
+
+	SECTION("Float")
+	{
+		Expression<float> testExpression(&context, "theInt * aFloat + 1.0f");
+		REQUIRE_FALSE(testExpression.hasError());
+		std::vector<float> results(objects.size());
+		testExpression.getValues(&context, batchScopeId, objectPointers.data(), objectPointers.size(), results.data());
+		for (std::size_t i = 0; i < objects.size(); i++)
+		{
+			CHECK(results[i] == Approx(objects[i].theInt * objects[i].aFloat + 1.0f));
+		}
+		CHECK(context.getScopeObject(batchScopeId) == reinterpret_cast<unsigned char*>(&reflectedObject));
+	}
+	SECTION("Bool")
+	{
+		Expression<bool> testExpression(&context, "theInt > 15");
+		std::unique_ptr<bool[]> results(new bool[objects.size()]);
+		testExpression.getValues(&context, batchScopeId, objectPointers.data(), objectPointers.size(), results.get());
+		CHECK_FALSE(results[0]);
+		CHECK_FALSE(results[1]);
+		CHECK(results[2]);
+		CHECK(results[3]);
+	}
+	SECTION("Member of nested object")
+	{
+		Expression<int> testExpression(&context, "nestedObjectPointer.someInt");
+		std::vector<int> results(objects.size(), -1);
+		testExpression.getValues(&context, batchScopeId, objectPointers.data(), objectPointers.size(), results.data());
+		CHECK(results == std::vector<int>({0, 21, 0, 0}));
+	}
+	SECTION("Null object")
+	{
+		Expression<int> testExpression(&context, "theInt + 1");
+		unsigned char* nullObjects[2] = {objectPointers[3], nullptr};
+		int results[2] = {0, 0};
+		testExpression.getValues(&context, batchScopeId, nullObjects, 2, results);
+		CHECK(results[0] == 31);
+		CHECK(results[1] == 1);
+	}
+	SECTION("String")
+	{
+		Expression<std::string> testExpression(&context, "text + theInt");
+		std::vector<std::string> results(2);
+		testExpression.getValues(&context, batchScopeId, objectPointers.data(), 2, results.data());
+		CHECK(results[0] == "Hello!0");
+		CHECK(results[1] == "Hello!10");
+	}
+	SECTION("Constant")
+	{
+		Expression<int> testExpression(&context, "3 * 4");
+		std::vector<int> results(objects.size());
+		testExpression.getValues(&context, batchScopeId, objectPointers.data(), objectPointers.size(), results.data());
+		CHECK(results == std::vector<int>(objects.size(), 12));
+	}
+	SECTION("Discarded AST")
+	{
+		//Batch evaluation needs the AST, so the expression is compiled again to get it back.
+		JitCat::get()->setDiscardASTAfterNativeCodeCompilation(true);
+		ScopeGuard discardASTScope([]{JitCat::get()->setDiscardASTAfterNativeCodeCompilation(false);});
+		Expression<int> testExpression(&context, "theInt * 2 + 1");
+		REQUIRE_FALSE(testExpression.hasError());
+		std::vector<int> results(objects.size());
+		testExpression.getValues(&context, batchScopeId, objectPointers.data(), objectPointers.size(), results.data());
+		CHECK(results == std::vector<int>({1, 21, 41, 61}));
+		testExpression.getValues(&context, batchScopeId, objectPointers.data(), 2, results.data());
+		CHECK(results == std::vector<int>({1, 21, 41, 61}));
+		CHECK(testExpression.getValue(&context) == reflectedObject.theInt * 2 + 1);
+	}
+	SECTION("Empty")
+	{
+		Expression<float> testExpression(&context, "aFloat");
+		testExpression.getValues(&context, batchScopeId, nullptr, 0, nullptr);
+		CHECK(context.getScopeObject(batchScopeId) == reinterpret_cast<unsigned char*>(&reflectedObject));
+	}
+}
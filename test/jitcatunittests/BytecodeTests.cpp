@@ -0,0 +1,139 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <cmath>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+//When LLVM is disabled, getValue executes the bytecode and getInterpretedValue walks the AST,
+//so doChecks compares both interpreters against the expected value.
+TEST_CASE("Bytecode interpreter", "[bytecode]" )
+{
+	const InterpreterMode interpreterMode = JitCat::get()->getInterpreterMode();
+	ScopeGuard interpreterModeScope([interpreterMode]{JitCat::get()->setInterpreterMode(interpreterMode);});
+	JitCat::get()->setInterpreterMode(InterpreterMode::Bytecode);
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("bytecode", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	context.addStaticScope(&reflectedObject, "bytecodeStaticScope");
+
+	SECTION("Member chain")
+	{
+		Expression<int> testExpression(&context, "nestedSelfObject.nestedObject.someInt");
+		doChecks(21, false, false, false, testExpression, context);
+	}
+	SECTION("Member chain through pointers")
+	{
+		Expression<float> testExpression(&context, "nestedObjectPointer.someFloat + nestedObjectUniquePointer.someFloat");
+		doChecks(2.2f, false, false, false, testExpression, context);
+	}
+	SECTION("Member of null object")
+	{
+		Expression<int> testExpression(&context, "nullObject.theInt + 1");
+		doChecks(1, false, false, false, testExpression, context);
+	}
+	SECTION("Object pointer")
+	{
+		Expression<ReflectedObject*> testExpression(&context, "nestedSelfObject");
+		doChecks(reflectedObject.nestedSelfObject, false, false, false, testExpression, context);
+	}
+	SECTION("Nested null object")
+	{
+		Expression<double> testExpression(&context, "nestedSelfObject.nestedSelfObject.aDouble + smallDouble");
+		doChecks(0.5, false, false, false, testExpression, context);
+	}
+	SECTION("Mixed arithmetic")
+	{
+		Expression<double> testExpression(&context, "theInt * aFloat - aDouble / 3");
+		doChecks(42 * 999.9f - 999.9 / 3, false, false, false, testExpression, context);
+	}
+	SECTION("Integer arithmetic")
+	{
+		Expression<int> testExpression(&context, "(largeInt % 1000) - -theInt / 4");
+		doChecks((1234567 % 1000) + 42 / 4, false, false, false, testExpression, context);
+	}
+	SECTION("Float modulo")
+	{
+		Expression<float> testExpression(&context, "aFloat % 7.0f");
+		doChecks(std::fmod(999.9f, 7.0f), false, false, false, testExpression, context);
+	}
+	SECTION("Comparison")
+	{
+		Expression<bool> testExpression(&context, "theInt > aFloat || smallDouble <= zeroInt");
+		doChecks(false, false, false, false, testExpression, context);
+	}
+	SECTION("Logical short-circuit")
+	{
+		Expression<bool> testExpression(&context, "no && nullObject.aBoolean || !no && aBoolean");
+		doChecks(true, false, false, false, testExpression, context);
+	}
+	SECTION("Conversion to bool")
+	{
+		Expression<bool> testExpression(&context, "toBool(negativeFloat) || toBool(zeroInt)");
+		doChecks(false, false, false, false, testExpression, context);
+	}
+	SECTION("Select")
+	{
+		Expression<float> testExpression(&context, "select(theInt > 40, aFloat, negativeFloat)");
+		doChecks(999.9f, false, false, false, testExpression, context);
+	}
+	SECTION("Select with conversion")
+	{
+		Expression<double> testExpression(&context, "select(no, theInt, smallDouble)");
+		doChecks(0.5, false, false, false, testExpression, context);
+	}
+	SECTION("Cap, min and max")
+	{
+		Expression<float> testExpression(&context, "cap(aFloat, negativeFloat, smallFloat) + min(theInt, zeroInt) + max(smallFloat, zeroFloat)");
+		doChecks(1.0f, false, false, false, testExpression, context);
+	}
+	SECTION("Maths functions")
+	{
+		Expression<float> testExpression(&context, "sqrt(abs(negativeFloat)) + pow(smallFloat, 2) + floor(aFloat)");
+		doChecks(std::sqrt(111.1f) + 0.25f + 999.0f, false, false, false, testExpression, context);
+	}
+	SECTION("Double maths functions")
+	{
+		Expression<double> testExpression(&context, "sin(aDouble) * cos(aDouble) + atan2(smallDouble, aDouble)");
+		doChecks(std::sin(999.9) * std::cos(999.9) + std::atan2(0.5, 999.9), false, false, false, testExpression, context);
+	}
+	SECTION("Many registers")
+	{
+		//Needs more registers than execute keeps on the stack.
+		std::string expressionText = "theInt";
+		for (int i = 0; i < 99; i++)
+		{
+			expressionText += " + theInt";
+		}
+		Expression<int> testExpression(&context, expressionText);
+		doChecks(42 * 100, false, false, false, testExpression, context);
+	}
+	SECTION("Fallback")
+	{
+		Expression<int> testExpression(&context, "theInt + toInt(numberString) * 2");
+		doChecks(42 + 123 * 2, false, false, false, testExpression, context);
+	}
+	SECTION("Error")
+	{
+		Expression<int> testExpression(&context, "theInt + notAnInt");
+		doChecks(0, true, false, false, testExpression, context);
+	}
+}
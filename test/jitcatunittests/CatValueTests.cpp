@@ -0,0 +1,107 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatGenericType.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/CatValue.h"
+#include "jitcat/ExpressionAny.h"
+#include "jitcat/TypeInfo.h"
+#include "jitcat/TypeTraits.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("CatValue conversion", "[catvalue]" )
+{
+	SECTION("Scalars")
+	{
+		std::any intAny(42);
+		CatValue intValue = CatValue::fromAny(intAny, CatGenericType::intType);
+		REQUIRE(intValue.getTag() == CatValue::Tag::Int);
+		CHECK(intValue.getInt() == 42);
+		CHECK(std::any_cast<int>(intValue.toAny(CatGenericType::intType)) == 42);
+
+		CatValue doubleValue(1.5);
+		REQUIRE(doubleValue.getTag() == CatValue::Tag::Double);
+		CHECK(std::any_cast<double>(doubleValue.toAny(CatGenericType::doubleType)) == 1.5);
+	}
+	SECTION("Pointer")
+	{
+		ReflectedObject reflectedObject;
+		CatGenericType pointerType = TypeTraits<ReflectedObject*>::toGenericType();
+		CatValue pointerValue = CatValue::fromAny(std::any(&reflectedObject), pointerType);
+		REQUIRE(pointerValue.getTag() == CatValue::Tag::Pointer);
+		CHECK(pointerValue.getPointer() == reinterpret_cast<uintptr_t>(&reflectedObject));
+		CHECK(std::any_cast<ReflectedObject*>(pointerValue.toAny(pointerType)) == &reflectedObject);
+	}
+	SECTION("Types that are not held")
+	{
+		CHECK(std::is_trivially_copyable<CatValue>::value);
+		CHECK_FALSE(CatValue::canHold(CatGenericType::stringType));
+		CHECK_FALSE(CatValue::canHold(CatGenericType::voidType));
+		CHECK_FALSE(CatValue::canHold(TypeTraits<TestEnum>::toGenericType()));
+		CHECK(CatValue::canHold(TypeTraits<ReflectedObject*>::toGenericType()));
+	}
+}
+
+
+//getInterpretedValue executes basic type expressions through CatTypedExpression::executeValue.
+TEST_CASE("CatValue execution", "[catvalue]" )
+{
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("catValue", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	context.addStaticScope(&reflectedObject, "catValueStaticScope");
+
+	SECTION("Member chain")
+	{
+		Expression<float> testExpression(&context, "-nestedObjectPointer.someFloat * theInt");
+		doChecks(-1.1f * 42, false, false, false, testExpression, context);
+	}
+	SECTION("Logical operators")
+	{
+		Expression<bool> testExpression(&context, "nestedSelfObject.nestedSelfObject.theInt == zeroInt && !no");
+		doChecks(true, false, false, false, testExpression, context);
+	}
+	SECTION("String operands")
+	{
+		Expression<bool> testExpression(&context, "text == \"Hello!\" || no");
+		doChecks(true, false, false, false, testExpression, context);
+	}
+	SECTION("Member of null object")
+	{
+		Expression<double> testExpression(&context, "nullObject.aDouble + smallDouble");
+		doChecks(0.5, false, false, false, testExpression, context);
+	}
+	SECTION("Member function calls")
+	{
+		Expression<float> testExpression(&context, "getInt() + getConstantFloat() + getObject().getFloat()");
+		doChecks(42 + 999.9f + 999.9f, false, false, false, testExpression, context);
+	}
+	SECTION("Member function call on null object")
+	{
+		Expression<int> testExpression(&context, "nullObject.getInt() + 1");
+		doChecks(1, false, false, false, testExpression, context);
+	}
+	SECTION("Short circuit")
+	{
+		//Both execute and executeValue skip the right hand side when the left hand side decides the result.
+		Expression<bool> valueExpression(&context, "no && nullObject.getBoolean()");
+		doChecks(false, false, false, false, valueExpression, context);
+		ExpressionAny anyExpression(&context, "aBoolean || nullObject.getBoolean()");
+		CHECK(std::any_cast<bool>(anyExpression.getValue(&context)) == true);
+	}
+}
@@ -0,0 +1,194 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/ColumnBinding.h"
+#include "jitcat/Configuration.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+namespace
+{
+	struct Row
+	{
+		int theInt;
+		float aFloat;
+		double aDouble;
+	};
+}
+
+
+TEST_CASE("Column evaluation", "[columns]" )
+{
+	ReflectedObject reflectedObject;
+	NestedReflectedObject staticObject;
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("columns", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	context.addStaticScope(&staticObject, "columnsStaticScope");
+	CatScopeID columnScopeId = context.addDynamicScope(&reflectedObject);
+
+	//Floats are stored as a column, ints and doubles are stored interleaved in rows.
+	const std::size_t numRows = 37;
+	std::vector<float> floats;
+	std::vector<Row> rows;
+	for (std::size_t i = 0; i < numRows; i++)
+	{
+		floats.push_back(0.25f * i);
+		rows.push_back({static_cast<int>(i) - 10, 0.0f, 0.5 * i});
+	}
+	ColumnBinding columns(context.getScopeType(columnScopeId), numRows);
+	REQUIRE(columns.bindColumn("aFloat", floats.data()));
+	REQUIRE(columns.bindColumn("theInt", &rows[0].theInt, sizeof(Row)));
+	REQUIRE(columns.bindColumn("aDouble", &rows[0].aDouble, sizeof(Row)));
+
+	SECTION("Binding errors")
+	{
+		CHECK_FALSE(columns.bindColumn("notAMember", floats.data()));
+		CHECK_FALSE(columns.bindColumn("text", floats.data()));
+		CHECK_FALSE(columns.bindColumn("aFloat", floats.data(), 6));
+	}
+	SECTION("Float arithmetic")
+	{
+		Expression<float> testExpression(&context, "aFloat * 2.0f + theInt");
+		std::vector<float> results(numRows);
+		REQUIRE(testExpression.getColumnValues(&context, columnScopeId, columns, results.data()));
+		for (std::size_t i = 0; i < numRows; i++)
+		{
+			CHECK(results[i] == Approx(floats[i] * 2.0f + rows[i].theInt));
+		}
+	}
+	SECTION("Built-in functions")
+	{
+		Expression<double> testExpression(&context, "sqrt(abs(theInt)) + min(aDouble, 4.0) + cos(aDouble)");
+		std::vector<double> results(numRows);
+		REQUIRE(testExpression.getColumnValues(&context, columnScopeId, columns, results.data()));
+		for (std::size_t i = 0; i < numRows; i++)
+		{
+			CHECK(results[i] == Approx(std::sqrt(std::abs(rows[i].theInt)) + std::min(rows[i].aDouble, 4.0) + std::cos(rows[i].aDouble)));
+		}
+	}
+	SECTION("Comparison")
+	{
+		Expression<bool> testExpression(&context, "theInt > 0 && aFloat < 7.0f");
+		std::unique_ptr<bool[]> results(new bool[numRows]);
+		REQUIRE(testExpression.getColumnValues(&context, columnScopeId, columns, results.get()));
+		for (std::size_t i = 0; i < numRows; i++)
+		{
+			CHECK(results[i] == (rows[i].theInt > 0 && floats[i] < 7.0f));
+		}
+	}
+	SECTION("Static scope member")
+	{
+		//Members of other scopes are read from the scope object.
+		Expression<int> testExpression(&context, "theInt * someInt");
+		std::vector<int> results(numRows);
+		REQUIRE(testExpression.getColumnValues(&context, columnScopeId, columns, results.data()));
+		for (std::size_t i = 0; i < numRows; i++)
+		{
+			CHECK(results[i] == rows[i].theInt * staticObject.someInt);
+		}
+	}
+	SECTION("Conversion to result type")
+	{
+		Expression<int> testExpression(&context, "aFloat");
+		std::vector<int> results(numRows);
+		REQUIRE(testExpression.getColumnValues(&context, columnScopeId, columns, results.data()));
+		CHECK(results[numRows - 1] == static_cast<int>(floats[numRows - 1]));
+	}
+	SECTION("Unbound member")
+	{
+		Expression<float> testExpression(&context, "aFloat + largeInt");
+		std::vector<float> results(numRows, -1.0f);
+		CHECK_FALSE(testExpression.getColumnValues(&context, columnScopeId, columns, results.data()));
+		CHECK(results[0] == -1.0f);
+	}
+	SECTION("Not pure arithmetic")
+	{
+		Expression<int> testExpression(&context, "theInt + toInt(numberString)");
+		std::vector<int> results(numRows);
+		CHECK_FALSE(testExpression.getColumnValues(&context, columnScopeId, columns, results.data()));
+	}
+	SECTION("Discarded AST")
+	{
+		//Column evaluation needs the AST, so the expression is compiled again to get it back.
+		JitCat::get()->setDiscardASTAfterNativeCodeCompilation(true);
+		ScopeGuard discardASTScope([]{JitCat::get()->setDiscardASTAfterNativeCodeCompilation(false);});
+		Expression<float> testExpression(&context, "aFloat - theInt");
+		REQUIRE_FALSE(testExpression.hasError());
+		std::vector<float> results(numRows);
+		REQUIRE(testExpression.getColumnValues(&context, columnScopeId, columns, results.data()));
+		for (std::size_t i = 0; i < numRows; i++)
+		{
+			CHECK(results[i] == Approx(floats[i] - rows[i].theInt));
+		}
+		CHECK(testExpression.getValue(&context) == Approx(reflectedObject.aFloat - reflectedObject.theInt));
+	}
+	SECTION("Discarded AST, compile context destroyed")
+	{
+		//The AST can only be recovered by compiling the expression with the context that it was compiled with.
+		JitCat::get()->setDiscardASTAfterNativeCodeCompilation(true);
+		ScopeGuard discardASTScope([]{JitCat::get()->setDiscardASTAfterNativeCodeCompilation(false);});
+		std::unique_ptr<CatRuntimeContext> compileContext = std::make_unique<CatRuntimeContext>("columnsCompile", &errorManager);
+		compileContext->addStaticScope(&staticObject, "columnsStaticScope");
+		compileContext->addDynamicScope(&reflectedObject);
+		Expression<float> testExpression(compileContext.get(), "aFloat * theInt");
+		REQUIRE_FALSE(testExpression.hasError());
+		compileContext.reset();
+		std::vector<float> results(numRows);
+		//Without LLVM, the AST is never discarded.
+		CHECK(testExpression.getColumnValues(&context, columnScopeId, columns, results.data()) == !Configuration::enableLLVM);
+	}
+	SECTION("Vectorization")
+	{
+		JitCat::get()->resetCodeGenerationStatistics();
+		std::vector<float> packedFloats(numRows, 1.5f);
+		ColumnBinding packedColumns(context.getScopeType(columnScopeId), numRows);
+		REQUIRE(packedColumns.bindColumn("aFloat", packedFloats.data()));
+		Expression<float> testExpression(&context, "aFloat * 2.0f + 1.0f");
+		std::vector<float> results(numRows);
+		REQUIRE(testExpression.getColumnValues(&context, columnScopeId, packedColumns, results.data()));
+		CHECK(results[numRows - 1] == 4.0f);
+		CodeGenerationStatistics statistics = JitCat::get()->getCodeGenerationStatistics();
+		if constexpr (Configuration::enableLLVM)
+		{
+			CHECK(statistics.numColumnFunctions == 1);
+			CHECK(statistics.numVectorizedColumnFunctions == 1);
+		}
+		else
+		{
+			CHECK(statistics.numColumnFunctions == 0);
+		}
+	}
+	SECTION("Reuse")
+	{
+		Expression<float> testExpression(&context, "aFloat + 1.0f");
+		std::vector<float> results(numRows);
+		REQUIRE(testExpression.getColumnValues(&context, columnScopeId, columns, results.data()));
+		std::vector<float> otherFloats(numRows, 2.0f);
+		ColumnBinding otherColumns(context.getScopeType(columnScopeId), 3);
+		REQUIRE(otherColumns.bindColumn("aFloat", otherFloats.data()));
+		REQUIRE(testExpression.getColumnValues(&context, columnScopeId, otherColumns, results.data()));
+		CHECK(results[0] == 3.0f);
+		CHECK(results[2] == 3.0f);
+		CHECK(results[3] == Approx(floats[3] + 1.0f));
+	}
+}
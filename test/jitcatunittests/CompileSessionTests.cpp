@@ -0,0 +1,191 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/CompileSession.h"
+#include "jitcat/ExpressionAny.h"
+#include "jitcat/ExpressionAssignment.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Compile sessions", "[compilesession]" )
+{
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("compileSession", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	context.addStaticScope(&reflectedObject, "compileSessionStaticScope");
+
+	SECTION("Many expressions")
+	{
+		CompileSession session;
+		CHECK(CompileSession::getCurrent() == &session);
+		std::vector<std::unique_ptr<Expression<int>>> expressions;
+		for (int i = 0; i < 64; i++)
+		{
+			expressions.emplace_back(std::make_unique<Expression<int>>(&context, "theInt + nestedObjectPointer.someInt * " + std::to_string(i)));
+			REQUIRE_FALSE(expressions.back()->hasError());
+		}
+		CHECK(session.getNumPendingExpressions() == 64);
+		//The expressions can be executed before the session is finalized.
+		CHECK(expressions[2]->getValue(&context) == 42 + 21 * 2);
+		session.finalize();
+		CHECK(session.getNumPendingExpressions() == 0);
+		CHECK(CompileSession::getCurrent() == nullptr);
+		for (int i = 0; i < 64; i++)
+		{
+			CHECK(expressions[i]->getValue(&context) == 42 + 21 * i);
+			CHECK(expressions[i]->getInterpretedValue(&context) == 42 + 21 * i);
+		}
+	}
+	SECTION("Mixed types")
+	{
+		Expression<std::string> stringExpression;
+		ExpressionAny anyExpression;
+		Expression<float> floatExpression;
+		{
+			CompileSession session;
+			stringExpression.setExpression("text + theInt", &context);
+			anyExpression.setExpression("aFloat + 1.0f", &context);
+			floatExpression.setExpression("aFloat", &context);
+			//The same expression text twice.
+			Expression<float> duplicateExpression(&context, "aFloat");
+			CHECK(session.getNumPendingExpressions() == 4);
+			CHECK(std::any_cast<float>(anyExpression.getValue(&context)) == Approx(1000.9f));
+		}
+		CHECK(stringExpression.getValue(&context) == "Hello!42");
+		CHECK(std::any_cast<float>(anyExpression.getValue(&context)) == Approx(1000.9f));
+		CHECK(floatExpression.getValue(&context) == Approx(999.9f));
+	}
+	SECTION("Not collected")
+	{
+		CompileSession session;
+		Expression<int> constantExpression(&context, "3 * 4");
+		Expression<int> errorExpression(&context, "theInt + notAnInt");
+		ExpressionAssignment<int> assignment(&context, "theInt");
+		CHECK(session.getNumPendingExpressions() == 0);
+		CHECK(constantExpression.getValue(&context) == 12);
+		CHECK(errorExpression.hasError());
+		CHECK(assignment.assignValue(&context, 43));
+		CHECK(reflectedObject.theInt == 43);
+	}
+	SECTION("Recompile")
+	{
+		CompileSession session;
+		Expression<int> testExpression(&context, "theInt + 1");
+		testExpression.setExpression("theInt - 1", &context);
+		CHECK(session.getNumPendingExpressions() == 1);
+		session.finalize();
+		CHECK(testExpression.getValue(&context) == 41);
+	}
+	SECTION("Destroyed before finalize")
+	{
+		CompileSession session;
+		Expression<int> testExpression(&context, "theInt * 2");
+		{
+			Expression<int> temporaryExpression(&context, "theInt * 3");
+			CHECK(session.getNumPendingExpressions() == 2);
+		}
+		CHECK(session.getNumPendingExpressions() == 1);
+		session.finalize();
+		CHECK(testExpression.getValue(&context) == 84);
+	}
+	SECTION("Context destroyed before finalize")
+	{
+		CompileSession session;
+		std::vector<std::unique_ptr<Expression<bool>>> expressions;
+		{
+			ExpressionErrorManager temporaryErrorManager;
+			CatRuntimeContext temporaryContext("temporary", &temporaryErrorManager);
+			temporaryContext.addStaticScope(&reflectedObject, "temporaryStaticScope");
+			for (int i = 0; i < 10; i++)
+			{
+				expressions.emplace_back(std::make_unique<Expression<bool>>(&temporaryContext, "theInt > 40 && aBoolean"));
+			}
+			CHECK(session.getNumPendingExpressions() == 10);
+		}
+		CHECK(session.getNumPendingExpressions() == 0);
+	}
+	SECTION("Nested sessions")
+	{
+		CompileSession outerSession;
+		Expression<int> outerExpression(&context, "theInt + 2");
+		{
+			CompileSession innerSession;
+			Expression<int> innerExpression(&context, "theInt + 3");
+			CHECK(innerSession.getNumPendingExpressions() == 1);
+			CHECK(outerSession.getNumPendingExpressions() == 1);
+			innerSession.finalize();
+			CHECK(CompileSession::getCurrent() == &outerSession);
+			CHECK(innerExpression.getValue(&context) == 45);
+		}
+		outerSession.finalize();
+		CHECK(outerExpression.getValue(&context) == 44);
+	}
+	SECTION("Out of order finalize")
+	{
+		std::unique_ptr<CompileSession> outerSession = std::make_unique<CompileSession>();
+		CompileSession middleSession;
+		CompileSession innerSession;
+		Expression<int> innerExpression(&context, "theInt + 3");
+		//Finalizing the outer and middle sessions first unlinks them from the chain, the inner session remains current.
+		outerSession->finalize();
+		outerSession.reset();
+		CHECK(CompileSession::getCurrent() == &innerSession);
+		middleSession.finalize();
+		CHECK(CompileSession::getCurrent() == &innerSession);
+		CHECK(innerSession.getNumPendingExpressions() == 1);
+		innerSession.finalize();
+		CHECK(CompileSession::getCurrent() == nullptr);
+		CHECK(innerExpression.getValue(&context) == 45);
+	}
+	SECTION("Context destroyed in nested session")
+	{
+		CompileSession outerSession;
+		ExpressionErrorManager temporaryErrorManager;
+		std::unique_ptr<CatRuntimeContext> temporaryContext = std::make_unique<CatRuntimeContext>("temporary", &temporaryErrorManager);
+		temporaryContext->addStaticScope(&reflectedObject, "temporaryStaticScope");
+		Expression<int> outerExpression(temporaryContext.get(), "theInt + 2");
+		CHECK(outerSession.getNumPendingExpressions() == 1);
+		{
+			CompileSession innerSession;
+			Expression<int> innerExpression(&context, "theInt + 3");
+			//The context is destroyed while the outer session is not the current session.
+			temporaryContext.reset();
+			CHECK(outerSession.getNumPendingExpressions() == 0);
+			CHECK(innerSession.getNumPendingExpressions() == 1);
+			innerSession.finalize();
+			CHECK(innerExpression.getValue(&context) == 45);
+		}
+		outerSession.finalize();
+	}
+	SECTION("Identical expressions")
+	{
+		CompileSession session;
+		Expression<int> firstExpression(&context, "theInt * 5");
+		Expression<int> secondExpression(&context, "theInt * 5");
+		CHECK(session.getNumPendingExpressions() == 2);
+		session.finalize();
+		CHECK(firstExpression.getValue(&context) == 210);
+		CHECK(secondExpression.getValue(&context) == 210);
+	}
+}
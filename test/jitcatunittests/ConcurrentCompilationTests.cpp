@@ -0,0 +1,143 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Concurrent compilation", "[concurrency]" )
+{
+	const int numContexts = 8;
+	const int expressionsPerContext = 32;
+
+	std::vector<std::unique_ptr<ReflectedObject>> objects;
+	std::vector<std::unique_ptr<ExpressionErrorManager>> errorManagers;
+	std::vector<std::unique_ptr<CatRuntimeContext>> contexts;
+	for (int i = 0; i < numContexts; i++)
+	{
+		objects.emplace_back(std::make_unique<ReflectedObject>());
+		objects.back()->theInt = i;
+		objects.back()->createNestedObjects();
+		errorManagers.emplace_back(std::make_unique<ExpressionErrorManager>());
+		contexts.emplace_back(std::make_unique<CatRuntimeContext>("concurrent", errorManagers.back().get()));
+		contexts.back()->setPrecompilationContext(Precompilation::precompContext);
+		contexts.back()->addDynamicScope(objects.back().get());
+	}
+
+	std::vector<std::unique_ptr<Expression<int>>> intExpressions;
+	std::vector<std::unique_ptr<Expression<std::string>>> stringExpressions;
+	std::vector<std::pair<ExpressionBase*, CatRuntimeContext*>> expressions;
+	for (int i = 0; i < numContexts; i++)
+	{
+		for (int j = 0; j < expressionsPerContext; j++)
+		{
+			intExpressions.emplace_back(std::make_unique<Expression<int>>("theInt * 100 + nestedObjectPointer.someInt + " + std::to_string(j)));
+			expressions.emplace_back(intExpressions.back().get(), contexts[i].get());
+			stringExpressions.emplace_back(std::make_unique<Expression<std::string>>("text + theInt + \"_" + std::to_string(j) + "\""));
+			expressions.emplace_back(stringExpressions.back().get(), contexts[i].get());
+		}
+	}
+
+	SECTION("Multiple threads")
+	{
+		JitCat::get()->compileAll(expressions, 4);
+	}
+	SECTION("Hardware threads")
+	{
+		JitCat::get()->compileAll(expressions);
+	}
+	SECTION("Single thread")
+	{
+		JitCat::get()->compileAll(expressions, 1);
+	}
+
+	for (int i = 0; i < numContexts; i++)
+	{
+		CHECK(errorManagers[i]->getNumErrors() == 0);
+		for (int j = 0; j < expressionsPerContext; j++)
+		{
+			std::size_t index = i * expressionsPerContext + j;
+			REQUIRE_FALSE(intExpressions[index]->hasError());
+			CHECK(intExpressions[index]->getValue(contexts[i].get()) == i * 100 + 21 + j);
+			REQUIRE_FALSE(stringExpressions[index]->hasError());
+			CHECK(stringExpressions[index]->getValue(contexts[i].get()) == "Hello!" + std::to_string(i) + "_" + std::to_string(j));
+		}
+	}
+}
+
+
+TEST_CASE("Concurrent compilation runs in parallel", "[concurrency]" )
+{
+	//Each context has an expression with an error. The error handler waits until the handlers of all threads are
+	//running at the same time, which only happens if the contexts are compiled in parallel.
+	const unsigned int numThreads = 4;
+	std::mutex mutex;
+	std::condition_variable waitingChanged;
+	unsigned int numWaiting = 0;
+	unsigned int maxWaiting = 0;
+	std::set<std::thread::id> threadIds;
+	auto errorHandler = [&](const std::string&, int, int, int)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		threadIds.insert(std::this_thread::get_id());
+		numWaiting++;
+		maxWaiting = std::max(maxWaiting, numWaiting);
+		waitingChanged.notify_all();
+		waitingChanged.wait_for(lock, std::chrono::seconds(10), [&]{return maxWaiting == numThreads;});
+		numWaiting--;
+	};
+
+	std::vector<std::unique_ptr<ReflectedObject>> objects;
+	std::vector<std::unique_ptr<ExpressionErrorManager>> errorManagers;
+	std::vector<std::unique_ptr<CatRuntimeContext>> contexts;
+	std::vector<std::unique_ptr<Expression<int>>> intExpressions;
+	std::vector<std::pair<ExpressionBase*, CatRuntimeContext*>> expressions;
+	for (unsigned int i = 0; i < numThreads; i++)
+	{
+		objects.emplace_back(std::make_unique<ReflectedObject>());
+		errorManagers.emplace_back(std::make_unique<ExpressionErrorManager>(errorHandler));
+		contexts.emplace_back(std::make_unique<CatRuntimeContext>("parallel", errorManagers.back().get()));
+		contexts.back()->setPrecompilationContext(Precompilation::precompContext);
+		contexts.back()->addDynamicScope(objects.back().get());
+		intExpressions.emplace_back(std::make_unique<Expression<int>>("theInt + notAMember"));
+		expressions.emplace_back(intExpressions.back().get(), contexts.back().get());
+		intExpressions.emplace_back(std::make_unique<Expression<int>>("theInt * 2"));
+		expressions.emplace_back(intExpressions.back().get(), contexts.back().get());
+	}
+
+	JitCat::get()->compileAll(expressions, numThreads);
+
+	CHECK(maxWaiting == numThreads);
+	CHECK(threadIds.size() == numThreads);
+	for (unsigned int i = 0; i < numThreads; i++)
+	{
+		CHECK(intExpressions[i * 2]->hasError());
+		REQUIRE_FALSE(intExpressions[i * 2 + 1]->hasError());
+		CHECK(intExpressions[i * 2 + 1]->getValue(contexts[i].get()) == 84);
+	}
+}
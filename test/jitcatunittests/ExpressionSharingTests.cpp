@@ -0,0 +1,176 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/CustomTypeInfo.h"
+#include "jitcat/Expression.h"
+#include "jitcat/ExpressionAny.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/ObjectInstance.h"
+#include "jitcat/TypeInfoDeleter.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+using namespace jitcat;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Expression sharing", "[sharing]" )
+{
+	JitCat::get()->setExpressionSharing(true);
+	JitCat::get()->resetExpressionSharingStatistics();
+	ScopeGuard expressionSharingScope([]{JitCat::get()->setExpressionSharing(false);});
+
+	ReflectedObject reflectedObject1;
+	reflectedObject1.createNestedObjects();
+	ReflectedObject reflectedObject2;
+	reflectedObject2.createNestedObjects();
+	reflectedObject2.theInt = 7;
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context1("sharing1", &errorManager);
+	CatRuntimeContext context2("sharing2", &errorManager);
+	context1.addDynamicScope(&reflectedObject1);
+	context2.addDynamicScope(&reflectedObject2);
+
+	SECTION("Same scope layout")
+	{
+		Expression<int> testExpression1(&context1, "theInt * 2 + nestedObject.someInt");
+		Expression<int> testExpression2(&context2, "theInt * 2 + nestedObject.someInt");
+		ExpressionSharingStatistics statistics = JitCat::get()->getExpressionSharingStatistics();
+		CHECK(statistics.numMisses == 1);
+		CHECK(statistics.numHits == 1);
+		CHECK(statistics.numSharedExpressions == 1);
+		CHECK_FALSE(testExpression2.hasError());
+		CHECK(testExpression2.getType().isIntType());
+		CHECK(testExpression1.getValue(&context1) == 42 * 2 + 21);
+		CHECK(testExpression2.getValue(&context2) == 7 * 2 + 21);
+		CHECK(testExpression1.getValue(&context2) == 7 * 2 + 21);
+	}
+	SECTION("Different expected type")
+	{
+		Expression<int> testExpression1(&context1, "theInt");
+		Expression<float> testExpression2(&context2, "theInt");
+		ExpressionAny testExpression3(&context2, "theInt");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 0);
+		CHECK(testExpression2.getValue(&context2) == Approx(7.0f));
+		CHECK(std::any_cast<int>(testExpression3.getValue(&context2)) == 7);
+	}
+	SECTION("Different optimization levels")
+	{
+		Expression<int> testExpression1;
+		testExpression1.setOptimizationLevel(LLVM::LLVMOptimizationLevel::O0);
+		testExpression1.setExpression("theInt * 3", &context1);
+		Expression<int> testExpression2;
+		testExpression2.setOptimizationLevel(LLVM::LLVMOptimizationLevel::O2);
+		testExpression2.setExpression("theInt * 3", &context2);
+		//An expression without an explicit level uses the default level, O1.
+		Expression<int> testExpression3(&context2, "theInt * 3");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 0);
+		Expression<int> testExpression4;
+		testExpression4.setOptimizationLevel(LLVM::LLVMOptimizationLevel::O2);
+		testExpression4.setExpression("theInt * 3", &context1);
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 1);
+		CHECK(testExpression1.getValue(&context1) == 42 * 3);
+		CHECK(testExpression2.getValue(&context2) == 7 * 3);
+		CHECK(testExpression3.getValue(&context2) == 7 * 3);
+		CHECK(testExpression4.getValue(&context1) == 42 * 3);
+	}
+	SECTION("Different static scope objects")
+	{
+		CatRuntimeContext staticContext1("sharingStatic1", &errorManager);
+		CatRuntimeContext staticContext2("sharingStatic2", &errorManager);
+		staticContext1.addStaticScope(&reflectedObject1, "sharingStaticScope1");
+		staticContext2.addStaticScope(&reflectedObject2, "sharingStaticScope2");
+		Expression<int> testExpression1(&staticContext1, "theInt");
+		Expression<int> testExpression2(&staticContext2, "theInt");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 0);
+		CHECK(testExpression1.getValue(&staticContext1) == 42);
+		CHECK(testExpression2.getValue(&staticContext2) == 7);
+	}
+	SECTION("Errors are not shared")
+	{
+		Expression<int> testExpression1(&context1, "theInt + doesNotExist");
+		Expression<int> testExpression2(&context2, "theInt + doesNotExist");
+		CHECK(testExpression1.hasError());
+		CHECK(testExpression2.hasError());
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 0);
+	}
+	SECTION("Freed with the last expression")
+	{
+		{
+			Expression<int> testExpression1(&context1, "theInt - 1");
+			{
+				Expression<int> testExpression2(&context2, "theInt - 1");
+				CHECK(testExpression2.getValue(&context2) == 6);
+			}
+			CHECK(JitCat::get()->getExpressionSharingStatistics().numSharedExpressions == 1);
+			CHECK(testExpression1.getValue(&context1) == 41);
+		}
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numSharedExpressions == 0);
+		Expression<int> testExpression3(&context2, "theInt - 1");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numMisses == 2);
+		CHECK(testExpression3.getValue(&context2) == 6);
+	}
+	SECTION("Recompiled expression")
+	{
+		Expression<int> testExpression1(&context1, "theInt + 1");
+		Expression<int> testExpression2(&context2, "theInt + 1");
+		testExpression1.setExpression("theInt + 2", &context1);
+		CHECK(testExpression1.getValue(&context1) == 44);
+		CHECK(testExpression2.getValue(&context2) == 8);
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numSharedExpressions == 2);
+	}
+	SECTION("Unrelated type changed")
+	{
+		Expression<int> testExpression1(&context1, "theInt + 5");
+		std::unique_ptr<CustomTypeInfo, TypeInfoDeleter> unrelatedType = makeTypeInfo<CustomTypeInfo>("SharingUnrelatedType");
+		unrelatedType->addIntMember("theInt", 3);
+		Expression<int> testExpression2(&context2, "theInt + 5");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 1);
+		CHECK(testExpression2.getValue(&context2) == 12);
+	}
+	SECTION("Resolved type changed")
+	{
+		std::unique_ptr<CustomTypeInfo, TypeInfoDeleter> innerType = makeTypeInfo<CustomTypeInfo>("SharingInnerType");
+		innerType->addIntMember("value", 3);
+		ObjectInstance innerObject(innerType.get());
+		std::unique_ptr<CustomTypeInfo, TypeInfoDeleter> scopeType = makeTypeInfo<CustomTypeInfo>("SharingScopeType");
+		scopeType->addIntMember("scopeValue", 4);
+		scopeType->addObjectMember("inner", innerObject.getObject(), innerType.get());
+		ObjectInstance scopeObject1(scopeType.get());
+		ObjectInstance scopeObject2(scopeType.get());
+		CatRuntimeContext customContext1("sharingCustom1", &errorManager);
+		CatRuntimeContext customContext2("sharingCustom2", &errorManager);
+		customContext1.addDynamicScope(scopeObject1);
+		customContext2.addDynamicScope(scopeObject2);
+
+		Expression<int> scopeExpression1(&customContext1, "scopeValue * 2");
+		Expression<int> innerExpression1(&customContext1, "inner.value * 2");
+		Expression<int> innerExpression2(&customContext2, "inner.value * 2");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 1);
+
+		//A change to the scope type stops sharing of all expressions that use the scope.
+		scopeType->addConstant("scopeConstant", 5);
+		Expression<int> scopeExpression2(&customContext2, "scopeValue * 2");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 1);
+		CHECK(scopeExpression2.getValue(&customContext2) == 8);
+
+		//A change to a type that the expression was resolved against stops sharing of that expression.
+		JitCat::get()->resetExpressionSharingStatistics();
+		Expression<int> innerExpression3(&customContext2, "inner.value * 2");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numMisses == 1);
+		Expression<int> innerExpression4(&customContext2, "inner.value * 2");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 1);
+		innerType->addConstant("innerConstant", 6);
+		Expression<int> innerExpression5(&customContext2, "inner.value * 2");
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numHits == 1);
+		CHECK(JitCat::get()->getExpressionSharingStatistics().numMisses == 2);
+		CHECK(innerExpression5.getValue(&customContext2) == 6);
+	}
+}
@@ -0,0 +1,150 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/MemberFunctionInfo.h"
+#include "jitcat/Reflectable.h"
+#include "jitcat/ReflectedTypeInfo.h"
+#include "jitcat/TypeInfo.h"
+#include "jitcat/TypeRegistry.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+
+#include <string>
+
+using namespace jitcat;
+using namespace jitcat::Reflection;
+
+
+namespace InlineFunctionBodyTestObjects
+{
+	class Player: public Reflectable
+	{
+	public:
+		Player(): health(100), armor(25), shield(10) {}
+
+		int getHealth() const {return health;}
+		int getArmor() const {return armor;}
+		int getShield() const {return shield;}
+		void setHealth(int newHealth) {health = newHealth;}
+
+		static void reflect(ReflectedTypeInfo& typeInfo)
+		{
+			Player player;
+			const std::string healthOffset = std::to_string(reinterpret_cast<uintptr_t>(&player.health) - reinterpret_cast<uintptr_t>(&player));
+			//What clang would generate for an extern "C" wrapper around getHealth, and setHealth.
+			const std::string getHealthBody =
+				"define i32 @InlineTestPlayer_getHealth(i8* %this)\n"
+				"{\n"
+				"	%address = getelementptr inbounds i8, i8* %this, i64 " + healthOffset + "\n"
+				"	%healthPtr = bitcast i8* %address to i32*\n"
+				"	%health = load i32, i32* %healthPtr\n"
+				"	ret i32 %health\n"
+				"}\n";
+			const std::string setHealthBody =
+				"define void @InlineTestPlayer_setHealth(i8* %this, i32 %newHealth)\n"
+				"{\n"
+				"	%address = getelementptr inbounds i8, i8* %this, i64 " + healthOffset + "\n"
+				"	%healthPtr = bitcast i8* %address to i32*\n"
+				"	store i32 %newHealth, i32* %healthPtr\n"
+				"	ret void\n"
+				"}\n";
+			//Returns a float instead of an int, so it can not be used and the function is called as usual.
+			const std::string getShieldBody =
+				"define float @InlineTestPlayer_getShield(i8* %this)\n"
+				"{\n"
+				"	ret float 0.0\n"
+				"}\n";
+			typeInfo
+				.addMember("getHealth", &Player::getHealth)
+				.setInlineFunctionBody("getHealth", getHealthBody, "InlineTestPlayer_getHealth")
+				.addMember("getArmor", &Player::getArmor)
+				.addMember("getShield", &Player::getShield)
+				.setInlineFunctionBody("getShield", getShieldBody, "InlineTestPlayer_getShield")
+				.addMember("setHealth", &Player::setHealth)
+				.setInlineFunctionBody("setHealth", setHealthBody, "InlineTestPlayer_setHealth");
+		}
+		static const char* getTypeName() {return "InlineTestPlayer";}
+
+		int health;
+		int armor;
+		int shield;
+	};
+
+
+	class Team: public Reflectable
+	{
+	public:
+		Team(): player(&ownPlayer), nullPlayer(nullptr) {}
+
+		static void reflect(ReflectedTypeInfo& typeInfo)
+		{
+			typeInfo
+				.addMember("player", &Team::player)
+				.addMember("nullPlayer", &Team::nullPlayer);
+		}
+		static const char* getTypeName() {return "InlineTestTeam";}
+
+		Player* player;
+		Player* nullPlayer;
+		Player ownPlayer;
+	};
+}
+
+using namespace InlineFunctionBodyTestObjects;
+
+
+TEST_CASE("Inline function bodies", "[inlinefunctionbodies]" )
+{
+	TypeInfo* playerTypeInfo = TypeRegistry::get()->registerType<Player>();
+	REQUIRE(playerTypeInfo->getFirstMemberFunctionInfo("getHealth") != nullptr);
+	CHECK(playerTypeInfo->getFirstMemberFunctionInfo("getHealth")->hasInlineBody());
+	CHECK(playerTypeInfo->getFirstMemberFunctionInfo("getHealth")->getInlineBodyFunctionName() == "InlineTestPlayer_getHealth");
+	CHECK_FALSE(playerTypeInfo->getFirstMemberFunctionInfo("getArmor")->hasInlineBody());
+
+	Team team;
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("inlineFunctionBodies", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	context.addStaticScope(&team, "inlineFunctionBodiesStaticScope");
+
+	SECTION("Getter")
+	{
+		Expression<int> testExpression(&context, "player.getHealth() + player.getArmor()");
+		REQUIRE_FALSE(testExpression.hasError());
+		CHECK(testExpression.getValue(&context) == 125);
+		team.ownPlayer.health = 50;
+		CHECK(testExpression.getValue(&context) == 75);
+	}
+	SECTION("Same body twice")
+	{
+		Expression<int> testExpression(&context, "player.getHealth() * player.getHealth()");
+		REQUIRE_FALSE(testExpression.hasError());
+		CHECK(testExpression.getValue(&context) == 10000);
+	}
+	SECTION("Setter")
+	{
+		Expression<void> testExpression(&context, "player.setHealth(player.getArmor() * 2)");
+		REQUIRE_FALSE(testExpression.hasError());
+		testExpression.getValue(&context);
+		CHECK(team.ownPlayer.health == 50);
+	}
+	SECTION("Null object")
+	{
+		Expression<int> testExpression(&context, "nullPlayer.getHealth()");
+		REQUIRE_FALSE(testExpression.hasError());
+		CHECK(testExpression.getValue(&context) == 0);
+	}
+	SECTION("Unusable body")
+	{
+		Expression<int> testExpression(&context, "player.getShield()");
+		REQUIRE_FALSE(testExpression.hasError());
+		CHECK(testExpression.getValue(&context) == 10);
+	}
+}
@@ -0,0 +1,116 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/CustomTypeInfo.h"
+#include "jitcat/Expression.h"
+#include "jitcat/FunctionSignature.h"
+#include "jitcat/SymbolTable.h"
+#include "jitcat/TypeInfo.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+using namespace jitcat;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Scope lookup cache", "[lookupcache]")
+{
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("lookupCache", &errorManager);
+	context.addStaticScope(&reflectedObject, "lookupCacheStaticScope");
+
+	SECTION("Hits and misses")
+	{
+		context.resetLookupCacheStatistics();
+		CatScopeID scopeId = InvalidScopeID;
+		TypeMemberInfo* memberInfo = context.findVariable("theInt", scopeId);
+		REQUIRE(memberInfo != nullptr);
+		CatScopeID cachedScopeId = InvalidScopeID;
+		CHECK(context.findVariable("THEINT", cachedScopeId) == memberInfo);
+		CHECK(cachedScopeId == scopeId);
+		CHECK(context.getLookupCacheStatistics().numHits == 1);
+		CHECK(context.getLookupCacheStatistics().numMisses == 1);
+		CHECK(context.getLookupCacheStatistics().getHitRate() == Approx(0.5));
+
+		//Misses are cached as well and leave the scope id unchanged.
+		SymbolTable::intern("lookupCacheMissingMember");
+		CatScopeID missingScopeId = 42;
+		CHECK(context.findVariable("lookupCacheMissingMember", missingScopeId) == nullptr);
+		CHECK(context.findVariable("lookupCacheMissingMember", missingScopeId) == nullptr);
+		CHECK(missingScopeId == 42);
+		CHECK(context.getLookupCacheStatistics().numHits == 2);
+		CHECK(context.getLookupCacheStatistics().numMisses == 2);
+	}
+	SECTION("Function signatures")
+	{
+		context.resetLookupCacheStatistics();
+		CatScopeID scopeId = InvalidScopeID;
+		SearchFunctionSignature noParameters("getStaticInt", {});
+		SearchFunctionSignature oneParameter("getStaticInt", {CatGenericType::intType});
+		StaticFunctionInfo* functionInfo = context.findStaticFunction(&noParameters, scopeId);
+		REQUIRE(functionInfo != nullptr);
+		CHECK(context.findStaticFunction(&oneParameter, scopeId) == nullptr);
+		CHECK(context.findStaticFunction(&noParameters, scopeId) == functionInfo);
+		CHECK(context.findStaticFunction(&oneParameter, scopeId) == nullptr);
+		CHECK(context.getLookupCacheStatistics().numHits == 2);
+		CHECK(context.getLookupCacheStatistics().numMisses == 2);
+	}
+	SECTION("Invalidated by scope changes")
+	{
+		std::unique_ptr<CustomTypeInfo, TypeInfoDeleter> customType = makeTypeInfo<CustomTypeInfo>("LookupCacheType");
+		customType->addIntMember("theInt", 7);
+		ObjectInstance customObject(customType.get());
+
+		CatScopeID scopeId = InvalidScopeID;
+		TypeMemberInfo* reflectedMember = context.findVariable("theInt", scopeId);
+		context.resetLookupCacheStatistics();
+
+		CatScopeID customScopeId = context.addDynamicScope(customObject);
+		CHECK(context.getLookupCacheStatistics().numInvalidations == 1);
+		TypeMemberInfo* customMember = context.findVariable("theInt", scopeId);
+		CHECK(customMember != reflectedMember);
+		CHECK(customMember == customType->getMemberInfo("theInt"));
+
+		context.removeScope(customScopeId);
+		CHECK(context.getLookupCacheStatistics().numInvalidations == 2);
+		CHECK(context.findVariable("theInt", scopeId) == reflectedMember);
+	}
+	SECTION("Invalidated by type changes")
+	{
+		std::unique_ptr<CustomTypeInfo, TypeInfoDeleter> customType = makeTypeInfo<CustomTypeInfo>("LookupCacheChangingType");
+		ObjectInstance customObject(customType.get());
+		CatScopeID customScopeId = context.addDynamicScope(customObject);
+		SymbolTable::intern("lookupCacheAddedMember");
+
+		CatScopeID scopeId = InvalidScopeID;
+		CHECK(context.findVariable("lookupCacheAddedMember", scopeId) == nullptr);
+		TypeMemberInfo* addedMember = customType->addFloatMember("lookupCacheAddedMember", 1.0f);
+		CHECK(context.findVariable("lookupCacheAddedMember", scopeId) == addedMember);
+		customType->removeMember("lookupcacheaddedmember");
+		CHECK(context.findVariable("lookupCacheAddedMember", scopeId) == nullptr);
+		context.removeScope(customScopeId);
+	}
+	SECTION("Repeated compiles")
+	{
+		context.resetLookupCacheStatistics();
+		for (int i = 0; i < 10; i++)
+		{
+			Expression<int> testExpression(&context, "theInt + getInt() + nestedObject.someInt");
+			CHECK(testExpression.isConst() == false);
+			CHECK_FALSE(testExpression.hasError());
+		}
+		const LookupCacheStatistics& statistics = context.getLookupCacheStatistics();
+		CHECK(statistics.numMisses > 0);
+		CHECK(statistics.numHits >= 9 * statistics.numMisses);
+		CHECK(statistics.numInvalidations == 0);
+	}
+}
@@ -0,0 +1,152 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatLib.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/Expression.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <memory>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+namespace
+{
+	const ContextMemoryStatistics* findContext(const MemoryStatistics& statistics, const std::string& contextName)
+	{
+		for (const ContextMemoryStatistics& context : statistics.contexts)
+		{
+			if (context.contextName == contextName)
+			{
+				return &context;
+			}
+		}
+		return nullptr;
+	}
+
+
+	const CatLibMemoryStatistics* findCatLib(const MemoryStatistics& statistics, const std::string& libName)
+	{
+		for (const CatLibMemoryStatistics& catLib : statistics.catLibs)
+		{
+			if (catLib.libName == libName)
+			{
+				return &catLib;
+			}
+		}
+		return nullptr;
+	}
+}
+
+
+TEST_CASE("Memory statistics", "[memorystatistics]" )
+{
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+
+	SECTION("Contexts")
+	{
+		std::unique_ptr<CatRuntimeContext> context = std::make_unique<CatRuntimeContext>("memoryStatistics", &errorManager);
+		context->setPrecompilationContext(Precompilation::precompContext);
+		context->addStaticScope(&reflectedObject, "memoryStatisticsStaticScope");
+		MemoryStatistics statistics = JitCat::get()->getMemoryStatistics();
+		const ContextMemoryStatistics* contextStatistics = findContext(statistics, "memoryStatistics");
+		REQUIRE(contextStatistics != nullptr);
+		CHECK(contextStatistics->contextExists);
+		CHECK(contextStatistics->numExpressions == 0);
+		CHECK(contextStatistics->astMemory == 0);
+
+		std::unique_ptr<Expression<int>> testExpression = std::make_unique<Expression<int>>(context.get(), "theInt * 2 + nestedObjectPointer.someInt");
+		REQUIRE_FALSE(testExpression->hasError());
+		Expression<int> errorExpression(context.get(), "theInt + notAnInt");
+		REQUIRE(errorExpression.hasError());
+		statistics = JitCat::get()->getMemoryStatistics();
+		contextStatistics = findContext(statistics, "memoryStatistics");
+		REQUIRE(contextStatistics != nullptr);
+		//Expressions with errors are not counted.
+		CHECK(contextStatistics->numExpressions == 1);
+		//The unit tests keep the AST after native code compilation.
+		CHECK(contextStatistics->numRetainedASTs == 1);
+		CHECK(contextStatistics->astMemory > 0);
+		CHECK(statistics.astMemory >= contextStatistics->astMemory);
+		CHECK(statistics.numASTNodes > 0);
+		CHECK(statistics.numTypeInfos > 0);
+		CHECK(statistics.typeInfoMemory > 0);
+		CHECK(statistics.getTotalMemory() >= statistics.astMemory + statistics.typeInfoMemory);
+		CHECK(statistics.toString().find("memoryStatistics") != std::string::npos);
+
+		//Recompiling replaces the accounted AST.
+		std::size_t astMemory = contextStatistics->astMemory;
+		testExpression->setExpression("theInt", context.get());
+		statistics = JitCat::get()->getMemoryStatistics();
+		contextStatistics = findContext(statistics, "memoryStatistics");
+		REQUIRE(contextStatistics != nullptr);
+		CHECK(contextStatistics->numExpressions == 1);
+		CHECK(contextStatistics->astMemory > 0);
+		CHECK(contextStatistics->astMemory < astMemory);
+
+		//An expression that outlives its context is still reported.
+		context.reset(nullptr);
+		statistics = JitCat::get()->getMemoryStatistics();
+		contextStatistics = findContext(statistics, "memoryStatistics");
+		REQUIRE(contextStatistics != nullptr);
+		CHECK_FALSE(contextStatistics->contextExists);
+		CHECK(contextStatistics->numExpressions == 1);
+
+		testExpression.reset(nullptr);
+		CHECK(findContext(JitCat::get()->getMemoryStatistics(), "memoryStatistics") == nullptr);
+	}
+	SECTION("String constant pool")
+	{
+		CatRuntimeContext context("memoryStatisticsStrings", &errorManager);
+		context.addStaticScope(&reflectedObject, "memoryStatisticsStringsStaticScope");
+		Expression<std::string> testExpression(&context, "text + \"a string constant that is too long for the small string buffer\"");
+		REQUIRE_FALSE(testExpression.hasError());
+		MemoryStatistics statistics = JitCat::get()->getMemoryStatistics();
+		CHECK(statistics.numPooledStrings > 0);
+		CHECK(statistics.stringConstantPoolMemory > 0);
+	}
+	SECTION("CatLib")
+	{
+		std::size_t astMemoryBefore = JitCat::get()->getMemoryStatistics().astMemory;
+		{
+			CatLib library("MemoryStatisticsLib", Precompilation::precompContext);
+			Tokenizer::Document source(
+				"class MemoryStatisticsClass\n"
+				"{\n"
+				"	int anInt = 42;\n"
+				"	float aFloat = 1.0f;\n"
+				"	int getInt() { return anInt;}\n"
+				"}\n");
+			REQUIRE(library.addSource("memorystatistics.jc", source) != nullptr);
+
+			MemoryStatistics statistics = JitCat::get()->getMemoryStatistics();
+			const CatLibMemoryStatistics* catLibStatistics = findCatLib(statistics, "MemoryStatisticsLib");
+			REQUIRE(catLibStatistics != nullptr);
+			CHECK(catLibStatistics->numSourceFiles == 1);
+			CHECK(catLibStatistics->astMemory > 0);
+			CHECK(statistics.astMemory >= astMemoryBefore + catLibStatistics->astMemory);
+			//The type of the source file and the class.
+			CHECK(catLibStatistics->numTypes == 2);
+			CHECK(catLibStatistics->typeInfoMemory > 0);
+			CHECK(statistics.toString().find("MemoryStatisticsLib") != std::string::npos);
+		}
+		MemoryStatistics statistics = JitCat::get()->getMemoryStatistics();
+		CHECK(findCatLib(statistics, "MemoryStatisticsLib") == nullptr);
+		CHECK(statistics.astMemory == astMemoryBefore);
+	}
+}
@@ -0,0 +1,155 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/Configuration.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/Reflectable.h"
+#include "jitcat/ReflectedTypeInfo.h"
+#include "jitcat/TypeInfo.h"
+#include "jitcat/TypeRegistry.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+
+
+namespace NullCheckTestObjects
+{
+	class WeaponStats: public Reflectable
+	{
+	public:
+		WeaponStats(): damage(12) {}
+		static void reflect(ReflectedTypeInfo& typeInfo)
+		{
+			typeInfo.addMember("damage", &WeaponStats::damage);
+		}
+		static const char* getTypeName() {return "NullCheckWeaponStats";}
+
+		int damage;
+	};
+
+
+	class Weapon: public Reflectable
+	{
+	public:
+		Weapon(): stats(&ownStats) {}
+		static void reflect(ReflectedTypeInfo& typeInfo)
+		{
+			typeInfo
+				.addMember("stats", &Weapon::stats, MF::isTrustedNonNull)
+				.addMember("ownStats", &Weapon::ownStats);
+		}
+		static const char* getTypeName() {return "NullCheckWeapon";}
+
+		WeaponStats* stats;
+		WeaponStats ownStats;
+	};
+
+
+	class Player: public Reflectable
+	{
+	public:
+		Player(): weapon(&ownWeapon), backupWeapon(nullptr) {}
+		static void reflect(ReflectedTypeInfo& typeInfo)
+		{
+			typeInfo
+				.addMember("weapon", &Player::weapon, MF::isTrustedNonNull)
+				.addMember("backupWeapon", &Player::backupWeapon)
+				.addMember("ownWeapon", &Player::ownWeapon);
+		}
+		static const char* getTypeName() {return "NullCheckPlayer";}
+
+		Weapon* weapon;
+		Weapon* backupWeapon;
+		Weapon ownWeapon;
+	};
+}
+
+using namespace NullCheckTestObjects;
+
+
+namespace
+{
+	//Only counts null checks if the expression was compiled to native code by the LLVM backend.
+	bool getCountsNullChecks()
+	{
+		return Configuration::enableLLVM && !JitCat::get()->getHasPrecompiledExpression();
+	}
+}
+
+
+TEST_CASE("Null check elision", "[nullchecks]" )
+{
+	TypeInfo* playerTypeInfo = TypeRegistry::get()->registerType<Player>();
+	REQUIRE(playerTypeInfo->getMemberInfo("weapon") != nullptr);
+	CHECK(playerTypeInfo->getMemberInfo("weapon")->getIsTrustedNonNull());
+	CHECK_FALSE(playerTypeInfo->getMemberInfo("backupWeapon")->getIsTrustedNonNull());
+	CHECK_FALSE(playerTypeInfo->getMemberInfo("ownWeapon")->getIsTrustedNonNull());
+
+	Player player;
+	ExpressionErrorManager errorManager;
+
+	SECTION("Static scope")
+	{
+		CatRuntimeContext context("nullChecksStatic", &errorManager);
+		context.setPrecompilationContext(Precompilation::precompContext);
+		context.addStaticScope(&player, "nullChecksStaticScope");
+
+		JitCat::get()->resetCodeGenerationStatistics();
+		Expression<int> trustedChain(&context, "weapon.stats.damage");
+		REQUIRE_FALSE(trustedChain.hasError());
+		CHECK(trustedChain.getValue(&context) == 12);
+		if (getCountsNullChecks())
+		{
+			CHECK(JitCat::get()->getCodeGenerationStatistics().numNullChecks == 0);
+			CHECK(JitCat::get()->getCodeGenerationStatistics().numElidedNullChecks > 0);
+		}
+
+		JitCat::get()->resetCodeGenerationStatistics();
+		Expression<int> embeddedChain(&context, "ownWeapon.ownStats.damage + weapon.ownStats.damage");
+		REQUIRE_FALSE(embeddedChain.hasError());
+		CHECK(embeddedChain.getValue(&context) == 24);
+		if (getCountsNullChecks())
+		{
+			CHECK(JitCat::get()->getCodeGenerationStatistics().numNullChecks == 0);
+		}
+
+		//backupWeapon is not trusted, so its null check is kept even though stats is trusted.
+		JitCat::get()->resetCodeGenerationStatistics();
+		Expression<int> untrustedChain(&context, "backupWeapon.stats.damage");
+		REQUIRE_FALSE(untrustedChain.hasError());
+		CHECK(untrustedChain.getValue(&context) == 0);
+		if (getCountsNullChecks())
+		{
+			CHECK(JitCat::get()->getCodeGenerationStatistics().numNullChecks > 0);
+		}
+	}
+	SECTION("Dynamic scope")
+	{
+		CatRuntimeContext context("nullChecksDynamic", &errorManager);
+		context.setPrecompilationContext(Precompilation::precompContext);
+		context.addDynamicScope(&player);
+
+		Expression<int> trustedChain(&context, "weapon.stats.damage");
+		REQUIRE_FALSE(trustedChain.hasError());
+		CHECK(trustedChain.getValue(&context) == 12);
+
+		player.ownWeapon.ownStats.damage = 7;
+		Expression<int> repeatedChain(&context, "weapon.stats.damage * ownWeapon.stats.damage");
+		REQUIRE_FALSE(repeatedChain.hasError());
+		CHECK(repeatedChain.getValue(&context) == 49);
+
+		player.backupWeapon = &player.ownWeapon;
+		Expression<int> untrustedChain(&context, "backupWeapon.stats.damage");
+		REQUIRE_FALSE(untrustedChain.hasError());
+		CHECK(untrustedChain.getValue(&context) == 7);
+	}
+}
@@ -0,0 +1,91 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#ifdef ENABLE_LLVM
+	#include "jitcat/LLVMJit.h"
+	#include "jitcat/LLVMObjectCache.h"
+	#include <llvm/Support/FileSystem.h>
+#endif
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <memory>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Object cache", "[objectcache]" )
+{
+	const std::string cacheDirectory = "JitCatObjectCacheTest";
+	JitCat::get()->setObjectCacheDirectory(cacheDirectory);
+	ScopeGuard objectCacheScope([]
+		{
+#ifdef ENABLE_LLVM
+			llvm::sys::fs::remove_directories(JitCat::get()->getObjectCacheDirectory());
+#endif
+			JitCat::get()->setObjectCacheDirectory("");
+		});
+	CHECK(JitCat::get()->getObjectCacheDirectory() == cacheDirectory);
+
+	SECTION("Loaded by a new code generator")
+	{
+		//Each context has its own code generator. A second context of the same name and with the same scopes generates identical code,
+		//so its expression is loaded from the cache, as it would be in a later run of the program.
+		//Each iteration uses objects at different addresses, which must not affect the cache key.
+		for (int i = 0; i < 2; i++)
+		{
+			std::unique_ptr<ReflectedObject> reflectedObject = std::make_unique<ReflectedObject>();
+			reflectedObject->createNestedObjects();
+			ExpressionErrorManager errorManager;
+			CatRuntimeContext context("objectCache", &errorManager);
+			context.addDynamicScope(reflectedObject.get());
+#ifdef ENABLE_LLVM
+			std::size_t previousStoredObjects = LLVMJit::get().getObjectCache()->getNumStoredObjects();
+			std::size_t previousLoadedObjects = LLVMJit::get().getObjectCache()->getNumLoadedObjects();
+#endif
+			Expression<int> testExpression(&context, "theInt * 3 + nestedObjectPointer.someInt");
+			REQUIRE_FALSE(testExpression.hasError());
+			CHECK(testExpression.getValue(&context) == 42 * 3 + 21);
+#ifdef ENABLE_LLVM
+			if (i == 0)
+			{
+				CHECK(LLVMJit::get().getObjectCache()->getNumStoredObjects() == previousStoredObjects + 1);
+			}
+			else
+			{
+				CHECK(LLVMJit::get().getObjectCache()->getNumStoredObjects() == previousStoredObjects);
+				CHECK(LLVMJit::get().getObjectCache()->getNumLoadedObjects() == previousLoadedObjects + 1);
+			}
+#endif
+		}
+	}
+	SECTION("Embedded addresses")
+	{
+		//Code that accesses a static scope contains the address of the scope object, which is different in every run.
+		ReflectedObject reflectedObject;
+		reflectedObject.createNestedObjects();
+		ExpressionErrorManager errorManager;
+		CatRuntimeContext context("objectCacheStatic", &errorManager);
+		context.addStaticScope(&reflectedObject, "objectCacheStaticScope");
+#ifdef ENABLE_LLVM
+		std::size_t previousStoredObjects = LLVMJit::get().getObjectCache()->getNumStoredObjects();
+#endif
+		Expression<int> testExpression(&context, "theInt * 4");
+		REQUIRE_FALSE(testExpression.hasError());
+		CHECK(testExpression.getValue(&context) == 42 * 4);
+#ifdef ENABLE_LLVM
+		CHECK(LLVMJit::get().getObjectCache()->getNumStoredObjects() == previousStoredObjects);
+#endif
+	}
+}
@@ -0,0 +1,132 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatLib.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/ExpressionHelperFunctions.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+namespace
+{
+	const LLVMOptimizationLevel allLevels[] = {LLVMOptimizationLevel::O0, LLVMOptimizationLevel::O1, LLVMOptimizationLevel::O2, LLVMOptimizationLevel::O3};
+}
+
+
+TEST_CASE("Optimization levels", "[optimizationlevels]" )
+{
+	const LLVMOptimizationLevel previousLevel = JitCat::get()->getDefaultOptimizationLevel();
+	ScopeGuard optimizationLevelScope([previousLevel]{JitCat::get()->setDefaultOptimizationLevel(previousLevel);});
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("optimizationLevels", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	context.addStaticScope(&reflectedObject, "optimizationLevelsStaticScope");
+
+	SECTION("Per expression")
+	{
+		//All levels share the code generator of the context. The function of each level has a different name, 
+		//so each level is compiled instead of reusing the function that was compiled for the first level.
+		const std::string expressionText = "abs(theInt - nestedObjectPointer.someInt * 3) + select(aBoolean, 1, 2)";
+		std::set<std::string> functionNames;
+		for (LLVMOptimizationLevel level : allLevels)
+		{
+			Expression<int> testExpression;
+			testExpression.setOptimizationLevel(level);
+			CHECK(testExpression.getOptimizationLevel() == level);
+			testExpression.setExpression(expressionText, &context);
+			REQUIRE_FALSE(testExpression.hasError());
+			CHECK(testExpression.getValue(&context) == 21 + 1);
+			functionNames.insert(ExpressionHelperFunctions::getUniqueExpressionFunctionName(expressionText, &context, false, CatGenericType::intType, level));
+		}
+		CHECK(functionNames.size() == 4);
+	}
+	SECTION("Global default")
+	{
+		for (LLVMOptimizationLevel level : allLevels)
+		{
+			JitCat::get()->setDefaultOptimizationLevel(level);
+			CHECK(JitCat::get()->getDefaultOptimizationLevel() == level);
+			Expression<float> testExpression(&context, "aFloat * 2.0f + toFloat(theInt)");
+			CHECK(testExpression.getOptimizationLevel() == level);
+			REQUIRE_FALSE(testExpression.hasError());
+			CHECK(testExpression.getValue(&context) == Approx(999.9f * 2.0f + 42.0f));
+		}
+	}
+	SECTION("Per expression overrides global default")
+	{
+		JitCat::get()->setDefaultOptimizationLevel(LLVMOptimizationLevel::O0);
+		Expression<bool> testExpression;
+		testExpression.setOptimizationLevel(LLVMOptimizationLevel::O3);
+		testExpression.setExpression("theInt > 40 && aBoolean", &context);
+		CHECK(testExpression.getOptimizationLevel() == LLVMOptimizationLevel::O3);
+		CHECK(testExpression.getValue(&context));
+	}
+	SECTION("CatLib")
+	{
+		CatLib library("OptimizationLevelLib", Precompilation::precompContext);
+		JitCat::get()->setDefaultOptimizationLevel(LLVMOptimizationLevel::O2);
+		CHECK(library.getOptimizationLevel() == LLVMOptimizationLevel::O2);
+		library.setOptimizationLevel(LLVMOptimizationLevel::O0);
+		CHECK(library.getOptimizationLevel() == LLVMOptimizationLevel::O0);
+	}
+}
+
+
+//Not run by default. Run with the [benchmark] tag to compare compile time and execution time of the optimization levels.
+TEST_CASE("Optimization levels benchmark", "[.][benchmark][optimizationlevels]" )
+{
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	const int numExpressions = 50;
+	const int numExecutions = 100000;
+	const char* levelNames[] = {"O0", "O1", "O2", "O3"};
+
+	for (LLVMOptimizationLevel level : allLevels)
+	{
+		//A new context, and therefore a new code generator, for each level, so that every level compiles all expressions.
+		ExpressionErrorManager errorManager;
+		CatRuntimeContext context("optimizationLevelsBenchmark", &errorManager);
+		context.addStaticScope(&reflectedObject, "optimizationLevelsBenchmarkStaticScope");
+		std::vector<std::unique_ptr<Expression<float>>> expressions;
+		auto compileStart = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < numExpressions; i++)
+		{
+			expressions.emplace_back(std::make_unique<Expression<float>>());
+			expressions.back()->setOptimizationLevel(level);
+			expressions.back()->setExpression("sqrt(aFloat * aFloat + toFloat(theInt * nestedObjectPointer.someInt)) * " + std::to_string(i) + ".0f", &context);
+			REQUIRE_FALSE(expressions.back()->hasError());
+		}
+		auto executeStart = std::chrono::high_resolution_clock::now();
+		float sum = 0.0f;
+		for (int i = 0; i < numExecutions; i++)
+		{
+			sum += expressions[i % numExpressions]->getValue(&context);
+		}
+		auto executeEnd = std::chrono::high_resolution_clock::now();
+		std::cout << levelNames[(int)level] << ": compile " << std::chrono::duration<double, std::milli>(executeStart - compileStart).count() << "ms"
+				  << ", execute " << std::chrono::duration<double, std::milli>(executeEnd - executeStart).count() << "ms"
+				  << " (" << sum << ")\n";
+	}
+}
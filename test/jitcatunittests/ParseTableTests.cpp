@@ -0,0 +1,54 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatGrammar.h"
+#include "jitcat/CatTokenizer.h"
+#include "jitcat/SLRParser.h"
+#include "jitcat/SLRParseTables.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace jitcat;
+using namespace jitcat::Grammar;
+using namespace jitcat::Parser;
+using namespace jitcat::Tokenizer;
+
+
+TEST_CASE("Precomputed parse tables", "[parsetables]" )
+{
+	CatTokenizer tokenizer;
+	auto grammarType = GENERATE(CatGrammarType::Expression, CatGrammarType::Statement, CatGrammarType::Full);
+	CatGrammar grammar(&tokenizer, grammarType);
+	const SLRParseTables* tables = grammar.getPrecomputedParseTables();
+	REQUIRE(tables != nullptr);
+
+	SECTION("Tables are up to date")
+	{
+		//If this fails, the grammar or the tokenizer has changed. Build the JitCatParseTables target to regenerate the tables.
+		CHECK(tables->grammarHash == grammar.getGrammarHash());
+		SLRParser builtParser(&grammar);
+		builtParser.createNFA();
+		std::stringstream builtTables;
+		REQUIRE(builtParser.writeParseTables(builtTables, "tables"));
+
+		SLRParser loadedParser(&grammar);
+		REQUIRE(loadedParser.loadParseTables(*tables));
+		std::stringstream loadedTables;
+		REQUIRE(loadedParser.writeParseTables(loadedTables, "tables"));
+		CHECK(builtTables.str() == loadedTables.str());
+	}
+	SECTION("Mismatched tables")
+	{
+		SLRParseTables otherGrammarTables = *tables;
+		otherGrammarTables.grammarHash++;
+		SLRParser parser(&grammar);
+		CHECK_FALSE(parser.loadParseTables(otherGrammarTables));
+	}
+}
@@ -0,0 +1,59 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#ifdef ENABLE_LLVM
+	#include <llvm/Support/MemoryBuffer.h>
+	#include <llvm/Support/Process.h>
+#endif
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <string>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Profiler support", "[profilersupport]" )
+{
+	JitCat::get()->setPerfMapEnabled(true);
+	JitCat::get()->setGDBJitRegistrationEnabled(true);
+	ScopeGuard profilerSupportScope([]{JitCat::get()->setPerfMapEnabled(false); JitCat::get()->setGDBJitRegistrationEnabled(false);});
+	CHECK(JitCat::get()->getPerfMapEnabled());
+	CHECK(JitCat::get()->getGDBJitRegistrationEnabled());
+
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("profilerSupport", &errorManager);
+	context.addDynamicScope(&reflectedObject);
+
+	const std::string expressionText = "theInt * 5 + nestedObjectPointer.someInt";
+	Expression<int> testExpression(&context, expressionText);
+	REQUIRE_FALSE(testExpression.hasError());
+	CHECK(testExpression.getValue(&context) == 42 * 5 + 21);
+#ifdef ENABLE_LLVM
+	std::string perfMapPath = std::string("/tmp/perf-") + std::to_string(llvm::sys::Process::getProcessId()) + ".map";
+	llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> perfMap = llvm::MemoryBuffer::getFile(perfMapPath, -1, false);
+	REQUIRE(perfMap);
+	CHECK(perfMap.get()->getBuffer().find(std::string("jitcat:") + expressionText) != llvm::StringRef::npos);
+#endif
+
+	JitCat::get()->setPerfMapEnabled(false);
+	JitCat::get()->setGDBJitRegistrationEnabled(false);
+	CHECK_FALSE(JitCat::get()->getPerfMapEnabled());
+	CHECK_FALSE(JitCat::get()->getGDBJitRegistrationEnabled());
+	//Expressions still work while profiler support is disabled.
+	Expression<int> secondExpression(&context, "theInt - 2");
+	CHECK(secondExpression.getValue(&context) == 40);
+}
@@ -0,0 +1,177 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatLib.h"
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/ExpressionAny.h"
+#include "jitcat/ExpressionAssignment.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <sstream>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+namespace
+{
+	const ProfileReportEntry* findReportEntry(const std::vector<ProfileReportEntry>& report, ProfileRecordKind kind, const std::string& name)
+	{
+		for (const ProfileReportEntry& entry : report)
+		{
+			if (entry.kind == kind && entry.name == name)
+			{
+				return &entry;
+			}
+		}
+		return nullptr;
+	}
+}
+
+
+TEST_CASE("Profiling", "[profiling]" )
+{
+	JitCat::get()->setProfilingEnabled(true);
+	JitCat::get()->resetProfilingStatistics();
+	ScopeGuard profilingScope([]{JitCat::get()->setProfilingEnabled(false); JitCat::get()->resetProfilingStatistics();});
+	CHECK(JitCat::get()->getProfilingEnabled());
+
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("profiling", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	context.addStaticScope(&reflectedObject, "profilingStaticScope");
+
+	SECTION("Expressions")
+	{
+		Expression<int> testExpression(&context, "theInt * 2 + nestedObjectPointer.someInt");
+		REQUIRE_FALSE(testExpression.hasError());
+		ExpressionAny anyExpression(&context, "aFloat + 1.0f");
+		REQUIRE_FALSE(anyExpression.hasError());
+		ExpressionAssignment<int> assignment(&context, "theInt");
+		REQUIRE_FALSE(assignment.hasError());
+		//Constant expressions are not profiled.
+		Expression<int> constantExpression(&context, "3 * 4");
+		for (int i = 0; i < 10; i++)
+		{
+			CHECK(testExpression.getValue(&context) == 42 * 2 + 21);
+		}
+		for (int i = 0; i < 3; i++)
+		{
+			CHECK(std::any_cast<float>(anyExpression.getValue(&context)) == Approx(1000.9f));
+		}
+		CHECK(assignment.assignValue(&context, 42));
+		CHECK(assignment.assignValue(&context, 42));
+		CHECK(constantExpression.getValue(&context) == 12);
+
+		std::vector<ProfileReportEntry> report = JitCat::get()->getProfilingReport();
+		CHECK(report.size() == 3);
+		const ProfileReportEntry* expressionEntry = findReportEntry(report, ProfileRecordKind::Expression, "theInt * 2 + nestedObjectPointer.someInt");
+		REQUIRE(expressionEntry != nullptr);
+		CHECK(expressionEntry->numCalls == 10);
+		CHECK(expressionEntry->contextName == "profiling");
+		const ProfileReportEntry* anyEntry = findReportEntry(report, ProfileRecordKind::Expression, "aFloat + 1.0f");
+		REQUIRE(anyEntry != nullptr);
+		CHECK(anyEntry->numCalls == 3);
+		const ProfileReportEntry* assignmentEntry = findReportEntry(report, ProfileRecordKind::Assignment, "theInt");
+		REQUIRE(assignmentEntry != nullptr);
+		CHECK(assignmentEntry->numCalls == 2);
+		for (std::size_t i = 1; i < report.size(); i++)
+		{
+			CHECK(report[i - 1].totalTime >= report[i].totalTime);
+		}
+
+		std::stringstream reportText;
+		JitCat::get()->writeProfilingReport(reportText, 1);
+		//The name of one expression can be part of the name of another, so the names are matched up to the end of the line.
+		CHECK(reportText.str().find(": " + report[0].name + "\n") != std::string::npos);
+		CHECK(reportText.str().find(": " + report[1].name + "\n") == std::string::npos);
+
+		//Expressions with the same text and context share their counters.
+		Expression<int> sameExpression(&context, "theInt * 2 + nestedObjectPointer.someInt");
+		sameExpression.getValue(&context);
+		report = JitCat::get()->getProfilingReport();
+		CHECK(findReportEntry(report, ProfileRecordKind::Expression, "theInt * 2 + nestedObjectPointer.someInt")->numCalls == 11);
+
+		JitCat::get()->resetProfilingStatistics();
+		CHECK(JitCat::get()->getProfilingReport().empty());
+	}
+	SECTION("Destroyed expressions")
+	{
+		{
+			Expression<int> testExpression(&context, "theInt + 3");
+			ExpressionAny anyExpression(&context, "theInt + 4");
+			CHECK(testExpression.getValue(&context) == 45);
+			CHECK(std::any_cast<int>(anyExpression.getValue(&context)) == 46);
+			std::vector<ProfileReportEntry> report = JitCat::get()->getProfilingReport();
+			CHECK(findReportEntry(report, ProfileRecordKind::Expression, "theInt + 3") != nullptr);
+			CHECK(findReportEntry(report, ProfileRecordKind::Expression, "theInt + 4") != nullptr);
+		}
+		//The records are freed together with the last expression that uses them.
+		std::vector<ProfileReportEntry> report = JitCat::get()->getProfilingReport();
+		CHECK(findReportEntry(report, ProfileRecordKind::Expression, "theInt + 3") == nullptr);
+		CHECK(findReportEntry(report, ProfileRecordKind::Expression, "theInt + 4") == nullptr);
+		//A new expression starts counting from zero.
+		Expression<int> newExpression(&context, "theInt + 3");
+		CHECK(newExpression.getValue(&context) == 45);
+		report = JitCat::get()->getProfilingReport();
+		const ProfileReportEntry* expressionEntry = findReportEntry(report, ProfileRecordKind::Expression, "theInt + 3");
+		REQUIRE(expressionEntry != nullptr);
+		CHECK(expressionEntry->numCalls == 1);
+	}
+	SECTION("Disabled")
+	{
+		JitCat::get()->setProfilingEnabled(false);
+		Expression<int> testExpression(&context, "theInt - 1");
+		CHECK(testExpression.getValue(&context) == 41);
+		CHECK(JitCat::get()->getProfilingReport().empty());
+	}
+	SECTION("CatLib functions")
+	{
+		if (!JitCat::get()->getHasPrecompiledExpression() && Precompilation::precompContext == nullptr)
+		{
+			CatLib library("ProfilingLib", nullptr);
+			Tokenizer::Document source(
+				"class ProfiledClass\n"
+				"{\n"
+				"	int value = 3;\n"
+				"	int getValue() { return value * 2;}\n"
+				"}\n");
+			library.addSource("profiling.jc", source);
+			REQUIRE(library.getErrorManager().getNumErrors() == 0);
+			TypeInfo* classInfo = library.getTypeInfo("ProfiledClass");
+			REQUIRE(classInfo != nullptr);
+			unsigned char* instance = classInfo->construct();
+
+			ExpressionErrorManager libErrorManager;
+			CatRuntimeContext libContext("profilingLib", &libErrorManager);
+			libContext.addDynamicScope(classInfo, instance);
+			Expression<int> testExpression(&libContext, "getValue()");
+			REQUIRE_FALSE(testExpression.hasError());
+			for (int i = 0; i < 5; i++)
+			{
+				CHECK(testExpression.getValue(&libContext) == 6);
+			}
+			std::vector<ProfileReportEntry> report = JitCat::get()->getProfilingReport();
+			const ProfileReportEntry* functionEntry = findReportEntry(report, ProfileRecordKind::Function, "ProfiledClass::getValue");
+			REQUIRE(functionEntry != nullptr);
+			CHECK(functionEntry->numCalls == 5);
+			const ProfileReportEntry* expressionEntry = findReportEntry(report, ProfileRecordKind::Expression, "getValue()");
+			REQUIRE(expressionEntry != nullptr);
+			CHECK(expressionEntry->numCalls == 5);
+			classInfo->destruct(instance);
+		}
+	}
+}
@@ -0,0 +1,127 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/CustomTypeInfo.h"
+#include "jitcat/MemberFunctionInfo.h"
+#include "jitcat/SymbolTable.h"
+#include "jitcat/TypeInfo.h"
+#include "jitcat/TypeRegistry.h"
+#include "TestObjects.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jitcat;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Symbol table", "[symbols]")
+{
+	SECTION("Case insensitive")
+	{
+		SymbolId symbol = SymbolTable::intern("symbolTableTestName");
+		CHECK(symbol != SymbolTable::noSymbol);
+		CHECK(SymbolTable::intern("SYMBOLTABLETESTNAME") == symbol);
+		CHECK(SymbolTable::find("symboltabletestname") == symbol);
+		CHECK(SymbolTable::find("SymbolTableTestName") == symbol);
+		CHECK(SymbolTable::find("symbolTableTestName2") == SymbolTable::noSymbol);
+		CHECK(SymbolTable::intern("symbolTableTestName2") != symbol);
+		CHECK(SymbolTable::getName(symbol) == "symboltabletestname");
+	}
+	SECTION("Growth")
+	{
+		//Enough names to replace the initial table at least once.
+		std::vector<SymbolId> symbols;
+		for (int i = 0; i < 2000; ++i)
+		{
+			symbols.push_back(SymbolTable::intern("symbolTableGrowth" + std::to_string(i)));
+		}
+		for (int i = 0; i < 2000; ++i)
+		{
+			CHECK(SymbolTable::find("SYMBOLTABLEGROWTH" + std::to_string(i)) == symbols[i]);
+		}
+	}
+	SECTION("Concurrent interning")
+	{
+		//Every thread interns the same names, all threads must agree on their symbols.
+		const int numThreads = 4;
+		const int numNames = 1000;
+		std::vector<std::vector<SymbolId>> symbolsPerThread(numThreads);
+		std::vector<std::thread> threads;
+		for (int thread = 0; thread < numThreads; ++thread)
+		{
+			threads.emplace_back([&symbolsPerThread, thread]()
+				{
+					for (int i = 0; i < numNames; ++i)
+					{
+						std::string name = "symbolTableConcurrent" + std::to_string(i);
+						SymbolId symbol = SymbolTable::intern(name);
+						if (SymbolTable::find(name) != symbol)
+						{
+							symbol = SymbolTable::noSymbol;
+						}
+						symbolsPerThread[thread].push_back(symbol);
+					}
+				});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		for (int i = 0; i < numNames; ++i)
+		{
+			CHECK(symbolsPerThread[0][i] != SymbolTable::noSymbol);
+			for (int thread = 1; thread < numThreads; ++thread)
+			{
+				CHECK(symbolsPerThread[thread][i] == symbolsPerThread[0][i]);
+			}
+		}
+	}
+	SECTION("Reflected type lookups")
+	{
+		TypeInfo* objectTypeInfo = TypeRegistry::get()->registerType<ReflectedObject>();
+		CHECK(TypeRegistry::get()->getTypeInfo(SymbolTable::find("REFLECTEDOBJECT")) == objectTypeInfo);
+		TypeMemberInfo* memberInfo = objectTypeInfo->getMemberInfo("theInt");
+		REQUIRE(memberInfo != nullptr);
+		CHECK(objectTypeInfo->getMemberInfo("THEINT") == memberInfo);
+		CHECK(objectTypeInfo->getMemberInfo(SymbolTable::find("theint")) == memberInfo);
+		MemberFunctionInfo* functionInfo = objectTypeInfo->getFirstMemberFunctionInfo("getInt");
+		REQUIRE(functionInfo != nullptr);
+		CHECK(objectTypeInfo->getFirstMemberFunctionInfo(SymbolTable::find("GETINT")) == functionInfo);
+		CHECK(objectTypeInfo->getMemberFunctionsByName("GetInt").size() == 1);
+		CHECK(objectTypeInfo->getMemberInfo("symbolTableMemberThatDoesNotExist") == nullptr);
+		CHECK(objectTypeInfo->getMemberInfo(SymbolTable::noSymbol) == nullptr);
+	}
+	SECTION("Custom type members")
+	{
+		std::unique_ptr<CustomTypeInfo, TypeInfoDeleter> customType = makeTypeInfo<CustomTypeInfo>("SymbolTableCustomType");
+		TypeMemberInfo* memberInfo = customType->addIntMember("symbolTableMember", 42);
+		CHECK(customType->getMemberInfo("SYMBOLTABLEMEMBER") == memberInfo);
+		customType->renameMember("symbolTableMember", "renamedSymbolTableMember");
+		CHECK(customType->getMemberInfo("symbolTableMember") == nullptr);
+		CHECK(customType->getMemberInfo("RenamedSymbolTableMember") == memberInfo);
+		customType->removeMember("renamedsymboltablemember");
+		CHECK(customType->getMemberInfo("renamedSymbolTableMember") == nullptr);
+	}
+	SECTION("Runtime context lookups")
+	{
+		ReflectedObject reflectedObject;
+		CatRuntimeContext context("symbolTable", nullptr);
+		context.addStaticScope(&reflectedObject, "symbolTableStaticScope");
+		CatScopeID scopeId = InvalidScopeID;
+		TypeMemberInfo* memberInfo = context.findVariable("TheInt", scopeId);
+		REQUIRE(memberInfo != nullptr);
+		CatScopeID symbolScopeId = InvalidScopeID;
+		CHECK(context.findVariable(SymbolTable::find("theint"), symbolScopeId) == memberInfo);
+		CHECK(symbolScopeId == scopeId);
+		CHECK(context.findFirstMemberFunction(SymbolTable::find("getint"), scopeId) != nullptr);
+	}
+}
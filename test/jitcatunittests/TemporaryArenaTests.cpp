@@ -0,0 +1,84 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/TemporaryArena.h"
+
+#include <any>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace jitcat;
+
+
+namespace
+{
+	struct DestructionRecorder
+	{
+		DestructionRecorder(std::vector<int>& destroyed, int id): destroyed(destroyed), id(id) {}
+		~DestructionRecorder() {destroyed.push_back(id);}
+		std::vector<int>& destroyed;
+		int id;
+	};
+}
+
+
+TEST_CASE("Temporary arena", "[temporaries]" )
+{
+	SECTION("Construction and destruction")
+	{
+		std::vector<int> destroyed;
+		TemporaryArena arena;
+		CHECK(arena.isEmpty());
+		arena.create<DestructionRecorder>(destroyed, 1);
+		int& intTemporary = arena.create<int>(42);
+		std::string& stringTemporary = arena.create<std::string>("A string that is too long for the small string buffer.");
+		arena.create<DestructionRecorder>(destroyed, 2);
+		CHECK((reinterpret_cast<std::uintptr_t>(&stringTemporary) % alignof(std::max_align_t)) == 0);
+		CHECK(intTemporary == 42);
+		CHECK(stringTemporary == "A string that is too long for the small string buffer.");
+		CHECK_FALSE(arena.isEmpty());
+		arena.reset();
+		CHECK(arena.isEmpty());
+		CHECK(destroyed == std::vector<int>({2, 1}));
+	}
+	SECTION("Memory is kept")
+	{
+		TemporaryArena arena;
+		for (int i = 0; i < 100; i++)
+		{
+			arena.create<std::string>("temporary");
+		}
+		const std::size_t reservedMemory = arena.getReservedMemory();
+		arena.reset();
+		//The blocks were coalesced into one.
+		CHECK(arena.getReservedMemory() <= reservedMemory);
+		const std::size_t coalescedMemory = arena.getReservedMemory();
+		for (int iteration = 0; iteration < 10; iteration++)
+		{
+			for (int i = 0; i < 100; i++)
+			{
+				arena.create<std::string>("temporary");
+			}
+			arena.reset();
+			CHECK(arena.getReservedMemory() == coalescedMemory);
+		}
+	}
+	SECTION("Runtime context")
+	{
+		CatRuntimeContext context("temporaries");
+		std::any& anyTemporary = context.addTemporary(std::any(std::string("text")));
+		std::string& stringTemporary = context.createTemporary<std::string>("text");
+		CHECK(std::any_cast<std::string>(anyTemporary) == stringTemporary);
+		context.clearTemporaries();
+		std::string& reusedTemporary = context.createTemporary<std::string>("other text");
+		CHECK(reusedTemporary == "other text");
+		context.clearTemporaries();
+	}
+}
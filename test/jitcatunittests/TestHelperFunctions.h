@@ -22,6 +22,21 @@
 #include <iostream>
 
 
+//Calls onExit when the guard goes out of scope, also if the test case fails.
+//Used to restore global JitCat settings that a test case has changed.
+class ScopeGuard
+{
+public:
+	ScopeGuard(std::function<void()> onExit): onExit(std::move(onExit)) {}
+	ScopeGuard(const ScopeGuard&) = delete;
+	void operator=(const ScopeGuard&) = delete;
+	~ScopeGuard() {onExit();}
+
+private:
+	std::function<void()> onExit;
+};
+
+
 template<typename T>
 inline void checkValueIsEqual(const T& actualValue, const T& expectedValue, bool approximateFloatComparison = true)
 {
@@ -0,0 +1,115 @@
+/*
+  This file is part of the JitCat library.
+
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatRuntimeContext.h"
+#include "jitcat/ExpressionAny.h"
+#include "jitcat/JitCat.h"
+#include "jitcat/TypeInfo.h"
+#include "PrecompilationTest.h"
+#include "TestHelperFunctions.h"
+#include "TestObjects.h"
+
+#include <algorithm>
+#include <memory>
+
+using namespace jitcat;
+using namespace jitcat::LLVM;
+using namespace jitcat::Reflection;
+using namespace TestObjects;
+
+
+TEST_CASE("Tiered compilation", "[tiering]" )
+{
+	JitCat::get()->setCompilationThreshold(3);
+	JitCat::get()->resetTieringStatistics();
+	ScopeGuard compilationThresholdScope([]{JitCat::get()->setCompilationThreshold(0); JitCat::get()->setBackgroundCompilation(false);});
+
+	ReflectedObject reflectedObject;
+	reflectedObject.createNestedObjects();
+	ExpressionErrorManager errorManager;
+	CatRuntimeContext context("tiering", &errorManager);
+	context.setPrecompilationContext(Precompilation::precompContext);
+	context.addStaticScope(&reflectedObject, "tieringStaticScope");
+
+	SECTION("Expression")
+	{
+		Expression<int> testExpression(&context, "theInt * 2 + nestedObjectPointer.someInt");
+		CHECK(JitCat::get()->getTieringStatistics().numDeferredExpressions == 1);
+		for (int i = 1; i <= 5; i++)
+		{
+			CHECK(testExpression.getValue(&context) == 42 * 2 + 21);
+			TieringStatistics statistics = JitCat::get()->getTieringStatistics();
+			CHECK(statistics.numHotExpressions == (i >= 3 ? 1 : 0));
+			CHECK(statistics.numColdExecutions == (std::size_t)std::min(i, 3));
+		}
+		CHECK(testExpression.getInterpretedValue(&context) == 42 * 2 + 21);
+	}
+	SECTION("ExpressionAny")
+	{
+		ExpressionAny testExpression(&context, "aFloat + 1.0f");
+		for (int i = 0; i < 5; i++)
+		{
+			CHECK(std::any_cast<float>(testExpression.getValue(&context)) == Approx(1000.9f));
+		}
+		TieringStatistics statistics = JitCat::get()->getTieringStatistics();
+		CHECK(statistics.numDeferredExpressions == 1);
+		CHECK(statistics.numHotExpressions == 1);
+		CHECK(statistics.numColdExecutions == 3);
+	}
+	SECTION("Compile context destroyed")
+	{
+		//Hot expressions are compiled using the context they were compiled with, not the context that is passed to getValue.
+		std::unique_ptr<CatRuntimeContext> compileContext = std::make_unique<CatRuntimeContext>("tieringCompile", &errorManager);
+		compileContext->addStaticScope(&reflectedObject, "tieringStaticScope");
+		Expression<int> testExpression(compileContext.get(), "theInt + 1");
+		compileContext.reset();
+		for (int i = 0; i < 5; i++)
+		{
+			CHECK(testExpression.getValue(&context) == 43);
+		}
+		TieringStatistics statistics = JitCat::get()->getTieringStatistics();
+		CHECK(statistics.numDeferredExpressions == 1);
+		CHECK(statistics.numHotExpressions == 0);
+	}
+	SECTION("Cold expression")
+	{
+		Expression<std::string> testExpression(&context, "text + theInt");
+		CHECK(testExpression.getValue(&context) == "Hello!42");
+		CHECK(JitCat::get()->getTieringStatistics().numHotExpressions == 0);
+	}
+	SECTION("Constant")
+	{
+		Expression<int> testExpression(&context, "3 * 4");
+		CHECK(testExpression.getValue(&context) == 12);
+		CHECK(JitCat::get()->getTieringStatistics().numDeferredExpressions == 0);
+	}
+	SECTION("Recompile")
+	{
+		Expression<float> testExpression(&context, "aFloat");
+		testExpression.getValue(&context);
+		testExpression.getValue(&context);
+		testExpression.setExpression("-aFloat", &context);
+		CHECK(testExpression.getValue(&context) == Approx(-999.9f));
+		CHECK(testExpression.getValue(&context) == Approx(-999.9f));
+		CHECK(JitCat::get()->getTieringStatistics().numHotExpressions == 0);
+		CHECK(testExpression.getValue(&context) == Approx(-999.9f));
+		CHECK(JitCat::get()->getTieringStatistics().numHotExpressions == 1);
+	}
+	SECTION("Background")
+	{
+		JitCat::get()->setBackgroundCompilation(true);
+		Expression<bool> testExpression(&context, "theInt > 40 && !no");
+		for (int i = 0; i < 10; i++)
+		{
+			CHECK(testExpression.getValue(&context));
+		}
+		JitCat::get()->waitForBackgroundCompilation();
+		CHECK(testExpression.getValue(&context));
+		CHECK(JitCat::get()->getTieringStatistics().numHotExpressions == 1);
+	}
+}
@@ -0,0 +1,112 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+#include <catch2/catch.hpp>
+#include "jitcat/CatTokenizer.h"
+#include "jitcat/Document.h"
+#include "jitcat/IdentifierToken.h"
+#include "jitcat/ParseToken.h"
+#include "jitcat/Tools.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jitcat;
+using namespace jitcat::Tokenizer;
+
+
+namespace
+{
+	//Tokenizes the text with both CatTokenizer::tokenize and the token factory loop of TokenizerBase::tokenize
+	//and checks that the tokens and line numbers are identical.
+	void checkSameTokens(CatTokenizer& tokenizer, const std::string& text)
+	{
+		INFO("Text: \"" << text << "\"");
+		Document document(text);
+		Document referenceDocument(text);
+		REQUIRE(tokenizer.tokenize(document));
+		REQUIRE(tokenizer.TokenizerBase::tokenize(referenceDocument));
+		const std::vector<ParseToken>& tokens = document.getTokens();
+		const std::vector<ParseToken>& referenceTokens = referenceDocument.getTokens();
+		REQUIRE(tokens.size() == referenceTokens.size());
+		for (std::size_t i = 0; i < tokens.size(); i++)
+		{
+			INFO("Token " << i << ": \"" << referenceTokens[i].lexeme << "\"");
+			CHECK(document.getOffsetInDocument(tokens[i].lexeme) == referenceDocument.getOffsetInDocument(referenceTokens[i].lexeme));
+			CHECK(tokens[i].lexeme.size() == referenceTokens[i].lexeme.size());
+			CHECK(tokens[i].tokenID == referenceTokens[i].tokenID);
+			CHECK(tokens[i].subType == referenceTokens[i].subType);
+			CHECK(document.getLineAndColumnNumber(tokens[i].lexeme) == referenceDocument.getLineAndColumnNumber(referenceTokens[i].lexeme));
+		}
+	}
+}
+
+
+TEST_CASE("Tokenizer", "[tokenizer]" )
+{
+	CatTokenizer tokenizer;
+
+	SECTION("Keywords")
+	{
+		for (unsigned short type = Tools::enumToUSHort(Identifier::Class); type < Tools::enumToUSHort(Identifier::Last); ++type)
+		{
+			std::string keyword = tokenizer.getTokenName(CatTokenizer::identifier, type);
+			CHECK(IdentifierToken::getIdentifierType(keyword.c_str(), keyword.size()) == (Identifier)type);
+			std::string longerName = keyword + "_";
+			CHECK(IdentifierToken::getIdentifierType(longerName.c_str(), longerName.size()) == Identifier::Identifier);
+			CHECK(IdentifierToken::getIdentifierType(keyword.c_str(), keyword.size() - 1) != (Identifier)type);
+		}
+		CHECK(IdentifierToken::getIdentifierType("Class", 5) == Identifier::Identifier);
+		CHECK(IdentifierToken::getIdentifierType("someLongIdentifierName", 22) == Identifier::Identifier);
+	}
+	SECTION("Same tokens as the token factories")
+	{
+		const std::vector<std::string> texts = 
+		{
+			"",
+			"theInt + 42 * aFloat / 3.5f - 0x1F",
+			"a==b!=c<=d>=e&&f||g+=h-=i*=j\\=k|=l&=m^=n<<o>>p++q--r::s[]t",
+			"{}()[]=+*/-%<>,;&|^!.@",
+			"true false TRUE trueish falsey _true",
+			"class MyClass inherits Base { public int x = 0; }",
+			"1.0e10 .5 0. 07 09 0xZ 1e 1.5d \"text\\\"\" 'c' '\\n'",
+			"\"unterminated",
+			"'",
+			"// single line comment\nx",
+			"/* block\n comment */ y /*/ not closed /* */ z",
+			"/**/ /*",
+			"/*",
+			"/",
+			"#error $tokens ` ~ ? \\ x",
+			"line1\r\nline2\n\rline3\r\rline4\n\n",
+			"\t \t",
+			"\xC3\xA9t\xC3\xA9 + 1"
+		};
+		for (const std::string& text : texts)
+		{
+			checkSameTokens(tokenizer, text);
+		}
+	}
+	SECTION("Same tokens for random text")
+	{
+		const std::string alphabet = "abcefinrstuTF_019.eEx\"'\\/*=!<>&|+-^:[]{}();,%@# \t\r\n";
+		std::mt19937 randomEngine(42);
+		std::uniform_int_distribution<std::size_t> characterDistribution(0, alphabet.size() - 1);
+		std::uniform_int_distribution<std::size_t> lengthDistribution(0, 64);
+		for (int i = 0; i < 1000; i++)
+		{
+			std::string text;
+			std::size_t length = lengthDistribution(randomEngine);
+			for (std::size_t j = 0; j < length; j++)
+			{
+				text.push_back(alphabet[characterDistribution(randomEngine)]);
+			}
+			checkSameTokens(tokenizer, text);
+		}
+	}
+}
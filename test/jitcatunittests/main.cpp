@@ -27,13 +27,17 @@ int main( int argc, char* argv[] )
 	Catch::Session session; // There must be exactly one instance
   
 	bool precompile = false; 
+	bool bytecode = false;
   
 	// Build a new parser on top of Catch's
 	using namespace Catch::clara;
 	auto cli = session.cli() // Get Catch's composite command line parser
 		| Opt(precompile) // bind variable to a new option, with a hint string
 		["-p"]["--precompile"]    // the option names it will respond to
-		("Precompile JitCat expressions to an object file."); // description string for the help output
+		("Precompile JitCat expressions to an object file.") // description string for the help output
+		| Opt(bytecode)
+		["-b"]["--bytecode"]
+		("Run the tests using the bytecode interpreter instead of the tree-walking interpreter.");
         
 	// Now pass the new composite back to Catch so it uses that
 	session.cli(cli); 
@@ -48,6 +52,12 @@ int main( int argc, char* argv[] )
 
 	//Keep expression ASTs after native code compilation so that we can also test the interpreter.
 	jitcat::JitCat::get()->setDiscardASTAfterNativeCodeCompilation(false);
+	//When native code compilation is disabled and --bytecode is passed, getValue uses the bytecode interpreter 
+	//and getInterpretedValue uses the tree-walking interpreter. Without it, the whole suite runs on the tree-walking interpreter.
+	if (bytecode)
+	{
+		jitcat::JitCat::get()->setInterpreterMode(jitcat::InterpreterMode::Bytecode);
+	}
 	
 	#ifdef ENABLE_LLVM
 		std::unique_ptr<jitcat::LLVM::LLVMTargetConfig> precompilationTargetWindows; 
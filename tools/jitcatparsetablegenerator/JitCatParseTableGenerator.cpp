@@ -0,0 +1,80 @@
+/*
+  This file is part of the JitCat library.
+	
+  Copyright (C) Machiel van Hooren 2018
+  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).
+*/
+
+//Generates src/jitcat/CatGrammarParseTables.cpp, the precomputed parse tables of the JitCat grammars.
+//Usage: JitCatParseTableGenerator <output file>
+
+#include <jitcat/CatGrammar.h>
+#include <jitcat/CatTokenizer.h>
+#include <jitcat/SLRParser.h>
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace jitcat;
+using namespace jitcat::Grammar;
+using namespace jitcat::Parser;
+using namespace jitcat::Tokenizer;
+
+
+bool writeTables(std::ostream& stream, TokenizerBase* tokenizer, CatGrammarType grammarType, const std::string& tablesName)
+{
+	CatGrammar grammar(tokenizer, grammarType);
+	//The DFA is always built from the grammar here, the tables that are currently compiled in may be out of date.
+	SLRParser parser(&grammar);
+	parser.createNFA();
+	if (!parser.writeParseTables(stream, tablesName))
+	{
+		std::cout << "Failed to generate the " << tablesName << " parse tables.\n";
+		return false;
+	}
+	stream << "\n\n";
+	return true;
+}
+
+
+int main(int argc, char* argv[])
+{
+	if (argc != 2)
+	{
+		std::cout << "Usage: JitCatParseTableGenerator <output file>\n";
+		return 1;
+	}
+	CatTokenizer tokenizer;
+	std::stringstream tables;
+	tables << "/*\n"
+			  "  This file is part of the JitCat library.\n"
+			  "\t\n"
+			  "  Copyright (C) Machiel van Hooren 2018\n"
+			  "  Distributed under the MIT License (license terms are at http://opensource.org/licenses/MIT).\n"
+			  "*/\n\n"
+			  "//Generated by JitCatParseTableGenerator, do not edit.\n"
+			  "//Build the JitCatParseTables target to regenerate this file after the grammar or the tokenizer has changed.\n\n"
+			  "#include \"jitcat/CatGrammarParseTables.h\"\n\n"
+			  "#include <cstdint>\n\n"
+			  "namespace jitcat::Grammar::CatGrammarParseTables\n"
+			  "{\n\n";
+	if (!writeTables(tables, &tokenizer, CatGrammarType::Expression, "expression")
+		|| !writeTables(tables, &tokenizer, CatGrammarType::Statement, "statement")
+		|| !writeTables(tables, &tokenizer, CatGrammarType::Full, "full"))
+	{
+		return 1;
+	}
+	tables << "} //End namespace jitcat::Grammar::CatGrammarParseTables\n";
+
+	std::ofstream outputFile(argv[1], std::ios::binary);
+	if (!outputFile)
+	{
+		std::cout << "Could not open " << argv[1] << " for writing.\n";
+		return 1;
+	}
+	outputFile << tables.str();
+	return 0;
+}